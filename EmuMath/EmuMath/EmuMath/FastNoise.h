@@ -3,6 +3,7 @@
 
 #include "_do_not_manually_include/_noise/_fast_noise_table.h"
 #include "_do_not_manually_include/_noise/_fast_noise_sample_processors.h"
+#include "_do_not_manually_include/_noise/_noise_chunk_cache.h"
 #include "_do_not_manually_include/_noise/_noise_sample_processor_analytics.h"
 
 #endif
@@ -0,0 +1,6 @@
+#ifndef EMU_MATH_FAST_VECTOR_H_INC_
+#define EMU_MATH_FAST_VECTOR_H_INC_ 1
+
+#include "_do_not_manually_include/_fast_vector/_fast_vector_t.h"
+
+#endif
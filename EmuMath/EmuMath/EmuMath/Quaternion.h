@@ -0,0 +1,7 @@
+#ifndef EMU_MATH_QUATERNION_H_INC_
+#define EMU_MATH_QUATERNION_H_INC_ 1
+
+#include "_do_not_manually_include/_quaternion/_quaternion_t.h"
+#include "_do_not_manually_include/_quaternion/_quaternion_soa_helpers.h"
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef EMU_MATH_VECTOR_EXPRESSION_H_INC_
+#define EMU_MATH_VECTOR_EXPRESSION_H_INC_ 1
+
+#include "_do_not_manually_include/_vector_expressions/_vector_expression_t.h"
+
+#endif
@@ -0,0 +1,7 @@
+#ifndef EMU_MATH_VECTOR_SOA_H_INC_
+#define EMU_MATH_VECTOR_SOA_H_INC_ 1
+
+#include "_do_not_manually_include/_vector_soa/_vector_soa_t.h"
+#include "_do_not_manually_include/_vector_soa/_vector_soa_helpers.h"
+
+#endif
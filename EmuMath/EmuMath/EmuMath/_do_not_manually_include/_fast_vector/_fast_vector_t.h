@@ -0,0 +1,756 @@
+#ifndef EMU_MATH_FAST_VECTOR_T_H_INC_
+#define EMU_MATH_FAST_VECTOR_T_H_INC_ 1
+
+#include "../_vectors/_vector_t.h"
+#include "../../../EmuSIMD/SIMDHelpers.h"
+#include "../../../EmuCore/TMPHelpers/TypeConvertors.h"
+#include "../../../EmuCore/TMPHelpers/Values.h"
+#include <climits>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+namespace EmuMath
+{
+	/// <summary>
+	/// <para> SIMD-backed counterpart to EmuMath::Vector, storing all of its elements within a single SIMD register. </para>
+	/// <para>
+	///		Only floating-point T_ arguments whose contiguous elements exactly fill a supported SIMD register are valid
+	///		(e.g. `FastVector&lt;4, float&gt;` is stored as a __m128, `FastVector&lt;8, float&gt;` as a __m256, `FastVector&lt;4, double&gt;` as a __m256d).
+	/// </para>
+	/// <para>
+	///		Member functions follow the names and semantics of their EmuMath::Vector equivalents where an equivalent exists,
+	///		so that hot paths may swap an EmuMath::Vector for a FastVector without restructuring.
+	///		Unlike EmuMath::Vector, all arithmetic is performed in the stored register and results are always output as the same FastVector type.
+	/// </para>
+	/// <para> Elements are read by value rather than by reference, as they are not individually addressable within the stored register. </para>
+	/// </summary>
+	/// <typeparam name="Size_">Number of elements contained within this FastVector.</typeparam>
+	/// <typeparam name="T_">Floating-point type of the contained elements.</typeparam>
+	template<std::size_t Size_, typename T_>
+	struct FastVector
+	{
+#pragma region COMMON_STATIC_INFO
+	public:
+		using this_type = FastVector<Size_, T_>;
+		using value_type = T_;
+		using vector_type = EmuMath::Vector<Size_, T_>;
+
+		static constexpr std::size_t size = Size_;
+		static constexpr std::size_t element_width = sizeof(value_type) * CHAR_BIT;
+		static constexpr std::size_t register_width = size * element_width;
+		static constexpr bool is_floating_point = std::is_floating_point_v<value_type>;
+
+		[[nodiscard]] static constexpr inline bool is_valid()
+		{
+			return is_floating_point && EmuSIMD::TMP::_valid_simd_register_width(register_width);
+		}
+
+		static_assert
+		(
+			is_valid(),
+			"Invalid EmuMath::FastVector instantiation: T_ must be a floating-point type, and Size_ elements of T_ must exactly fill a 128-, 256- or 512-bit SIMD register."
+		);
+
+		using register_type = EmuSIMD::TMP::register_type_t<value_type, register_width>;
+		using index_sequence = std::make_index_sequence<size>;
+
+		/// <summary> Alignment required for pointers passed to this FastVector's Load and Store functions. </summary>
+		static constexpr std::size_t required_alignment = alignof(register_type);
+#pragma endregion
+
+#pragma region CONSTRUCTORS
+	public:
+		/// <summary> Constructs a FastVector with all elements set to 0. </summary>
+		inline FastVector() : data_(EmuSIMD::setzero<register_type>())
+		{
+		}
+
+		inline FastVector(const this_type& to_copy_) : data_(to_copy_.data_)
+		{
+		}
+
+		/// <summary> Constructs a FastVector which directly uses the passed SIMD register as its data. </summary>
+		/// <param name="data_register_">Register to copy as this FastVector's data, where index 0 of this FastVector is the lowest element of the register.</param>
+		explicit inline FastVector(register_type data_register_) : data_(data_register_)
+		{
+		}
+
+		/// <summary> Constructs a FastVector with its elements set to the passed arguments in contiguous order (i.e. the first argument is index 0). </summary>
+		/// <param name="args_">Values to initialise respective elements of this FastVector with. Exactly `size` arguments are required.</param>
+		template
+		<
+			class...Args_,
+			typename = std::enable_if_t<sizeof...(Args_) == Size_ && (... && std::is_convertible_v<Args_, T_>)>
+		>
+		explicit inline FastVector(Args_&&...args_) : data_(EmuSIMD::setr<register_type>(static_cast<value_type>(std::forward<Args_>(args_))...))
+		{
+		}
+
+		/// <summary>
+		/// <para> Constructs a FastVector from the theoretical elements of the passed EmuMath Vector. </para>
+		/// <para> Indices beyond the passed Vector's size will be set to the Vector's implied zero. </para>
+		/// </summary>
+		/// <param name="to_copy_">EmuMath Vector to copy the elements of.</param>
+		template<std::size_t InSize_, typename InT_>
+		explicit inline FastVector(const EmuMath::Vector<InSize_, InT_>& to_copy_) : data_(_make_register_from_vector(to_copy_, index_sequence()))
+		{
+		}
+
+		/// <summary>
+		/// <para> Loads a FastVector from the contiguous data pointed to by p_to_load_. </para>
+		/// <para> The pointed-to data must be aligned to at least `required_alignment` bytes, and contain at least `size` contiguous elements. </para>
+		/// </summary>
+		/// <param name="p_to_load_">Pointer to aligned contiguous elements to load.</param>
+		/// <returns>FastVector containing the `size` elements starting at p_to_load_.</returns>
+		[[nodiscard]] static inline this_type Load(const value_type* p_to_load_)
+		{
+			return this_type(EmuSIMD::load<register_type>(p_to_load_));
+		}
+#pragma endregion
+
+#pragma region ACCESS
+	public:
+		/// <summary>
+		/// <para> Retrieves a copy of the element at the provided Index_ within this FastVector. If the Index_ is invalid, a compile-time error will be generated. </para>
+		/// <para> This is a relatively slow operation; if multiple elements are required, it is recommended to use `Store` or `AsVector` instead. </para>
+		/// </summary>
+		/// <returns>Copy of the element at the provided index within this FastVector.</returns>
+		template<std::size_t Index_>
+		[[nodiscard]] inline value_type at() const
+		{
+			if constexpr (Index_ < size)
+			{
+				return EmuSIMD::get_index<Index_, value_type>(data_);
+			}
+			else
+			{
+				static_assert
+				(
+					EmuCore::TMP::get_false<std::size_t, Index_>(),
+					"Attempted to access an element at an invalid Index_ within an EmuMath FastVector via its template `at<Index_>` member. Valid indices are in the inclusive range 0:size-1."
+				);
+			}
+		}
+
+		/// <summary> Provides direct access to the SIMD register used to store this FastVector's elements. </summary>
+		/// <returns>Reference to this FastVector's underlying register.</returns>
+		[[nodiscard]] inline register_type& data()
+		{
+			return data_;
+		}
+		[[nodiscard]] inline register_type data() const
+		{
+			return data_;
+		}
+
+		/// <summary>
+		/// <para> Outputs all elements of this FastVector to the contiguous memory pointed to by p_out_. </para>
+		/// <para> The pointed-to memory must be aligned to at least `required_alignment` bytes, and have space for at least `size` contiguous elements. </para>
+		/// </summary>
+		/// <param name="p_out_">Pointer to aligned contiguous memory to output to.</param>
+		inline void Store(value_type* p_out_) const
+		{
+			EmuSIMD::store(data_, p_out_);
+		}
+
+		/// <summary> Creates an EmuMath Vector containing the same elements as this FastVector. </summary>
+		/// <returns>EmuMath Vector of this FastVector's size and value_type, containing respective elements of this FastVector.</returns>
+		[[nodiscard]] inline vector_type AsVector() const
+		{
+			return _make_vector(index_sequence());
+		}
+
+		[[nodiscard]] explicit inline operator vector_type() const
+		{
+			return AsVector();
+		}
+#pragma endregion
+
+#pragma region ASSIGNMENT_OPERATORS
+	public:
+		inline this_type& operator=(const this_type& to_copy_)
+		{
+			data_ = to_copy_.data_;
+			return *this;
+		}
+
+		template<std::size_t InSize_, typename InT_>
+		inline this_type& operator=(const EmuMath::Vector<InSize_, InT_>& to_copy_)
+		{
+			data_ = _make_register_from_vector(to_copy_, index_sequence());
+			return *this;
+		}
+#pragma endregion
+
+#pragma region CONST_ARITHMETIC_OPERATORS
+	public:
+		[[nodiscard]] inline this_type operator+(const this_type& rhs_) const
+		{
+			return Add(rhs_);
+		}
+		[[nodiscard]] inline this_type operator+(value_type rhs_) const
+		{
+			return Add(rhs_);
+		}
+
+		[[nodiscard]] inline this_type operator-(const this_type& rhs_) const
+		{
+			return Subtract(rhs_);
+		}
+		[[nodiscard]] inline this_type operator-(value_type rhs_) const
+		{
+			return Subtract(rhs_);
+		}
+
+		[[nodiscard]] inline this_type operator*(const this_type& rhs_) const
+		{
+			return Multiply(rhs_);
+		}
+		[[nodiscard]] inline this_type operator*(value_type rhs_) const
+		{
+			return Multiply(rhs_);
+		}
+
+		[[nodiscard]] inline this_type operator/(const this_type& rhs_) const
+		{
+			return Divide(rhs_);
+		}
+		[[nodiscard]] inline this_type operator/(value_type rhs_) const
+		{
+			return Divide(rhs_);
+		}
+
+		[[nodiscard]] inline this_type operator%(const this_type& rhs_) const
+		{
+			return Mod(rhs_);
+		}
+		[[nodiscard]] inline this_type operator%(value_type rhs_) const
+		{
+			return Mod(rhs_);
+		}
+
+		[[nodiscard]] inline this_type operator-() const
+		{
+			return Negate();
+		}
+#pragma endregion
+
+#pragma region ARITHMETIC_ASSIGN_OPERATORS
+	public:
+		inline this_type& operator+=(const this_type& rhs_)
+		{
+			data_ = EmuSIMD::add(data_, rhs_.data_);
+			return *this;
+		}
+		inline this_type& operator+=(value_type rhs_)
+		{
+			data_ = EmuSIMD::add(data_, _make_register(rhs_));
+			return *this;
+		}
+
+		inline this_type& operator-=(const this_type& rhs_)
+		{
+			data_ = EmuSIMD::sub(data_, rhs_.data_);
+			return *this;
+		}
+		inline this_type& operator-=(value_type rhs_)
+		{
+			data_ = EmuSIMD::sub(data_, _make_register(rhs_));
+			return *this;
+		}
+
+		inline this_type& operator*=(const this_type& rhs_)
+		{
+			data_ = EmuSIMD::mul_all(data_, rhs_.data_);
+			return *this;
+		}
+		inline this_type& operator*=(value_type rhs_)
+		{
+			data_ = EmuSIMD::mul_all(data_, _make_register(rhs_));
+			return *this;
+		}
+
+		inline this_type& operator/=(const this_type& rhs_)
+		{
+			data_ = EmuSIMD::div(data_, rhs_.data_);
+			return *this;
+		}
+		inline this_type& operator/=(value_type rhs_)
+		{
+			data_ = EmuSIMD::div(data_, _make_register(rhs_));
+			return *this;
+		}
+
+		inline this_type& operator%=(const this_type& rhs_)
+		{
+			data_ = EmuSIMD::mod(data_, rhs_.data_);
+			return *this;
+		}
+		inline this_type& operator%=(value_type rhs_)
+		{
+			data_ = EmuSIMD::mod(data_, _make_register(rhs_));
+			return *this;
+		}
+#pragma endregion
+
+#pragma region CONST_ARITHMETIC_FUNCS
+	public:
+		/// <summary>
+		/// <para> Returns the result of adding rhs_ to this FastVector. </para>
+		/// <para> If rhs_ is a FastVector: Respective elements will be added. Otherwise, all elements have rhs_ added. </para>
+		/// </summary>
+		/// <param name="rhs_">: Scalar or FastVector to add to this FastVector.</param>
+		/// <returns>Copy of this FastVector with rhs_ added.</returns>
+		[[nodiscard]] inline this_type Add(const this_type& rhs_) const
+		{
+			return this_type(EmuSIMD::add(data_, rhs_.data_));
+		}
+		[[nodiscard]] inline this_type Add(value_type rhs_) const
+		{
+			return this_type(EmuSIMD::add(data_, _make_register(rhs_)));
+		}
+
+		/// <summary>
+		/// <para> Returns the result of subtracting rhs_ from this FastVector. </para>
+		/// <para> If rhs_ is a FastVector: Respective elements will be subtracted. Otherwise, all elements have rhs_ subtracted. </para>
+		/// </summary>
+		/// <param name="rhs_">: Scalar or FastVector to subtract from this FastVector.</param>
+		/// <returns>Copy of this FastVector with rhs_ subtracted.</returns>
+		[[nodiscard]] inline this_type Subtract(const this_type& rhs_) const
+		{
+			return this_type(EmuSIMD::sub(data_, rhs_.data_));
+		}
+		[[nodiscard]] inline this_type Subtract(value_type rhs_) const
+		{
+			return this_type(EmuSIMD::sub(data_, _make_register(rhs_)));
+		}
+
+		/// <summary>
+		/// <para> Returns the result of multiplying this FastVector by rhs_. </para>
+		/// <para> If rhs_ is a FastVector: Respective elements will be multiplied. Otherwise, all elements are multiplied by rhs_. </para>
+		/// </summary>
+		/// <param name="rhs_">: Scalar or FastVector to multiply this FastVector by.</param>
+		/// <returns>Copy of this FastVector multiplied by rhs_.</returns>
+		[[nodiscard]] inline this_type Multiply(const this_type& rhs_) const
+		{
+			return this_type(EmuSIMD::mul_all(data_, rhs_.data_));
+		}
+		[[nodiscard]] inline this_type Multiply(value_type rhs_) const
+		{
+			return this_type(EmuSIMD::mul_all(data_, _make_register(rhs_)));
+		}
+
+		/// <summary>
+		/// <para> Returns the result of dividing this FastVector by rhs_. </para>
+		/// <para> If rhs_ is a FastVector: Respective elements will be divided. Otherwise, all elements are divided by rhs_. </para>
+		/// </summary>
+		/// <param name="rhs_">: Scalar or FastVector to divide this FastVector by.</param>
+		/// <returns>Copy of this FastVector divided by rhs_.</returns>
+		[[nodiscard]] inline this_type Divide(const this_type& rhs_) const
+		{
+			return this_type(EmuSIMD::div(data_, rhs_.data_));
+		}
+		[[nodiscard]] inline this_type Divide(value_type rhs_) const
+		{
+			return this_type(EmuSIMD::div(data_, _make_register(rhs_)));
+		}
+
+		/// <summary>
+		/// <para> Returns the result of modulo-dividing this FastVector by rhs_. </para>
+		/// <para> If rhs_ is a FastVector: Respective elements will be modulo-divided. Otherwise, all elements are modulo-divided by rhs_. </para>
+		/// </summary>
+		/// <param name="rhs_">: Scalar or FastVector to modulo-divide this FastVector by.</param>
+		/// <returns>Copy of this FastVector modulo-divided by rhs_.</returns>
+		[[nodiscard]] inline this_type Mod(const this_type& rhs_) const
+		{
+			return this_type(EmuSIMD::mod(data_, rhs_.data_));
+		}
+		[[nodiscard]] inline this_type Mod(value_type rhs_) const
+		{
+			return this_type(EmuSIMD::mod(data_, _make_register(rhs_)));
+		}
+
+		/// <summary> Returns a copy of this FastVector with all of its elements negated. </summary>
+		/// <returns>Negated form of this FastVector.</returns>
+		[[nodiscard]] inline this_type Negate() const
+		{
+			return this_type(EmuSIMD::negate(data_));
+		}
+#pragma endregion
+
+#pragma region MISC_ARITHMETIC_FUNCS
+	public:
+		/// <summary> Returns a copy of this FastVector with all elements set to their absolute values. </summary>
+		/// <returns>Copy of this FastVector with non-negative elements.</returns>
+		[[nodiscard]] inline this_type Abs() const
+		{
+			return this_type(EmuSIMD::bitwise_andnot(EmuSIMD::set1<register_type>(value_type(-0.0)), data_));
+		}
+
+		/// <summary>
+		/// <para> Returns a FastVector containing the lowest of respective elements in this FastVector and b_. </para>
+		/// <para> If b_ is a scalar, it is compared with all elements in this FastVector. </para>
+		/// </summary>
+		[[nodiscard]] inline this_type Min(const this_type& b_) const
+		{
+			return this_type(EmuSIMD::vector_min(data_, b_.data_));
+		}
+		[[nodiscard]] inline this_type Min(value_type b_) const
+		{
+			return this_type(EmuSIMD::vector_min(data_, _make_register(b_)));
+		}
+
+		/// <summary>
+		/// <para> Returns a FastVector containing the greatest of respective elements in this FastVector and b_. </para>
+		/// <para> If b_ is a scalar, it is compared with all elements in this FastVector. </para>
+		/// </summary>
+		[[nodiscard]] inline this_type Max(const this_type& b_) const
+		{
+			return this_type(EmuSIMD::vector_max(data_, b_.data_));
+		}
+		[[nodiscard]] inline this_type Max(value_type b_) const
+		{
+			return this_type(EmuSIMD::vector_max(data_, _make_register(b_)));
+		}
+
+		/// <summary> Returns a copy of this FastVector with its elements clamped to be no less than respective elements of min_. </summary>
+		[[nodiscard]] inline this_type ClampMin(const this_type& min_) const
+		{
+			return this_type(EmuSIMD::clamp_min(data_, min_.data_));
+		}
+		[[nodiscard]] inline this_type ClampMin(value_type min_) const
+		{
+			return this_type(EmuSIMD::clamp_min(data_, _make_register(min_)));
+		}
+
+		/// <summary> Returns a copy of this FastVector with its elements clamped to be no greater than respective elements of max_. </summary>
+		[[nodiscard]] inline this_type ClampMax(const this_type& max_) const
+		{
+			return this_type(EmuSIMD::clamp_max(data_, max_.data_));
+		}
+		[[nodiscard]] inline this_type ClampMax(value_type max_) const
+		{
+			return this_type(EmuSIMD::clamp_max(data_, _make_register(max_)));
+		}
+
+		/// <summary> Returns a copy of this FastVector with its elements clamped into the inclusive range min_:max_. </summary>
+		[[nodiscard]] inline this_type Clamp(const this_type& min_, const this_type& max_) const
+		{
+			return this_type(EmuSIMD::clamp(data_, min_.data_, max_.data_));
+		}
+		[[nodiscard]] inline this_type Clamp(value_type min_, value_type max_) const
+		{
+			return this_type(EmuSIMD::clamp(data_, _make_register(min_), _make_register(max_)));
+		}
+
+		/// <summary>
+		/// <para> Linearly interpolates this FastVector with b_ using the weighting t_, in the form `a + ((b - a) * t)`. </para>
+		/// <para> Both b_ and t_ may be either a FastVector of this type or a scalar. </para>
+		/// </summary>
+		/// <param name="b_">: Target to interpolate this FastVector toward.</param>
+		/// <param name="t_">: Weighting for the interpolation.</param>
+		/// <returns>FastVector containing the results of linear interpolation.</returns>
+		template
+		<
+			class B_, class Weighting_,
+			typename = std::enable_if_t
+			<
+				(std::is_same_v<EmuCore::TMP::remove_ref_cv_t<B_>, this_type> || std::is_convertible_v<B_, value_type>) &&
+				(std::is_same_v<EmuCore::TMP::remove_ref_cv_t<Weighting_>, this_type> || std::is_convertible_v<Weighting_, value_type>)
+			>
+		>
+		[[nodiscard]] inline this_type Lerp(B_&& b_, Weighting_&& t_) const
+		{
+			return this_type(EmuSIMD::fused_lerp(data_, _make_register(std::forward<B_>(b_)), _make_register(std::forward<Weighting_>(t_))));
+		}
+#pragma endregion
+
+#pragma region ROUNDING_FUNCS
+	public:
+		/// <summary> Returns a copy of this FastVector with all elements rounded toward negative infinity. </summary>
+		[[nodiscard]] inline this_type Floor() const
+		{
+			return this_type(EmuSIMD::floor(data_));
+		}
+
+		/// <summary> Returns a copy of this FastVector with all elements rounded toward positive infinity. </summary>
+		[[nodiscard]] inline this_type Ceil() const
+		{
+			return this_type(EmuSIMD::ceil(data_));
+		}
+
+		/// <summary> Returns a copy of this FastVector with all elements rounded toward 0. </summary>
+		[[nodiscard]] inline this_type Trunc() const
+		{
+			return this_type(EmuSIMD::trunc(data_));
+		}
+#pragma endregion
+
+#pragma region VECTOR_OPERATIONS
+	public:
+		/// <summary> Calculates the dot product of this FastVector and the passed vector_b_. </summary>
+		/// <param name="vector_b_">: FastVector to calculate the dot product of this FastVector with.</param>
+		/// <returns>Dot product of this FastVector and the passed vector_b_.</returns>
+		[[nodiscard]] inline value_type Dot(const this_type& vector_b_) const
+		{
+			return EmuSIMD::dot_scalar<value_type>(data_, vector_b_.data_);
+		}
+
+		/// <summary>
+		/// <para> Calculates the squared magnitude of this FastVector. </para>
+		/// <para> This is equivalent to forming the dot product of this FastVector with itself. </para>
+		/// </summary>
+		/// <returns>Squared magnitude of this FastVector.</returns>
+		[[nodiscard]] inline value_type SquareMagnitude() const
+		{
+			return EmuSIMD::dot_scalar<value_type>(data_, data_);
+		}
+
+		/// <summary> Calculates the magnitude of this FastVector. </summary>
+		/// <returns>Magnitude of this FastVector.</returns>
+		[[nodiscard]] inline value_type Magnitude() const
+		{
+			return EmuSIMD::get_index<0, value_type>(EmuSIMD::sqrt(EmuSIMD::dot(data_, data_)));
+		}
+
+		/// <summary>
+		/// <para> Calculates a copy of this FastVector with normalised elements. </para>
+		/// <para> The magnitude is calculated and applied entirely within SIMD registers, without any intermediate scalar extraction. </para>
+		/// </summary>
+		/// <returns>Normalised copy of this FastVector.</returns>
+		[[nodiscard]] inline this_type Normalise() const
+		{
+			return this_type(EmuSIMD::div(data_, EmuSIMD::sqrt(EmuSIMD::dot_fill(data_, data_))));
+		}
+
+		/// <summary>
+		/// <para> Calculates an approximate magnitude of this FastVector via a reciprocal square root of its square magnitude. </para>
+		/// <para> For float FastVectors this has a relative error of roughly 1e-4 or better, in exchange for being significantly cheaper than `Magnitude`. </para>
+		/// </summary>
+		/// <returns>Approximate magnitude of this FastVector.</returns>
+		[[nodiscard]] inline value_type MagnitudeFast() const
+		{
+			const register_type square_mag_ = EmuSIMD::dot_fill(data_, data_);
+			const value_type square_mag_scalar_ = EmuSIMD::get_index<0, value_type>(square_mag_);
+			return square_mag_scalar_ == value_type(0) ? square_mag_scalar_ : EmuSIMD::get_index<0, value_type>(EmuSIMD::mul_all(square_mag_, EmuSIMD::rsqrt(square_mag_)));
+		}
+
+		/// <summary>
+		/// <para> Calculates a copy of this FastVector with approximately normalised elements, multiplying by a reciprocal square root instead of dividing by a square root. </para>
+		/// <para> For float FastVectors this has a relative error of roughly 1e-4 or better, in exchange for being significantly cheaper than `Normalise`. </para>
+		/// </summary>
+		/// <returns>Approximately normalised copy of this FastVector.</returns>
+		[[nodiscard]] inline this_type NormaliseFast() const
+		{
+			return this_type(EmuSIMD::mul_all(data_, EmuSIMD::rsqrt(EmuSIMD::dot_fill(data_, data_))));
+		}
+
+		/// <summary> Calculates the distance between this FastVector and the passed target_. </summary>
+		[[nodiscard]] inline value_type Distance(const this_type& target_) const
+		{
+			return target_.Subtract(*this).Magnitude();
+		}
+
+		/// <summary> Calculates the squared distance between this FastVector and the passed target_. </summary>
+		[[nodiscard]] inline value_type SquareDistance(const this_type& target_) const
+		{
+			return target_.Subtract(*this).SquareMagnitude();
+		}
+#pragma endregion
+
+#pragma region CMP_OPERATORS
+	public:
+		/// <summary> Returns true if all respective elements in this FastVector and rhs_ are equal. Equivalent to CmpAllEqual. </summary>
+		[[nodiscard]] inline bool operator==(const this_type& rhs_) const
+		{
+			return CmpAllEqual(rhs_);
+		}
+
+		/// <summary> Returns true if any respective elements in this FastVector and rhs_ are not equal. Equivalent to CmpAnyNotEqual. </summary>
+		[[nodiscard]] inline bool operator!=(const this_type& rhs_) const
+		{
+			return CmpAnyNotEqual(rhs_);
+		}
+#pragma endregion
+
+#pragma region CMP_ALL_FUNCS
+	public:
+		/// <summary> Returns true if all elements in this FastVector are equal to respective elements in rhs_ (or rhs_ itself, if it is a scalar). </summary>
+		[[nodiscard]] inline bool CmpAllEqual(const this_type& rhs_) const
+		{
+			return EmuSIMD::cmp_all_eq(data_, rhs_.data_);
+		}
+		[[nodiscard]] inline bool CmpAllEqual(value_type rhs_) const
+		{
+			return EmuSIMD::cmp_all_eq(data_, _make_register(rhs_));
+		}
+
+		/// <summary> Returns true if all elements in this FastVector are not equal to respective elements in rhs_ (or rhs_ itself, if it is a scalar). </summary>
+		[[nodiscard]] inline bool CmpAllNotEqual(const this_type& rhs_) const
+		{
+			return EmuSIMD::cmp_all_neq(data_, rhs_.data_);
+		}
+		[[nodiscard]] inline bool CmpAllNotEqual(value_type rhs_) const
+		{
+			return EmuSIMD::cmp_all_neq(data_, _make_register(rhs_));
+		}
+
+		/// <summary> Returns true if all elements in this FastVector are greater than respective elements in rhs_ (or rhs_ itself, if it is a scalar). </summary>
+		[[nodiscard]] inline bool CmpAllGreater(const this_type& rhs_) const
+		{
+			return EmuSIMD::cmp_all_gt(data_, rhs_.data_);
+		}
+		[[nodiscard]] inline bool CmpAllGreater(value_type rhs_) const
+		{
+			return EmuSIMD::cmp_all_gt(data_, _make_register(rhs_));
+		}
+
+		/// <summary> Returns true if all elements in this FastVector are less than respective elements in rhs_ (or rhs_ itself, if it is a scalar). </summary>
+		[[nodiscard]] inline bool CmpAllLess(const this_type& rhs_) const
+		{
+			return EmuSIMD::cmp_all_lt(data_, rhs_.data_);
+		}
+		[[nodiscard]] inline bool CmpAllLess(value_type rhs_) const
+		{
+			return EmuSIMD::cmp_all_lt(data_, _make_register(rhs_));
+		}
+
+		/// <summary> Returns true if all elements in this FastVector are greater than or equal to respective elements in rhs_ (or rhs_ itself, if it is a scalar). </summary>
+		[[nodiscard]] inline bool CmpAllGreaterEqual(const this_type& rhs_) const
+		{
+			return EmuSIMD::cmp_all_ge(data_, rhs_.data_);
+		}
+		[[nodiscard]] inline bool CmpAllGreaterEqual(value_type rhs_) const
+		{
+			return EmuSIMD::cmp_all_ge(data_, _make_register(rhs_));
+		}
+
+		/// <summary> Returns true if all elements in this FastVector are less than or equal to respective elements in rhs_ (or rhs_ itself, if it is a scalar). </summary>
+		[[nodiscard]] inline bool CmpAllLessEqual(const this_type& rhs_) const
+		{
+			return EmuSIMD::cmp_all_le(data_, rhs_.data_);
+		}
+		[[nodiscard]] inline bool CmpAllLessEqual(value_type rhs_) const
+		{
+			return EmuSIMD::cmp_all_le(data_, _make_register(rhs_));
+		}
+#pragma endregion
+
+#pragma region CMP_ANY_FUNCS
+	public:
+		/// <summary> Returns true if any elements in this FastVector are equal to respective elements in rhs_ (or rhs_ itself, if it is a scalar). </summary>
+		[[nodiscard]] inline bool CmpAnyEqual(const this_type& rhs_) const
+		{
+			return EmuSIMD::cmp_any_eq(data_, rhs_.data_);
+		}
+		[[nodiscard]] inline bool CmpAnyEqual(value_type rhs_) const
+		{
+			return EmuSIMD::cmp_any_eq(data_, _make_register(rhs_));
+		}
+
+		/// <summary> Returns true if any elements in this FastVector are not equal to respective elements in rhs_ (or rhs_ itself, if it is a scalar). </summary>
+		[[nodiscard]] inline bool CmpAnyNotEqual(const this_type& rhs_) const
+		{
+			return EmuSIMD::cmp_any_neq(data_, rhs_.data_);
+		}
+		[[nodiscard]] inline bool CmpAnyNotEqual(value_type rhs_) const
+		{
+			return EmuSIMD::cmp_any_neq(data_, _make_register(rhs_));
+		}
+
+		/// <summary> Returns true if any elements in this FastVector are greater than respective elements in rhs_ (or rhs_ itself, if it is a scalar). </summary>
+		[[nodiscard]] inline bool CmpAnyGreater(const this_type& rhs_) const
+		{
+			return EmuSIMD::cmp_any_gt(data_, rhs_.data_);
+		}
+		[[nodiscard]] inline bool CmpAnyGreater(value_type rhs_) const
+		{
+			return EmuSIMD::cmp_any_gt(data_, _make_register(rhs_));
+		}
+
+		/// <summary> Returns true if any elements in this FastVector are less than respective elements in rhs_ (or rhs_ itself, if it is a scalar). </summary>
+		[[nodiscard]] inline bool CmpAnyLess(const this_type& rhs_) const
+		{
+			return EmuSIMD::cmp_any_lt(data_, rhs_.data_);
+		}
+		[[nodiscard]] inline bool CmpAnyLess(value_type rhs_) const
+		{
+			return EmuSIMD::cmp_any_lt(data_, _make_register(rhs_));
+		}
+
+		/// <summary> Returns true if any elements in this FastVector are greater than or equal to respective elements in rhs_ (or rhs_ itself, if it is a scalar). </summary>
+		[[nodiscard]] inline bool CmpAnyGreaterEqual(const this_type& rhs_) const
+		{
+			return EmuSIMD::cmp_any_ge(data_, rhs_.data_);
+		}
+		[[nodiscard]] inline bool CmpAnyGreaterEqual(value_type rhs_) const
+		{
+			return EmuSIMD::cmp_any_ge(data_, _make_register(rhs_));
+		}
+
+		/// <summary> Returns true if any elements in this FastVector are less than or equal to respective elements in rhs_ (or rhs_ itself, if it is a scalar). </summary>
+		[[nodiscard]] inline bool CmpAnyLessEqual(const this_type& rhs_) const
+		{
+			return EmuSIMD::cmp_any_le(data_, rhs_.data_);
+		}
+		[[nodiscard]] inline bool CmpAnyLessEqual(value_type rhs_) const
+		{
+			return EmuSIMD::cmp_any_le(data_, _make_register(rhs_));
+		}
+#pragma endregion
+
+#pragma region STREAMS
+	public:
+		/// <summary> Appends this FastVector to the provided stream, in the same format as EmuMath Vectors. </summary>
+		/// <param name="str_">Stream to append to.</param>
+		/// <returns>Reference to the passed str_.</returns>
+		template<class Stream_>
+		inline Stream_& AppendToStream(Stream_& str_) const
+		{
+			str_ << AsVector();
+			return str_;
+		}
+#pragma endregion
+
+	private:
+		[[nodiscard]] static inline register_type _make_register(value_type scalar_)
+		{
+			return EmuSIMD::set1<register_type>(scalar_);
+		}
+		[[nodiscard]] static inline register_type _make_register(const this_type& fast_vector_)
+		{
+			return fast_vector_.data_;
+		}
+
+		template<std::size_t InSize_, typename InT_, std::size_t...Indices_>
+		[[nodiscard]] static inline register_type _make_register_from_vector(const EmuMath::Vector<InSize_, InT_>& in_, std::index_sequence<Indices_...>)
+		{
+			return EmuSIMD::setr<register_type>(static_cast<value_type>(in_.template AtTheoretical<Indices_>())...);
+		}
+
+		template<std::size_t...Indices_>
+		[[nodiscard]] inline vector_type _make_vector(std::index_sequence<Indices_...>) const
+		{
+			alignas(register_type) value_type out_[size];
+			EmuSIMD::store(data_, out_);
+			return vector_type(out_[Indices_]...);
+		}
+
+		register_type data_;
+	};
+}
+
+template<std::size_t Size_, typename T_>
+inline std::ostream& operator<<(std::ostream& str_, const EmuMath::FastVector<Size_, T_>& fast_vector_)
+{
+	return fast_vector_.AppendToStream(str_);
+}
+
+template<std::size_t Size_, typename T_>
+inline std::wostream& operator<<(std::wostream& w_str_, const EmuMath::FastVector<Size_, T_>& fast_vector_)
+{
+	return fast_vector_.AppendToStream(w_str_);
+}
+
+#endif
@@ -2,6 +2,12 @@
 #define EMU_MATH_ALL_MATRIX_HELPERS_H_INC_ 1
 
 #include "_common_matrix_helper_includes.h"
+#include "_matrix_affine.h"
+#include "_matrix_determinant.h"
+#include "_matrix_inverse.h"
+#include "_matrix_multiply.h"
 #include "_matrix_stream_append.h"
+#include "_matrix_transform_points.h"
+#include "_matrix_transpose.h"
 
 #endif
@@ -2,7 +2,12 @@
 #define EMU_MATH_COMMON_MATRIX_HELPER_INCLUDES_H_INC_ 1
 
 #include "../_underlying_helpers/_matrix.info.h"
+#include "../_underlying_helpers/_matrix_affine_underlying.h"
+#include "../_underlying_helpers/_matrix_inverse_underlying.h"
+#include "../_underlying_helpers/_matrix_multiply_underlying.h"
 #include "../_underlying_helpers/_matrix_tmp.h"
+#include "../_underlying_helpers/_matrix_transform_points_underlying.h"
+#include "../_underlying_helpers/_matrix_transpose_underlying.h"
 #include "../_underlying_helpers/_matrix_underlying_stream_append.h"
 
 #endif
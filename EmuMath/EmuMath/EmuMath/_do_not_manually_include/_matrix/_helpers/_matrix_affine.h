@@ -0,0 +1,368 @@
+#ifndef EMU_MATH_MATRIX_AFFINE_H_INC_
+#define EMU_MATH_MATRIX_AFFINE_H_INC_ 1
+
+#include "_common_matrix_helper_includes.h"
+
+// CONTAINS:
+// --- matrix_make_translation
+// --- matrix_make_scale
+// --- matrix_make_rotation_x/y/z
+// --- matrix_make_rotation_euler
+// --- matrix_make_rotation_axis_angle
+// --- matrix_make_look_at
+// --- matrix_make_perspective
+// --- matrix_make_orthographic
+// --- matrix_affine_inverse
+//
+// All builders output an EmuMath Matrix<4, 4, OutT_, OutColumnMajor_>, defaulting to a column-major float Matrix.
+// Builders assume column vectors (i.e. points are transformed as `matrix * point`), and all angles are in radians.
+// Functions suffixed with `_constexpr` use constexpr-guaranteed trigonometry and square roots, which may be slower at runtime.
+// Builders are scalar and constexpr rather than SIMD: each is a one-off construction dominated by its trigonometry, and scalar construction
+// lets results be formed at compile time. SIMD is instead used where matrices are consumed, via matrix_affine_inverse and matrix_multiply.
+
+namespace EmuMath::Helpers
+{
+#pragma region TRANSLATION_AND_SCALE
+	/// <summary>
+	/// <para> Outputs a 4x4 transformation Matrix which translates points by the passed x_, y_ and z_ offsets. </para>
+	/// </summary>
+	/// <param name="x_">: Translation along the X axis.</param>
+	/// <param name="y_">: Translation along the Y axis.</param>
+	/// <param name="z_">: Translation along the Z axis.</param>
+	/// <returns>4x4 EmuMath Matrix representing the described translation.</returns>
+	template<typename OutT_ = float, bool OutColumnMajor_ = true, typename X_, typename Y_, typename Z_>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_> matrix_make_translation(const X_& x_, const Y_& y_, const Z_& z_)
+	{
+		return _matrix_underlying::_matrix_make_translation<EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_>>(x_, y_, z_);
+	}
+
+	/// <summary>
+	/// <para> Outputs a 4x4 transformation Matrix which translates points by theoretical indices 0, 1 and 2 of the passed translation_ Vector. </para>
+	/// </summary>
+	/// <param name="translation_">: EmuMath Vector of X, Y and Z translations.</param>
+	/// <returns>4x4 EmuMath Matrix representing the described translation.</returns>
+	template<typename OutT_ = float, bool OutColumnMajor_ = true, std::size_t Size_, typename T_>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_> matrix_make_translation(const EmuMath::Vector<Size_, T_>& translation_)
+	{
+		return _matrix_underlying::_matrix_make_translation<EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_>>
+		(
+			translation_.template AtTheoretical<0>(),
+			translation_.template AtTheoretical<1>(),
+			translation_.template AtTheoretical<2>()
+		);
+	}
+
+	/// <summary>
+	/// <para> Outputs a 4x4 transformation Matrix which scales points along each axis by the passed x_, y_ and z_ factors. </para>
+	/// </summary>
+	/// <param name="x_">: Scale along the X axis.</param>
+	/// <param name="y_">: Scale along the Y axis.</param>
+	/// <param name="z_">: Scale along the Z axis.</param>
+	/// <returns>4x4 EmuMath Matrix representing the described scale.</returns>
+	template<typename OutT_ = float, bool OutColumnMajor_ = true, typename X_, typename Y_, typename Z_>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_> matrix_make_scale(const X_& x_, const Y_& y_, const Z_& z_)
+	{
+		return _matrix_underlying::_matrix_make_scale<EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_>>(x_, y_, z_);
+	}
+
+	/// <summary>
+	/// <para> Outputs a 4x4 transformation Matrix which scales points along each axis by theoretical indices 0, 1 and 2 of the passed scale_ Vector. </para>
+	/// </summary>
+	/// <param name="scale_">: EmuMath Vector of X, Y and Z scales.</param>
+	/// <returns>4x4 EmuMath Matrix representing the described scale.</returns>
+	template<typename OutT_ = float, bool OutColumnMajor_ = true, std::size_t Size_, typename T_>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_> matrix_make_scale(const EmuMath::Vector<Size_, T_>& scale_)
+	{
+		return _matrix_underlying::_matrix_make_scale<EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_>>
+		(
+			scale_.template AtTheoretical<0>(),
+			scale_.template AtTheoretical<1>(),
+			scale_.template AtTheoretical<2>()
+		);
+	}
+#pragma endregion
+
+#pragma region ROTATION
+	/// <summary>
+	/// <para> Outputs a 4x4 transformation Matrix which rotates points about the X axis by the passed angle_rads_. </para>
+	/// <para> For a guarantee to produce a compile-time result if possible, use `matrix_make_rotation_x_constexpr` instead. </para>
+	/// </summary>
+	/// <param name="angle_rads_">: Angle to rotate by, in radians.</param>
+	/// <returns>4x4 EmuMath Matrix representing the described rotation.</returns>
+	template<typename OutT_ = float, bool OutColumnMajor_ = true, typename Angle_>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_> matrix_make_rotation_x(const Angle_& angle_rads_)
+	{
+		using out_matrix = EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_>;
+		using out_value = typename out_matrix::value_type_uq;
+		return _matrix_underlying::_matrix_make_rotation_x<out_matrix, EmuCore::do_cos<out_value>, EmuCore::do_sin<out_value>>(angle_rads_);
+	}
+	template<typename OutT_ = float, bool OutColumnMajor_ = true, typename Angle_>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_> matrix_make_rotation_x_constexpr(const Angle_& angle_rads_)
+	{
+		using out_matrix = EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_>;
+		using out_value = typename out_matrix::value_type_uq;
+		return _matrix_underlying::_matrix_make_rotation_x<out_matrix, EmuCore::do_cos_constexpr<out_value>, EmuCore::do_sin_constexpr<out_value>>(angle_rads_);
+	}
+
+	/// <summary>
+	/// <para> Outputs a 4x4 transformation Matrix which rotates points about the Y axis by the passed angle_rads_. </para>
+	/// <para> For a guarantee to produce a compile-time result if possible, use `matrix_make_rotation_y_constexpr` instead. </para>
+	/// </summary>
+	/// <param name="angle_rads_">: Angle to rotate by, in radians.</param>
+	/// <returns>4x4 EmuMath Matrix representing the described rotation.</returns>
+	template<typename OutT_ = float, bool OutColumnMajor_ = true, typename Angle_>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_> matrix_make_rotation_y(const Angle_& angle_rads_)
+	{
+		using out_matrix = EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_>;
+		using out_value = typename out_matrix::value_type_uq;
+		return _matrix_underlying::_matrix_make_rotation_y<out_matrix, EmuCore::do_cos<out_value>, EmuCore::do_sin<out_value>>(angle_rads_);
+	}
+	template<typename OutT_ = float, bool OutColumnMajor_ = true, typename Angle_>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_> matrix_make_rotation_y_constexpr(const Angle_& angle_rads_)
+	{
+		using out_matrix = EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_>;
+		using out_value = typename out_matrix::value_type_uq;
+		return _matrix_underlying::_matrix_make_rotation_y<out_matrix, EmuCore::do_cos_constexpr<out_value>, EmuCore::do_sin_constexpr<out_value>>(angle_rads_);
+	}
+
+	/// <summary>
+	/// <para> Outputs a 4x4 transformation Matrix which rotates points about the Z axis by the passed angle_rads_. </para>
+	/// <para> For a guarantee to produce a compile-time result if possible, use `matrix_make_rotation_z_constexpr` instead. </para>
+	/// </summary>
+	/// <param name="angle_rads_">: Angle to rotate by, in radians.</param>
+	/// <returns>4x4 EmuMath Matrix representing the described rotation.</returns>
+	template<typename OutT_ = float, bool OutColumnMajor_ = true, typename Angle_>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_> matrix_make_rotation_z(const Angle_& angle_rads_)
+	{
+		using out_matrix = EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_>;
+		using out_value = typename out_matrix::value_type_uq;
+		return _matrix_underlying::_matrix_make_rotation_z<out_matrix, EmuCore::do_cos<out_value>, EmuCore::do_sin<out_value>>(angle_rads_);
+	}
+	template<typename OutT_ = float, bool OutColumnMajor_ = true, typename Angle_>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_> matrix_make_rotation_z_constexpr(const Angle_& angle_rads_)
+	{
+		using out_matrix = EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_>;
+		using out_value = typename out_matrix::value_type_uq;
+		return _matrix_underlying::_matrix_make_rotation_z<out_matrix, EmuCore::do_cos_constexpr<out_value>, EmuCore::do_sin_constexpr<out_value>>(angle_rads_);
+	}
+
+	/// <summary>
+	/// <para> Outputs a 4x4 transformation Matrix which rotates points by the passed Euler angles. </para>
+	/// <para> Rotations are applied in the order X, Y, Z; i.e. the output is equivalent to `rotation_z * rotation_y * rotation_x`. </para>
+	/// <para> For a guarantee to produce a compile-time result if possible, use `matrix_make_rotation_euler_constexpr` instead. </para>
+	/// </summary>
+	/// <param name="x_rads_">: Angle to rotate about the X axis by, in radians.</param>
+	/// <param name="y_rads_">: Angle to rotate about the Y axis by, in radians.</param>
+	/// <param name="z_rads_">: Angle to rotate about the Z axis by, in radians.</param>
+	/// <returns>4x4 EmuMath Matrix representing the described rotation.</returns>
+	template<typename OutT_ = float, bool OutColumnMajor_ = true, typename X_, typename Y_, typename Z_>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_> matrix_make_rotation_euler(const X_& x_rads_, const Y_& y_rads_, const Z_& z_rads_)
+	{
+		using out_matrix = EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_>;
+		using out_value = typename out_matrix::value_type_uq;
+		return _matrix_underlying::_matrix_make_rotation_euler<out_matrix, EmuCore::do_cos<out_value>, EmuCore::do_sin<out_value>>(x_rads_, y_rads_, z_rads_);
+	}
+	template<typename OutT_ = float, bool OutColumnMajor_ = true, typename X_, typename Y_, typename Z_>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_> matrix_make_rotation_euler_constexpr
+	(
+		const X_& x_rads_,
+		const Y_& y_rads_,
+		const Z_& z_rads_
+	)
+	{
+		using out_matrix = EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_>;
+		using out_value = typename out_matrix::value_type_uq;
+		return _matrix_underlying::_matrix_make_rotation_euler<out_matrix, EmuCore::do_cos_constexpr<out_value>, EmuCore::do_sin_constexpr<out_value>>
+		(
+			x_rads_,
+			y_rads_,
+			z_rads_
+		);
+	}
+
+	/// <summary>
+	/// <para> Outputs a 4x4 transformation Matrix which rotates points about the passed axis_ by the passed angle_rads_. </para>
+	/// <para> The axis_ does not need to be normalised, but must not be a zero Vector. Only its x, y and z elements are used, so a w element does not affect its length. </para>
+	/// <para> For a guarantee to produce a compile-time result if possible, use `matrix_make_rotation_axis_angle_constexpr` instead. </para>
+	/// </summary>
+	/// <param name="axis_">: EmuMath Vector representing the axis to rotate about, using theoretical indices 0, 1 and 2.</param>
+	/// <param name="angle_rads_">: Angle to rotate by, in radians.</param>
+	/// <returns>4x4 EmuMath Matrix representing the described rotation.</returns>
+	template<typename OutT_ = float, bool OutColumnMajor_ = true, std::size_t AxisSize_, typename AxisT_, typename Angle_>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_> matrix_make_rotation_axis_angle
+	(
+		const EmuMath::Vector<AxisSize_, AxisT_>& axis_,
+		const Angle_& angle_rads_
+	)
+	{
+		using out_matrix = EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_>;
+		using out_value = typename out_matrix::value_type_uq;
+		return _matrix_underlying::_matrix_make_rotation_axis_angle<out_matrix, EmuCore::do_cos<out_value>, EmuCore::do_sin<out_value>, EmuCore::do_sqrt<out_value>>
+		(
+			axis_,
+			angle_rads_
+		);
+	}
+	template<typename OutT_ = float, bool OutColumnMajor_ = true, std::size_t AxisSize_, typename AxisT_, typename Angle_>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_> matrix_make_rotation_axis_angle_constexpr
+	(
+		const EmuMath::Vector<AxisSize_, AxisT_>& axis_,
+		const Angle_& angle_rads_
+	)
+	{
+		using out_matrix = EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_>;
+		using out_value = typename out_matrix::value_type_uq;
+		return _matrix_underlying::_matrix_make_rotation_axis_angle
+		<
+			out_matrix,
+			EmuCore::do_cos_constexpr<out_value>,
+			EmuCore::do_sin_constexpr<out_value>,
+			EmuCore::do_sqrt_constexpr<out_value>
+		>(axis_, angle_rads_);
+	}
+#pragma endregion
+
+#pragma region VIEW_AND_PROJECTION
+	/// <summary>
+	/// <para> Outputs a right-handed 4x4 view Matrix for a camera positioned at eye_, facing target_, with the passed up_ direction. </para>
+	/// <para> View space looks down its negative Z axis, with positive Y as up. up_ does not need to be normalised, but must not be parallel to the view direction. </para>
+	/// <para> For a guarantee to produce a compile-time result if possible, use `matrix_make_look_at_constexpr` instead. </para>
+	/// </summary>
+	/// <param name="eye_">: EmuMath Vector of the camera's position, using theoretical indices 0, 1 and 2.</param>
+	/// <param name="target_">: EmuMath Vector of the position being looked at, using theoretical indices 0, 1 and 2.</param>
+	/// <param name="up_">: EmuMath Vector of the world's up direction, using theoretical indices 0, 1 and 2.</param>
+	/// <returns>4x4 EmuMath Matrix which transforms points from world space to view space.</returns>
+	template
+	<
+		typename OutT_ = float, bool OutColumnMajor_ = true,
+		std::size_t EyeSize_, typename EyeT_, std::size_t TargetSize_, typename TargetT_, std::size_t UpSize_, typename UpT_
+	>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_> matrix_make_look_at
+	(
+		const EmuMath::Vector<EyeSize_, EyeT_>& eye_,
+		const EmuMath::Vector<TargetSize_, TargetT_>& target_,
+		const EmuMath::Vector<UpSize_, UpT_>& up_
+	)
+	{
+		using out_matrix = EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_>;
+		using out_value = typename out_matrix::value_type_uq;
+		return _matrix_underlying::_matrix_make_look_at<out_matrix, EmuCore::do_sqrt<out_value>>(eye_, target_, up_);
+	}
+	template
+	<
+		typename OutT_ = float, bool OutColumnMajor_ = true,
+		std::size_t EyeSize_, typename EyeT_, std::size_t TargetSize_, typename TargetT_, std::size_t UpSize_, typename UpT_
+	>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_> matrix_make_look_at_constexpr
+	(
+		const EmuMath::Vector<EyeSize_, EyeT_>& eye_,
+		const EmuMath::Vector<TargetSize_, TargetT_>& target_,
+		const EmuMath::Vector<UpSize_, UpT_>& up_
+	)
+	{
+		using out_matrix = EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_>;
+		using out_value = typename out_matrix::value_type_uq;
+		return _matrix_underlying::_matrix_make_look_at<out_matrix, EmuCore::do_sqrt_constexpr<out_value>>(eye_, target_, up_);
+	}
+
+	/// <summary>
+	/// <para> Outputs a right-handed 4x4 perspective projection Matrix. </para>
+	/// <para> View-space depths of -near_ and -far_ are mapped to clip-space depths of 0 and 1 respectively, and clip-space W is set to the view-space distance. </para>
+	/// <para> For a guarantee to produce a compile-time result if possible, use `matrix_make_perspective_constexpr` instead. </para>
+	/// </summary>
+	/// <param name="fov_y_rads_">: Vertical field of view, in radians.</param>
+	/// <param name="aspect_ratio_">: Ratio of the view's width to its height.</param>
+	/// <param name="near_">: Positive distance to the near clipping plane.</param>
+	/// <param name="far_">: Positive distance to the far clipping plane.</param>
+	/// <returns>4x4 EmuMath Matrix which transforms points from view space to clip space.</returns>
+	template<typename OutT_ = float, bool OutColumnMajor_ = true, typename Fov_, typename Aspect_, typename Near_, typename Far_>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_> matrix_make_perspective
+	(
+		const Fov_& fov_y_rads_,
+		const Aspect_& aspect_ratio_,
+		const Near_& near_,
+		const Far_& far_
+	)
+	{
+		using out_matrix = EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_>;
+		using out_value = typename out_matrix::value_type_uq;
+		return _matrix_underlying::_matrix_make_perspective<out_matrix, EmuCore::do_tan<out_value>>(fov_y_rads_, aspect_ratio_, near_, far_);
+	}
+	template<typename OutT_ = float, bool OutColumnMajor_ = true, typename Fov_, typename Aspect_, typename Near_, typename Far_>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_> matrix_make_perspective_constexpr
+	(
+		const Fov_& fov_y_rads_,
+		const Aspect_& aspect_ratio_,
+		const Near_& near_,
+		const Far_& far_
+	)
+	{
+		using out_matrix = EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_>;
+		using out_value = typename out_matrix::value_type_uq;
+		return _matrix_underlying::_matrix_make_perspective<out_matrix, EmuCore::do_tan_constexpr<out_value>>(fov_y_rads_, aspect_ratio_, near_, far_);
+	}
+
+	/// <summary>
+	/// <para> Outputs a right-handed 4x4 orthographic projection Matrix for the passed view-space box. </para>
+	/// <para> View-space depths of -near_ and -far_ are mapped to clip-space depths of 0 and 1 respectively. </para>
+	/// </summary>
+	/// <param name="left_">: View-space X coordinate of the left clipping plane.</param>
+	/// <param name="right_">: View-space X coordinate of the right clipping plane.</param>
+	/// <param name="bottom_">: View-space Y coordinate of the bottom clipping plane.</param>
+	/// <param name="top_">: View-space Y coordinate of the top clipping plane.</param>
+	/// <param name="near_">: Distance to the near clipping plane.</param>
+	/// <param name="far_">: Distance to the far clipping plane.</param>
+	/// <returns>4x4 EmuMath Matrix which transforms points from view space to clip space.</returns>
+	template
+	<
+		typename OutT_ = float, bool OutColumnMajor_ = true,
+		typename Left_, typename Right_, typename Bottom_, typename Top_, typename Near_, typename Far_
+	>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_> matrix_make_orthographic
+	(
+		const Left_& left_,
+		const Right_& right_,
+		const Bottom_& bottom_,
+		const Top_& top_,
+		const Near_& near_,
+		const Far_& far_
+	)
+	{
+		return _matrix_underlying::_matrix_make_orthographic<EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_>>(left_, right_, bottom_, top_, near_, far_);
+	}
+#pragma endregion
+
+#pragma region AFFINE_INVERSE
+	/// <summary>
+	/// <para> Calculates the inverse of the passed 4x4 affine matrix_, whose final row is assumed to be (0, 0, 0, 1). </para>
+	/// <para>
+	///		Only the upper-left 3x3 is inverted, with the translation inverted through it.
+	///		This is significantly cheaper than a general inverse, but produces incorrect results for non-affine matrices such as projections.
+	/// </para>
+	/// <para> Where the input and output are column-major 4x4 float matrices, the inverse is performed via a dedicated SIMD kernel. </para>
+	/// </summary>
+	/// <typeparam name="OutT_">Type of value contained in the output Matrix.</typeparam>
+	/// <param name="matrix_">4x4 affine EmuMath Matrix to calculate the inverse of.</param>
+	/// <returns>4x4 EmuMath Matrix containing the inverse of matrix_.</returns>
+	template<typename OutT_, bool OutColumnMajor_, typename InT_, bool InColumnMajor_>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_> matrix_affine_inverse(const EmuMath::Matrix<4, 4, InT_, InColumnMajor_>& matrix_)
+	{
+		return _matrix_underlying::_matrix_affine_inverse<EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_>>(matrix_);
+	}
+
+	template<typename OutT_, typename InT_, bool InColumnMajor_>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<4, 4, OutT_, InColumnMajor_> matrix_affine_inverse(const EmuMath::Matrix<4, 4, InT_, InColumnMajor_>& matrix_)
+	{
+		return matrix_affine_inverse<OutT_, InColumnMajor_>(matrix_);
+	}
+
+	template<bool InColumnMajor_, typename InT_>
+	[[nodiscard]] constexpr inline auto matrix_affine_inverse(const EmuMath::Matrix<4, 4, InT_, InColumnMajor_>& matrix_)
+	{
+		using in_fp = typename EmuMath::Matrix<4, 4, InT_, InColumnMajor_>::preferred_floating_point;
+		return matrix_affine_inverse<in_fp, InColumnMajor_>(matrix_);
+	}
+#pragma endregion
+}
+
+#endif
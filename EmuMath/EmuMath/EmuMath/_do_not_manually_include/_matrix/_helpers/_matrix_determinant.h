@@ -0,0 +1,41 @@
+#ifndef EMU_MATH_MATRIX_DETERMINANT_H_INC_
+#define EMU_MATH_MATRIX_DETERMINANT_H_INC_ 1
+
+#include "_common_matrix_helper_includes.h"
+
+namespace EmuMath::Helpers
+{
+	/// <summary>
+	/// <para> Calculates the determinant of the passed square matrix_. If matrix_ is not square, a static_assert will be triggered. </para>
+	/// <para> 2x2 and 3x3 matrices use closed-form expansions, and 4x4 float matrices output as float use a dedicated SIMD kernel. </para>
+	/// <para> All other sizes are calculated via LU decomposition with partial pivoting, performed as OutT_. </para>
+	/// </summary>
+	/// <typeparam name="OutT_">Type to calculate and output the determinant as. Defaults to the preferred_floating_point of the passed matrix_.</typeparam>
+	/// <param name="matrix_">Square EmuMath Matrix to calculate the determinant of.</param>
+	/// <returns>Determinant of the passed matrix_.</returns>
+	template<typename OutT_, std::size_t NumColumns_, std::size_t NumRows_, typename InT_, bool InColumnMajor_>
+	[[nodiscard]] constexpr inline OutT_ matrix_determinant(const EmuMath::Matrix<NumColumns_, NumRows_, InT_, InColumnMajor_>& matrix_)
+	{
+		if constexpr (NumColumns_ == NumRows_)
+		{
+			return _matrix_underlying::_matrix_determinant<OutT_>(matrix_);
+		}
+		else
+		{
+			static_assert
+			(
+				EmuCore::TMP::get_false<std::size_t, NumColumns_>(),
+				"Attempted to calculate the determinant of an EmuMath Matrix, but the Matrix is not square. Determinants are only defined for square matrices."
+			);
+		}
+	}
+
+	template<std::size_t NumColumns_, std::size_t NumRows_, typename InT_, bool InColumnMajor_>
+	[[nodiscard]] constexpr inline auto matrix_determinant(const EmuMath::Matrix<NumColumns_, NumRows_, InT_, InColumnMajor_>& matrix_)
+	{
+		using in_fp = typename EmuMath::Matrix<NumColumns_, NumRows_, InT_, InColumnMajor_>::preferred_floating_point;
+		return matrix_determinant<in_fp>(matrix_);
+	}
+}
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef EMU_MATH_MATRIX_INVERSE_H_INC_
+#define EMU_MATH_MATRIX_INVERSE_H_INC_ 1
+
+#include "_common_matrix_helper_includes.h"
+
+namespace EmuMath::Helpers
+{
+	/// <summary>
+	/// <para> Calculates the inverse of the passed square matrix_, additionally outputting its determinant to out_determinant_. </para>
+	/// <para> If matrix_ is not square, a static_assert will be triggered. </para>
+	/// <para>
+	///		2x2 and 3x3 matrices use closed-form adjugates. 4x4 float matrices output to a 4x4 float Matrix of the same major order use a branch-free SIMD kernel.
+	///		All other sizes are calculated via LU decomposition with partial pivoting, performed as OutT_.
+	/// </para>
+	/// <para> No check is made for a singular matrix_. If out_determinant_ is 0, the output Matrix will contain non-finite values. </para>
+	/// <para>
+	///		Overloads without OutColumnMajor_ take matrix_ as a whole type rather than by its dimensions,
+	///		so that an explicit OutColumnMajor_ argument can never be deduced as the column count of a 1x1 Matrix.
+	/// </para>
+	/// </summary>
+	/// <typeparam name="OutT_">Type of value contained in the output Matrix.</typeparam>
+	/// <param name="matrix_">Square EmuMath Matrix to calculate the inverse of.</param>
+	/// <param name="out_determinant_">Reference to output the determinant of matrix_ to. If OutT_ is not explicitly provided, it is deduced from this argument.</param>
+	/// <returns>EmuMath Matrix containing the inverse of matrix_.</returns>
+	template<typename OutT_, bool OutColumnMajor_, std::size_t NumColumns_, std::size_t NumRows_, typename InT_, bool InColumnMajor_>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<NumColumns_, NumRows_, OutT_, OutColumnMajor_> matrix_inverse
+	(
+		const EmuMath::Matrix<NumColumns_, NumRows_, InT_, InColumnMajor_>& matrix_,
+		OutT_& out_determinant_
+	)
+	{
+		if constexpr (NumColumns_ == NumRows_)
+		{
+			return _matrix_underlying::_matrix_inverse<EmuMath::Matrix<NumColumns_, NumRows_, OutT_, OutColumnMajor_>>(matrix_, out_determinant_);
+		}
+		else
+		{
+			static_assert
+			(
+				EmuCore::TMP::get_false<std::size_t, NumColumns_>(),
+				"Attempted to calculate the inverse of an EmuMath Matrix, but the Matrix is not square. Only square matrices may be inverted."
+			);
+		}
+	}
+
+	template<typename OutT_, class Matrix_, typename = std::enable_if_t<EmuMath::TMP::is_emu_matrix_v<Matrix_>>>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<Matrix_::num_columns, Matrix_::num_rows, OutT_, Matrix_::is_column_major> matrix_inverse
+	(
+		const Matrix_& matrix_,
+		OutT_& out_determinant_
+	)
+	{
+		return matrix_inverse<OutT_, Matrix_::is_column_major>(matrix_, out_determinant_);
+	}
+
+	/// <summary>
+	/// <para> Calculates the inverse of the passed square matrix_. If matrix_ is not square, a static_assert will be triggered. </para>
+	/// <para>
+	///		2x2 and 3x3 matrices use closed-form adjugates. 4x4 float matrices output to a 4x4 float Matrix of the same major order use a branch-free SIMD kernel.
+	///		All other sizes are calculated via LU decomposition with partial pivoting, performed as OutT_.
+	/// </para>
+	/// <para> No check is made for a singular matrix_, which will produce an output Matrix containing non-finite values. </para>
+	/// </summary>
+	/// <typeparam name="OutT_">Type of value contained in the output Matrix.</typeparam>
+	/// <param name="matrix_">Square EmuMath Matrix to calculate the inverse of.</param>
+	/// <returns>EmuMath Matrix containing the inverse of matrix_.</returns>
+	template<typename OutT_, bool OutColumnMajor_, std::size_t NumColumns_, std::size_t NumRows_, typename InT_, bool InColumnMajor_>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<NumColumns_, NumRows_, OutT_, OutColumnMajor_> matrix_inverse
+	(
+		const EmuMath::Matrix<NumColumns_, NumRows_, InT_, InColumnMajor_>& matrix_
+	)
+	{
+		OutT_ determinant_ = OutT_();
+		return matrix_inverse<OutT_, OutColumnMajor_>(matrix_, determinant_);
+	}
+
+	template<typename OutT_, class Matrix_, typename = std::enable_if_t<EmuMath::TMP::is_emu_matrix_v<Matrix_>>>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<Matrix_::num_columns, Matrix_::num_rows, OutT_, Matrix_::is_column_major> matrix_inverse
+	(
+		const Matrix_& matrix_
+	)
+	{
+		return matrix_inverse<OutT_, Matrix_::is_column_major>(matrix_);
+	}
+
+	template<std::size_t NumColumns_, std::size_t NumRows_, typename InT_, bool InColumnMajor_>
+	[[nodiscard]] constexpr inline auto matrix_inverse(const EmuMath::Matrix<NumColumns_, NumRows_, InT_, InColumnMajor_>& matrix_)
+	{
+		using in_fp = typename EmuMath::Matrix<NumColumns_, NumRows_, InT_, InColumnMajor_>::preferred_floating_point;
+		return matrix_inverse<in_fp, InColumnMajor_>(matrix_);
+	}
+}
+
+#endif
@@ -0,0 +1,122 @@
+#ifndef EMU_MATH_MATRIX_MULTIPLY_H_INC_
+#define EMU_MATH_MATRIX_MULTIPLY_H_INC_ 1
+
+#include "_common_matrix_helper_includes.h"
+
+namespace EmuMath::Helpers
+{
+	/// <summary>
+	/// <para> Performs a standard matrix multiplication of lhs_matrix_ and rhs_matrix_, in the form `lhs_matrix_ * rhs_matrix_`. </para>
+	/// <para> The number of columns in lhs_matrix_ must equal the number of rows in rhs_matrix_. Otherwise, a static_assert will be triggered. </para>
+	/// <para> The output Matrix will have a number of columns equal to that of rhs_matrix_, and a number of rows equal to that of lhs_matrix_. </para>
+	/// <para>
+	///		Where both inputs and the output are 4x4 float matrices of the same major order, multiplication is performed via a dedicated SIMD kernel.
+	///		All other combinations are fully evaluated at compile time where possible.
+	/// </para>
+	/// </summary>
+	/// <typeparam name="OutT_">Type of value contained in the output Matrix.</typeparam>
+	/// <param name="lhs_matrix_">EmuMath Matrix appearing on the left-hand side of multiplication.</param>
+	/// <param name="rhs_matrix_">EmuMath Matrix appearing on the right-hand side of multiplication.</param>
+	/// <returns>EmuMath Matrix containing the result of the multiplication.</returns>
+	template
+	<
+		typename OutT_, bool OutColumnMajor_,
+		std::size_t LhsNumColumns_, std::size_t LhsNumRows_, typename LhsT_, bool LhsColumnMajor_,
+		std::size_t RhsNumColumns_, std::size_t RhsNumRows_, typename RhsT_, bool RhsColumnMajor_
+	>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<RhsNumColumns_, LhsNumRows_, OutT_, OutColumnMajor_> matrix_multiply
+	(
+		const EmuMath::Matrix<LhsNumColumns_, LhsNumRows_, LhsT_, LhsColumnMajor_>& lhs_matrix_,
+		const EmuMath::Matrix<RhsNumColumns_, RhsNumRows_, RhsT_, RhsColumnMajor_>& rhs_matrix_
+	)
+	{
+		if constexpr (LhsNumColumns_ == RhsNumRows_)
+		{
+			return _matrix_underlying::_matrix_multiply<EmuMath::Matrix<RhsNumColumns_, LhsNumRows_, OutT_, OutColumnMajor_>>(lhs_matrix_, rhs_matrix_);
+		}
+		else
+		{
+			static_assert
+			(
+				EmuCore::TMP::get_false<std::size_t, LhsNumColumns_>(),
+				"Attempted to multiply two EmuMath Matrices, but the number of columns in the left-hand Matrix does not match the number of rows in the right-hand Matrix."
+			);
+		}
+	}
+
+	/// <summary>
+	/// <para> Performs a standard matrix multiplication of lhs_matrix_ and rhs_matrix_, outputting a Matrix with the same major order as lhs_matrix_. </para>
+	/// <para>
+	///		Operands are taken as whole types rather than by their dimensions,
+	///		so that a major-order argument explicitly passed to the OutColumnMajor_ overload can never be deduced as a Matrix dimension here instead.
+	/// </para>
+	/// </summary>
+	template
+	<
+		typename OutT_, class LhsMatrix_, class RhsMatrix_,
+		typename = std::enable_if_t<EmuMath::TMP::is_emu_matrix_v<LhsMatrix_> && EmuMath::TMP::is_emu_matrix_v<RhsMatrix_>>
+	>
+	[[nodiscard]] constexpr inline EmuMath::Matrix<RhsMatrix_::num_columns, LhsMatrix_::num_rows, OutT_, LhsMatrix_::is_column_major> matrix_multiply
+	(
+		const LhsMatrix_& lhs_matrix_,
+		const RhsMatrix_& rhs_matrix_
+	)
+	{
+		return matrix_multiply<OutT_, LhsMatrix_::is_column_major>(lhs_matrix_, rhs_matrix_);
+	}
+
+	template
+	<
+		std::size_t LhsNumColumns_, std::size_t LhsNumRows_, typename LhsT_, bool LhsColumnMajor_,
+		std::size_t RhsNumColumns_, std::size_t RhsNumRows_, typename RhsT_, bool RhsColumnMajor_
+	>
+	[[nodiscard]] constexpr inline auto matrix_multiply
+	(
+		const EmuMath::Matrix<LhsNumColumns_, LhsNumRows_, LhsT_, LhsColumnMajor_>& lhs_matrix_,
+		const EmuMath::Matrix<RhsNumColumns_, RhsNumRows_, RhsT_, RhsColumnMajor_>& rhs_matrix_
+	)
+	{
+		using lhs_value_uq = typename EmuMath::Matrix<LhsNumColumns_, LhsNumRows_, LhsT_, LhsColumnMajor_>::value_type_uq;
+		return matrix_multiply<lhs_value_uq, LhsColumnMajor_>(lhs_matrix_, rhs_matrix_);
+	}
+
+	/// <summary>
+	/// <para> Multiplies the passed lhs_matrix_ by the passed column vector_, in the form `lhs_matrix_ * vector_`. </para>
+	/// <para>
+	///		The vector_ is treated as a column vector with a number of rows equal to the number of columns in lhs_matrix_.
+	///		Indices that the vector_ does not contain are treated as its implied zero.
+	/// </para>
+	/// <para> Where lhs_matrix_ is a column-major 4x4 float Matrix and vector_ is a 4D float Vector, multiplication is performed via a dedicated SIMD kernel. </para>
+	/// <para> Operands are taken as whole types so that, as with Matrix multiplication, explicit template arguments can never be deduced as Matrix dimensions. </para>
+	/// </summary>
+	/// <typeparam name="OutT_">Type of value contained in the output Vector.</typeparam>
+	/// <param name="lhs_matrix_">EmuMath Matrix appearing on the left-hand side of multiplication.</param>
+	/// <param name="vector_">EmuMath Vector to treat as a column vector appearing on the right-hand side of multiplication.</param>
+	/// <returns>EmuMath Vector containing a number of elements equal to the number of rows in lhs_matrix_, representing the transformed column vector.</returns>
+	template
+	<
+		typename OutT_, class LhsMatrix_, class RhsVector_,
+		typename = std::enable_if_t<EmuMath::TMP::is_emu_matrix_v<LhsMatrix_> && EmuMath::TMP::is_emu_vector_v<RhsVector_>>
+	>
+	[[nodiscard]] constexpr inline EmuMath::Vector<LhsMatrix_::num_rows, OutT_> matrix_multiply
+	(
+		const LhsMatrix_& lhs_matrix_,
+		const RhsVector_& vector_
+	)
+	{
+		return _matrix_underlying::_matrix_multiply_vector<EmuMath::Vector<LhsMatrix_::num_rows, OutT_>>(lhs_matrix_, vector_);
+	}
+
+	template<std::size_t LhsNumColumns_, std::size_t LhsNumRows_, typename LhsT_, bool LhsColumnMajor_, std::size_t VectorSize_, typename VectorT_>
+	[[nodiscard]] constexpr inline auto matrix_multiply
+	(
+		const EmuMath::Matrix<LhsNumColumns_, LhsNumRows_, LhsT_, LhsColumnMajor_>& lhs_matrix_,
+		const EmuMath::Vector<VectorSize_, VectorT_>& vector_
+	)
+	{
+		using lhs_value_uq = typename EmuMath::Matrix<LhsNumColumns_, LhsNumRows_, LhsT_, LhsColumnMajor_>::value_type_uq;
+		return matrix_multiply<lhs_value_uq>(lhs_matrix_, vector_);
+	}
+}
+
+#endif
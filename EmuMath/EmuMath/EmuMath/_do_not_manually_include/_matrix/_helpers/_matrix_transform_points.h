@@ -0,0 +1,82 @@
+#ifndef EMU_MATH_MATRIX_TRANSFORM_POINTS_H_INC_
+#define EMU_MATH_MATRIX_TRANSFORM_POINTS_H_INC_ 1
+
+#include "_common_matrix_helper_includes.h"
+
+namespace EmuMath::Helpers
+{
+	/// <summary>
+	/// <para> Transforms count_ contiguous 3D float points starting at p_in_points_ by the passed 4x4 matrix_, outputting to count_ contiguous points at p_out_points_. </para>
+	/// <para> Each point is treated as a column vector with an implied w of 1, in the form `matrix_ * point`. No perspective divide is performed. </para>
+	/// <para> 4 points are processed per SIMD iteration, with any remainder transformed individually. </para>
+	/// <para>
+	///		Non-temporal stores are used where the output is sufficiently large and aligned to 16 bytes, avoiding cache pollution when transforming large buffers.
+	///		p_in_points_ and p_out_points_ may point to the same array for an in-place transformation, but must not otherwise overlap.
+	/// </para>
+	/// </summary>
+	/// <param name="matrix_">4x4 float EmuMath Matrix to transform points by. May be either column-major or row-major.</param>
+	/// <param name="p_in_points_">Pointer to the first of count_ contiguous points to transform.</param>
+	/// <param name="p_out_points_">Pointer to the first of count_ contiguous points to output to.</param>
+	/// <param name="count_">Number of points to transform.</param>
+	template<bool ColumnMajor_>
+	inline void matrix_transform_points
+	(
+		const EmuMath::Matrix<4, 4, float, ColumnMajor_>& matrix_,
+		const EmuMath::Vector<3, float>* p_in_points_,
+		EmuMath::Vector<3, float>* p_out_points_,
+		std::size_t count_
+	)
+	{
+		static_assert
+		(
+			sizeof(EmuMath::Vector<3, float>) == (sizeof(float) * 3),
+			"Attempted to transform contiguous EmuMath Vector<3, float> points, but the Vector type contains padding and cannot be treated as contiguous floats."
+		);
+
+		if (count_ != 0)
+		{
+			_matrix_underlying::_matrix_transform_points_aos_fp32
+			(
+				matrix_,
+				p_in_points_->data(),
+				p_out_points_->data(),
+				count_
+			);
+		}
+	}
+
+	/// <summary>
+	/// <para> Transforms count_ 3D float points stored as separate x, y, and z arrays by the passed 4x4 matrix_, outputting to separate x, y, and z arrays. </para>
+	/// <para> Each point is treated as a column vector with an implied w of 1, in the form `matrix_ * point`. No perspective divide is performed. </para>
+	/// <para> 8 points are processed per SIMD iteration, with any remainder transformed individually. </para>
+	/// <para>
+	///		Non-temporal stores are used where the output is sufficiently large and all output arrays are aligned to 32 bytes.
+	///		Input and output arrays may be the same for an in-place transformation, but must not otherwise overlap.
+	/// </para>
+	/// </summary>
+	/// <param name="matrix_">4x4 float EmuMath Matrix to transform points by. May be either column-major or row-major.</param>
+	/// <param name="p_in_x_">Pointer to the first of count_ contiguous x coordinates to transform.</param>
+	/// <param name="p_in_y_">Pointer to the first of count_ contiguous y coordinates to transform.</param>
+	/// <param name="p_in_z_">Pointer to the first of count_ contiguous z coordinates to transform.</param>
+	/// <param name="p_out_x_">Pointer to the first of count_ contiguous x coordinates to output to.</param>
+	/// <param name="p_out_y_">Pointer to the first of count_ contiguous y coordinates to output to.</param>
+	/// <param name="p_out_z_">Pointer to the first of count_ contiguous z coordinates to output to.</param>
+	/// <param name="count_">Number of points to transform.</param>
+	template<bool ColumnMajor_>
+	inline void matrix_transform_points
+	(
+		const EmuMath::Matrix<4, 4, float, ColumnMajor_>& matrix_,
+		const float* p_in_x_,
+		const float* p_in_y_,
+		const float* p_in_z_,
+		float* p_out_x_,
+		float* p_out_y_,
+		float* p_out_z_,
+		std::size_t count_
+	)
+	{
+		_matrix_underlying::_matrix_transform_points_soa_fp32(matrix_, p_in_x_, p_in_y_, p_in_z_, p_out_x_, p_out_y_, p_out_z_, count_);
+	}
+}
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef EMU_MATH_MATRIX_TRANSPOSE_H_INC_
+#define EMU_MATH_MATRIX_TRANSPOSE_H_INC_ 1
+
+#include "_common_matrix_helper_includes.h"
+
+namespace EmuMath::Helpers
+{
+	/// <summary>
+	/// <para> Outputs the transpose of the passed matrix_, where each column of the input becomes the respective row of the output. </para>
+	/// <para> The output Matrix will have a number of columns equal to the number of rows in matrix_, and a number of rows equal to the number of columns in matrix_. </para>
+	/// <para> Where the input and output are 4x4 float matrices of the same major order, the transpose is performed via a dedicated SIMD kernel. </para>
+	/// <para>
+	///		The overload without OutColumnMajor_ takes matrix_ as a whole type rather than by its dimensions,
+	///		so that an explicit OutColumnMajor_ argument can never be deduced as the column count of a single-column Matrix.
+	/// </para>
+	/// </summary>
+	/// <typeparam name="OutT_">Type of value contained in the output Matrix.</typeparam>
+	/// <param name="matrix_">EmuMath Matrix to transpose.</param>
+	/// <returns>EmuMath Matrix containing the transpose of matrix_.</returns>
+	template<typename OutT_, bool OutColumnMajor_, std::size_t NumColumns_, std::size_t NumRows_, typename InT_, bool InColumnMajor_>
+	[[nodiscard]] constexpr inline EmuMath::TMP::emu_matrix_transpose_t<EmuMath::Matrix<NumColumns_, NumRows_, InT_, InColumnMajor_>, OutT_, OutColumnMajor_> matrix_transpose
+	(
+		const EmuMath::Matrix<NumColumns_, NumRows_, InT_, InColumnMajor_>& matrix_
+	)
+	{
+		using out_matrix = EmuMath::TMP::emu_matrix_transpose_t<EmuMath::Matrix<NumColumns_, NumRows_, InT_, InColumnMajor_>, OutT_, OutColumnMajor_>;
+		return _matrix_underlying::_matrix_transpose<out_matrix>(matrix_);
+	}
+
+	template<typename OutT_, class Matrix_, typename = std::enable_if_t<EmuMath::TMP::is_emu_matrix_v<Matrix_>>>
+	[[nodiscard]] constexpr inline EmuMath::TMP::emu_matrix_transpose_t<Matrix_, OutT_, Matrix_::is_column_major> matrix_transpose
+	(
+		const Matrix_& matrix_
+	)
+	{
+		return matrix_transpose<OutT_, Matrix_::is_column_major>(matrix_);
+	}
+
+	template<std::size_t NumColumns_, std::size_t NumRows_, typename InT_, bool InColumnMajor_>
+	[[nodiscard]] constexpr inline auto matrix_transpose(const EmuMath::Matrix<NumColumns_, NumRows_, InT_, InColumnMajor_>& matrix_)
+	{
+		using in_value_uq = typename EmuMath::Matrix<NumColumns_, NumRows_, InT_, InColumnMajor_>::value_type_uq;
+		return matrix_transpose<in_value_uq, InColumnMajor_>(matrix_);
+	}
+}
+
+#endif
@@ -566,6 +566,195 @@ namespace EmuMath
 		}
 #pragma endregion
 
+#pragma region MATRIX_OPERATIONS
+	public:
+		/// <summary>
+		/// <para> Performs a standard matrix multiplication of this Matrix and the passed rhs_matrix_, in the form `this * rhs_matrix_`. </para>
+		/// <para> The number of rows in rhs_matrix_ must equal the number of columns in this Matrix. </para>
+		/// <para> OutT_: Type of value contained in the output Matrix. Defaults to this Matrix's value_type_uq. </para>
+		/// <para> OutColumnMajor_: Major order of the output Matrix. Defaults to this Matrix's major order. </para>
+		/// </summary>
+		/// <param name="rhs_matrix_">: EmuMath Matrix appearing on the right-hand side of multiplication.</param>
+		/// <returns>EmuMath Matrix with a number of columns equal to that of rhs_matrix_, and a number of rows equal to that of this Matrix.</returns>
+		template
+		<
+			typename OutT_ = value_type_uq, bool OutColumnMajor_ = is_column_major,
+			std::size_t RhsNumColumns_, std::size_t RhsNumRows_, typename RhsT_, bool RhsColumnMajor_
+		>
+		[[nodiscard]] constexpr inline EmuMath::Matrix<RhsNumColumns_, num_rows, OutT_, OutColumnMajor_> Multiply
+		(
+			const EmuMath::Matrix<RhsNumColumns_, RhsNumRows_, RhsT_, RhsColumnMajor_>& rhs_matrix_
+		) const
+		{
+			return EmuMath::Helpers::matrix_multiply<OutT_, OutColumnMajor_>(*this, rhs_matrix_);
+		}
+
+		/// <summary>
+		/// <para> Multiplies this Matrix by the passed column vector_, in the form `this * vector_`. </para>
+		/// <para> Indices that the vector_ does not contain are treated as its implied zero. </para>
+		/// <para> OutT_: Type of value contained in the output Vector. Defaults to this Matrix's value_type_uq. </para>
+		/// </summary>
+		/// <param name="vector_">: EmuMath Vector to treat as a column vector appearing on the right-hand side of multiplication.</param>
+		/// <returns>EmuMath Vector containing a number of elements equal to the number of rows in this Matrix.</returns>
+		template<typename OutT_ = value_type_uq, std::size_t VectorSize_, typename VectorT_>
+		[[nodiscard]] constexpr inline EmuMath::Vector<num_rows, OutT_> Multiply(const EmuMath::Vector<VectorSize_, VectorT_>& vector_) const
+		{
+			return EmuMath::Helpers::matrix_multiply<OutT_>(*this, vector_);
+		}
+
+		template<std::size_t RhsNumColumns_, std::size_t RhsNumRows_, typename RhsT_, bool RhsColumnMajor_>
+		[[nodiscard]] constexpr inline EmuMath::Matrix<RhsNumColumns_, num_rows, value_type_uq, is_column_major> operator*
+		(
+			const EmuMath::Matrix<RhsNumColumns_, RhsNumRows_, RhsT_, RhsColumnMajor_>& rhs_matrix_
+		) const
+		{
+			return EmuMath::Helpers::matrix_multiply<value_type_uq, is_column_major>(*this, rhs_matrix_);
+		}
+
+		template<std::size_t VectorSize_, typename VectorT_>
+		[[nodiscard]] constexpr inline EmuMath::Vector<num_rows, value_type_uq> operator*(const EmuMath::Vector<VectorSize_, VectorT_>& vector_) const
+		{
+			return EmuMath::Helpers::matrix_multiply<value_type_uq>(*this, vector_);
+		}
+
+		/// <summary>
+		/// <para> Multiplies this Matrix by the passed square rhs_matrix_, in the form `this = this * rhs_matrix_`. </para>
+		/// </summary>
+		/// <param name="rhs_matrix_">: Square EmuMath Matrix appearing on the right-hand side of multiplication.</param>
+		/// <returns>Reference to this Matrix.</returns>
+		template<typename RhsT_, bool RhsColumnMajor_>
+		constexpr inline this_type& operator*=(const EmuMath::Matrix<num_columns, num_columns, RhsT_, RhsColumnMajor_>& rhs_matrix_)
+		{
+			_data = EmuMath::Helpers::matrix_multiply<value_type_uq, is_column_major>(*this, rhs_matrix_)._data;
+			return *this;
+		}
+
+		/// <summary>
+		/// <para> Outputs the transpose of this Matrix, where each column of this Matrix becomes the respective row of the output. </para>
+		/// <para> OutT_: Type of value contained in the output Matrix. Defaults to this Matrix's value_type_uq. </para>
+		/// <para> OutColumnMajor_: Major order of the output Matrix. Defaults to this Matrix's major order. </para>
+		/// </summary>
+		/// <returns>EmuMath Matrix with a number of columns equal to the number of rows in this Matrix, and a number of rows equal to the number of columns in this Matrix.</returns>
+		template<typename OutT_ = value_type_uq, bool OutColumnMajor_ = is_column_major>
+		[[nodiscard]] constexpr inline EmuMath::TMP::emu_matrix_transpose_t<this_type, OutT_, OutColumnMajor_> Transpose() const
+		{
+			return EmuMath::Helpers::matrix_transpose<OutT_, OutColumnMajor_>(*this);
+		}
+
+		/// <summary>
+		/// <para> Calculates the determinant of this Matrix. This is only available for square matrices. </para>
+		/// <para> OutT_: Type to calculate and output the determinant as. Defaults to this Matrix's preferred_floating_point. </para>
+		/// </summary>
+		/// <returns>Determinant of this Matrix.</returns>
+		template<typename OutT_ = preferred_floating_point>
+		[[nodiscard]] constexpr inline OutT_ Determinant() const
+		{
+			return EmuMath::Helpers::matrix_determinant<OutT_>(*this);
+		}
+
+		/// <summary>
+		/// <para> Calculates the inverse of this Matrix. This is only available for square matrices. </para>
+		/// <para> No check is made for a singular Matrix, which will produce an output Matrix containing non-finite values. </para>
+		/// <para> OutT_: Type of value contained in the output Matrix. Defaults to this Matrix's preferred_floating_point. </para>
+		/// <para> OutColumnMajor_: Major order of the output Matrix. Defaults to this Matrix's major order. </para>
+		/// </summary>
+		/// <returns>EmuMath Matrix containing the inverse of this Matrix.</returns>
+		template<typename OutT_ = preferred_floating_point, bool OutColumnMajor_ = is_column_major>
+		[[nodiscard]] constexpr inline EmuMath::Matrix<num_columns, num_rows, OutT_, OutColumnMajor_> Inverse() const
+		{
+			return EmuMath::Helpers::matrix_inverse<OutT_, OutColumnMajor_>(*this);
+		}
+
+		/// <summary>
+		/// <para> Calculates the inverse of this Matrix, additionally outputting its determinant to out_determinant_. This is only available for square matrices. </para>
+		/// <para> No check is made for a singular Matrix. If out_determinant_ is 0, the output Matrix will contain non-finite values. </para>
+		/// <para> OutT_: Type of value contained in the output Matrix, and the type of out_determinant_. </para>
+		/// <para> OutColumnMajor_: Major order of the output Matrix. Defaults to this Matrix's major order. </para>
+		/// </summary>
+		/// <param name="out_determinant_">: Reference to output the determinant of this Matrix to.</param>
+		/// <returns>EmuMath Matrix containing the inverse of this Matrix.</returns>
+		template<bool OutColumnMajor_ = is_column_major, typename OutT_>
+		[[nodiscard]] constexpr inline EmuMath::Matrix<num_columns, num_rows, OutT_, OutColumnMajor_> Inverse(OutT_& out_determinant_) const
+		{
+			return EmuMath::Helpers::matrix_inverse<OutT_, OutColumnMajor_>(*this, out_determinant_);
+		}
+
+		/// <summary>
+		/// <para> Calculates the inverse of this Matrix, assuming it is an affine transformation whose final row is (0, 0, 0, 1). This is only available for 4x4 matrices. </para>
+		/// <para> This is significantly cheaper than Inverse, but produces incorrect results for non-affine matrices such as projections. </para>
+		/// <para> OutT_: Type of value contained in the output Matrix. Defaults to this Matrix's preferred_floating_point. </para>
+		/// <para> OutColumnMajor_: Major order of the output Matrix. Defaults to this Matrix's major order. </para>
+		/// </summary>
+		/// <returns>EmuMath Matrix containing the inverse of this affine Matrix.</returns>
+		template<typename OutT_ = preferred_floating_point, bool OutColumnMajor_ = is_column_major>
+		[[nodiscard]] constexpr inline EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_> AffineInverse() const
+		{
+			if constexpr (num_columns == 4 && num_rows == 4)
+			{
+				return EmuMath::Helpers::matrix_affine_inverse<OutT_, OutColumnMajor_>(*this);
+			}
+			else
+			{
+				static_assert(EmuCore::TMP::get_false<OutT_>(), "Attempted to calculate the affine inverse of an EmuMath Matrix, but only 4x4 matrices may be treated as affine transformations.");
+			}
+		}
+
+		/// <summary>
+		/// <para> Transforms count_ contiguous 3D float points by this Matrix, outputting to count_ contiguous points at p_out_points_. </para>
+		/// <para> Each point is treated as a column vector with an implied w of 1, in the form `this * point`. No perspective divide is performed. </para>
+		/// <para> This is only available for 4x4 float matrices. </para>
+		/// </summary>
+		/// <param name="p_in_points_">: Pointer to the first of count_ contiguous points to transform.</param>
+		/// <param name="p_out_points_">: Pointer to the first of count_ contiguous points to output to. May be p_in_points_, but must not otherwise overlap.</param>
+		/// <param name="count_">: Number of points to transform.</param>
+		template<typename PointT_ = float>
+		inline void TransformPoints(const EmuMath::Vector<3, PointT_>* p_in_points_, EmuMath::Vector<3, PointT_>* p_out_points_, std::size_t count_) const
+		{
+			if constexpr (num_columns == 4 && num_rows == 4 && std::is_same_v<stored_type, float> && std::is_same_v<PointT_, float>)
+			{
+				EmuMath::Helpers::matrix_transform_points(*this, p_in_points_, p_out_points_, count_);
+			}
+			else
+			{
+				static_assert(EmuCore::TMP::get_false<PointT_>(), "Attempted to batch transform points via an EmuMath Matrix, but only 4x4 float matrices transforming 3D float points are supported.");
+			}
+		}
+
+		/// <summary>
+		/// <para> Transforms count_ 3D float points stored as separate x, y, and z arrays by this Matrix, outputting to separate x, y, and z arrays. </para>
+		/// <para> Each point is treated as a column vector with an implied w of 1, in the form `this * point`. No perspective divide is performed. </para>
+		/// <para> This is only available for 4x4 float matrices. </para>
+		/// </summary>
+		/// <param name="p_in_x_">: Pointer to the first of count_ contiguous x coordinates to transform.</param>
+		/// <param name="p_in_y_">: Pointer to the first of count_ contiguous y coordinates to transform.</param>
+		/// <param name="p_in_z_">: Pointer to the first of count_ contiguous z coordinates to transform.</param>
+		/// <param name="p_out_x_">: Pointer to the first of count_ contiguous x coordinates to output to.</param>
+		/// <param name="p_out_y_">: Pointer to the first of count_ contiguous y coordinates to output to.</param>
+		/// <param name="p_out_z_">: Pointer to the first of count_ contiguous z coordinates to output to.</param>
+		/// <param name="count_">: Number of points to transform.</param>
+		template<typename PointT_ = float>
+		inline void TransformPoints
+		(
+			const PointT_* p_in_x_,
+			const PointT_* p_in_y_,
+			const PointT_* p_in_z_,
+			PointT_* p_out_x_,
+			PointT_* p_out_y_,
+			PointT_* p_out_z_,
+			std::size_t count_
+		) const
+		{
+			if constexpr (num_columns == 4 && num_rows == 4 && std::is_same_v<stored_type, float> && std::is_same_v<PointT_, float>)
+			{
+				EmuMath::Helpers::matrix_transform_points(*this, p_in_x_, p_in_y_, p_in_z_, p_out_x_, p_out_y_, p_out_z_, count_);
+			}
+			else
+			{
+				static_assert(EmuCore::TMP::get_false<PointT_>(), "Attempted to batch transform points via an EmuMath Matrix, but only 4x4 float matrices transforming 3D float points are supported.");
+			}
+		}
+#pragma endregion
+
 #pragma region STREAM_FUNCS
 		/// <summary>
 		/// <para> Appends this Matrix to the provided stream. </para>
@@ -589,6 +778,9 @@ namespace EmuMath
 #pragma endregion
 
 	private:
+		template<std::size_t OtherNumColumns_, std::size_t OtherNumRows_, typename OtherT_, bool OtherColumnMajor_>
+		friend struct Matrix;
+
 		matrix_vector_type _data;
 
 		template<std::size_t NonMajorIndex_, class Out_, std::size_t...MajorIndices_>
@@ -0,0 +1,404 @@
+#ifndef EMU_MATH_UNDERLYING_MATRIX_AFFINE_H_INC_
+#define EMU_MATH_UNDERLYING_MATRIX_AFFINE_H_INC_ 1
+
+#include "_matrix_tmp.h"
+#include "_matrix_transpose_underlying.h"
+#include "../../../Vector.h"
+#include "../../../../EmuCore/Functors/Arithmetic.h"
+#include "../../../../EmuSIMD/SIMDHelpers.h"
+#include <type_traits>
+
+namespace EmuMath::Helpers::_matrix_underlying
+{
+	/// <summary>
+	/// <para> Constructs a 4x4 Out_ matrix from 16 values provided in the order they are read when the matrix is written out, i.e. row by row. </para>
+	/// <para> This allows builders to be written in their textbook form regardless of the output Matrix's major order. </para>
+	/// </summary>
+	template<class Out_, typename T_>
+	[[nodiscard]] constexpr inline Out_ _make_4x4_from_rows
+	(
+		const T_& m00_, const T_& m10_, const T_& m20_, const T_& m30_,
+		const T_& m01_, const T_& m11_, const T_& m21_, const T_& m31_,
+		const T_& m02_, const T_& m12_, const T_& m22_, const T_& m32_,
+		const T_& m03_, const T_& m13_, const T_& m23_, const T_& m33_
+	)
+	{
+		if constexpr (Out_::is_column_major)
+		{
+			return Out_
+			(
+				m00_, m01_, m02_, m03_,
+				m10_, m11_, m12_, m13_,
+				m20_, m21_, m22_, m23_,
+				m30_, m31_, m32_, m33_
+			);
+		}
+		else
+		{
+			return Out_
+			(
+				m00_, m10_, m20_, m30_,
+				m01_, m11_, m21_, m31_,
+				m02_, m12_, m22_, m32_,
+				m03_, m13_, m23_, m33_
+			);
+		}
+	}
+
+#pragma region BUILDERS
+	template<class Out_, typename X_, typename Y_, typename Z_>
+	[[nodiscard]] constexpr inline Out_ _matrix_make_translation(const X_& x_, const Y_& y_, const Z_& z_)
+	{
+		using out_value = typename Out_::value_type_uq;
+		constexpr out_value zero_ = out_value(0);
+		constexpr out_value one_ = out_value(1);
+		return _make_4x4_from_rows<Out_, out_value>
+		(
+			one_, zero_, zero_, static_cast<out_value>(x_),
+			zero_, one_, zero_, static_cast<out_value>(y_),
+			zero_, zero_, one_, static_cast<out_value>(z_),
+			zero_, zero_, zero_, one_
+		);
+	}
+
+	template<class Out_, typename X_, typename Y_, typename Z_>
+	[[nodiscard]] constexpr inline Out_ _matrix_make_scale(const X_& x_, const Y_& y_, const Z_& z_)
+	{
+		using out_value = typename Out_::value_type_uq;
+		constexpr out_value zero_ = out_value(0);
+		constexpr out_value one_ = out_value(1);
+		return _make_4x4_from_rows<Out_, out_value>
+		(
+			static_cast<out_value>(x_), zero_, zero_, zero_,
+			zero_, static_cast<out_value>(y_), zero_, zero_,
+			zero_, zero_, static_cast<out_value>(z_), zero_,
+			zero_, zero_, zero_, one_
+		);
+	}
+
+	/// <summary> Builds a 4x4 matrix from the passed 3x3 rotation, provided row by row. </summary>
+	template<class Out_, typename T_>
+	[[nodiscard]] constexpr inline Out_ _matrix_make_rotation_from_3x3
+	(
+		const T_& m00_, const T_& m10_, const T_& m20_,
+		const T_& m01_, const T_& m11_, const T_& m21_,
+		const T_& m02_, const T_& m12_, const T_& m22_
+	)
+	{
+		constexpr T_ zero_ = T_(0);
+		return _make_4x4_from_rows<Out_, T_>
+		(
+			m00_, m10_, m20_, zero_,
+			m01_, m11_, m21_, zero_,
+			m02_, m12_, m22_, zero_,
+			zero_, zero_, zero_, T_(1)
+		);
+	}
+
+	template<class Out_, class Cos_, class Sin_, typename Angle_>
+	[[nodiscard]] constexpr inline Out_ _matrix_make_rotation_x(const Angle_& angle_rads_)
+	{
+		using out_value = typename Out_::value_type_uq;
+		const out_value cos_ = static_cast<out_value>(Cos_()(static_cast<out_value>(angle_rads_)));
+		const out_value sin_ = static_cast<out_value>(Sin_()(static_cast<out_value>(angle_rads_)));
+		constexpr out_value zero_ = out_value(0);
+		return _matrix_make_rotation_from_3x3<Out_, out_value>
+		(
+			out_value(1), zero_, zero_,
+			zero_, cos_, -sin_,
+			zero_, sin_, cos_
+		);
+	}
+
+	template<class Out_, class Cos_, class Sin_, typename Angle_>
+	[[nodiscard]] constexpr inline Out_ _matrix_make_rotation_y(const Angle_& angle_rads_)
+	{
+		using out_value = typename Out_::value_type_uq;
+		const out_value cos_ = static_cast<out_value>(Cos_()(static_cast<out_value>(angle_rads_)));
+		const out_value sin_ = static_cast<out_value>(Sin_()(static_cast<out_value>(angle_rads_)));
+		constexpr out_value zero_ = out_value(0);
+		return _matrix_make_rotation_from_3x3<Out_, out_value>
+		(
+			cos_, zero_, sin_,
+			zero_, out_value(1), zero_,
+			-sin_, zero_, cos_
+		);
+	}
+
+	template<class Out_, class Cos_, class Sin_, typename Angle_>
+	[[nodiscard]] constexpr inline Out_ _matrix_make_rotation_z(const Angle_& angle_rads_)
+	{
+		using out_value = typename Out_::value_type_uq;
+		const out_value cos_ = static_cast<out_value>(Cos_()(static_cast<out_value>(angle_rads_)));
+		const out_value sin_ = static_cast<out_value>(Sin_()(static_cast<out_value>(angle_rads_)));
+		constexpr out_value zero_ = out_value(0);
+		return _matrix_make_rotation_from_3x3<Out_, out_value>
+		(
+			cos_, -sin_, zero_,
+			sin_, cos_, zero_,
+			zero_, zero_, out_value(1)
+		);
+	}
+
+	/// <summary> Builds the rotation Z * Y * X, such that rotation about the X axis is applied first and rotation about the Z axis is applied last. </summary>
+	template<class Out_, class Cos_, class Sin_, typename X_, typename Y_, typename Z_>
+	[[nodiscard]] constexpr inline Out_ _matrix_make_rotation_euler(const X_& x_rads_, const Y_& y_rads_, const Z_& z_rads_)
+	{
+		using out_value = typename Out_::value_type_uq;
+		const out_value cx_ = static_cast<out_value>(Cos_()(static_cast<out_value>(x_rads_)));
+		const out_value sx_ = static_cast<out_value>(Sin_()(static_cast<out_value>(x_rads_)));
+		const out_value cy_ = static_cast<out_value>(Cos_()(static_cast<out_value>(y_rads_)));
+		const out_value sy_ = static_cast<out_value>(Sin_()(static_cast<out_value>(y_rads_)));
+		const out_value cz_ = static_cast<out_value>(Cos_()(static_cast<out_value>(z_rads_)));
+		const out_value sz_ = static_cast<out_value>(Sin_()(static_cast<out_value>(z_rads_)));
+		return _matrix_make_rotation_from_3x3<Out_, out_value>
+		(
+			cz_ * cy_, (cz_ * sy_ * sx_) - (sz_ * cx_), (cz_ * sy_ * cx_) + (sz_ * sx_),
+			sz_ * cy_, (sz_ * sy_ * sx_) + (cz_ * cx_), (sz_ * sy_ * cx_) - (cz_ * sx_),
+			-sy_, cy_ * sx_, cy_ * cx_
+		);
+	}
+
+	/// <summary>
+	/// <para> Builds a rotation of angle_rads_ about the passed axis_ via Rodrigues' rotation formula. </para>
+	/// <para> Only the x, y, and z elements of axis_ are used, and they are normalised via Sqrt_; any further elements (such as w) do not contribute to its length. </para>
+	/// </summary>
+	template<class Out_, class Cos_, class Sin_, class Sqrt_, std::size_t AxisSize_, typename AxisT_, typename Angle_>
+	[[nodiscard]] constexpr inline Out_ _matrix_make_rotation_axis_angle(const EmuMath::Vector<AxisSize_, AxisT_>& axis_, const Angle_& angle_rads_)
+	{
+		using out_value = typename Out_::value_type_uq;
+		const EmuMath::Vector<3, out_value> axis_xyz_ = EmuMath::Vector<3, out_value>
+		(
+			static_cast<out_value>(axis_.template AtTheoretical<0>()),
+			static_cast<out_value>(axis_.template AtTheoretical<1>()),
+			static_cast<out_value>(axis_.template AtTheoretical<2>())
+		);
+		const EmuMath::Vector<3, out_value> norm_axis_ = EmuMath::Helpers::_vector_underlying::_vector_normalise<Sqrt_, 3, out_value>(axis_xyz_);
+		const out_value x_ = norm_axis_.template at<0>();
+		const out_value y_ = norm_axis_.template at<1>();
+		const out_value z_ = norm_axis_.template at<2>();
+		const out_value cos_ = static_cast<out_value>(Cos_()(static_cast<out_value>(angle_rads_)));
+		const out_value sin_ = static_cast<out_value>(Sin_()(static_cast<out_value>(angle_rads_)));
+		const out_value t_ = out_value(1) - cos_;
+		return _matrix_make_rotation_from_3x3<Out_, out_value>
+		(
+			(t_ * x_ * x_) + cos_, (t_ * x_ * y_) - (sin_ * z_), (t_ * x_ * z_) + (sin_ * y_),
+			(t_ * x_ * y_) + (sin_ * z_), (t_ * y_ * y_) + cos_, (t_ * y_ * z_) - (sin_ * x_),
+			(t_ * x_ * z_) - (sin_ * y_), (t_ * y_ * z_) + (sin_ * x_), (t_ * z_ * z_) + cos_
+		);
+	}
+
+	/// <summary>
+	/// <para> Builds a right-handed view matrix positioned at eye_, facing target_, with the passed up_ direction. </para>
+	/// <para> The resulting view space looks down its negative Z axis. Directions are normalised via Sqrt_. </para>
+	/// </summary>
+	template<class Out_, class Sqrt_, std::size_t EyeSize_, typename EyeT_, std::size_t TargetSize_, typename TargetT_, std::size_t UpSize_, typename UpT_>
+	[[nodiscard]] constexpr inline Out_ _matrix_make_look_at
+	(
+		const EmuMath::Vector<EyeSize_, EyeT_>& eye_,
+		const EmuMath::Vector<TargetSize_, TargetT_>& target_,
+		const EmuMath::Vector<UpSize_, UpT_>& up_
+	)
+	{
+		using out_value = typename Out_::value_type_uq;
+		using vector3 = EmuMath::Vector<3, out_value>;
+		const vector3 eye_3_ = vector3
+		(
+			static_cast<out_value>(eye_.template AtTheoretical<0>()),
+			static_cast<out_value>(eye_.template AtTheoretical<1>()),
+			static_cast<out_value>(eye_.template AtTheoretical<2>())
+		);
+		const vector3 to_target_ = vector3
+		(
+			static_cast<out_value>(target_.template AtTheoretical<0>()) - eye_3_.template at<0>(),
+			static_cast<out_value>(target_.template AtTheoretical<1>()) - eye_3_.template at<1>(),
+			static_cast<out_value>(target_.template AtTheoretical<2>()) - eye_3_.template at<2>()
+		);
+
+		const vector3 forward_ = EmuMath::Helpers::_vector_underlying::_vector_normalise<Sqrt_, 3, out_value, 0, 3>(to_target_);
+		const vector3 side_ = EmuMath::Helpers::_vector_underlying::_vector_normalise<Sqrt_, 3, out_value, 0, 3>
+		(
+			EmuMath::Helpers::vector_cross_3d<3, out_value>(forward_, up_)
+		);
+		const vector3 up_ortho_ = EmuMath::Helpers::vector_cross_3d<3, out_value>(side_, forward_);
+
+		constexpr out_value zero_ = out_value(0);
+		return _make_4x4_from_rows<Out_, out_value>
+		(
+			side_.template at<0>(), side_.template at<1>(), side_.template at<2>(), -EmuMath::Helpers::vector_dot<out_value>(side_, eye_3_),
+			up_ortho_.template at<0>(), up_ortho_.template at<1>(), up_ortho_.template at<2>(), -EmuMath::Helpers::vector_dot<out_value>(up_ortho_, eye_3_),
+			-forward_.template at<0>(), -forward_.template at<1>(), -forward_.template at<2>(), EmuMath::Helpers::vector_dot<out_value>(forward_, eye_3_),
+			zero_, zero_, zero_, out_value(1)
+		);
+	}
+
+	/// <summary>
+	/// <para> Builds a right-handed perspective projection, mapping view-space depths of -near_ and -far_ to clip-space depths of 0 and 1 respectively. </para>
+	/// <para> The tangent of half of fov_y_rads_ is calculated via Tan_. </para>
+	/// </summary>
+	template<class Out_, class Tan_, typename Fov_, typename Aspect_, typename Near_, typename Far_>
+	[[nodiscard]] constexpr inline Out_ _matrix_make_perspective(const Fov_& fov_y_rads_, const Aspect_& aspect_ratio_, const Near_& near_, const Far_& far_)
+	{
+		using out_value = typename Out_::value_type_uq;
+		const out_value near_cast_ = static_cast<out_value>(near_);
+		const out_value far_cast_ = static_cast<out_value>(far_);
+		const out_value focal_length_ = out_value(1) / static_cast<out_value>(Tan_()(static_cast<out_value>(fov_y_rads_) * out_value(0.5)));
+		const out_value reciprocal_depth_range_ = out_value(1) / (near_cast_ - far_cast_);
+
+		constexpr out_value zero_ = out_value(0);
+		return _make_4x4_from_rows<Out_, out_value>
+		(
+			focal_length_ / static_cast<out_value>(aspect_ratio_), zero_, zero_, zero_,
+			zero_, focal_length_, zero_, zero_,
+			zero_, zero_, far_cast_ * reciprocal_depth_range_, near_cast_ * far_cast_ * reciprocal_depth_range_,
+			zero_, zero_, out_value(-1), zero_
+		);
+	}
+
+	/// <summary>
+	/// <para> Builds a right-handed orthographic projection of the passed view-space box, mapping view-space depths of -near_ and -far_ to clip-space depths of 0 and 1. </para>
+	/// </summary>
+	template<class Out_, typename Left_, typename Right_, typename Bottom_, typename Top_, typename Near_, typename Far_>
+	[[nodiscard]] constexpr inline Out_ _matrix_make_orthographic
+	(
+		const Left_& left_,
+		const Right_& right_,
+		const Bottom_& bottom_,
+		const Top_& top_,
+		const Near_& near_,
+		const Far_& far_
+	)
+	{
+		using out_value = typename Out_::value_type_uq;
+		const out_value left_cast_ = static_cast<out_value>(left_);
+		const out_value right_cast_ = static_cast<out_value>(right_);
+		const out_value bottom_cast_ = static_cast<out_value>(bottom_);
+		const out_value top_cast_ = static_cast<out_value>(top_);
+		const out_value near_cast_ = static_cast<out_value>(near_);
+		const out_value reciprocal_width_ = out_value(1) / (right_cast_ - left_cast_);
+		const out_value reciprocal_height_ = out_value(1) / (top_cast_ - bottom_cast_);
+		const out_value reciprocal_depth_range_ = out_value(1) / (near_cast_ - static_cast<out_value>(far_));
+
+		constexpr out_value zero_ = out_value(0);
+		return _make_4x4_from_rows<Out_, out_value>
+		(
+			out_value(2) * reciprocal_width_, zero_, zero_, -(right_cast_ + left_cast_) * reciprocal_width_,
+			zero_, out_value(2) * reciprocal_height_, zero_, -(top_cast_ + bottom_cast_) * reciprocal_height_,
+			zero_, zero_, reciprocal_depth_range_, near_cast_ * reciprocal_depth_range_,
+			zero_, zero_, zero_, out_value(1)
+		);
+	}
+#pragma endregion
+
+#pragma region AFFINE_INVERSE
+	/// <summary>
+	/// <para> Calculates the inverse of a column-major 4x4 float affine matrix, whose final row is assumed to be (0, 0, 0, 1). </para>
+	/// <para>
+	///		The rows of the inverted 3x3 linear part are formed from cross products of its columns, scaled by the reciprocal of the determinant.
+	///		The inverted translation is then -inverse(linear) * translation.
+	/// </para>
+	/// <para> No alignment is required of any pointer, and p_out_cm_ may be the same as p_in_cm_. </para>
+	/// </summary>
+	inline void _matrix_affine_inverse_4x4_cm_fp32(const float* p_in_cm_, float* p_out_cm_)
+	{
+		// The final row is assumed to be (0, 0, 0, 1), so w is explicitly cleared rather than relying on the cross products below to cancel it.
+		// Under FMA contraction, w*w - w*w leaves the rounding error of a single product, which would otherwise leak into the determinant.
+		const __m128 zero_ = EmuSIMD::setzero<__m128>();
+		__m128 column_0_ = EmuSIMD::blend<false, false, false, true>(EmuSIMD::load_unaligned<__m128>(p_in_cm_), zero_);
+		__m128 column_1_ = EmuSIMD::blend<false, false, false, true>(EmuSIMD::load_unaligned<__m128>(p_in_cm_ + 4), zero_);
+		__m128 column_2_ = EmuSIMD::blend<false, false, false, true>(EmuSIMD::load_unaligned<__m128>(p_in_cm_ + 8), zero_);
+		__m128 translation_ = EmuSIMD::load_unaligned<__m128>(p_in_cm_ + 12);
+
+		__m128 row_0_ = EmuSIMD::fmsub
+		(
+			EmuSIMD::shuffle<1, 2, 0, 3>(column_1_),
+			EmuSIMD::shuffle<2, 0, 1, 3>(column_2_),
+			EmuSIMD::mul_all(EmuSIMD::shuffle<2, 0, 1, 3>(column_1_), EmuSIMD::shuffle<1, 2, 0, 3>(column_2_))
+		);
+		__m128 row_1_ = EmuSIMD::fmsub
+		(
+			EmuSIMD::shuffle<1, 2, 0, 3>(column_2_),
+			EmuSIMD::shuffle<2, 0, 1, 3>(column_0_),
+			EmuSIMD::mul_all(EmuSIMD::shuffle<2, 0, 1, 3>(column_2_), EmuSIMD::shuffle<1, 2, 0, 3>(column_0_))
+		);
+		__m128 row_2_ = EmuSIMD::fmsub
+		(
+			EmuSIMD::shuffle<1, 2, 0, 3>(column_0_),
+			EmuSIMD::shuffle<2, 0, 1, 3>(column_1_),
+			EmuSIMD::mul_all(EmuSIMD::shuffle<2, 0, 1, 3>(column_0_), EmuSIMD::shuffle<1, 2, 0, 3>(column_1_))
+		);
+
+		__m128 reciprocal_determinant_ = EmuSIMD::div(EmuSIMD::set1<__m128>(1.0f), EmuSIMD::dot_fill(column_0_, row_0_));
+		row_0_ = EmuSIMD::mul_all(row_0_, reciprocal_determinant_);
+		row_1_ = EmuSIMD::mul_all(row_1_, reciprocal_determinant_);
+		row_2_ = EmuSIMD::mul_all(row_2_, reciprocal_determinant_);
+
+		// Transpose the 3 rows (plus a zero row) into the first 3 output columns, whose w elements therefore come directly from the zero row
+		__m128 row_3_ = zero_;
+		__m128 low_01_ = EmuSIMD::shuffle<0, 1, 0, 1>(row_0_, row_1_);
+		__m128 low_23_ = EmuSIMD::shuffle<0, 1, 0, 1>(row_2_, row_3_);
+		__m128 high_01_ = EmuSIMD::shuffle<2, 3, 2, 3>(row_0_, row_1_);
+		__m128 high_23_ = EmuSIMD::shuffle<2, 3, 2, 3>(row_2_, row_3_);
+		column_0_ = EmuSIMD::shuffle<0, 2, 0, 2>(low_01_, low_23_);
+		column_1_ = EmuSIMD::shuffle<1, 3, 1, 3>(low_01_, low_23_);
+		column_2_ = EmuSIMD::shuffle<0, 2, 0, 2>(high_01_, high_23_);
+
+		__m128 out_translation_ = EmuSIMD::mul_all(column_0_, EmuSIMD::shuffle<0, 0, 0, 0>(translation_));
+		out_translation_ = EmuSIMD::fmadd(column_1_, EmuSIMD::shuffle<1, 1, 1, 1>(translation_), out_translation_);
+		out_translation_ = EmuSIMD::fmadd(column_2_, EmuSIMD::shuffle<2, 2, 2, 2>(translation_), out_translation_);
+		out_translation_ = EmuSIMD::blend<false, false, false, true>(EmuSIMD::sub(zero_, out_translation_), EmuSIMD::set1<__m128>(1.0f));
+
+		EmuSIMD::store_unaligned(column_0_, p_out_cm_);
+		EmuSIMD::store_unaligned(column_1_, p_out_cm_ + 4);
+		EmuSIMD::store_unaligned(column_2_, p_out_cm_ + 8);
+		EmuSIMD::store_unaligned(out_translation_, p_out_cm_ + 12);
+	}
+
+	template<class Out_, class In_>
+	[[nodiscard]] constexpr inline Out_ _matrix_affine_inverse_generic(const In_& in_)
+	{
+		using out_value = typename Out_::value_type_uq;
+		const out_value a_ = static_cast<out_value>(in_.template at<0, 0>()), b_ = static_cast<out_value>(in_.template at<1, 0>()), c_ = static_cast<out_value>(in_.template at<2, 0>());
+		const out_value d_ = static_cast<out_value>(in_.template at<0, 1>()), e_ = static_cast<out_value>(in_.template at<1, 1>()), f_ = static_cast<out_value>(in_.template at<2, 1>());
+		const out_value g_ = static_cast<out_value>(in_.template at<0, 2>()), h_ = static_cast<out_value>(in_.template at<1, 2>()), i_ = static_cast<out_value>(in_.template at<2, 2>());
+		const out_value tx_ = static_cast<out_value>(in_.template at<3, 0>());
+		const out_value ty_ = static_cast<out_value>(in_.template at<3, 1>());
+		const out_value tz_ = static_cast<out_value>(in_.template at<3, 2>());
+
+		const out_value cofactor_a_ = e_ * i_ - f_ * h_;
+		const out_value cofactor_d_ = c_ * h_ - b_ * i_;
+		const out_value cofactor_g_ = b_ * f_ - c_ * e_;
+		const out_value reciprocal_ = out_value(1) / ((a_ * cofactor_a_) + (d_ * cofactor_d_) + (g_ * cofactor_g_));
+
+		const out_value r00_ = cofactor_a_ * reciprocal_, r10_ = cofactor_d_ * reciprocal_, r20_ = cofactor_g_ * reciprocal_;
+		const out_value r01_ = (f_ * g_ - d_ * i_) * reciprocal_, r11_ = (a_ * i_ - c_ * g_) * reciprocal_, r21_ = (c_ * d_ - a_ * f_) * reciprocal_;
+		const out_value r02_ = (d_ * h_ - e_ * g_) * reciprocal_, r12_ = (b_ * g_ - a_ * h_) * reciprocal_, r22_ = (a_ * e_ - b_ * d_) * reciprocal_;
+
+		constexpr out_value zero_ = out_value(0);
+		return _make_4x4_from_rows<Out_, out_value>
+		(
+			r00_, r10_, r20_, -((r00_ * tx_) + (r10_ * ty_) + (r20_ * tz_)),
+			r01_, r11_, r21_, -((r01_ * tx_) + (r11_ * ty_) + (r21_ * tz_)),
+			r02_, r12_, r22_, -((r02_ * tx_) + (r12_ * ty_) + (r22_ * tz_)),
+			zero_, zero_, zero_, out_value(1)
+		);
+	}
+
+	template<class Out_, class In_>
+	[[nodiscard]] constexpr inline Out_ _matrix_affine_inverse(const In_& in_)
+	{
+		if constexpr (_matrix_square_4x4_fp32_is_valid<Out_, In_>() && Out_::is_column_major)
+		{
+			Out_ out_ = Out_();
+			_matrix_affine_inverse_4x4_cm_fp32(in_.data(), out_.data());
+			return out_;
+		}
+		else
+		{
+			return _matrix_affine_inverse_generic<Out_>(in_);
+		}
+	}
+#pragma endregion
+}
+
+#endif
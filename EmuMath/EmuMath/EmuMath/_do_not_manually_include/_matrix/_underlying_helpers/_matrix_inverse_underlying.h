@@ -0,0 +1,387 @@
+#ifndef EMU_MATH_UNDERLYING_MATRIX_INVERSE_H_INC_
+#define EMU_MATH_UNDERLYING_MATRIX_INVERSE_H_INC_ 1
+
+#include "_matrix_tmp.h"
+#include "_matrix_transpose_underlying.h"
+#include "../../../../EmuSIMD/SIMDHelpers.h"
+#include <array>
+#include <type_traits>
+
+namespace EmuMath::Helpers::_matrix_underlying
+{
+#pragma region SIMD_4X4_FP32
+	/// <summary>
+	/// <para> Loads the four 2x2 blocks of a 4x4 float matrix from 16 contiguous floats, where each output block is itself a contiguously column-major 2x2 matrix. </para>
+	/// <para> The matrix is partitioned as [[A, B], [C, D]], with A in the top-left and D in the bottom-right. </para>
+	/// <para> Also outputs the determinants of each block, in the order [det(A), det(C), det(B), det(D)]. </para>
+	/// </summary>
+	inline void _matrix_load_4x4_fp32_blocks(const float* p_in_, __m128& a_, __m128& b_, __m128& c_, __m128& d_, __m128& block_determinants_)
+	{
+		__m128 column_0_ = EmuSIMD::load_unaligned<__m128>(p_in_);
+		__m128 column_1_ = EmuSIMD::load_unaligned<__m128>(p_in_ + 4);
+		__m128 column_2_ = EmuSIMD::load_unaligned<__m128>(p_in_ + 8);
+		__m128 column_3_ = EmuSIMD::load_unaligned<__m128>(p_in_ + 12);
+
+		a_ = EmuSIMD::shuffle<0, 1, 0, 1>(column_0_, column_1_);
+		c_ = EmuSIMD::shuffle<2, 3, 2, 3>(column_0_, column_1_);
+		b_ = EmuSIMD::shuffle<0, 1, 0, 1>(column_2_, column_3_);
+		d_ = EmuSIMD::shuffle<2, 3, 2, 3>(column_2_, column_3_);
+
+		block_determinants_ = EmuSIMD::sub
+		(
+			EmuSIMD::mul_all(EmuSIMD::shuffle<0, 2, 0, 2>(column_0_, column_2_), EmuSIMD::shuffle<1, 3, 1, 3>(column_1_, column_3_)),
+			EmuSIMD::mul_all(EmuSIMD::shuffle<1, 3, 1, 3>(column_0_, column_2_), EmuSIMD::shuffle<0, 2, 0, 2>(column_1_, column_3_))
+		);
+	}
+
+	/// <summary>
+	/// <para> Calculates the determinant of a 4x4 matrix from its 2x2 blocks, as loaded by _matrix_load_4x4_fp32_blocks. </para>
+	/// <para> The determinant is given as det(A)det(D) + det(B)det(C) - tr(adj(A)B adj(D)C), and is output in every element of the returned register. </para>
+	/// </summary>
+	[[nodiscard]] inline __m128 _matrix_determinant_4x4_fp32_from_blocks(__m128 block_determinants_, __m128 adj_a_b_, __m128 adj_d_c_)
+	{
+		__m128 determinant_ = EmuSIMD::mul_all(EmuSIMD::shuffle<0, 0, 0, 0>(block_determinants_), EmuSIMD::shuffle<3, 3, 3, 3>(block_determinants_));
+		determinant_ = EmuSIMD::fmadd(EmuSIMD::shuffle<2, 2, 2, 2>(block_determinants_), EmuSIMD::shuffle<1, 1, 1, 1>(block_determinants_), determinant_);
+		__m128 trace_ = EmuSIMD::mul_all(adj_a_b_, EmuSIMD::shuffle<0, 2, 1, 3>(adj_d_c_));
+		trace_ = EmuSIMD::add(trace_, EmuSIMD::shuffle<1, 0, 3, 2>(trace_));
+		trace_ = EmuSIMD::add(trace_, EmuSIMD::shuffle<2, 3, 0, 1>(trace_));
+		return EmuSIMD::sub(determinant_, trace_);
+	}
+
+	/// <summary>
+	/// <para> Calculates the determinant of a 4x4 matrix represented by 16 contiguous floats. </para>
+	/// <para> As det(M) == det(transpose(M)), the major order of the input data does not affect the result. </para>
+	/// </summary>
+	[[nodiscard]] inline float _matrix_determinant_4x4_fp32(const float* p_in_)
+	{
+		__m128 a_, b_, c_, d_, block_determinants_;
+		_matrix_load_4x4_fp32_blocks(p_in_, a_, b_, c_, d_, block_determinants_);
+		__m128 determinant_ = _matrix_determinant_4x4_fp32_from_blocks
+		(
+			block_determinants_,
+			EmuSIMD::matrix_2x2_multiply_adj_norm_cm(a_, b_),
+			EmuSIMD::matrix_2x2_multiply_adj_norm_cm(d_, c_)
+		);
+		return EmuSIMD::get_index<0, float>(determinant_);
+	}
+
+	/// <summary>
+	/// <para> Calculates the inverse of a 4x4 matrix represented by 16 contiguous floats, outputting it as 16 contiguous floats in the same major order. </para>
+	/// <para>
+	///		Uses a branch-free blockwise cofactor expansion built on 2x2 adjugate multiplications.
+	///		As inverse(transpose(M)) == transpose(inverse(M)), the same kernel is valid for both column-major and row-major data.
+	/// </para>
+	/// <para> No check is made for a singular input, which will produce non-finite outputs. No alignment is required, and p_out_ may be the same as p_in_. </para>
+	/// </summary>
+	/// <returns>Determinant of the input matrix.</returns>
+	inline float _matrix_inverse_4x4_fp32(const float* p_in_, float* p_out_)
+	{
+		__m128 a_, b_, c_, d_, block_determinants_;
+		_matrix_load_4x4_fp32_blocks(p_in_, a_, b_, c_, d_, block_determinants_);
+
+		__m128 adj_a_b_ = EmuSIMD::matrix_2x2_multiply_adj_norm_cm(a_, b_);
+		__m128 adj_d_c_ = EmuSIMD::matrix_2x2_multiply_adj_norm_cm(d_, c_);
+		__m128 determinant_ = _matrix_determinant_4x4_fp32_from_blocks(block_determinants_, adj_a_b_, adj_d_c_);
+
+		// Blocks of the inverse before their adjugates are taken and the determinant is divided out
+		__m128 x_ = EmuSIMD::sub(EmuSIMD::mul_all(EmuSIMD::shuffle<3, 3, 3, 3>(block_determinants_), a_), EmuSIMD::matrix_2x2_multiply_cm(b_, adj_d_c_));
+		__m128 w_ = EmuSIMD::sub(EmuSIMD::mul_all(EmuSIMD::shuffle<0, 0, 0, 0>(block_determinants_), d_), EmuSIMD::matrix_2x2_multiply_cm(c_, adj_a_b_));
+		__m128 y_ = EmuSIMD::sub(EmuSIMD::mul_all(EmuSIMD::shuffle<2, 2, 2, 2>(block_determinants_), c_), EmuSIMD::matrix_2x2_multiply_norm_adj_cm(d_, adj_a_b_));
+		__m128 z_ = EmuSIMD::sub(EmuSIMD::mul_all(EmuSIMD::shuffle<1, 1, 1, 1>(block_determinants_), b_), EmuSIMD::matrix_2x2_multiply_norm_adj_cm(a_, adj_d_c_));
+
+		// Negating the off-diagonal of each block here allows the adjugates to be formed by the output shuffles alone
+		__m128 reciprocal_ = EmuSIMD::div(EmuSIMD::setr<__m128>(1.0f, -1.0f, -1.0f, 1.0f), determinant_);
+		x_ = EmuSIMD::mul_all(x_, reciprocal_);
+		y_ = EmuSIMD::mul_all(y_, reciprocal_);
+		z_ = EmuSIMD::mul_all(z_, reciprocal_);
+		w_ = EmuSIMD::mul_all(w_, reciprocal_);
+
+		EmuSIMD::store_unaligned(EmuSIMD::shuffle<3, 1, 3, 1>(x_, z_), p_out_);
+		EmuSIMD::store_unaligned(EmuSIMD::shuffle<2, 0, 2, 0>(x_, z_), p_out_ + 4);
+		EmuSIMD::store_unaligned(EmuSIMD::shuffle<3, 1, 3, 1>(y_, w_), p_out_ + 8);
+		EmuSIMD::store_unaligned(EmuSIMD::shuffle<2, 0, 2, 0>(y_, w_), p_out_ + 12);
+		return EmuSIMD::get_index<0, float>(determinant_);
+	}
+#pragma endregion
+
+#pragma region GENERIC_FUNCS
+	/// <summary> Contiguously column-major array of OutT_ values representing a square matrix of size Size_ x Size_. </summary>
+	template<typename OutT_, std::size_t Size_>
+	using _square_matrix_cm_array = std::array<OutT_, Size_ * Size_>;
+
+	template<class Out_, typename OutT_, std::size_t Size_, std::size_t...OutFlattenedIndices_>
+	[[nodiscard]] constexpr inline Out_ _matrix_from_cm_array(const _square_matrix_cm_array<OutT_, Size_>& cm_array_, std::index_sequence<OutFlattenedIndices_...>)
+	{
+		// Arguments to construct a Matrix are taken in major order, so flattened indices are remapped here for row-major outputs
+		if constexpr (Out_::is_column_major)
+		{
+			return Out_(cm_array_[OutFlattenedIndices_]...);
+		}
+		else
+		{
+			return Out_(cm_array_[((OutFlattenedIndices_ % Size_) * Size_) + (OutFlattenedIndices_ / Size_)]...);
+		}
+	}
+
+	template<typename OutT_, class In_>
+	[[nodiscard]] constexpr inline _square_matrix_cm_array<OutT_, In_::num_columns> _matrix_to_cm_array(const In_& in_)
+	{
+		constexpr std::size_t size_ = In_::num_columns;
+		_square_matrix_cm_array<OutT_, size_> out_ = {};
+		for (std::size_t column_ = 0; column_ < size_; ++column_)
+		{
+			for (std::size_t row_ = 0; row_ < size_; ++row_)
+			{
+				out_[(column_ * size_) + row_] = static_cast<OutT_>(in_(column_, row_));
+			}
+		}
+		return out_;
+	}
+
+	template<typename T_>
+	[[nodiscard]] constexpr inline T_ _matrix_lu_abs(const T_& val_)
+	{
+		return val_ < T_(0) ? -val_ : val_;
+	}
+
+	/// <summary>
+	/// <para> In-place LU decomposition with partial pivoting of a square matrix, such that PA = LU. </para>
+	/// <para> L is unit lower-triangular and stored beneath the diagonal; U is stored on and above the diagonal. </para>
+	/// </summary>
+	template<typename T_, std::size_t Size_>
+	struct _matrix_lu_decomposition
+	{
+		constexpr _matrix_lu_decomposition(const _square_matrix_cm_array<T_, Size_>& in_) : lu(in_), permutation(), odd_permutation(false)
+		{
+			for (std::size_t i_ = 0; i_ < Size_; ++i_)
+			{
+				permutation[i_] = i_;
+			}
+
+			for (std::size_t k_ = 0; k_ < Size_; ++k_)
+			{
+				std::size_t pivot_row_ = k_;
+				T_ pivot_magnitude_ = _matrix_lu_abs(At(k_, k_));
+				for (std::size_t row_ = k_ + 1; row_ < Size_; ++row_)
+				{
+					T_ magnitude_ = _matrix_lu_abs(At(k_, row_));
+					if (magnitude_ > pivot_magnitude_)
+					{
+						pivot_magnitude_ = magnitude_;
+						pivot_row_ = row_;
+					}
+				}
+
+				if (pivot_row_ != k_)
+				{
+					for (std::size_t column_ = 0; column_ < Size_; ++column_)
+					{
+						T_ temp_ = At(column_, k_);
+						At(column_, k_) = At(column_, pivot_row_);
+						At(column_, pivot_row_) = temp_;
+					}
+					std::size_t temp_index_ = permutation[k_];
+					permutation[k_] = permutation[pivot_row_];
+					permutation[pivot_row_] = temp_index_;
+					odd_permutation = !odd_permutation;
+				}
+
+				// A zero pivot means the matrix is singular; U retains the zero so that the determinant correctly evaluates to 0
+				const T_ pivot_ = At(k_, k_);
+				if (pivot_ != T_(0))
+				{
+					for (std::size_t row_ = k_ + 1; row_ < Size_; ++row_)
+					{
+						At(k_, row_) /= pivot_;
+						const T_ factor_ = At(k_, row_);
+						for (std::size_t column_ = k_ + 1; column_ < Size_; ++column_)
+						{
+							At(column_, row_) -= factor_ * At(column_, k_);
+						}
+					}
+				}
+			}
+		}
+
+		[[nodiscard]] constexpr inline T_& At(std::size_t column_, std::size_t row_)
+		{
+			return lu[(column_ * Size_) + row_];
+		}
+
+		[[nodiscard]] constexpr inline const T_& At(std::size_t column_, std::size_t row_) const
+		{
+			return lu[(column_ * Size_) + row_];
+		}
+
+		[[nodiscard]] constexpr inline T_ Determinant() const
+		{
+			T_ out_ = odd_permutation ? T_(-1) : T_(1);
+			for (std::size_t i_ = 0; i_ < Size_; ++i_)
+			{
+				out_ *= At(i_, i_);
+			}
+			return out_;
+		}
+
+		/// <summary> Solves for each column of the identity matrix via forward and back substitution, producing the column-major inverse. </summary>
+		[[nodiscard]] constexpr inline _square_matrix_cm_array<T_, Size_> Inverse() const
+		{
+			_square_matrix_cm_array<T_, Size_> out_ = {};
+			for (std::size_t identity_column_ = 0; identity_column_ < Size_; ++identity_column_)
+			{
+				T_* p_x_ = out_.data() + (identity_column_ * Size_);
+				for (std::size_t row_ = 0; row_ < Size_; ++row_)
+				{
+					T_ y_ = (permutation[row_] == identity_column_) ? T_(1) : T_(0);
+					for (std::size_t k_ = 0; k_ < row_; ++k_)
+					{
+						y_ -= At(k_, row_) * p_x_[k_];
+					}
+					p_x_[row_] = y_;
+				}
+
+				for (std::size_t i_ = Size_; i_ > 0; --i_)
+				{
+					const std::size_t row_ = i_ - 1;
+					T_ x_ = p_x_[row_];
+					for (std::size_t k_ = row_ + 1; k_ < Size_; ++k_)
+					{
+						x_ -= At(k_, row_) * p_x_[k_];
+					}
+					p_x_[row_] = x_ / At(row_, row_);
+				}
+			}
+			return out_;
+		}
+
+		_square_matrix_cm_array<T_, Size_> lu;
+		std::array<std::size_t, Size_> permutation;
+		bool odd_permutation;
+	};
+
+	template<typename OutT_, class In_>
+	[[nodiscard]] constexpr inline OutT_ _matrix_determinant_2x2(const In_& in_)
+	{
+		return
+		(
+			static_cast<OutT_>(in_.template at<0, 0>()) * static_cast<OutT_>(in_.template at<1, 1>()) -
+			static_cast<OutT_>(in_.template at<1, 0>()) * static_cast<OutT_>(in_.template at<0, 1>())
+		);
+	}
+
+	template<typename OutT_, class In_>
+	[[nodiscard]] constexpr inline OutT_ _matrix_determinant_3x3(const In_& in_)
+	{
+		const OutT_ a_ = static_cast<OutT_>(in_.template at<0, 0>()), b_ = static_cast<OutT_>(in_.template at<1, 0>()), c_ = static_cast<OutT_>(in_.template at<2, 0>());
+		const OutT_ d_ = static_cast<OutT_>(in_.template at<0, 1>()), e_ = static_cast<OutT_>(in_.template at<1, 1>()), f_ = static_cast<OutT_>(in_.template at<2, 1>());
+		const OutT_ g_ = static_cast<OutT_>(in_.template at<0, 2>()), h_ = static_cast<OutT_>(in_.template at<1, 2>()), i_ = static_cast<OutT_>(in_.template at<2, 2>());
+		return (a_ * (e_ * i_ - f_ * h_)) - (b_ * (d_ * i_ - f_ * g_)) + (c_ * (d_ * h_ - e_ * g_));
+	}
+
+	template<typename OutT_, class In_>
+	[[nodiscard]] constexpr inline _square_matrix_cm_array<OutT_, 2> _matrix_inverse_2x2(const In_& in_, OutT_& out_determinant_)
+	{
+		out_determinant_ = _matrix_determinant_2x2<OutT_>(in_);
+		const OutT_ reciprocal_ = OutT_(1) / out_determinant_;
+		return _square_matrix_cm_array<OutT_, 2>
+		({
+			static_cast<OutT_>(in_.template at<1, 1>()) * reciprocal_,
+			-static_cast<OutT_>(in_.template at<0, 1>()) * reciprocal_,
+			-static_cast<OutT_>(in_.template at<1, 0>()) * reciprocal_,
+			static_cast<OutT_>(in_.template at<0, 0>()) * reciprocal_
+		});
+	}
+
+	template<typename OutT_, class In_>
+	[[nodiscard]] constexpr inline _square_matrix_cm_array<OutT_, 3> _matrix_inverse_3x3(const In_& in_, OutT_& out_determinant_)
+	{
+		// Named by row-major position: [[a, b, c], [d, e, f], [g, h, i]]
+		const OutT_ a_ = static_cast<OutT_>(in_.template at<0, 0>()), b_ = static_cast<OutT_>(in_.template at<1, 0>()), c_ = static_cast<OutT_>(in_.template at<2, 0>());
+		const OutT_ d_ = static_cast<OutT_>(in_.template at<0, 1>()), e_ = static_cast<OutT_>(in_.template at<1, 1>()), f_ = static_cast<OutT_>(in_.template at<2, 1>());
+		const OutT_ g_ = static_cast<OutT_>(in_.template at<0, 2>()), h_ = static_cast<OutT_>(in_.template at<1, 2>()), i_ = static_cast<OutT_>(in_.template at<2, 2>());
+
+		const OutT_ cofactor_a_ = e_ * i_ - f_ * h_;
+		const OutT_ cofactor_d_ = c_ * h_ - b_ * i_;
+		const OutT_ cofactor_g_ = b_ * f_ - c_ * e_;
+		out_determinant_ = (a_ * cofactor_a_) + (d_ * cofactor_d_) + (g_ * cofactor_g_);
+		const OutT_ reciprocal_ = OutT_(1) / out_determinant_;
+
+		return _square_matrix_cm_array<OutT_, 3>
+		({
+			cofactor_a_ * reciprocal_, (f_ * g_ - d_ * i_) * reciprocal_, (d_ * h_ - e_ * g_) * reciprocal_,
+			cofactor_d_ * reciprocal_, (a_ * i_ - c_ * g_) * reciprocal_, (b_ * g_ - a_ * h_) * reciprocal_,
+			cofactor_g_ * reciprocal_, (c_ * d_ - a_ * f_) * reciprocal_, (a_ * e_ - b_ * d_) * reciprocal_
+		});
+	}
+
+	template<typename OutT_, class In_>
+	[[nodiscard]] constexpr inline _square_matrix_cm_array<OutT_, In_::num_columns> _matrix_inverse_generic(const In_& in_, OutT_& out_determinant_)
+	{
+		if constexpr (In_::num_columns == 1)
+		{
+			out_determinant_ = static_cast<OutT_>(in_.template at<0, 0>());
+			return _square_matrix_cm_array<OutT_, 1>({ OutT_(1) / out_determinant_ });
+		}
+		else if constexpr (In_::num_columns == 2)
+		{
+			return _matrix_inverse_2x2<OutT_>(in_, out_determinant_);
+		}
+		else if constexpr (In_::num_columns == 3)
+		{
+			return _matrix_inverse_3x3<OutT_>(in_, out_determinant_);
+		}
+		else
+		{
+			const _matrix_lu_decomposition<OutT_, In_::num_columns> lu_(_matrix_to_cm_array<OutT_>(in_));
+			out_determinant_ = lu_.Determinant();
+			return lu_.Inverse();
+		}
+	}
+#pragma endregion
+
+	template<typename OutT_, class In_>
+	[[nodiscard]] constexpr inline OutT_ _matrix_determinant(const In_& in_)
+	{
+		if constexpr (In_::num_columns == 1)
+		{
+			return static_cast<OutT_>(in_.template at<0, 0>());
+		}
+		else if constexpr (In_::num_columns == 2)
+		{
+			return _matrix_determinant_2x2<OutT_>(in_);
+		}
+		else if constexpr (In_::num_columns == 3)
+		{
+			return _matrix_determinant_3x3<OutT_>(in_);
+		}
+		else if constexpr (In_::num_columns == 4 && std::is_same_v<typename In_::stored_type, float> && std::is_same_v<OutT_, float>)
+		{
+			return _matrix_determinant_4x4_fp32(in_.data());
+		}
+		else
+		{
+			return _matrix_lu_decomposition<OutT_, In_::num_columns>(_matrix_to_cm_array<OutT_>(in_)).Determinant();
+		}
+	}
+
+	template<class Out_, typename OutDeterminant_, class In_>
+	[[nodiscard]] constexpr inline Out_ _matrix_inverse(const In_& in_, OutDeterminant_& out_determinant_)
+	{
+		if constexpr (_matrix_square_4x4_fp32_is_valid<Out_, In_>())
+		{
+			Out_ out_ = Out_();
+			out_determinant_ = static_cast<OutDeterminant_>(_matrix_inverse_4x4_fp32(in_.data(), out_.data()));
+			return out_;
+		}
+		else
+		{
+			using out_value = typename Out_::value_type_uq;
+			out_value determinant_ = out_value();
+			const auto inverse_cm_ = _matrix_inverse_generic<out_value>(in_, determinant_);
+			out_determinant_ = static_cast<OutDeterminant_>(determinant_);
+			return _matrix_from_cm_array<Out_, out_value, Out_::num_columns>(inverse_cm_, std::make_index_sequence<Out_::size>());
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,195 @@
+#ifndef EMU_MATH_UNDERLYING_MATRIX_MULTIPLY_H_INC_
+#define EMU_MATH_UNDERLYING_MATRIX_MULTIPLY_H_INC_ 1
+
+#include "_matrix_tmp.h"
+#include "../../../../EmuSIMD/SIMDHelpers.h"
+#include <type_traits>
+
+namespace EmuMath::Helpers::_matrix_underlying
+{
+	/// <summary>
+	/// <para> Determines if the fast SIMD 4x4 kernel may be used to multiply the provided Lhs_ and Rhs_ matrices, outputting to the provided Out_ matrix. </para>
+	/// <para> This is only the case if all matrices are non-reference 4x4 float matrices sharing the same major order. </para>
+	/// </summary>
+	template<class Out_, class Lhs_, class Rhs_>
+	[[nodiscard]] constexpr inline bool _matrix_multiply_4x4_fp32_is_valid()
+	{
+		using out_uq = EmuCore::TMP::remove_ref_cv_t<Out_>;
+		using lhs_uq = EmuCore::TMP::remove_ref_cv_t<Lhs_>;
+		using rhs_uq = EmuCore::TMP::remove_ref_cv_t<Rhs_>;
+		return
+		(
+			(out_uq::num_columns == 4 && out_uq::num_rows == 4 && std::is_same_v<typename out_uq::stored_type, float>) &&
+			(lhs_uq::num_columns == 4 && lhs_uq::num_rows == 4 && std::is_same_v<typename lhs_uq::stored_type, float>) &&
+			(rhs_uq::num_columns == 4 && rhs_uq::num_rows == 4 && std::is_same_v<typename rhs_uq::stored_type, float>) &&
+			(out_uq::is_column_major == lhs_uq::is_column_major) &&
+			(out_uq::is_column_major == rhs_uq::is_column_major)
+		);
+	}
+
+	/// <summary>
+	/// <para> Multiplies two contiguously column-major 4x4 float matrices, outputting the column-major result to p_out_. </para>
+	/// <para> Each output column is formed as a weighted sum of lhs columns, where the weights are broadcast from the respective rhs column. </para>
+	/// <para> No alignment is required of any pointer, but p_out_ must not overlap with either input. </para>
+	/// </summary>
+	/// <param name="p_lhs_cm_">Pointer to the 16 contiguous column-major elements of the left-hand matrix.</param>
+	/// <param name="p_rhs_cm_">Pointer to the 16 contiguous column-major elements of the right-hand matrix.</param>
+	/// <param name="p_out_cm_">Pointer to the 16 contiguous column-major elements to output to.</param>
+	inline void _matrix_multiply_4x4_cm_fp32(const float* p_lhs_cm_, const float* p_rhs_cm_, float* p_out_cm_)
+	{
+		__m128 lhs_0_ = EmuSIMD::load_unaligned<__m128>(p_lhs_cm_);
+		__m128 lhs_1_ = EmuSIMD::load_unaligned<__m128>(p_lhs_cm_ + 4);
+		__m128 lhs_2_ = EmuSIMD::load_unaligned<__m128>(p_lhs_cm_ + 8);
+		__m128 lhs_3_ = EmuSIMD::load_unaligned<__m128>(p_lhs_cm_ + 12);
+
+		for (std::size_t offset_ = 0; offset_ < 16; offset_ += 4)
+		{
+			__m128 rhs_column_ = EmuSIMD::load_unaligned<__m128>(p_rhs_cm_ + offset_);
+			__m128 out_column_ = EmuSIMD::mul_all(lhs_0_, EmuSIMD::shuffle<0, 0, 0, 0>(rhs_column_));
+			out_column_ = EmuSIMD::fmadd(lhs_1_, EmuSIMD::shuffle<1, 1, 1, 1>(rhs_column_), out_column_);
+			out_column_ = EmuSIMD::fmadd(lhs_2_, EmuSIMD::shuffle<2, 2, 2, 2>(rhs_column_), out_column_);
+			out_column_ = EmuSIMD::fmadd(lhs_3_, EmuSIMD::shuffle<3, 3, 3, 3>(rhs_column_), out_column_);
+			EmuSIMD::store_unaligned(out_column_, p_out_cm_ + offset_);
+		}
+	}
+
+	/// <summary>
+	/// <para> Multiplies a contiguously column-major 4x4 float matrix by a 4-element column vector, outputting the 4-element result to p_out_. </para>
+	/// <para> No alignment is required of any pointer. </para>
+	/// </summary>
+	/// <param name="p_lhs_cm_">Pointer to the 16 contiguous column-major elements of the matrix.</param>
+	/// <param name="vector_">SIMD register containing the column vector, where index 0 is the lowest element.</param>
+	/// <returns>SIMD register containing the result of the multiplication.</returns>
+	[[nodiscard]] inline __m128 _matrix_multiply_4x4_cm_fp32_vector(const float* p_lhs_cm_, __m128 vector_)
+	{
+		__m128 out_ = EmuSIMD::mul_all(EmuSIMD::load_unaligned<__m128>(p_lhs_cm_), EmuSIMD::shuffle<0, 0, 0, 0>(vector_));
+		out_ = EmuSIMD::fmadd(EmuSIMD::load_unaligned<__m128>(p_lhs_cm_ + 4), EmuSIMD::shuffle<1, 1, 1, 1>(vector_), out_);
+		out_ = EmuSIMD::fmadd(EmuSIMD::load_unaligned<__m128>(p_lhs_cm_ + 8), EmuSIMD::shuffle<2, 2, 2, 2>(vector_), out_);
+		return EmuSIMD::fmadd(EmuSIMD::load_unaligned<__m128>(p_lhs_cm_ + 12), EmuSIMD::shuffle<3, 3, 3, 3>(vector_), out_);
+	}
+
+	/// <summary>
+	/// <para> Calculates a single element of the product of lhs_ and rhs_, at the provided OutColumn_ and OutRow_. </para>
+	/// <para> This is the dot product of lhs_ row OutRow_ and rhs_ column OutColumn_, with all multiplications performed as OutT_. </para>
+	/// </summary>
+	template<std::size_t OutColumn_, std::size_t OutRow_, typename OutT_, class Lhs_, class Rhs_, std::size_t...SharedIndices_>
+	[[nodiscard]] constexpr inline OutT_ _matrix_multiply_element(const Lhs_& lhs_, const Rhs_& rhs_, std::index_sequence<SharedIndices_...>)
+	{
+		return
+		(
+			... +
+			(
+				static_cast<OutT_>(lhs_.template at<SharedIndices_, OutRow_>()) *
+				static_cast<OutT_>(rhs_.template at<OutColumn_, SharedIndices_>())
+			)
+		);
+	}
+
+	template<class Out_, class Lhs_, class Rhs_, std::size_t...OutFlattenedIndices_>
+	[[nodiscard]] constexpr inline Out_ _matrix_multiply_generic(const Lhs_& lhs_, const Rhs_& rhs_, std::index_sequence<OutFlattenedIndices_...>)
+	{
+		using out_value = typename Out_::value_type_uq;
+		using shared_indices = std::make_index_sequence<Lhs_::num_columns>;
+
+		// Arguments to construct a Matrix are taken in major order, so flattened indices are remapped here for row-major outputs
+		if constexpr (Out_::is_column_major)
+		{
+			return Out_
+			(
+				_matrix_multiply_element<OutFlattenedIndices_ / Out_::num_rows, OutFlattenedIndices_ % Out_::num_rows, out_value>
+				(
+					lhs_,
+					rhs_,
+					shared_indices()
+				)...
+			);
+		}
+		else
+		{
+			return Out_
+			(
+				_matrix_multiply_element<OutFlattenedIndices_ % Out_::num_columns, OutFlattenedIndices_ / Out_::num_columns, out_value>
+				(
+					lhs_,
+					rhs_,
+					shared_indices()
+				)...
+			);
+		}
+	}
+
+	template<class Out_, class Lhs_, class Rhs_>
+	[[nodiscard]] constexpr inline Out_ _matrix_multiply(const Lhs_& lhs_, const Rhs_& rhs_)
+	{
+		if constexpr (_matrix_multiply_4x4_fp32_is_valid<Out_, Lhs_, Rhs_>())
+		{
+			Out_ out_ = Out_();
+			if constexpr (Out_::is_column_major)
+			{
+				_matrix_multiply_4x4_cm_fp32(lhs_.data(), rhs_.data(), out_.data());
+			}
+			else
+			{
+				// Row-major data is the column-major data of a transpose, and (AB)^T = (B^T)(A^T)
+				_matrix_multiply_4x4_cm_fp32(rhs_.data(), lhs_.data(), out_.data());
+			}
+			return out_;
+		}
+		else
+		{
+			return _matrix_multiply_generic<Out_>(lhs_, rhs_, std::make_index_sequence<Out_::size>());
+		}
+	}
+
+	template<std::size_t OutRow_, typename OutT_, class Lhs_, class Vector_, std::size_t...SharedIndices_>
+	[[nodiscard]] constexpr inline OutT_ _matrix_multiply_vector_element(const Lhs_& lhs_, const Vector_& vector_, std::index_sequence<SharedIndices_...>)
+	{
+		return
+		(
+			... +
+			(
+				static_cast<OutT_>(lhs_.template at<SharedIndices_, OutRow_>()) *
+				static_cast<OutT_>(vector_.template AtTheoretical<SharedIndices_>())
+			)
+		);
+	}
+
+	template<class OutVector_, class Lhs_, class Vector_, std::size_t...OutIndices_>
+	[[nodiscard]] constexpr inline OutVector_ _matrix_multiply_vector_generic(const Lhs_& lhs_, const Vector_& vector_, std::index_sequence<OutIndices_...>)
+	{
+		using out_value = typename OutVector_::value_type_uq;
+		return OutVector_
+		(
+			_matrix_multiply_vector_element<OutIndices_, out_value>(lhs_, vector_, std::make_index_sequence<Lhs_::num_columns>())...
+		);
+	}
+
+	template<class OutVector_, class Lhs_, class Vector_>
+	[[nodiscard]] constexpr inline OutVector_ _matrix_multiply_vector(const Lhs_& lhs_, const Vector_& vector_)
+	{
+		constexpr bool is_fast_4x4_ =
+		(
+			Lhs_::num_columns == 4 && Lhs_::num_rows == 4 && Lhs_::is_column_major &&
+			std::is_same_v<typename Lhs_::stored_type, float> &&
+			Vector_::size == 4 && std::is_same_v<typename Vector_::stored_type, float> &&
+			OutVector_::size == 4 && std::is_same_v<typename OutVector_::stored_type, float>
+		);
+
+		if constexpr (is_fast_4x4_)
+		{
+			OutVector_ out_ = OutVector_();
+			EmuSIMD::store_unaligned
+			(
+				_matrix_multiply_4x4_cm_fp32_vector(lhs_.data(), EmuSIMD::load_unaligned<__m128>(vector_.data())),
+				out_.data()
+			);
+			return out_;
+		}
+		else
+		{
+			return _matrix_multiply_vector_generic<OutVector_>(lhs_, vector_, std::make_index_sequence<OutVector_::size>());
+		}
+	}
+}
+
+#endif
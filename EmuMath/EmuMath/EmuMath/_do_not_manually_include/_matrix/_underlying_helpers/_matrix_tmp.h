@@ -61,7 +61,7 @@ namespace EmuMath::TMP
 			using out_t = std::conditional_t<std::is_void_v<OutT_>, typename in_uq::value_type_uq, OutT_>;
 
 		public:
-			using type = EmuMath::Matrix<in_uq::num_rows, in_uq::num_columns, OutT_, OutColumnMajor_>;
+			using type = EmuMath::Matrix<in_uq::num_rows, in_uq::num_columns, out_t, OutColumnMajor_>;
 		};
 
 	public:
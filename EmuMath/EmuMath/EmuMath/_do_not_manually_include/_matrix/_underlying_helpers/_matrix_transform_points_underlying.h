@@ -0,0 +1,195 @@
+#ifndef EMU_MATH_UNDERLYING_MATRIX_TRANSFORM_POINTS_H_INC_
+#define EMU_MATH_UNDERLYING_MATRIX_TRANSFORM_POINTS_H_INC_ 1
+
+#include "_matrix_tmp.h"
+#include "../../../../EmuSIMD/SIMDHelpers.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace EmuMath::Helpers::_matrix_underlying
+{
+	/// <summary>
+	/// <para> Minimum number of output bytes at which batched point transformations will use non-temporal stores, where the output is suitably aligned. </para>
+	/// <para> Below this size, outputs are likely to still be in cache when next read, so regular stores are preferred. </para>
+	/// </summary>
+	constexpr std::size_t _transform_points_non_temporal_threshold_bytes = std::size_t(8) * 1024 * 1024;
+
+	[[nodiscard]] inline bool _transform_points_is_aligned(const void* p_, std::size_t alignment_)
+	{
+		return (reinterpret_cast<std::uintptr_t>(p_) % alignment_) == 0;
+	}
+
+	/// <summary>
+	/// <para> Broadcasts of the 12 elements of a 4x4 affine transformation that contribute to the x, y, and z of a transformed point. </para>
+	/// <para> The w row of the matrix is ignored, as points are output without a perspective divide. </para>
+	/// </summary>
+	template<class Register_>
+	struct _transform_points_broadcasts
+	{
+		template<class Matrix_>
+		explicit _transform_points_broadcasts(const Matrix_& matrix_) :
+			m00(EmuSIMD::set1<Register_>(static_cast<float>(matrix_.template at<0, 0>()))),
+			m10(EmuSIMD::set1<Register_>(static_cast<float>(matrix_.template at<1, 0>()))),
+			m20(EmuSIMD::set1<Register_>(static_cast<float>(matrix_.template at<2, 0>()))),
+			m30(EmuSIMD::set1<Register_>(static_cast<float>(matrix_.template at<3, 0>()))),
+			m01(EmuSIMD::set1<Register_>(static_cast<float>(matrix_.template at<0, 1>()))),
+			m11(EmuSIMD::set1<Register_>(static_cast<float>(matrix_.template at<1, 1>()))),
+			m21(EmuSIMD::set1<Register_>(static_cast<float>(matrix_.template at<2, 1>()))),
+			m31(EmuSIMD::set1<Register_>(static_cast<float>(matrix_.template at<3, 1>()))),
+			m02(EmuSIMD::set1<Register_>(static_cast<float>(matrix_.template at<0, 2>()))),
+			m12(EmuSIMD::set1<Register_>(static_cast<float>(matrix_.template at<1, 2>()))),
+			m22(EmuSIMD::set1<Register_>(static_cast<float>(matrix_.template at<2, 2>()))),
+			m32(EmuSIMD::set1<Register_>(static_cast<float>(matrix_.template at<3, 2>())))
+		{
+		}
+
+		/// <summary> Transforms the passed x_, y_, and z_ lanes in place, treating each lane as a point with an implied w of 1. </summary>
+		inline void Transform(Register_& x_, Register_& y_, Register_& z_) const
+		{
+			Register_ out_x_ = EmuSIMD::fmadd(m00, x_, EmuSIMD::fmadd(m10, y_, EmuSIMD::fmadd(m20, z_, m30)));
+			Register_ out_y_ = EmuSIMD::fmadd(m01, x_, EmuSIMD::fmadd(m11, y_, EmuSIMD::fmadd(m21, z_, m31)));
+			z_ = EmuSIMD::fmadd(m02, x_, EmuSIMD::fmadd(m12, y_, EmuSIMD::fmadd(m22, z_, m32)));
+			x_ = out_x_;
+			y_ = out_y_;
+		}
+
+		Register_ m00, m10, m20, m30;
+		Register_ m01, m11, m21, m31;
+		Register_ m02, m12, m22, m32;
+	};
+
+	/// <summary> Transforms a single point with an implied w of 1 via the passed matrix_, without SIMD. Used for the tails of batched transformations. </summary>
+	template<class Matrix_>
+	inline void _transform_point_scalar(const Matrix_& matrix_, float x_, float y_, float z_, float& out_x_, float& out_y_, float& out_z_)
+	{
+		const float m00_ = static_cast<float>(matrix_.template at<0, 0>()), m10_ = static_cast<float>(matrix_.template at<1, 0>());
+		const float m20_ = static_cast<float>(matrix_.template at<2, 0>()), m30_ = static_cast<float>(matrix_.template at<3, 0>());
+		const float m01_ = static_cast<float>(matrix_.template at<0, 1>()), m11_ = static_cast<float>(matrix_.template at<1, 1>());
+		const float m21_ = static_cast<float>(matrix_.template at<2, 1>()), m31_ = static_cast<float>(matrix_.template at<3, 1>());
+		const float m02_ = static_cast<float>(matrix_.template at<0, 2>()), m12_ = static_cast<float>(matrix_.template at<1, 2>());
+		const float m22_ = static_cast<float>(matrix_.template at<2, 2>()), m32_ = static_cast<float>(matrix_.template at<3, 2>());
+		out_x_ = (m00_ * x_) + (m10_ * y_) + (m20_ * z_) + m30_;
+		out_y_ = (m01_ * x_) + (m11_ * y_) + (m21_ * z_) + m31_;
+		out_z_ = (m02_ * x_) + (m12_ * y_) + (m22_ * z_) + m32_;
+	}
+
+	/// <summary>
+	/// <para> Transforms count_ interleaved (AoS) xyz float points starting at p_in_, outputting count_ interleaved xyz float points starting at p_out_. </para>
+	/// <para> 4 points (12 floats) are processed per iteration: they are loaded as 3 registers, deinterleaved into x, y, and z lanes, then reinterleaved for output. </para>
+	/// <para> p_in_ and p_out_ may be the same pointer, but must not otherwise overlap. </para>
+	/// </summary>
+	template<class Matrix_>
+	inline void _matrix_transform_points_aos_fp32(const Matrix_& matrix_, const float* p_in_, float* p_out_, std::size_t count_)
+	{
+		const _transform_points_broadcasts<__m128> broadcasts_(matrix_);
+		const std::size_t simd_count_ = count_ - (count_ % 4);
+		const bool use_non_temporal_ =
+		(
+			(count_ * 3 * sizeof(float)) >= _transform_points_non_temporal_threshold_bytes &&
+			_transform_points_is_aligned(p_out_, 16)
+		);
+
+		std::size_t i_ = 0;
+		for (; i_ < simd_count_; i_ += 4, p_in_ += 12, p_out_ += 12)
+		{
+			// a = [x0, y0, z0, x1], b = [y1, z1, x2, y2], c = [z2, x3, y3, z3]
+			__m128 a_ = EmuSIMD::load_unaligned<__m128>(p_in_);
+			__m128 b_ = EmuSIMD::load_unaligned<__m128>(p_in_ + 4);
+			__m128 c_ = EmuSIMD::load_unaligned<__m128>(p_in_ + 8);
+
+			__m128 x_ = EmuSIMD::shuffle<0, 3, 0, 2>(a_, EmuSIMD::shuffle<2, 2, 1, 1>(b_, c_));
+			__m128 y_ = EmuSIMD::shuffle<0, 2, 0, 2>(EmuSIMD::shuffle<1, 1, 0, 0>(a_, b_), EmuSIMD::shuffle<3, 3, 2, 2>(b_, c_));
+			__m128 z_ = EmuSIMD::shuffle<0, 2, 0, 3>(EmuSIMD::shuffle<2, 2, 1, 1>(a_, b_), c_);
+			broadcasts_.Transform(x_, y_, z_);
+
+			a_ = EmuSIMD::shuffle<0, 2, 0, 2>(EmuSIMD::shuffle<0, 0, 0, 0>(x_, y_), EmuSIMD::shuffle<0, 0, 1, 1>(z_, x_));
+			b_ = EmuSIMD::shuffle<0, 2, 0, 2>(EmuSIMD::shuffle<1, 1, 1, 1>(y_, z_), EmuSIMD::shuffle<2, 2, 2, 2>(x_, y_));
+			c_ = EmuSIMD::shuffle<0, 2, 0, 2>(EmuSIMD::shuffle<2, 2, 3, 3>(z_, x_), EmuSIMD::shuffle<3, 3, 3, 3>(y_, z_));
+
+			if (use_non_temporal_)
+			{
+				EmuSIMD::store_non_temporal(a_, p_out_);
+				EmuSIMD::store_non_temporal(b_, p_out_ + 4);
+				EmuSIMD::store_non_temporal(c_, p_out_ + 8);
+			}
+			else
+			{
+				EmuSIMD::store_unaligned(a_, p_out_);
+				EmuSIMD::store_unaligned(b_, p_out_ + 4);
+				EmuSIMD::store_unaligned(c_, p_out_ + 8);
+			}
+		}
+
+		if (use_non_temporal_)
+		{
+			_mm_sfence();
+		}
+
+		for (; i_ < count_; ++i_, p_in_ += 3, p_out_ += 3)
+		{
+			_transform_point_scalar(matrix_, p_in_[0], p_in_[1], p_in_[2], p_out_[0], p_out_[1], p_out_[2]);
+		}
+	}
+
+	/// <summary>
+	/// <para> Transforms count_ points stored as separate (SoA) x, y, and z float arrays, outputting to separate x, y, and z float arrays. </para>
+	/// <para> 8 points are processed per iteration. Input and output arrays may be the same pointers, but must not otherwise overlap. </para>
+	/// </summary>
+	template<class Matrix_>
+	inline void _matrix_transform_points_soa_fp32
+	(
+		const Matrix_& matrix_,
+		const float* p_in_x_,
+		const float* p_in_y_,
+		const float* p_in_z_,
+		float* p_out_x_,
+		float* p_out_y_,
+		float* p_out_z_,
+		std::size_t count_
+	)
+	{
+		const _transform_points_broadcasts<__m256> broadcasts_(matrix_);
+		const std::size_t simd_count_ = count_ - (count_ % 8);
+		const bool use_non_temporal_ =
+		(
+			(count_ * 3 * sizeof(float)) >= _transform_points_non_temporal_threshold_bytes &&
+			_transform_points_is_aligned(p_out_x_, 32) &&
+			_transform_points_is_aligned(p_out_y_, 32) &&
+			_transform_points_is_aligned(p_out_z_, 32)
+		);
+
+		std::size_t i_ = 0;
+		for (; i_ < simd_count_; i_ += 8)
+		{
+			__m256 x_ = EmuSIMD::load_unaligned<__m256>(p_in_x_ + i_);
+			__m256 y_ = EmuSIMD::load_unaligned<__m256>(p_in_y_ + i_);
+			__m256 z_ = EmuSIMD::load_unaligned<__m256>(p_in_z_ + i_);
+			broadcasts_.Transform(x_, y_, z_);
+
+			if (use_non_temporal_)
+			{
+				EmuSIMD::store_non_temporal(x_, p_out_x_ + i_);
+				EmuSIMD::store_non_temporal(y_, p_out_y_ + i_);
+				EmuSIMD::store_non_temporal(z_, p_out_z_ + i_);
+			}
+			else
+			{
+				EmuSIMD::store_unaligned(x_, p_out_x_ + i_);
+				EmuSIMD::store_unaligned(y_, p_out_y_ + i_);
+				EmuSIMD::store_unaligned(z_, p_out_z_ + i_);
+			}
+		}
+
+		if (use_non_temporal_)
+		{
+			_mm_sfence();
+		}
+
+		for (; i_ < count_; ++i_)
+		{
+			_transform_point_scalar(matrix_, p_in_x_[i_], p_in_y_[i_], p_in_z_[i_], p_out_x_[i_], p_out_y_[i_], p_out_z_[i_]);
+		}
+	}
+}
+
+#endif
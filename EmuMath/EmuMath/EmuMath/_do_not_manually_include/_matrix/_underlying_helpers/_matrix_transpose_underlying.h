@@ -0,0 +1,88 @@
+#ifndef EMU_MATH_UNDERLYING_MATRIX_TRANSPOSE_H_INC_
+#define EMU_MATH_UNDERLYING_MATRIX_TRANSPOSE_H_INC_ 1
+
+#include "_matrix_tmp.h"
+#include "../../../../EmuSIMD/SIMDHelpers.h"
+#include <type_traits>
+
+namespace EmuMath::Helpers::_matrix_underlying
+{
+	/// <summary>
+	/// <para> Determines if the fast SIMD 4x4 kernel may be used to transpose the provided In_ matrix, outputting to the provided Out_ matrix. </para>
+	/// <para> This is only the case if both matrices are non-reference 4x4 float matrices sharing the same major order. </para>
+	/// </summary>
+	template<class Out_, class In_>
+	[[nodiscard]] constexpr inline bool _matrix_square_4x4_fp32_is_valid()
+	{
+		using out_uq = EmuCore::TMP::remove_ref_cv_t<Out_>;
+		using in_uq = EmuCore::TMP::remove_ref_cv_t<In_>;
+		return
+		(
+			(out_uq::num_columns == 4 && out_uq::num_rows == 4 && std::is_same_v<typename out_uq::stored_type, float>) &&
+			(in_uq::num_columns == 4 && in_uq::num_rows == 4 && std::is_same_v<typename in_uq::stored_type, float>) &&
+			(out_uq::is_column_major == in_uq::is_column_major)
+		);
+	}
+
+	/// <summary>
+	/// <para> Transposes 16 contiguous floats representing a 4x4 matrix, outputting the 16 contiguous floats of its transpose in the same major order. </para>
+	/// <para> No alignment is required of any pointer, and p_out_ may be the same as p_in_. </para>
+	/// </summary>
+	inline void _matrix_transpose_4x4_fp32(const float* p_in_, float* p_out_)
+	{
+		__m128 major_0_ = EmuSIMD::load_unaligned<__m128>(p_in_);
+		__m128 major_1_ = EmuSIMD::load_unaligned<__m128>(p_in_ + 4);
+		__m128 major_2_ = EmuSIMD::load_unaligned<__m128>(p_in_ + 8);
+		__m128 major_3_ = EmuSIMD::load_unaligned<__m128>(p_in_ + 12);
+
+		// Pair the low and high halves of each major, then gather each non-major index into its own register
+		__m128 low_01_ = EmuSIMD::shuffle<0, 1, 0, 1>(major_0_, major_1_);
+		__m128 low_23_ = EmuSIMD::shuffle<0, 1, 0, 1>(major_2_, major_3_);
+		__m128 high_01_ = EmuSIMD::shuffle<2, 3, 2, 3>(major_0_, major_1_);
+		__m128 high_23_ = EmuSIMD::shuffle<2, 3, 2, 3>(major_2_, major_3_);
+
+		EmuSIMD::store_unaligned(EmuSIMD::shuffle<0, 2, 0, 2>(low_01_, low_23_), p_out_);
+		EmuSIMD::store_unaligned(EmuSIMD::shuffle<1, 3, 1, 3>(low_01_, low_23_), p_out_ + 4);
+		EmuSIMD::store_unaligned(EmuSIMD::shuffle<0, 2, 0, 2>(high_01_, high_23_), p_out_ + 8);
+		EmuSIMD::store_unaligned(EmuSIMD::shuffle<1, 3, 1, 3>(high_01_, high_23_), p_out_ + 12);
+	}
+
+	template<class Out_, class In_, std::size_t...OutFlattenedIndices_>
+	[[nodiscard]] constexpr inline Out_ _matrix_transpose_generic(const In_& in_, std::index_sequence<OutFlattenedIndices_...>)
+	{
+		using out_value = typename Out_::value_type_uq;
+
+		// Arguments to construct a Matrix are taken in major order, so flattened indices are remapped here for row-major outputs
+		if constexpr (Out_::is_column_major)
+		{
+			return Out_
+			(
+				static_cast<out_value>(in_.template at<OutFlattenedIndices_ % Out_::num_rows, OutFlattenedIndices_ / Out_::num_rows>())...
+			);
+		}
+		else
+		{
+			return Out_
+			(
+				static_cast<out_value>(in_.template at<OutFlattenedIndices_ / Out_::num_columns, OutFlattenedIndices_ % Out_::num_columns>())...
+			);
+		}
+	}
+
+	template<class Out_, class In_>
+	[[nodiscard]] constexpr inline Out_ _matrix_transpose(const In_& in_)
+	{
+		if constexpr (_matrix_square_4x4_fp32_is_valid<Out_, In_>())
+		{
+			Out_ out_ = Out_();
+			_matrix_transpose_4x4_fp32(in_.data(), out_.data());
+			return out_;
+		}
+		else
+		{
+			return _matrix_transpose_generic<Out_>(in_, std::make_index_sequence<Out_::size>());
+		}
+	}
+}
+
+#endif
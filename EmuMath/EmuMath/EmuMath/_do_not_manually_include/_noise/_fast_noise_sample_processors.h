@@ -37,6 +37,11 @@ namespace EmuMath::Functors
 			samples_ = EmuSIMD::sub(samples_, min_256);
 			return EmuSIMD::mul(samples_, denominator_reciprocal_256);
 		}
+		[[nodiscard]] inline __m512 operator()(__m512 samples_) const
+		{
+			samples_ = EmuSIMD::sub(samples_, EmuSIMD::set1<__m512>(min_));
+			return EmuSIMD::mul(samples_, EmuSIMD::set1<__m512>(denominator_reciprocal_));
+		}
 
 	private:
 		static constexpr float max_ = EmuCore::CommonConstants::SQRT_N<float, std::size_t, N_> / 2.0f;
@@ -63,6 +68,10 @@ namespace EmuMath::Functors
 		{
 			return EmuSIMD::mul_all(sample_, multiplier_256);
 		}
+		[[nodiscard]] inline __m512 operator()(__m512 sample_) const
+		{
+			return EmuSIMD::mul_all(sample_, EmuSIMD::set1<__m512>(multiplier_));
+		}
 
 	private:
 		// Highest absolute magnitude of N-dimensional perlin noise is (sqrt(N)/2).
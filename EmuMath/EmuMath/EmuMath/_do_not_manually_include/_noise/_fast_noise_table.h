@@ -9,6 +9,12 @@
 #include "../../../EmuCore/TMPHelpers/TypeComparators.h"
 #include "../../../EmuCore/TMPHelpers/TypeConvertors.h"
 #include "../../../EmuCore/TMPHelpers/Values.h"
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <future>
+#include <limits>
+#include <new>
 #include <ostream>
 #include <sstream>
 #include <vector>
@@ -37,7 +43,16 @@ namespace EmuMath
 
 		static constexpr std::size_t num_dimensions = NumDimensions_;
 		static constexpr std::size_t major_dimension = MajorDimensionIndex_;
+		/// <summary> Width of SIMD registers used by GenerateNoise when one is not specified. This is the widest register width enabled for the target architecture. </summary>
+#if defined(__AVX512F__)
+		static constexpr std::size_t default_register_width = 512;
+#elif defined(__AVX__)
+		static constexpr std::size_t default_register_width = 256;
+#else
 		static constexpr std::size_t default_register_width = 128;
+#endif
+		/// <summary> Alignment of this table's sample storage in bytes. Every major-dimension row begins on this alignment, allowing aligned stores of registers up to 512 bits. </summary>
+		static constexpr std::size_t storage_alignment = 64;
 		using value_type = float;
 		using this_type = FastNoiseTable<NumDimensions_, MajorDimensionIndex_>;
 		using options_type = EmuMath::NoiseTableOptions<NumDimensions_, value_type>;
@@ -102,22 +117,207 @@ namespace EmuMath
 			);
 		}
 
-	private:
-		/// <summary>table_storage will be a Dimensions_-dimensional vector of value_types.</summary>
-		using table_storage = EmuMath::TMP::_full_noise_table_storage<num_dimensions, value_type>;
-
 	public:
 #pragma region CONSTRUCTORS
-		FastNoiseTable() : samples(), table_size()
+		FastNoiseTable() :
+			samples(nullptr),
+			sample_capacity(0),
+			gradient_samples(nullptr),
+			gradient_capacity(0),
+			gradients_generated(false),
+			major_row_stride(0),
+			table_size()
 		{
 		}
 
-		FastNoiseTable(const this_type& to_copy_) : samples(to_copy_.samples), table_size(to_copy_.table_size)
+		FastNoiseTable(const this_type& to_copy_) :
+			samples(nullptr),
+			sample_capacity(0),
+			gradient_samples(nullptr),
+			gradient_capacity(0),
+			gradients_generated(to_copy_.gradients_generated),
+			major_row_stride(to_copy_.major_row_stride),
+			table_size(to_copy_.table_size)
+		{
+			const std::size_t num_stored_ = to_copy_.stored_size();
+			if (num_stored_ != 0)
+			{
+				samples = _allocate(num_stored_);
+				sample_capacity = num_stored_;
+				std::memcpy(samples, to_copy_.samples, num_stored_ * sizeof(value_type));
+
+				if (gradients_generated)
+				{
+					gradient_samples = _allocate(num_stored_ * num_dimensions);
+					gradient_capacity = num_stored_ * num_dimensions;
+					std::memcpy(gradient_samples, to_copy_.gradient_samples, num_stored_ * num_dimensions * sizeof(value_type));
+				}
+			}
+		}
+
+		FastNoiseTable(this_type&& to_move_) noexcept :
+			samples(to_move_.samples),
+			sample_capacity(to_move_.sample_capacity),
+			gradient_samples(to_move_.gradient_samples),
+			gradient_capacity(to_move_.gradient_capacity),
+			gradients_generated(to_move_.gradients_generated),
+			major_row_stride(to_move_.major_row_stride),
+			table_size(std::move(to_move_.table_size))
 		{
+			to_move_.samples = nullptr;
+			to_move_.sample_capacity = 0;
+			to_move_.gradient_samples = nullptr;
+			to_move_.gradient_capacity = 0;
+			to_move_.gradients_generated = false;
+			to_move_.major_row_stride = 0;
+			to_move_.table_size = coordinate_type();
 		}
 
-		FastNoiseTable(this_type&& to_move_) noexcept : samples(std::move(to_move_.samples)), table_size(std::move(to_move_.table_size))
+		~FastNoiseTable()
 		{
+			_deallocate(samples);
+			_deallocate(gradient_samples);
+		}
+#pragma endregion
+
+#pragma region ASSIGNMENT
+		inline this_type& operator=(const this_type& to_copy_)
+		{
+			if (this != &to_copy_)
+			{
+				const std::size_t num_stored_ = to_copy_.stored_size();
+				const std::size_t num_gradients_ = to_copy_.gradients_generated ? num_stored_ * num_dimensions : 0;
+
+				// Any new storage is allocated before this table is modified, so a failed allocation leaves it unchanged
+				value_type* p_new_samples_ = num_stored_ > sample_capacity ? _allocate(num_stored_) : nullptr;
+				value_type* p_new_gradients_ = nullptr;
+				if (num_gradients_ > gradient_capacity)
+				{
+					try
+					{
+						p_new_gradients_ = _allocate(num_gradients_);
+					}
+					catch (...)
+					{
+						_deallocate(p_new_samples_);
+						throw;
+					}
+				}
+
+				if (p_new_samples_ != nullptr)
+				{
+					_deallocate(samples);
+					samples = p_new_samples_;
+					sample_capacity = num_stored_;
+				}
+				if (p_new_gradients_ != nullptr)
+				{
+					_deallocate(gradient_samples);
+					gradient_samples = p_new_gradients_;
+					gradient_capacity = num_gradients_;
+				}
+
+				if (num_stored_ != 0)
+				{
+					std::memcpy(samples, to_copy_.samples, num_stored_ * sizeof(value_type));
+				}
+				if (num_gradients_ != 0)
+				{
+					std::memcpy(gradient_samples, to_copy_.gradient_samples, num_gradients_ * sizeof(value_type));
+				}
+				gradients_generated = to_copy_.gradients_generated;
+				major_row_stride = to_copy_.major_row_stride;
+				table_size = to_copy_.table_size;
+			}
+			return *this;
+		}
+
+		inline this_type& operator=(this_type&& to_move_) noexcept
+		{
+			if (this != &to_move_)
+			{
+				_deallocate(samples);
+				_deallocate(gradient_samples);
+				samples = to_move_.samples;
+				sample_capacity = to_move_.sample_capacity;
+				gradient_samples = to_move_.gradient_samples;
+				gradient_capacity = to_move_.gradient_capacity;
+				gradients_generated = to_move_.gradients_generated;
+				major_row_stride = to_move_.major_row_stride;
+				table_size = std::move(to_move_.table_size);
+				to_move_.samples = nullptr;
+				to_move_.sample_capacity = 0;
+				to_move_.gradient_samples = nullptr;
+				to_move_.gradient_capacity = 0;
+				to_move_.gradients_generated = false;
+				to_move_.major_row_stride = 0;
+				to_move_.table_size = coordinate_type();
+			}
+			return *this;
+		}
+#pragma endregion
+
+#pragma region STORAGE_ACCESS
+		/// <summary>
+		/// <para> Pointer to the contiguous storage of this table's samples, aligned to storage_alignment bytes. May be null if no noise has been generated. </para>
+		/// <para> 
+		///		Samples are stored in rows along the major dimension, with each row beginning major_stride() elements after the previous one. 
+		///		Rows are ordered by the remaining dimensions alphabetically (i.e. X-major is stored YZX, Y-major stored XZY, Z-major stored XYZ).
+		/// </para>
+		/// <para> Elements between the end of one row and the start of the next are padding, and their values are unspecified. </para>
+		/// </summary>
+		[[nodiscard]] inline value_type* data()
+		{
+			return samples;
+		}
+		[[nodiscard]] inline const value_type* data() const
+		{
+			return samples;
+		}
+
+		/// <summary> Number of elements from the start of one major-dimension row in data() to the start of the next. This is the major size rounded up to a multiple of storage_alignment bytes. </summary>
+		[[nodiscard]] inline std::size_t major_stride() const
+		{
+			return major_row_stride;
+		}
+
+		/// <summary> Total number of elements that may be accessed via data(), including row padding. </summary>
+		[[nodiscard]] inline std::size_t stored_size() const
+		{
+			if constexpr (num_dimensions == 1)
+			{
+				return major_row_stride;
+			}
+			else if constexpr (num_dimensions == 2)
+			{
+				return major_row_stride * _num_generation_layers();
+			}
+			else
+			{
+				return major_row_stride * _num_generation_layers() * _num_middle_layers();
+			}
+		}
+
+		/// <summary> True if the most recent generation into this table was performed via GenerateNoiseWithGradients, meaning gradient_data and gradient_at are valid. </summary>
+		[[nodiscard]] inline bool has_gradients() const
+		{
+			return gradients_generated;
+		}
+
+		/// <summary>
+		/// <para> Pointer to the contiguous storage of partial derivatives with respect to the provided Dimension_ for each sample, or null if has_gradients() is false. </para>
+		/// <para> Derivatives are stored with the same layout as data(), so the derivative of the sample at data()[i] is at gradient_data&lt;Dimension_&gt;()[i]. </para>
+		/// </summary>
+		template<std::size_t Dimension_>
+		[[nodiscard]] inline value_type* gradient_data()
+		{
+			static_assert(Dimension_ < num_dimensions, "Provided an invalid Dimension_ to EmuMath::FastNoiseTable::gradient_data. The provided Dimension_ must be less than the number of dimensions the table covers.");
+			return gradients_generated ? (gradient_samples + (Dimension_ * stored_size())) : nullptr;
+		}
+		template<std::size_t Dimension_>
+		[[nodiscard]] inline const value_type* gradient_data() const
+		{
+			return const_cast<this_type*>(this)->template gradient_data<Dimension_>();
 		}
 #pragma endregion
 
@@ -182,6 +382,20 @@ namespace EmuMath
 		{
 			return at(coords_);
 		}
+
+		/// <summary> Partial derivatives of the sample at the provided coordinates with respect to X, Y, and Z. Only valid if has_gradients() is true. </summary>
+		template<typename OnlyAvailableFor3Dimensional_ = std::enable_if_t<num_dimensions == 3>>
+		[[nodiscard]] inline EmuMath::Vector<3, value_type> gradient_at(std::size_t x_, std::size_t y_, std::size_t z_) const
+		{
+			const std::size_t index_ = static_cast<std::size_t>(&_get_index(coordinate_type(x_, y_, z_)) - samples);
+			const std::size_t plane_size_ = stored_size();
+			return EmuMath::Vector<3, value_type>
+			(
+				gradient_samples[index_],
+				gradient_samples[index_ + plane_size_],
+				gradient_samples[index_ + (plane_size_ * 2)]
+			);
+		}
 #pragma endregion
 
 		[[nodiscard]] inline coordinate_type size() const
@@ -202,48 +416,111 @@ namespace EmuMath
 		}
 
 #pragma region GENERATION
-		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_>
+		/// <summary>
+		/// <para> Generates noise of the provided NoiseType_ into this table, resizing it to match the passed options_. </para>
+		/// <para> Samples are generated in batches of RegisterWidth_ bits, which may be 128, 256, or 512; this defaults to the widest width enabled for the target. </para>
+		/// </summary>
+		/// <returns>True if noise was successfully generated; false if the options_ contained an invalid resolution.</returns>
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_, std::size_t RegisterWidth_ = default_register_width>
 		inline bool GenerateNoise(const options_type& options_, SampleProcessor_ sample_processor_)
 		{
-			using register_type = __m128;
-			using underlying_noise_gen_functor = EmuMath::fast_noise_gen_functor<num_dimensions, NoiseType_, register_type>;
-
-			if (_valid_resolution(options_.table_resolution))
-			{
-				_do_resize(options_.table_resolution);
+			static_assert
+			(
+				RegisterWidth_ == 128 || RegisterWidth_ == 256 || RegisterWidth_ == 512,
+				"Provided an invalid RegisterWidth_ to EmuMath::FastNoiseTable::GenerateNoise. Valid widths are 128, 256, and 512."
+			);
+			using register_type = EmuSIMD::TMP::register_type_t<value_type, RegisterWidth_>;
 
-				// TODO: OTHER RESOLUTIONS
-				if (options_.use_fractal_noise)
+			return _generate<NoiseType_, register_type>
+			(
+				options_,
+				[&](auto& generator_)
 				{
-					using fractal_generator = EmuMath::Functors::fractal_noise_wrapper<underlying_noise_gen_functor, register_type>;
-					_do_generation<register_type, fractal_generator, SampleProcessor_&>
-					(
-						fractal_generator
-						(
-							options_.freq,
-							options_.permutation_info.MakePermutations(),
-							options_.fractal_noise_info
-						),
-						sample_processor_,
-						options_.start_point,
-						options_.MakeStep()
-					);
+					_do_generation<register_type>(generator_, sample_processor_, options_.start_point, options_.MakeStep(), coordinate_type(), 0, _num_generation_layers());
 				}
-				else
+			);
+		}
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default, std::size_t RegisterWidth_ = default_register_width>
+		inline bool GenerateNoise(const options_type& options_)
+		{
+			return GenerateNoise<NoiseType_, SampleProcessor_, RegisterWidth_>(options_, SampleProcessor_());
+		}
+
+		/// <summary>
+		/// <para> Generates noise of the provided NoiseType_ into this table in the same manner as GenerateNoise, spreading the work over the passed thread_pool_. </para>
+		/// <para> The outermost layers of the table are partitioned into chunks which are generated concurrently, with the calling thread generating the final chunk. </para>
+		/// <para> Output is identical to that of GenerateNoise with the same arguments. This will not return until all samples have been generated. </para>
+		/// <para> The thread pool must provide `NumThreads()` and `AllocateTask(func_)` returning a std::future, such as EmuThreads::ThreadPool. </para>
+		/// <para> If the pool has no threads, generation is performed entirely on the calling thread. Chunks rejected by the pool (i.e. an invalid future is returned) are also generated on the calling thread. </para>
+		/// <para> If any chunk throws, every other allocated chunk is still waited on before the first exception is rethrown; the table's samples are unspecified in this case. </para>
+		/// <para> 
+		///		This blocks until chunks executed by the pool's workers complete, so it must not be called from one of thread_pool_'s own workers: 
+		///		if every worker is waiting in this way, no worker remains to execute the chunks and the call will deadlock.
+		/// </para>
+		/// </summary>
+		/// <returns>True if noise was successfully generated; false if the options_ contained an invalid resolution.</returns>
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_, std::size_t RegisterWidth_ = default_register_width, class ThreadPool_>
+		inline bool GenerateNoiseParallel(const options_type& options_, SampleProcessor_ sample_processor_, ThreadPool_& thread_pool_)
+		{
+			static_assert
+			(
+				RegisterWidth_ == 128 || RegisterWidth_ == 256 || RegisterWidth_ == 512,
+				"Provided an invalid RegisterWidth_ to EmuMath::FastNoiseTable::GenerateNoiseParallel. Valid widths are 128, 256, and 512."
+			);
+			using register_type = EmuSIMD::TMP::register_type_t<value_type, RegisterWidth_>;
+
+			return _generate<NoiseType_, register_type>
+			(
+				options_,
+				[&](auto& generator_)
 				{
-					using no_fractal_generator = EmuMath::Functors::no_fractal_noise_wrapper<underlying_noise_gen_functor, register_type>;
-					_do_generation<register_type, no_fractal_generator, SampleProcessor_&>
-					(
-						no_fractal_generator
-						(
-							options_.freq,
-							options_.permutation_info.MakePermutations()
-						),
-						sample_processor_,
-						options_.start_point,
-						options_.MakeStep()
-					);
+					_do_parallel_generation<register_type>(generator_, sample_processor_, options_.start_point, options_.MakeStep(), thread_pool_);
 				}
+			);
+		}
+		template
+		<
+			EmuMath::NoiseType NoiseType_,
+			class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default,
+			std::size_t RegisterWidth_ = default_register_width,
+			class ThreadPool_
+		>
+		inline bool GenerateNoiseParallel(const options_type& options_, ThreadPool_& thread_pool_)
+		{
+			return GenerateNoiseParallel<NoiseType_, SampleProcessor_, RegisterWidth_>(options_, SampleProcessor_(), thread_pool_);
+		}
+
+		/// <summary>
+		/// <para> Generates the tile of noise beginning at tile_begin_ within the full table described by options_ into this table, resizing this table to the tile's size. </para>
+		/// <para> The tile's size is tile_size_, clamped so that the tile does not extend beyond options_.table_resolution. </para>
+		/// <para> 
+		///		Each sample is identical to the sample at the same full-table index generated by GenerateNoise with the same options_, so adjacent tiles are seamless. 
+		///		Only the tile is stored, allowing tables too large to be held in memory to be generated in pieces.
+		/// </para>
+		/// <para> Full-table indices along the major dimension are formed as 32-bit integers, so the full table's major size must be less than 2^31 samples. </para>
+		/// </summary>
+		/// <returns>
+		///		True if noise was successfully generated; 
+		///		false if options_ or tile_size_ contained an invalid resolution (including a major size of 2^31 or more), or tile_begin_ was outside of the full table.
+		/// </returns>
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_, std::size_t RegisterWidth_ = default_register_width>
+		inline bool GenerateNoiseTile(const options_type& options_, const coordinate_type& tile_begin_, const coordinate_type& tile_size_, SampleProcessor_ sample_processor_)
+		{
+			static_assert
+			(
+				RegisterWidth_ == 128 || RegisterWidth_ == 256 || RegisterWidth_ == 512,
+				"Provided an invalid RegisterWidth_ to EmuMath::FastNoiseTable::GenerateNoiseTile. Valid widths are 128, 256, and 512."
+			);
+			using register_type = EmuSIMD::TMP::register_type_t<value_type, RegisterWidth_>;
+
+			if (_valid_tile(options_.table_resolution, tile_begin_, tile_size_))
+			{
+				_do_resize(_clamped_tile_size(options_.table_resolution, tile_begin_, tile_size_));
+				auto generation_func_ = [&](auto& generator_)
+				{
+					_do_generation<register_type>(generator_, sample_processor_, options_.start_point, options_.MakeStep(), tile_begin_, 0, _num_generation_layers());
+				};
+				_invoke_with_generator<NoiseType_, register_type>(options_, generation_func_);
 				return true;
 			}
 			else
@@ -251,290 +528,588 @@ namespace EmuMath
 				return false;
 			}
 		}
-		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default>
-		inline bool GenerateNoise(const options_type& options_)
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default, std::size_t RegisterWidth_ = default_register_width>
+		inline bool GenerateNoiseTile(const options_type& options_, const coordinate_type& tile_begin_, const coordinate_type& tile_size_)
 		{
-			return GenerateNoise<NoiseType_, SampleProcessor_>(options_, SampleProcessor_());
+			return GenerateNoiseTile<NoiseType_, SampleProcessor_, RegisterWidth_>(options_, tile_begin_, tile_size_, SampleProcessor_());
 		}
-#pragma endregion
 
-	private:
-		table_storage samples;
-		coordinate_type table_size;
-
-		template<class Generator_, class SampleProcessor_, class OutLayer_, class Register_>
-		inline void _finish_major_segment_partial
+		/// <summary>
+		/// <para> Generates the region of noise beginning at the signed index region_begin_ of the unbounded grid described by options_ into this table, resizing this table to region_size_. </para>
+		/// <para> 
+		///		The sample at grid index I is generated for the point `start_point + (step * I)` of options_, where step is the result of their MakeStep, 
+		///		and is identical to the sample at the same index generated by GenerateNoise or GenerateNoiseTile. Adjacent regions, including those at negative indices, are seamless.
+		/// </para>
+		/// <para> options_.table_resolution is only used to calculate the step, and is otherwise ignored. </para>
+		/// <para> Grid indices along the major dimension are formed as 32-bit integers, so every index of the region in that dimension must be representable as a std::int32_t. </para>
+		/// </summary>
+		/// <returns>True if noise was successfully generated; false if region_size_ contained an invalid resolution, or the region's major-dimension indices exceed 32 bits.</returns>
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_, std::size_t RegisterWidth_ = default_register_width>
+		inline bool GenerateNoiseRegion
 		(
-			Generator_& generator_,
-			SampleProcessor_& sample_processor_,
-			OutLayer_& out_layer_,
-			Register_ points_x_,
-			Register_ points_y_,
-			Register_ points_z_,
-			std::size_t i_,
-			const std::size_t end_
+			const options_type& options_,
+			const EmuMath::Vector<num_dimensions, std::int64_t>& region_begin_,
+			const coordinate_type& region_size_,
+			SampleProcessor_ sample_processor_
 		)
 		{
-			if (i_ < end_)
+			static_assert
+			(
+				RegisterWidth_ == 128 || RegisterWidth_ == 256 || RegisterWidth_ == 512,
+				"Provided an invalid RegisterWidth_ to EmuMath::FastNoiseTable::GenerateNoiseRegion. Valid widths are 128, 256, and 512."
+			);
+			using register_type = EmuSIMD::TMP::register_type_t<value_type, RegisterWidth_>;
+
+			if (_valid_region(region_begin_, region_size_))
 			{
-				Register_ sample_batch_ = sample_processor_(generator_(points_x_, points_y_, points_z_));
-				if ((i_ + 1) == end_)
+				// Negative indices wrap when stored as offsets, and are recovered as signed values when coordinates are calculated
+				coordinate_type offset_;
+				for (std::size_t i = 0; i < num_dimensions; ++i)
 				{
-					out_layer_[i_] = EmuSIMD::get_index<0, value_type>(sample_batch_);
+					offset_[i] = static_cast<std::size_t>(region_begin_[i]);
 				}
-				else
+
+				_do_resize(region_size_);
+				auto generation_func_ = [&](auto& generator_)
+				{
+					_do_generation<register_type>(generator_, sample_processor_, options_.start_point, options_.MakeStep(), offset_, 0, _num_generation_layers());
+				};
+				_invoke_with_generator<NoiseType_, register_type>(options_, generation_func_);
+				return true;
+			}
+			else
+			{
+				return false;
+			}
+		}
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default, std::size_t RegisterWidth_ = default_register_width>
+		inline bool GenerateNoiseRegion(const options_type& options_, const EmuMath::Vector<num_dimensions, std::int64_t>& region_begin_, const coordinate_type& region_size_)
+		{
+			return GenerateNoiseRegion<NoiseType_, SampleProcessor_, RegisterWidth_>(options_, region_begin_, region_size_, SampleProcessor_());
+		}
+
+		/// <summary>
+		/// <para> Generates every tile of the full table described by options_ in turn, in the same manner as GenerateNoiseTile, using this table as storage for the current tile. </para>
+		/// <para> After each tile is generated, tile_func_ is invoked with the tile's first full-table index and this table: `tile_func_(const coordinate_type&amp; tile_begin_, const FastNoiseTable&amp; tile_)`. </para>
+		/// <para> Tiles are visited with X varying fastest. The generator is built once and reused for every tile, and memory use is bounded by a single tile. </para>
+		/// </summary>
+		/// <returns>True if noise was successfully generated; false if options_ or tile_size_ contained an invalid resolution.</returns>
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_, std::size_t RegisterWidth_ = default_register_width, class TileFunc_>
+		inline bool StreamNoiseTiles(const options_type& options_, const coordinate_type& tile_size_, TileFunc_ tile_func_, SampleProcessor_ sample_processor_)
+		{
+			static_assert
+			(
+				RegisterWidth_ == 128 || RegisterWidth_ == 256 || RegisterWidth_ == 512,
+				"Provided an invalid RegisterWidth_ to EmuMath::FastNoiseTable::StreamNoiseTiles. Valid widths are 128, 256, and 512."
+			);
+			using register_type = EmuSIMD::TMP::register_type_t<value_type, RegisterWidth_>;
+
+			const coordinate_type& resolution_ = options_.table_resolution;
+			coordinate_type tile_begin_ = coordinate_type();
+			if (_valid_tile(resolution_, tile_begin_, tile_size_))
+			{
+				const EmuMath::Vector<num_dimensions, value_type> step_ = options_.MakeStep();
+				auto generation_func_ = [&](auto& generator_)
 				{
-					value_type calculated_values_[EmuSIMD::TMP::simd_register_width_v<Register_> / (sizeof(value_type) * 8)] = {};
-					EmuSIMD::store(sample_batch_, calculated_values_);
-					for (std::size_t index_ = 0; i_ < end_; ++i_, ++index_)
+					do
 					{
-						out_layer_[i_] = calculated_values_[index_];
-					}
+						_do_resize(_clamped_tile_size(resolution_, tile_begin_, tile_size_));
+						_do_generation<register_type>(generator_, sample_processor_, options_.start_point, step_, tile_begin_, 0, _num_generation_layers());
+						tile_func_(static_cast<const coordinate_type&>(tile_begin_), static_cast<const this_type&>(*this));
+					} while (_next_tile(resolution_, tile_size_, tile_begin_));
+				};
+				_invoke_with_generator<NoiseType_, register_type>(options_, generation_func_);
+				return true;
+			}
+			else
+			{
+				return false;
+			}
+		}
+		template
+		<
+			EmuMath::NoiseType NoiseType_,
+			class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default,
+			std::size_t RegisterWidth_ = default_register_width,
+			class TileFunc_
+		>
+		inline bool StreamNoiseTiles(const options_type& options_, const coordinate_type& tile_size_, TileFunc_ tile_func_)
+		{
+			return StreamNoiseTiles<NoiseType_, SampleProcessor_, RegisterWidth_>(options_, tile_size_, tile_func_, SampleProcessor_());
+		}
+
+		/// <summary>
+		/// <para> Generates noise of the provided NoiseType_ into this table in the same manner as GenerateNoise, additionally filling a gradient plane for each dimension. </para>
+		/// <para> Each gradient is the analytic partial derivative of the generated noise with respect to the point's coordinate, calculated in the same pass as its sample. </para>
+		/// <para> Samples are passed through the sample_processor_ as normal, but gradients are stored as raw derivatives of the generated noise, unaffected by the processor. </para>
+		/// <para> Gradients may be accessed via gradient_data and gradient_at. Only NoiseTypes whose generators provide SampleWithDerivatives (PERLIN and SIMPLEX) may be used. </para>
+		/// </summary>
+		/// <returns>True if noise was successfully generated; false if the options_ contained an invalid resolution.</returns>
+		template
+		<
+			EmuMath::NoiseType NoiseType_,
+			class SampleProcessor_,
+			std::size_t RegisterWidth_ = default_register_width,
+			typename OnlyAvailableFor3Dimensional_ = std::enable_if_t<num_dimensions == 3>
+		>
+		inline bool GenerateNoiseWithGradients(const options_type& options_, SampleProcessor_ sample_processor_)
+		{
+			static_assert
+			(
+				RegisterWidth_ == 128 || RegisterWidth_ == 256 || RegisterWidth_ == 512,
+				"Provided an invalid RegisterWidth_ to EmuMath::FastNoiseTable::GenerateNoiseWithGradients. Valid widths are 128, 256, and 512."
+			);
+			using register_type = EmuSIMD::TMP::register_type_t<value_type, RegisterWidth_>;
+
+			const bool success_ = _generate<NoiseType_, register_type>
+			(
+				options_,
+				[&](auto& generator_)
+				{
+					_reserve_gradients_discarding(stored_size() * num_dimensions);
+					_do_generation<register_type, true>(generator_, sample_processor_, options_.start_point, options_.MakeStep(), coordinate_type(), 0, _num_generation_layers());
 				}
+			);
+			gradients_generated = success_;
+			return success_;
+		}
+		template
+		<
+			EmuMath::NoiseType NoiseType_,
+			class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default,
+			std::size_t RegisterWidth_ = default_register_width,
+			typename OnlyAvailableFor3Dimensional_ = std::enable_if_t<num_dimensions == 3>
+		>
+		inline bool GenerateNoiseWithGradients(const options_type& options_)
+		{
+			return GenerateNoiseWithGradients<NoiseType_, SampleProcessor_, RegisterWidth_>(options_, SampleProcessor_());
+		}
+
+		/// <summary>
+		/// <para> Generates noise of the provided NoiseType_ at count_ arbitrary points, stored as separate arrays of X, Y, and Z coordinates, outputting samples to p_out_. </para>
+		/// <para> 
+		///		Points are used as they would be for the coordinates of a table cell, and are multiplied by the options_' frequency as normal. 
+		///		The options_' table_resolution, start_point, and end_point_or_step are ignored.
+		/// </para>
+		/// <para> Points are processed in batches of RegisterWidth_ bits, with a final partial batch for any remainder. No pointers have alignment requirements. </para>
+		/// <para> The generator is built from options_ on every call, so points should be sampled in as few calls as is practical. </para>
+		/// </summary>
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_, std::size_t RegisterWidth_ = default_register_width, typename OnlyAvailableFor3Dimensional_ = std::enable_if_t<num_dimensions == 3>>
+		static inline void SampleNoise
+		(
+			const value_type* p_x_,
+			const value_type* p_y_,
+			const value_type* p_z_,
+			value_type* p_out_,
+			std::size_t count_,
+			const options_type& options_,
+			SampleProcessor_ sample_processor_
+		)
+		{
+			const value_type* coords_[num_dimensions] = { p_x_, p_y_, p_z_ };
+			_sample_noise<NoiseType_, RegisterWidth_>(coords_, p_out_, count_, options_, sample_processor_);
+		}
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default, std::size_t RegisterWidth_ = default_register_width, typename OnlyAvailableFor3Dimensional_ = std::enable_if_t<num_dimensions == 3>>
+		static inline void SampleNoise(const value_type* p_x_, const value_type* p_y_, const value_type* p_z_, value_type* p_out_, std::size_t count_, const options_type& options_)
+		{
+			SampleNoise<NoiseType_, SampleProcessor_, RegisterWidth_>(p_x_, p_y_, p_z_, p_out_, count_, options_, SampleProcessor_());
+		}
+
+		/// <summary> Generates noise of the provided NoiseType_ at count_ arbitrary 2D points in the same manner as the 3-dimensional SampleNoise. </summary>
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_, std::size_t RegisterWidth_ = default_register_width, typename OnlyAvailableFor2Dimensional_ = std::enable_if_t<num_dimensions == 2>>
+		static inline void SampleNoise(const value_type* p_x_, const value_type* p_y_, value_type* p_out_, std::size_t count_, const options_type& options_, SampleProcessor_ sample_processor_)
+		{
+			const value_type* coords_[num_dimensions] = { p_x_, p_y_ };
+			_sample_noise<NoiseType_, RegisterWidth_>(coords_, p_out_, count_, options_, sample_processor_);
+		}
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default, std::size_t RegisterWidth_ = default_register_width, typename OnlyAvailableFor2Dimensional_ = std::enable_if_t<num_dimensions == 2>>
+		static inline void SampleNoise(const value_type* p_x_, const value_type* p_y_, value_type* p_out_, std::size_t count_, const options_type& options_)
+		{
+			SampleNoise<NoiseType_, SampleProcessor_, RegisterWidth_>(p_x_, p_y_, p_out_, count_, options_, SampleProcessor_());
+		}
+
+		/// <summary> Generates noise of the provided NoiseType_ at count_ arbitrary 1D points in the same manner as the 3-dimensional SampleNoise. </summary>
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_, std::size_t RegisterWidth_ = default_register_width, typename OnlyAvailableFor1Dimensional_ = std::enable_if_t<num_dimensions == 1>>
+		static inline void SampleNoise(const value_type* p_x_, value_type* p_out_, std::size_t count_, const options_type& options_, SampleProcessor_ sample_processor_)
+		{
+			const value_type* coords_[num_dimensions] = { p_x_ };
+			_sample_noise<NoiseType_, RegisterWidth_>(coords_, p_out_, count_, options_, sample_processor_);
+		}
+		template<EmuMath::NoiseType NoiseType_, class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default, std::size_t RegisterWidth_ = default_register_width, typename OnlyAvailableFor1Dimensional_ = std::enable_if_t<num_dimensions == 1>>
+		static inline void SampleNoise(const value_type* p_x_, value_type* p_out_, std::size_t count_, const options_type& options_)
+		{
+			SampleNoise<NoiseType_, SampleProcessor_, RegisterWidth_>(p_x_, p_out_, count_, options_, SampleProcessor_());
+		}
+#pragma endregion
+
+	private:
+		static constexpr std::size_t elements_per_aligned_block = storage_alignment / sizeof(value_type);
+		/// <summary> Dimension indexed by the outermost layers of storage. For 1-dimensional tables, this is the major dimension. </summary>
+		static constexpr std::size_t outer_dimension = (num_dimensions == 1 || major_dimension != 0) ? 0 : 1;
+		/// <summary> Dimension indexed by the layers between the outermost layers and major-dimension rows. Only meaningful for 3-dimensional tables. </summary>
+		static constexpr std::size_t middle_dimension = major_dimension == 2 ? 1 : 2;
+
+		value_type* samples;
+		std::size_t sample_capacity;
+		/// <summary> Gradient planes for each dimension, stored consecutively with the same layout as samples. Only allocated by GenerateNoiseWithGradients. </summary>
+		value_type* gradient_samples;
+		std::size_t gradient_capacity;
+		bool gradients_generated;
+		std::size_t major_row_stride;
+		coordinate_type table_size;
+
+		/// <summary> Resizes this table for the passed options_ and invokes generation_func_ with the generator they describe. Returns false if the resolution is invalid. </summary>
+		template<EmuMath::NoiseType NoiseType_, class Register_, class GenerationFunc_>
+		inline bool _generate(const options_type& options_, GenerationFunc_ generation_func_)
+		{
+			if (_valid_resolution(options_.table_resolution))
+			{
+				_do_resize(options_.table_resolution);
+				_invoke_with_generator<NoiseType_, Register_>(options_, generation_func_);
+				return true;
+			}
+			else
+			{
+				return false;
 			}
 		}
-		template<class Generator_, class SampleProcessor_, class OutLayer_, class Register_>
-		inline void _finish_major_segment_partial
+
+		/// <summary> Invokes generation_func_ with the generator described by the passed options_. </summary>
+		template<EmuMath::NoiseType NoiseType_, class Register_, class GenerationFunc_>
+		static inline void _invoke_with_generator(const options_type& options_, GenerationFunc_& generation_func_)
+		{
+			using underlying_noise_gen_functor = EmuMath::fast_noise_gen_functor<num_dimensions, NoiseType_, Register_>;
+
+			if (options_.use_fractal_noise)
+			{
+				using fractal_generator = EmuMath::Functors::fractal_noise_wrapper<underlying_noise_gen_functor, Register_>;
+				fractal_generator generator_
+				(
+					options_.freq,
+					options_.permutation_info.MakePermutations(),
+					options_.fractal_noise_info
+				);
+				generation_func_(generator_);
+			}
+			else
+			{
+				using no_fractal_generator = EmuMath::Functors::no_fractal_noise_wrapper<underlying_noise_gen_functor, Register_>;
+				no_fractal_generator generator_
+				(
+					options_.freq,
+					options_.permutation_info.MakePermutations()
+				);
+				generation_func_(generator_);
+			}
+		}
+
+		/// <summary> Generates samples for count_ points whose coordinates in each dimension are read from the respective pointers in p_coords_. </summary>
+		template<EmuMath::NoiseType NoiseType_, std::size_t RegisterWidth_, class SampleProcessor_>
+		static inline void _sample_noise
 		(
-			Generator_& generator_,
-			SampleProcessor_& sample_processor_,
-			OutLayer_& out_layer_,
-			Register_ points_x_,
-			Register_ points_y_,
-			std::size_t i_,
-			const std::size_t end_
+			const value_type* const (&p_coords_)[num_dimensions],
+			value_type* p_out_,
+			std::size_t count_,
+			const options_type& options_,
+			SampleProcessor_& sample_processor_
 		)
 		{
-			if (i_ < end_)
+			static_assert
+			(
+				RegisterWidth_ == 128 || RegisterWidth_ == 256 || RegisterWidth_ == 512,
+				"Provided an invalid RegisterWidth_ to EmuMath::FastNoiseTable::SampleNoise. Valid widths are 128, 256, and 512."
+			);
+			using register_type = EmuSIMD::TMP::register_type_t<value_type, RegisterWidth_>;
+			constexpr std::size_t num_elements_per_batch = RegisterWidth_ / (sizeof(value_type) * 8);
+
+			auto generation_func_ = [&](auto& generator_)
 			{
-				Register_ sample_batch_ = sample_processor_(generator_(points_x_, points_y_));
-				if ((i_ + 1) == end_)
+				register_type points_[num_dimensions];
+				std::size_t i = 0;
+				for (; (i + num_elements_per_batch) <= count_; i += num_elements_per_batch)
 				{
-					out_layer_[i_] = EmuSIMD::get_index<0, value_type>(sample_batch_);
+					for (std::size_t dimension_ = 0; dimension_ < num_dimensions; ++dimension_)
+					{
+						points_[dimension_] = EmuSIMD::load_unaligned<register_type>(p_coords_[dimension_] + i);
+					}
+					EmuSIMD::store_unaligned(sample_processor_(_invoke_generator(generator_, points_)), p_out_ + i);
 				}
-				else
+
+				// Remaining points are copied to zeroed aligned storage so that no memory is accessed beyond the end of any array
+				const std::size_t remaining_ = count_ - i;
+				if (remaining_ != 0)
 				{
-					value_type calculated_values_[EmuSIMD::TMP::simd_register_width_v<Register_> / (sizeof(value_type) * 8)] = {};
-					EmuSIMD::store(sample_batch_, calculated_values_);
-					for (std::size_t index_ = 0; i_ < end_; ++i_, ++index_)
+					alignas(storage_alignment) value_type tail_[num_dimensions + 1][num_elements_per_batch] = {};
+					for (std::size_t dimension_ = 0; dimension_ < num_dimensions; ++dimension_)
 					{
-						out_layer_[i_] = calculated_values_[index_];
+						std::memcpy(tail_[dimension_], p_coords_[dimension_] + i, remaining_ * sizeof(value_type));
+						points_[dimension_] = EmuSIMD::load<register_type>(tail_[dimension_]);
 					}
+					EmuSIMD::store(sample_processor_(_invoke_generator(generator_, points_)), tail_[num_dimensions]);
+					std::memcpy(p_out_ + i, tail_[num_dimensions], remaining_ * sizeof(value_type));
 				}
+			};
+			_invoke_with_generator<NoiseType_, register_type>(options_, generation_func_);
+		}
+
+		template<class Generator_, class Register_>
+		[[nodiscard]] static inline Register_ _invoke_generator(Generator_& generator_, const Register_ (&points_)[num_dimensions])
+		{
+			if constexpr (num_dimensions == 1)
+			{
+				return generator_(points_[0]);
+			}
+			else if constexpr (num_dimensions == 2)
+			{
+				return generator_(points_[0], points_[1]);
+			}
+			else
+			{
+				return generator_(points_[0], points_[1], points_[2]);
 			}
 		}
-		template<class Generator_, class SampleProcessor_, class OutLayer_, class Register_>
-		inline void _finish_major_segment_partial
-		(
-			Generator_& generator_,
-			SampleProcessor_& sample_processor_,
-			OutLayer_& out_layer_,
-			Register_ points_x_,
-			std::size_t i_,
-			const std::size_t end_
-		)
+
+		/// <summary> Whether a tile of the provided tile_size_ beginning at tile_begin_ lies at least partially within a table of the provided resolution_. </summary>
+		[[nodiscard]] static inline bool _valid_tile(const coordinate_type& resolution_, const coordinate_type& tile_begin_, const coordinate_type& tile_size_)
+		{
+			// Major-dimension indices are generated as 32-bit integers
+			constexpr std::size_t max_major_resolution = static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max());
+			return _valid_resolution(resolution_) && _valid_resolution(tile_size_) && tile_begin_.CmpAllLess(resolution_) && resolution_[major_dimension] <= max_major_resolution;
+		}
+
+		/// <summary> Whether a region of the provided region_size_ beginning at the signed grid index region_begin_ has a valid size and 32-bit major-dimension indices. </summary>
+		[[nodiscard]] static inline bool _valid_region(const EmuMath::Vector<num_dimensions, std::int64_t>& region_begin_, const coordinate_type& region_size_)
 		{
-			if (i_ < end_)
+			constexpr std::int64_t min_major_index = static_cast<std::int64_t>(std::numeric_limits<std::int32_t>::min());
+			constexpr std::int64_t max_major_index = static_cast<std::int64_t>(std::numeric_limits<std::int32_t>::max());
+			if (_valid_resolution(region_size_) && region_size_[major_dimension] <= static_cast<std::size_t>(max_major_index))
 			{
-				Register_ sample_batch_ = sample_processor_(generator_(points_x_));
-				if ((i_ + 1) == end_)
-				{
-					out_layer_[i_] = EmuSIMD::get_index<0, value_type>(sample_batch_);
-				}
-				else
+				const std::int64_t major_begin_ = region_begin_[major_dimension];
+				return major_begin_ >= min_major_index && major_begin_ <= (max_major_index - static_cast<std::int64_t>(region_size_[major_dimension]) + 1);
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		/// <summary> Size of the tile beginning at tile_begin_, which is tile_size_ clamped so that the tile does not extend beyond the provided resolution_. </summary>
+		[[nodiscard]] static inline coordinate_type _clamped_tile_size(const coordinate_type& resolution_, const coordinate_type& tile_begin_, const coordinate_type& tile_size_)
+		{
+			coordinate_type out_ = tile_size_;
+			for (std::size_t i = 0; i < num_dimensions; ++i)
+			{
+				const std::size_t remaining_ = resolution_[i] - tile_begin_[i];
+				out_[i] = out_[i] < remaining_ ? out_[i] : remaining_;
+			}
+			return out_;
+		}
+
+		/// <summary> Advances tile_begin_ to the start of the next tile of the provided resolution_, with X varying fastest. Returns false if there are no further tiles. </summary>
+		[[nodiscard]] static inline bool _next_tile(const coordinate_type& resolution_, const coordinate_type& tile_size_, coordinate_type& tile_begin_)
+		{
+			for (std::size_t i = 0; i < num_dimensions; ++i)
+			{
+				tile_begin_[i] += tile_size_[i];
+				if (tile_begin_[i] < resolution_[i])
 				{
-					value_type calculated_values_[EmuSIMD::TMP::simd_register_width_v<Register_> / (sizeof(value_type) * 8)] = {};
-					EmuSIMD::store(sample_batch_, calculated_values_);
-					for (std::size_t index_ = 0; i_ < end_; ++i_, ++index_)
-					{
-						out_layer_[i_] = calculated_values_[index_];
-					}
+					return true;
 				}
+				tile_begin_[i] = 0;
 			}
+			return false;
 		}
 
-		template<class Register_, class Generator_, class SampleProcessor_>
-		inline void _do_generation
+		/// <summary>
+		/// <para> Number of outermost layers that generation is partitioned by (i.e. the size of the first index into samples). </para>
+		/// <para> For 1-dimensional tables, this is the number of samples. </para>
+		/// </summary>
+		[[nodiscard]] inline std::size_t _num_generation_layers() const
+		{
+			if constexpr (num_dimensions == 1 || major_dimension != 0)
+			{
+				return table_size.template at<0>();
+			}
+			else
+			{
+				return table_size.template at<1>();
+			}
+		}
+
+		/// <summary>
+		/// <para> Value of the coordinate in the provided dimension for the outermost layer at the provided index, calculated directly so that it is independent of where generation started. </para>
+		/// <para> The index is interpreted as signed, so that the wrapped offsets of regions at negative indices produce negative coordinates. </para>
+		/// </summary>
+		template<std::size_t Dimension_>
+		[[nodiscard]] static inline value_type _layer_coordinate
 		(
-			Generator_ generator_,
-			SampleProcessor_ sample_processor_,
+			const EmuMath::Vector<num_dimensions, value_type>& start_,
+			const EmuMath::Vector<num_dimensions, value_type>& step_,
+			std::size_t layer_index_
+		)
+		{
+			return start_.template at<Dimension_>() + (step_.template at<Dimension_>() * static_cast<value_type>(static_cast<std::int64_t>(layer_index_)));
+		}
+
+		template<class Register_, class Generator_, class SampleProcessor_, class ThreadPool_>
+		inline void _do_parallel_generation
+		(
+			const Generator_& generator_,
+			const SampleProcessor_& sample_processor_,
 			const EmuMath::Vector<num_dimensions, value_type> start_,
-			const EmuMath::Vector<num_dimensions, value_type> step_
+			const EmuMath::Vector<num_dimensions, value_type> step_,
+			ThreadPool_& thread_pool_
 		)
 		{
-			constexpr std::size_t num_elements_per_batch = EmuSIMD::TMP::simd_register_width_v<Register_> / (sizeof(value_type) * 8);
-			constexpr value_type num_elements_per_batch_value_cast = static_cast<value_type>(num_elements_per_batch);
+			// 1D chunks must begin on a batch boundary to produce the same batches as serial generation
+			constexpr std::size_t layers_per_unit = num_dimensions == 1 ? EmuSIMD::TMP::simd_register_width_v<Register_> / (sizeof(value_type) * 8) : 1;
+			// Several chunks per thread so that a slow chunk does not leave other threads idle at the end
+			constexpr std::size_t chunks_per_thread = 4;
 
-			if constexpr (num_dimensions == 3)
+			const std::size_t num_layers_ = _num_generation_layers();
+			const std::size_t num_units_ = (num_layers_ + layers_per_unit - 1) / layers_per_unit;
+			const std::size_t num_threads_ = static_cast<std::size_t>(thread_pool_.NumThreads());
+
+			if (num_threads_ == 0 || num_units_ <= 1)
 			{
-				std::size_t end_x_ = table_size.at<0>();
-				std::size_t end_y_ = table_size.at<1>();
-				std::size_t end_z_ = table_size.at<2>();
-				std::size_t end_store_batch_ = table_size.at<major_dimension>();
-				end_store_batch_ -= end_store_batch_ % num_elements_per_batch;
+				Generator_ local_generator_ = generator_;
+				SampleProcessor_ local_sample_processor_ = sample_processor_;
+				_do_generation<Register_>(local_generator_, local_sample_processor_, start_, step_, coordinate_type(), 0, num_layers_);
+				return;
+			}
 
+			std::size_t num_chunks_ = (num_threads_ + 1) * chunks_per_thread;
+			num_chunks_ = num_chunks_ < num_units_ ? num_chunks_ : num_units_;
+			const std::size_t layers_per_chunk_ = ((num_units_ + num_chunks_ - 1) / num_chunks_) * layers_per_unit;
 
-				Register_ points_x_ = EmuSIMD::set1<Register_>(start_.at<0>());
-				Register_ points_y_ = EmuSIMD::set1<Register_>(start_.at<1>());
-				Register_ points_z_ = EmuSIMD::set1<Register_>(start_.at<2>());
-				Register_ step_x_ = EmuSIMD::set1<Register_>(step_.at<0>());
-				Register_ step_y_ = EmuSIMD::set1<Register_>(step_.at<1>());
-				Register_ step_z_ = EmuSIMD::set1<Register_>(step_.at<2>());
+			// Each chunk writes to a distinct set of layers and generates with its own copies of the generator and processor, so no synchronisation is needed beyond waiting on completion
+			// --- Captured references remain valid as this function does not return - even when throwing - until every allocated chunk has finished
+			auto generate_chunk_ = [this, &generator_, &sample_processor_, &start_, &step_](std::size_t chunk_begin_, std::size_t chunk_end_)
+			{
+				Generator_ chunk_generator_ = generator_;
+				SampleProcessor_ chunk_sample_processor_ = sample_processor_;
+				_do_generation<Register_>(chunk_generator_, chunk_sample_processor_, start_, step_, coordinate_type(), chunk_begin_, chunk_end_);
+			};
 
-				if constexpr (major_dimension == 0)
+			std::exception_ptr first_exception_ = nullptr;
+			std::vector<std::future<void>> pending_chunks_;
+			try
+			{
+				pending_chunks_.reserve(num_chunks_);
+				std::size_t begin_ = 0;
+				for (; (begin_ + layers_per_chunk_) < num_layers_; begin_ += layers_per_chunk_)
 				{
-					Register_ start_x_ = EmuSIMD::add(points_x_, EmuSIMD::mul_all(step_x_, EmuSIMD::setr_incrementing<Register_, 0>()));
-					Register_ start_z_ = points_z_;
-					step_x_ = EmuSIMD::mul(step_x_, EmuSIMD::set1<Register_>(num_elements_per_batch_value_cast));
-
-					for (std::size_t y = 0; y < end_y_; ++y)
+					const std::size_t end_ = begin_ + layers_per_chunk_;
+					pending_chunks_.emplace_back(thread_pool_.AllocateTask([&generate_chunk_, begin_, end_]() { generate_chunk_(begin_, end_); }));
+					if (!pending_chunks_.back().valid())
 					{
-						auto& layer_0_ = samples[y];
-						points_z_ = start_z_;
-
-						for (std::size_t z = 0; z < end_z_; ++z)
-						{
-							auto& layer_1_ = layer_0_[z];
-							std::size_t x = 0;
-							points_x_ = start_x_;
-
-							for (; x < end_store_batch_; x += num_elements_per_batch)
-							{
-								EmuSIMD::store(sample_processor_(generator_(points_x_, points_y_, points_z_)), &(layer_1_[x]));
-								points_x_ = EmuSIMD::add(points_x_, step_x_);
-							}
-							_finish_major_segment_partial(generator_, sample_processor_, layer_1_, points_x_, points_y_, points_z_, x, end_x_);
-							points_z_ = EmuSIMD::add(points_z_, step_z_);
-						}
-						points_y_ = EmuSIMD::add(points_y_, step_y_);
+						// The pool rejected this chunk (e.g. a full queue with a FAIL policy), so it is generated here instead
+						generate_chunk_(begin_, end_);
 					}
 				}
-				else if constexpr (major_dimension == 1)
-				{
-					Register_ start_y_ = EmuSIMD::add(points_y_, EmuSIMD::mul_all(step_y_, EmuSIMD::setr_incrementing<Register_, 0>()));
-					Register_ start_z_ = points_z_;
-					step_y_ = EmuSIMD::mul(step_y_, EmuSIMD::set1<Register_>(num_elements_per_batch_value_cast));
+				generate_chunk_(begin_, num_layers_);
+			}
+			catch (...)
+			{
+				first_exception_ = std::current_exception();
+			}
 
-					for (std::size_t x = 0; x < end_x_; ++x)
+			for (auto& pending_chunk_ : pending_chunks_)
+			{
+				if (pending_chunk_.valid())
+				{
+					try
 					{
-						auto& layer_0_ = samples[x];
-						points_z_ = start_z_;
-
-						for (std::size_t z = 0; z < end_z_; ++z)
-						{
-							auto& layer_1_ = layer_0_[z];
-							std::size_t y = 0;
-							points_y_ = start_y_;
-
-							for (; y < end_store_batch_; y += num_elements_per_batch)
-							{
-								EmuSIMD::store(sample_processor_(generator_(points_x_, points_y_, points_z_)), &(layer_1_[y]));
-								points_y_ = EmuSIMD::add(points_y_, step_y_);
-							}
-							_finish_major_segment_partial(generator_, sample_processor_, layer_1_, points_x_, points_y_, points_z_, y, end_y_);
-							points_z_ = EmuSIMD::add(points_z_, step_z_);
-						}
-						points_x_ = EmuSIMD::add(points_x_, step_x_);
+						pending_chunk_.get();
 					}
-				}
-				else
-				{
-					Register_ start_y_ = points_y_;
-					Register_ start_z_ = EmuSIMD::add(points_z_, EmuSIMD::mul(step_z_, EmuSIMD::setr_incrementing<Register_, 0>()));
-					step_z_ = EmuSIMD::mul(step_z_, EmuSIMD::set1<Register_>(num_elements_per_batch_value_cast));
-
-					for (std::size_t x = 0; x < end_x_; ++x)
+					catch (...)
 					{
-						auto& layer_0_ = samples[x];
-						points_y_ = start_y_;
-
-						for (std::size_t y = 0; y < end_y_; ++y)
+						if (first_exception_ == nullptr)
 						{
-							auto& layer_1_ = layer_0_[y];
-							std::size_t z = 0;
-							points_z_ = start_z_;
-
-							for (; z < end_store_batch_; z += num_elements_per_batch)
-							{
-								EmuSIMD::store(sample_processor_(generator_(points_x_, points_y_, points_z_)), &(layer_1_[z]));
-								points_z_ = EmuSIMD::add(points_z_, step_z_);
-							}
-							_finish_major_segment_partial(generator_, sample_processor_, layer_1_, points_x_, points_y_, points_z_, z, end_z_);
-							points_y_ = EmuSIMD::add(points_y_, step_y_);
+							first_exception_ = std::current_exception();
 						}
-						points_x_ = EmuSIMD::add(points_x_, step_x_);
 					}
 				}
 			}
-			else if constexpr (num_dimensions == 2)
+
+			if (first_exception_ != nullptr)
 			{
-				std::size_t end_x_ = table_size.at<0>();
-				std::size_t end_y_ = table_size.at<1>();
-				std::size_t end_store_batch_ = table_size.at<major_dimension>();
-				end_store_batch_ -= end_store_batch_ % num_elements_per_batch;
+				std::rethrow_exception(first_exception_);
+			}
+		}
 
+		/// <summary>
+		/// <para> Generates all samples of this table within the outermost layers [begin_, end_). For 1-dimensional tables, begin_ must be a multiple of the number of elements per register. </para>
+		/// <para> 
+		///		The sample at a local index of this table is generated for the coordinates at that index plus offset_ in the full table described by start_ and step_. 
+		///		Coordinates are calculated directly from full-table indices rather than accumulated, so any region produces the same samples as a full generation.
+		/// </para>
+		/// <para> Rows are padded to a multiple of storage_alignment bytes, so every batch - including the final partial batch of a row - is stored as a full aligned register. </para>
+		/// <para> If WithGradients_ is true, the derivatives of each sample are also stored to the gradient planes, which must have already been reserved. </para>
+		/// </summary>
+		template<class Register_, bool WithGradients_ = false, class Generator_, class SampleProcessor_>
+		inline void _do_generation
+		(
+			Generator_& generator_,
+			SampleProcessor_& sample_processor_,
+			const EmuMath::Vector<num_dimensions, value_type> start_,
+			const EmuMath::Vector<num_dimensions, value_type> step_,
+			const coordinate_type& offset_,
+			const std::size_t begin_,
+			const std::size_t end_
+		)
+		{
+			const Register_ start_major_ = EmuSIMD::set1<Register_>(start_.template at<major_dimension>());
+			const Register_ step_major_ = EmuSIMD::set1<Register_>(step_.template at<major_dimension>());
+			const std::size_t major_offset_ = offset_.template at<major_dimension>();
 
-				Register_ points_x_ = EmuSIMD::set1<Register_>(start_.at<0>());
-				Register_ points_y_ = EmuSIMD::set1<Register_>(start_.at<1>());
-				Register_ step_x_ = EmuSIMD::set1<Register_>(step_.at<0>());
-				Register_ step_y_ = EmuSIMD::set1<Register_>(step_.at<1>());
+			if constexpr (num_dimensions == 3)
+			{
+				const std::size_t outer_offset_ = offset_.template at<outer_dimension>();
+				const std::size_t middle_offset_ = offset_.template at<middle_dimension>();
+				const std::size_t end_middle_ = _num_middle_layers();
+				const std::size_t end_major_ = table_size.template at<major_dimension>();
+				const std::size_t gradient_plane_size_ = WithGradients_ ? stored_size() : 0;
 
-				if constexpr (major_dimension == 0)
-				{
-					Register_ start_x_ = EmuSIMD::add(points_x_, EmuSIMD::mul_all(step_x_, EmuSIMD::setr_incrementing<Register_, 0>()));
-					step_x_ = EmuSIMD::mul(step_x_, EmuSIMD::set1<Register_>(num_elements_per_batch_value_cast));
-					for (std::size_t y = 0; y < end_y_; ++y)
-					{
-						auto& layer_ = samples[y];
-						std::size_t x = 0;
-						points_x_ = start_x_;
-						for (; x < end_store_batch_; x += num_elements_per_batch)
-						{
-							EmuSIMD::store(sample_processor_(generator_(points_x_, points_y_)), &(layer_[x]));
-							points_x_ = EmuSIMD::add(points_x_, step_x_);
-						}
-						_finish_major_segment_partial(generator_, sample_processor_, layer_, points_x_, points_y_, x, end_x_);
-						points_y_ = EmuSIMD::add(points_y_, step_y_);
-					}
-				}
-				else
+				for (std::size_t outer = begin_; outer < end_; ++outer)
 				{
-					Register_ start_y_ = EmuSIMD::add(points_y_, EmuSIMD::mul_all(step_y_, EmuSIMD::setr_incrementing<Register_, 0>()));
-					step_y_ = EmuSIMD::mul(step_y_, EmuSIMD::set1<Register_>(num_elements_per_batch_value_cast));
-					for (std::size_t x = 0; x < end_x_; ++x)
+					const Register_ points_outer_ = EmuSIMD::set1<Register_>(_layer_coordinate<outer_dimension>(start_, step_, outer_offset_ + outer));
+					for (std::size_t middle = 0; middle < end_middle_; ++middle)
 					{
-						auto& layer_ = samples[x];
-						std::size_t y = 0;
-						points_y_ = start_y_;
-						for (; y < end_store_batch_; y += num_elements_per_batch)
-						{
-							EmuSIMD::store(sample_processor_(generator_(points_x_, points_y_)), &(layer_[y]));
-							points_y_ = EmuSIMD::add(points_y_, step_y_);
-						}
-						_finish_major_segment_partial(generator_, sample_processor_, layer_, points_x_, points_y_, y, end_y_);
-						points_x_ = EmuSIMD::add(points_x_, step_x_);
+						const Register_ points_middle_ = EmuSIMD::set1<Register_>(_layer_coordinate<middle_dimension>(start_, step_, middle_offset_ + middle));
+						value_type* p_row_ = _row_ptr(outer, middle);
+						_do_row_generation<Register_, WithGradients_>
+						(
+							generator_,
+							sample_processor_,
+							p_row_,
+							start_major_,
+							step_major_,
+							major_offset_,
+							0,
+							end_major_,
+							points_outer_,
+							points_middle_,
+							WithGradients_ ? (gradient_samples + (p_row_ - samples)) : nullptr,
+							gradient_plane_size_
+						);
 					}
 				}
 			}
-			else if constexpr (num_dimensions == 1)
+			else if constexpr (num_dimensions == 2)
 			{
-				std::size_t end_ = table_size.at<0>();
-				std::size_t end_store_batch_ = table_size.at<0>();
-				end_store_batch_ -= end_store_batch_ % num_elements_per_batch;
-
-
-				Register_ points_simd_ = EmuSIMD::set1<Register_>(start_.at<0>());
-				Register_ step_simd_ = EmuSIMD::set1<Register_>(step_.at<0>());
-				points_simd_ = EmuSIMD::add(points_simd_, EmuSIMD::mul_all(step_simd_, EmuSIMD::setr_incrementing<Register_, 0>()));
-				step_simd_ = EmuSIMD::mul(step_simd_, EmuSIMD::set1<Register_>(num_elements_per_batch_value_cast));
+				const std::size_t outer_offset_ = offset_.template at<outer_dimension>();
+				const std::size_t end_major_ = table_size.template at<major_dimension>();
 
-				std::size_t i = 0;
-				for (; i < end_store_batch_; i += num_elements_per_batch)
+				for (std::size_t outer = begin_; outer < end_; ++outer)
 				{
-					EmuSIMD::store(sample_processor_(generator_(points_simd_)), &(samples[i]));
-					points_simd_ = EmuSIMD::add(points_simd_, step_simd_);
+					const Register_ points_outer_ = EmuSIMD::set1<Register_>(_layer_coordinate<outer_dimension>(start_, step_, outer_offset_ + outer));
+					_do_row_generation<Register_>(generator_, sample_processor_, _row_ptr(outer), start_major_, step_major_, major_offset_, 0, end_major_, points_outer_, points_outer_);
 				}
-				_finish_major_segment_partial(generator_, sample_processor_, samples, points_simd_, i, end_);
+			}
+			else if constexpr (num_dimensions == 1)
+			{
+				_do_row_generation<Register_>(generator_, sample_processor_, samples, start_major_, step_major_, major_offset_, begin_, end_, start_major_, start_major_);
 			}
 			else
 			{
@@ -542,90 +1117,196 @@ namespace EmuMath
 			}
 		}
 
-		[[nodiscard]] static constexpr inline bool _valid_resolution(const EmuMath::Vector<num_dimensions, std::size_t>& new_size_)
+		/// <summary>
+		/// <para> Generates the samples [begin_, end_) of the major-dimension row at p_row_, where begin_ is a multiple of the number of elements per register. </para>
+		/// <para> points_outer_ and points_middle_ are the coordinates of the row in the outer and middle dimensions, and are ignored where this table does not have such a dimension. </para>
+		/// <para> If WithGradients_ is true, the derivatives in each dimension are stored to p_gradient_row_, with each dimension's plane gradient_plane_size_ elements after the previous. </para>
+		/// </summary>
+		template<class Register_, bool WithGradients_ = false, class Generator_, class SampleProcessor_>
+		static inline void _do_row_generation
+		(
+			Generator_& generator_,
+			SampleProcessor_& sample_processor_,
+			value_type* p_row_,
+			const Register_& start_major_,
+			const Register_& step_major_,
+			const std::size_t major_offset_,
+			const std::size_t begin_,
+			const std::size_t end_,
+			const Register_& points_outer_,
+			const Register_& points_middle_,
+			value_type* p_gradient_row_ = nullptr,
+			const std::size_t gradient_plane_size_ = 0
+		)
 		{
-			return !new_size_.CmpAnyEqual(std::size_t(0));
-		}
+			constexpr std::size_t num_elements_per_batch = EmuSIMD::TMP::simd_register_width_v<Register_> / (sizeof(value_type) * 8);
+			static_assert
+			(
+				storage_alignment % (EmuSIMD::TMP::simd_register_width_v<Register_> / 8) == 0,
+				"Attempted to generate a FastNoiseTable row with a register wider than the table's storage_alignment, which would make its aligned row stores invalid."
+			);
+			using int_register_type = typename EmuMath::Functors::_underlying_noise_gen::_fast_noise_register_info<Register_>::int_register_type;
+			const int_register_type lane_indices_ = EmuSIMD::setr_incrementing<int_register_type, 0, 32>();
 
-		void _do_resize(const coordinate_type& new_size_)
-		{
-			// We only do a resize if the new size is greater than what we currently have
-			// --- This avoids a clear when resizing to something smaller, unlike the normal NoiseTable
-			// --- This pertains to the "fast" aims of this noise table
-			if (new_size_.CmpAnyGreater(table_size))
+			for (std::size_t i = begin_; i < end_; i += num_elements_per_batch)
 			{
+				// Full-table indices are formed as integers and converted to float once per lane, rather than adding lane offsets in float
+				// --- This rounds each index exactly once, so every lane receives the same coordinate as it would for any other region containing it, even beyond 2^24
+				// --- Wrapped offsets of regions at negative indices convert back to their signed index here
+				const int_register_type int_indices_ = EmuSIMD::add<32>(EmuSIMD::set1<int_register_type, 32>(static_cast<std::int32_t>(major_offset_ + i)), lane_indices_);
+				Register_ indices_ = EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(int_indices_);
+				Register_ points_major_ = EmuSIMD::fmadd(step_major_, indices_, start_major_);
+
 				if constexpr (num_dimensions == 1)
 				{
-					// simple resize for 1 dimension.
-					samples.resize(new_size_.at<0>());
+					EmuSIMD::store(sample_processor_(generator_(points_major_)), p_row_ + i);
 				}
 				else if constexpr (num_dimensions == 2)
 				{
-					samples.clear();
-					using layer_0_type = typename table_storage::value_type;
-
-					// Simple resize for 2-dimensions, since major_dimension differences are a simple swap
 					if constexpr (major_dimension == 0)
 					{
-						samples.resize(new_size_.at<1>(), layer_0_type(new_size_.at<0>()));
+						EmuSIMD::store(sample_processor_(generator_(points_major_, points_outer_)), p_row_ + i);
 					}
 					else
 					{
-						samples.resize(new_size_.at<0>(), layer_0_type(new_size_.at<1>()));
+						EmuSIMD::store(sample_processor_(generator_(points_outer_, points_major_)), p_row_ + i);
 					}
 				}
-				else if constexpr (num_dimensions == 3)
+				else if constexpr (WithGradients_)
 				{
-					samples.clear();
-					using layer_0_type = typename table_storage::value_type;
-					using layer_1_type = typename layer_0_type::value_type;
-
-					// More complex for 3-dimensions as multiple layers change with major storage
-					// --- Major item is always contiguous for its length
-					// --- Always stored in alphabetical order excluding major (i.e. X-major will be stored YZX, Y-major stored XZY, Z-major stored XYZ)
+					Register_ dx_, dy_, dz_;
+					Register_ result_;
 					if constexpr (major_dimension == 0)
 					{
-						samples.resize
-						(
-							new_size_.at<1>(),
-							layer_0_type
-							(
-								new_size_.at<2>(),
-								layer_1_type(new_size_.at<0>())
-							)
-						);
+						result_ = generator_.SampleWithDerivatives(points_major_, points_outer_, points_middle_, dx_, dy_, dz_);
 					}
 					else if constexpr (major_dimension == 1)
 					{
-						samples.resize
-						(
-							new_size_.at<0>(),
-							layer_0_type
-							(
-								new_size_.at<2>(),
-								layer_1_type(new_size_.at<1>())
-							)
-						);
+						result_ = generator_.SampleWithDerivatives(points_outer_, points_major_, points_middle_, dx_, dy_, dz_);
 					}
 					else
 					{
-						samples.resize
-						(
-							new_size_.at<0>(),
-							layer_0_type
-							(
-								new_size_.at<1>(),
-								layer_1_type(new_size_.at<2>())
-							)
-						);
+						result_ = generator_.SampleWithDerivatives(points_outer_, points_middle_, points_major_, dx_, dy_, dz_);
 					}
+					EmuSIMD::store(sample_processor_(result_), p_row_ + i);
+					EmuSIMD::store(dx_, p_gradient_row_ + i);
+					EmuSIMD::store(dy_, p_gradient_row_ + gradient_plane_size_ + i);
+					EmuSIMD::store(dz_, p_gradient_row_ + (gradient_plane_size_ * 2) + i);
 				}
 				else
 				{
-					static_assert(EmuCore::TMP::get_false<std::size_t, num_dimensions>(), "Attempted to resize an EmuMath::FastNoiseTable with a prohibited number of dimensions.");
+					if constexpr (major_dimension == 0)
+					{
+						EmuSIMD::store(sample_processor_(generator_(points_major_, points_outer_, points_middle_)), p_row_ + i);
+					}
+					else if constexpr (major_dimension == 1)
+					{
+						EmuSIMD::store(sample_processor_(generator_(points_outer_, points_major_, points_middle_)), p_row_ + i);
+					}
+					else
+					{
+						EmuSIMD::store(sample_processor_(generator_(points_outer_, points_middle_, points_major_)), p_row_ + i);
+					}
 				}
 			}
+		}
+
+		[[nodiscard]] static constexpr inline bool _valid_resolution(const EmuMath::Vector<num_dimensions, std::size_t>& new_size_)
+		{
+			return !new_size_.CmpAnyEqual(std::size_t(0));
+		}
+
+		[[nodiscard]] static inline value_type* _allocate(std::size_t num_elements_)
+		{
+			return static_cast<value_type*>(::operator new(num_elements_ * sizeof(value_type), std::align_val_t(storage_alignment)));
+		}
+
+		static inline void _deallocate(value_type* p_samples_) noexcept
+		{
+			if (p_samples_ != nullptr)
+			{
+				::operator delete(p_samples_, std::align_val_t(storage_alignment));
+			}
+		}
+
+		/// <summary>
+		/// <para> Ensures storage for at least min_capacity_ samples. Existing samples are not preserved if a reallocation is required. </para>
+		/// <para> The new storage is allocated before the old storage is released, so the existing storage is left untouched if allocation throws. </para>
+		/// </summary>
+		inline void _reserve_discarding(std::size_t min_capacity_)
+		{
+			if (min_capacity_ > sample_capacity)
+			{
+				value_type* p_new_samples_ = _allocate(min_capacity_);
+				_deallocate(samples);
+				samples = p_new_samples_;
+				sample_capacity = min_capacity_;
+			}
+		}
+
+		/// <summary>
+		/// <para> Ensures storage for at least min_capacity_ gradients. Existing gradients are not preserved if a reallocation is required. </para>
+		/// <para> The new storage is allocated before the old storage is released, so the existing storage is left untouched if allocation throws. </para>
+		/// </summary>
+		inline void _reserve_gradients_discarding(std::size_t min_capacity_)
+		{
+			if (min_capacity_ > gradient_capacity)
+			{
+				value_type* p_new_gradients_ = _allocate(min_capacity_);
+				_deallocate(gradient_samples);
+				gradient_samples = p_new_gradients_;
+				gradient_capacity = min_capacity_;
+			}
+		}
+
+		void _do_resize(const coordinate_type& new_size_)
+		{
+			// Storage is only reallocated when it needs to grow, and is otherwise reused in-place as generation overwrites every sample
+			// --- This avoids reallocation when resizing to something smaller or differently shaped, unlike the normal NoiseTable
+			// --- This pertains to the "fast" aims of this noise table
+			// --- The previous dimensions are restored if allocation fails, so that they never describe more samples than are allocated
+			const std::size_t old_major_row_stride_ = major_row_stride;
+			const coordinate_type old_table_size_ = table_size;
+			std::size_t major_size_ = new_size_.at<major_dimension>();
+			major_row_stride = major_size_ + ((elements_per_aligned_block - (major_size_ % elements_per_aligned_block)) % elements_per_aligned_block);
 			table_size = new_size_;
+			try
+			{
+				_reserve_discarding(stored_size());
+			}
+			catch (...)
+			{
+				major_row_stride = old_major_row_stride_;
+				table_size = old_table_size_;
+				throw;
+			}
+			gradients_generated = false;
+		}
+
+		/// <summary> Number of layers between the outermost layers and major-dimension rows. Only meaningful for 3-dimensional tables. </summary>
+		[[nodiscard]] inline std::size_t _num_middle_layers() const
+		{
+			if constexpr (major_dimension == 2)
+			{
+				return table_size.template at<1>();
+			}
+			else
+			{
+				return table_size.template at<2>();
+			}
+		}
+
+		/// <summary> Pointer to the start of the major-dimension row at the provided outermost layer index and, for 3-dimensional tables, middle layer index. </summary>
+		[[nodiscard]] inline value_type* _row_ptr(std::size_t outer_index_, std::size_t middle_index_ = 0)
+		{
+			if constexpr (num_dimensions == 3)
+			{
+				return samples + (((outer_index_ * _num_middle_layers()) + middle_index_) * major_row_stride);
+			}
+			else
+			{
+				return samples + (outer_index_ * major_row_stride);
+			}
 		}
 
 		[[nodiscard]] value_type& _get_index(const coordinate_type& coords_)
@@ -640,12 +1321,12 @@ namespace EmuMath
 				if constexpr (MajorDimensionIndex_ == 0)
 				{
 					// X coords stored contiguously per row
-					return samples[coords_.at<1>()][coords_.at<0>()];
+					return _row_ptr(coords_.at<1>())[coords_.at<0>()];
 				}
 				else
 				{
 					// Y coords stored contiguously per column
-					return samples[coords_.at<0>()][coords_.at<1>()];
+					return _row_ptr(coords_.at<0>())[coords_.at<1>()];
 				}
 			}
 			else if constexpr (NumDimensions_ == 3)
@@ -653,15 +1334,15 @@ namespace EmuMath
 				// We store in alphabetical order before the major (i.e. X-major will be stored YZX, Y-major stored XZY, Z-major stored XYZ)
 				if constexpr (MajorDimensionIndex_ == 0)
 				{
-					return samples[coords_.at<1>()][coords_.at<2>()][coords_.at<0>()];
+					return _row_ptr(coords_.at<1>(), coords_.at<2>())[coords_.at<0>()];
 				}
 				else if constexpr (MajorDimensionIndex_ == 1)
 				{
-					return samples[coords_.at<0>()][coords_.at<2>()][coords_.at<1>()];
+					return _row_ptr(coords_.at<0>(), coords_.at<2>())[coords_.at<1>()];
 				}
 				else
 				{
-					return samples[coords_.at<0>()][coords_.at<1>()][coords_.at<2>()];
+					return _row_ptr(coords_.at<0>(), coords_.at<1>())[coords_.at<2>()];
 				}
 			}
 			else
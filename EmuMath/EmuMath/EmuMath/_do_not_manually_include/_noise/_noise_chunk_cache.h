@@ -0,0 +1,586 @@
+#ifndef EMU_MATH_NOISE_CHUNK_CACHE_H_INC_
+#define EMU_MATH_NOISE_CHUNK_CACHE_H_INC_ 1
+
+#include "_fast_noise_table.h"
+#include <array>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <list>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace EmuMath
+{
+	/// <summary>
+	/// <para> Cache of fixed-size chunks of noise over an unbounded grid of integer world coordinates, where each chunk is stored in an EmuMath::FastNoiseTable. </para>
+	/// <para> Chunks are generated on demand when a sample within them is requested, or ahead of time for a region via Prefetch, which may spread generation over a thread pool. </para>
+	/// <para>
+	///		When generating a new chunk would exceed the memory budget, the least-recently used chunk is evicted and its storage reused for the new chunk.
+	///		At least 1 chunk is always kept, regardless of the budget.
+	/// </para>
+	/// <para>
+	///		The sample at world coordinates W is generated for the point `start_point + step * W` of the options passed on construction, where step is the result of their MakeStep.
+	///		Their table_resolution is only used to calculate that step, and is otherwise ignored.
+	/// </para>
+	/// <para>
+	///		Chunks are generated via FastNoiseTable::GenerateNoiseRegion from world indices rather than per-chunk origins, so samples are bit-identical to those of a single table 
+	///		containing them and chunks join seamlessly. World coordinates in the major dimension must be representable as a std::int32_t.
+	/// </para>
+	/// </summary>
+	template
+	<
+		std::size_t NumDimensions_,
+		EmuMath::NoiseType NoiseType_,
+		class SampleProcessor_ = EmuMath::Functors::fast_noise_sample_processor_default,
+		std::size_t MajorDimensionIndex_ = NumDimensions_ - 1
+	>
+	class NoiseChunkCache
+	{
+	public:
+		using chunk_table_type = EmuMath::FastNoiseTable<NumDimensions_, MajorDimensionIndex_>;
+		static constexpr std::size_t num_dimensions = chunk_table_type::num_dimensions;
+		static constexpr EmuMath::NoiseType noise_type = NoiseType_;
+		using value_type = typename chunk_table_type::value_type;
+		using this_type = NoiseChunkCache<NumDimensions_, NoiseType_, SampleProcessor_, MajorDimensionIndex_>;
+		using options_type = typename chunk_table_type::options_type;
+		using sample_processor_type = SampleProcessor_;
+		/// <summary> Type used to index individual samples over the whole world. </summary>
+		using world_coordinate_type = EmuMath::Vector<num_dimensions, std::int64_t>;
+		/// <summary> Type used to index chunks. The chunk at chunk coordinates C contains the samples from world coordinates C * chunk_size() inclusive to (C + 1) * chunk_size() exclusive. </summary>
+		using chunk_coordinate_type = EmuMath::Vector<num_dimensions, std::int64_t>;
+		/// <summary> Type used to index samples within a single chunk. </summary>
+		using local_coordinate_type = typename chunk_table_type::coordinate_type;
+
+#pragma region CONSTRUCTORS
+	public:
+		/// <summary> Creates an empty cache which generates noise described by world_options_ in chunks of chunk_size_, holding at most memory_budget_bytes_ of samples. </summary>
+		/// <param name="world_options_">: Options describing noise over the whole world. See the class summary for how these are interpreted.</param>
+		/// <param name="chunk_size_">: Number of samples in each dimension of a chunk. Dimensions of 0 are treated as 1.</param>
+		/// <param name="memory_budget_bytes_">: Maximum number of bytes of sample storage held by generated chunks, including row padding.</param>
+		/// <param name="sample_processor_">: Processor applied to every generated sample.</param>
+		NoiseChunkCache
+		(
+			const options_type& world_options_,
+			const local_coordinate_type& chunk_size_,
+			std::size_t memory_budget_bytes_,
+			const sample_processor_type& sample_processor_ = sample_processor_type()
+		) :
+			chunk_options(_make_chunk_options(world_options_, chunk_size_)),
+			sample_processor(sample_processor_),
+			chunks(),
+			lru_order(),
+			max_num_chunks(0),
+			p_last_entry(nullptr),
+			last_chunk_coords(),
+			num_hits(0),
+			num_misses(0)
+		{
+			SetMemoryBudget(memory_budget_bytes_);
+		}
+
+		// Entries reference their own position in the LRU order, so copying would leave them referring to the copied cache
+		NoiseChunkCache(const this_type&) = delete;
+		NoiseChunkCache(this_type&&) = default;
+		this_type& operator=(const this_type&) = delete;
+		this_type& operator=(this_type&&) = default;
+#pragma endregion
+
+#pragma region SAMPLE_ACCESS
+	public:
+		/// <summary> Retrieves the sample at the provided world coordinates, generating its chunk if it is not already cached. </summary>
+		template<typename OnlyAvailableFor1Dimensional_ = std::enable_if_t<num_dimensions == 1>>
+		[[nodiscard]] inline value_type at(std::int64_t x_)
+		{
+			return at(world_coordinate_type(x_));
+		}
+		template<typename OnlyAvailableFor2Dimensional_ = std::enable_if_t<num_dimensions == 2>>
+		[[nodiscard]] inline value_type at(std::int64_t x_, std::int64_t y_)
+		{
+			return at(world_coordinate_type(x_, y_));
+		}
+		template<typename OnlyAvailableFor3Dimensional_ = std::enable_if_t<num_dimensions == 3>>
+		[[nodiscard]] inline value_type at(std::int64_t x_, std::int64_t y_, std::int64_t z_)
+		{
+			return at(world_coordinate_type(x_, y_, z_));
+		}
+		[[nodiscard]] inline value_type at(const world_coordinate_type& world_coords_)
+		{
+			chunk_coordinate_type chunk_coords_;
+			local_coordinate_type local_coords_;
+			for (std::size_t i = 0; i < num_dimensions; ++i)
+			{
+				const std::int64_t size_ = static_cast<std::int64_t>(chunk_options.table_resolution[i]);
+				const std::int64_t world_ = world_coords_[i];
+				chunk_coords_[i] = _chunk_index(world_, size_);
+				local_coords_[i] = static_cast<std::size_t>(world_ - (chunk_coords_[i] * size_));
+			}
+			return _find_or_generate(chunk_coords_).table.at(local_coords_);
+		}
+
+		template<typename OnlyAvailableFor1Dimensional_ = std::enable_if_t<num_dimensions == 1>>
+		[[nodiscard]] inline value_type operator()(std::int64_t x_)
+		{
+			return at(x_);
+		}
+		template<typename OnlyAvailableFor2Dimensional_ = std::enable_if_t<num_dimensions == 2>>
+		[[nodiscard]] inline value_type operator()(std::int64_t x_, std::int64_t y_)
+		{
+			return at(x_, y_);
+		}
+		template<typename OnlyAvailableFor3Dimensional_ = std::enable_if_t<num_dimensions == 3>>
+		[[nodiscard]] inline value_type operator()(std::int64_t x_, std::int64_t y_, std::int64_t z_)
+		{
+			return at(x_, y_, z_);
+		}
+		[[nodiscard]] inline value_type operator()(const world_coordinate_type& world_coords_)
+		{
+			return at(world_coords_);
+		}
+
+		/// <summary>
+		/// <para> Retrieves the table of the chunk at the provided chunk coordinates, generating it if it is not already cached. </para>
+		/// <para> The returned reference is invalidated when the chunk is evicted, which may occur when any other chunk is generated. </para>
+		/// </summary>
+		[[nodiscard]] inline const chunk_table_type& GetChunk(const chunk_coordinate_type& chunk_coords_)
+		{
+			return _find_or_generate(chunk_coords_).table;
+		}
+
+		/// <summary> Returns true if the chunk at the provided chunk coordinates is currently cached. This does not affect its recency. </summary>
+		[[nodiscard]] inline bool Contains(const chunk_coordinate_type& chunk_coords_) const
+		{
+			return chunks.find(_make_key(chunk_coords_)) != chunks.end();
+		}
+#pragma endregion
+
+#pragma region GENERATION
+	public:
+		/// <summary>
+		/// <para> Ensures that every chunk containing a sample in the inclusive world region [world_min_, world_max_] is cached, generating missing chunks on the calling thread. </para>
+		/// <para> If the region covers more chunks than the memory budget allows, only the most recently visited chunks are generated. </para>
+		/// </summary>
+		inline void Prefetch(const world_coordinate_type& world_min_, const world_coordinate_type& world_max_)
+		{
+			std::vector<chunk_coordinate_type> missing_ = _touch_region(world_min_, world_max_);
+			for (const chunk_coordinate_type& chunk_coords_ : missing_)
+			{
+				_generate_and_insert(chunk_coords_);
+			}
+		}
+
+		/// <summary>
+		/// <para> Ensures that every chunk containing a sample in the inclusive world region [world_min_, world_max_] is cached, generating missing chunks concurrently on the passed thread_pool_. </para>
+		/// <para> The calling thread generates one of the missing chunks itself, and this will not return until all missing chunks have been generated. </para>
+		/// <para> The thread pool must provide `NumThreads()` and `AllocateTask(func_)` returning a std::future, such as EmuThreads::ThreadPool. </para>
+		/// <para> If the region covers more chunks than the memory budget allows, only the most recently visited chunks are generated. </para>
+		/// <para> 
+		///		If generating any chunk throws, every other chunk is still waited on before the first exception is rethrown. 
+		///		Chunks which were generated successfully are cached, and chunks which failed are not.
+		/// </para>
+		/// <para> This must not be called from one of thread_pool_'s own workers, as waiting on chunks queued to the same pool may deadlock. </para>
+		/// </summary>
+		template<class ThreadPool_>
+		inline void Prefetch(const world_coordinate_type& world_min_, const world_coordinate_type& world_max_, ThreadPool_& thread_pool_)
+		{
+			std::vector<chunk_coordinate_type> missing_ = _touch_region(world_min_, world_max_);
+			if (missing_.empty())
+			{
+				return;
+			}
+			else if (static_cast<std::size_t>(thread_pool_.NumThreads()) == 0 || missing_.size() == 1)
+			{
+				for (const chunk_coordinate_type& chunk_coords_ : missing_)
+				{
+					_generate_and_insert(chunk_coords_);
+				}
+				return;
+			}
+
+			// Storage is acquired (evicting as needed) before generation and entries are inserted after it, so that the cache is only modified on this thread
+			// --- Each task writes to a distinct table, and _generate_chunk takes the sample processor by value so that each task generates with its own copy
+			// --- tables_, missing_, and this are referenced by tasks, so every allocated task is waited on before this function returns or rethrows
+			const std::size_t num_missing_ = missing_.size();
+			std::vector<chunk_table_type> tables_;
+			tables_.reserve(num_missing_);
+			for (std::size_t i = 0; i < num_missing_; ++i)
+			{
+				tables_.emplace_back(_acquire_table(tables_.size()));
+			}
+
+			auto generate_ = [this, &tables_, &missing_](std::size_t index_)
+			{
+				_generate_chunk(tables_[index_], missing_[index_], sample_processor);
+			};
+			std::vector<std::future<void>> pending_chunks_;
+			std::vector<bool> generated_(num_missing_, false);
+			std::exception_ptr first_exception_ = nullptr;
+			auto record_exception_ = [&first_exception_]()
+			{
+				if (first_exception_ == nullptr)
+				{
+					first_exception_ = std::current_exception();
+				}
+			};
+
+			try
+			{
+				pending_chunks_.reserve(num_missing_ - 1);
+				for (std::size_t i = 0; i < (num_missing_ - 1); ++i)
+				{
+					pending_chunks_.emplace_back(thread_pool_.AllocateTask([&generate_, i]() { generate_(i); }));
+					if (!pending_chunks_.back().valid())
+					{
+						// The pool rejected this chunk (e.g. a full queue with a FAIL policy), so it is generated here instead
+						generate_(i);
+						generated_[i] = true;
+					}
+				}
+				generate_(num_missing_ - 1);
+				generated_[num_missing_ - 1] = true;
+			}
+			catch (...)
+			{
+				record_exception_();
+			}
+
+			for (std::size_t i = 0; i < pending_chunks_.size(); ++i)
+			{
+				if (pending_chunks_[i].valid())
+				{
+					try
+					{
+						pending_chunks_[i].get();
+						generated_[i] = true;
+					}
+					catch (...)
+					{
+						record_exception_();
+					}
+				}
+			}
+
+			for (std::size_t i = 0; i < num_missing_; ++i)
+			{
+				if (generated_[i])
+				{
+					_insert(missing_[i], std::move(tables_[i]));
+				}
+			}
+
+			if (first_exception_ != nullptr)
+			{
+				std::rethrow_exception(first_exception_);
+			}
+		}
+#pragma endregion
+
+#pragma region CACHE_MANAGEMENT
+	public:
+		/// <summary> Sets the maximum number of bytes of sample storage held by this cache, evicting least-recently used chunks until it is respected. </summary>
+		inline void SetMemoryBudget(std::size_t memory_budget_bytes_)
+		{
+			const std::size_t chunk_bytes_ = chunk_size_bytes();
+			max_num_chunks = memory_budget_bytes_ / chunk_bytes_;
+			max_num_chunks = max_num_chunks != 0 ? max_num_chunks : 1;
+			while (chunks.size() > max_num_chunks)
+			{
+				_evict_lru();
+			}
+		}
+
+		/// <summary> Removes all chunks from this cache and releases their storage. Hit and miss counts are not reset. </summary>
+		inline void Clear()
+		{
+			chunks.clear();
+			lru_order.clear();
+			p_last_entry = nullptr;
+		}
+
+		/// <summary> Number of chunks currently cached. </summary>
+		[[nodiscard]] inline std::size_t size() const
+		{
+			return chunks.size();
+		}
+
+		/// <summary> Maximum number of chunks that may be cached under the current memory budget. </summary>
+		[[nodiscard]] inline std::size_t max_size() const
+		{
+			return max_num_chunks;
+		}
+
+		/// <summary> Number of samples in each dimension of a chunk. </summary>
+		[[nodiscard]] inline local_coordinate_type chunk_size() const
+		{
+			return chunk_options.table_resolution;
+		}
+
+		/// <summary> Number of bytes of sample storage used by a single chunk, including row padding. </summary>
+		[[nodiscard]] inline std::size_t chunk_size_bytes() const
+		{
+			constexpr std::size_t elements_per_aligned_block = chunk_table_type::storage_alignment / sizeof(value_type);
+			const local_coordinate_type& size_ = chunk_options.table_resolution;
+			std::size_t num_elements_ = size_.template at<MajorDimensionIndex_>();
+			num_elements_ += (elements_per_aligned_block - (num_elements_ % elements_per_aligned_block)) % elements_per_aligned_block;
+			for (std::size_t i = 0; i < num_dimensions; ++i)
+			{
+				num_elements_ *= (i == MajorDimensionIndex_) ? 1 : size_[i];
+			}
+			return num_elements_ * sizeof(value_type);
+		}
+
+		/// <summary> Number of chunk lookups which found an already-cached chunk. </summary>
+		[[nodiscard]] inline std::size_t hits() const
+		{
+			return num_hits;
+		}
+
+		/// <summary> Number of chunk lookups which required a chunk to be generated. Chunks generated by Prefetch are also counted. </summary>
+		[[nodiscard]] inline std::size_t misses() const
+		{
+			return num_misses;
+		}
+#pragma endregion
+
+	private:
+		using key_type = std::array<std::int64_t, num_dimensions>;
+		using lru_list = std::list<key_type>;
+
+		struct _key_hash
+		{
+			[[nodiscard]] inline std::size_t operator()(const key_type& key_) const
+			{
+				std::uint64_t hash_ = 0xCBF29CE484222325ULL;
+				for (const std::int64_t coord_ : key_)
+				{
+					hash_ = (hash_ ^ static_cast<std::uint64_t>(coord_)) * 0x100000001B3ULL;
+					hash_ ^= hash_ >> 29;
+				}
+				return static_cast<std::size_t>(hash_);
+			}
+		};
+
+		struct _chunk_entry
+		{
+			chunk_table_type table;
+			typename lru_list::iterator lru_position;
+		};
+
+		/// <summary> Options of the world with its step pinned, and a table_resolution of a single chunk. </summary>
+		options_type chunk_options;
+		sample_processor_type sample_processor;
+		std::unordered_map<key_type, _chunk_entry, _key_hash> chunks;
+		/// <summary> Keys of cached chunks, from most-recently used at the front to least-recently used at the back. </summary>
+		lru_list lru_order;
+		std::size_t max_num_chunks;
+		/// <summary> Most recently accessed entry, allowing repeated access to the same chunk to skip hashing. Always at the front of lru_order when not null. </summary>
+		_chunk_entry* p_last_entry;
+		key_type last_chunk_coords;
+		std::size_t num_hits;
+		std::size_t num_misses;
+
+		/// <summary>
+		/// <para> Creates the options used to generate every chunk, in step mode with the step of the passed world_options_. </para>
+		/// <para> Permutations using BOOL_INPUT are pinned to the seed they would currently use, as that seed is otherwise time-dependent and chunks would not join seamlessly. </para>
+		/// </summary>
+		[[nodiscard]] static inline options_type _make_chunk_options(const options_type& world_options_, const local_coordinate_type& chunk_size_)
+		{
+			options_type out_(world_options_);
+			out_.end_point_or_step = world_options_.MakeStep();
+			out_.step_mode = true;
+			for (std::size_t i = 0; i < num_dimensions; ++i)
+			{
+				out_.table_resolution[i] = chunk_size_[i] != 0 ? chunk_size_[i] : 1;
+			}
+
+			EmuMath::Info::NoisePermutationInfo& permutation_info_ = out_.permutation_info;
+			if (EmuMath::Info::validate_noise_permutation_shuffle_mode(permutation_info_.shuffle_mode) == EmuMath::Info::NoisePermutationShuffleMode::BOOL_INPUT)
+			{
+				if (permutation_info_.bool_input)
+				{
+					permutation_info_.shuffle_mode = EmuMath::Info::NoisePermutationShuffleMode::SEED_64;
+					permutation_info_.seed_64 = EmuMath::NoisePermutations::default_seed_64();
+				}
+				else
+				{
+					permutation_info_.shuffle_mode = EmuMath::Info::NoisePermutationShuffleMode::SEED_32;
+					permutation_info_.seed_32 = EmuMath::NoisePermutations::default_seed_32();
+				}
+			}
+			return out_;
+		}
+
+		/// <summary> Index of the chunk containing the provided world index in a dimension where chunks are chunk_size_ samples wide, rounding towards negative infinity. </summary>
+		[[nodiscard]] static constexpr inline std::int64_t _chunk_index(const std::int64_t world_index_, const std::int64_t chunk_size_)
+		{
+			return world_index_ >= 0 ? (world_index_ / chunk_size_) : (-((-(world_index_ + 1)) / chunk_size_) - 1);
+		}
+
+		[[nodiscard]] static inline key_type _make_key(const chunk_coordinate_type& chunk_coords_)
+		{
+			key_type out_;
+			for (std::size_t i = 0; i < num_dimensions; ++i)
+			{
+				out_[i] = chunk_coords_[i];
+			}
+			return out_;
+		}
+
+		/// <summary> Finds the entry for the provided chunk, moving it to the front of the LRU order, or generates it if it is not cached. </summary>
+		inline _chunk_entry& _find_or_generate(const chunk_coordinate_type& chunk_coords_)
+		{
+			const key_type key_ = _make_key(chunk_coords_);
+			if (p_last_entry != nullptr && key_ == last_chunk_coords)
+			{
+				++num_hits;
+				return *p_last_entry;
+			}
+
+			auto found_ = chunks.find(key_);
+			if (found_ != chunks.end())
+			{
+				++num_hits;
+				_chunk_entry& entry_ = found_->second;
+				lru_order.splice(lru_order.begin(), lru_order, entry_.lru_position);
+				p_last_entry = &entry_;
+				last_chunk_coords = key_;
+				return entry_;
+			}
+			else
+			{
+				return _generate_and_insert(chunk_coords_);
+			}
+		}
+
+		/// <summary>
+		/// <para> Generates the chunk at the provided chunk coordinates and inserts it at the front of the LRU order. The chunk must not already be cached. </para>
+		/// <para> The chunk is only inserted once generation has succeeded, so a throwing generation never leaves a partially generated chunk in the cache. </para>
+		/// </summary>
+		inline _chunk_entry& _generate_and_insert(const chunk_coordinate_type& chunk_coords_)
+		{
+			chunk_table_type table_ = _acquire_table();
+			_generate_chunk(table_, chunk_coords_, sample_processor);
+			return _insert(chunk_coords_, std::move(table_));
+		}
+
+		/// <summary> Moves every cached chunk within the provided world region to the front of the LRU order, and outputs up to max_size() of the last-visited chunks within it which are not cached. </summary>
+		[[nodiscard]] inline std::vector<chunk_coordinate_type> _touch_region(const world_coordinate_type& world_min_, const world_coordinate_type& world_max_)
+		{
+			chunk_coordinate_type min_chunk_;
+			chunk_coordinate_type max_chunk_;
+			for (std::size_t i = 0; i < num_dimensions; ++i)
+			{
+				const std::int64_t size_ = static_cast<std::int64_t>(chunk_options.table_resolution[i]);
+				const std::int64_t min_ = world_min_[i] < world_max_[i] ? world_min_[i] : world_max_[i];
+				const std::int64_t max_ = world_min_[i] < world_max_[i] ? world_max_[i] : world_min_[i];
+				min_chunk_[i] = _chunk_index(min_, size_);
+				max_chunk_[i] = _chunk_index(max_, size_);
+			}
+
+			std::vector<chunk_coordinate_type> missing_;
+			chunk_coordinate_type chunk_coords_ = min_chunk_;
+			bool finished_ = false;
+			while (!finished_)
+			{
+				auto found_ = chunks.find(_make_key(chunk_coords_));
+				if (found_ != chunks.end())
+				{
+					lru_order.splice(lru_order.begin(), lru_order, found_->second.lru_position);
+				}
+				else
+				{
+					missing_.push_back(chunk_coords_);
+				}
+
+				// Advance with X varying fastest, finishing once every dimension has wrapped
+				finished_ = true;
+				for (std::size_t i = 0; i < num_dimensions; ++i)
+				{
+					if (chunk_coords_[i] < max_chunk_[i])
+					{
+						++chunk_coords_[i];
+						finished_ = false;
+						break;
+					}
+					chunk_coords_[i] = min_chunk_[i];
+				}
+			}
+
+			if (missing_.size() > max_num_chunks)
+			{
+				// Chunks which would be evicted by later chunks of the same region are not worth generating
+				missing_.erase(missing_.begin(), missing_.end() - static_cast<std::ptrdiff_t>(max_num_chunks));
+			}
+
+			p_last_entry = nullptr;
+			return missing_;
+		}
+
+		/// <summary>
+		/// <para> Provides a table to store a new chunk in, evicting the least-recently used chunk and reusing its storage if the cache is full. </para>
+		/// <para> num_pending_ is the number of previously acquired tables which are yet to be inserted, and are counted towards the cache's size. </para>
+		/// </summary>
+		[[nodiscard]] inline chunk_table_type _acquire_table(std::size_t num_pending_ = 0)
+		{
+			if (!chunks.empty() && (chunks.size() + num_pending_) >= max_num_chunks)
+			{
+				return _evict_lru();
+			}
+			else
+			{
+				return chunk_table_type();
+			}
+		}
+
+		/// <summary> Removes the least-recently used chunk, outputting its table so that its storage may be reused. </summary>
+		inline chunk_table_type _evict_lru()
+		{
+			auto found_ = chunks.find(lru_order.back());
+			chunk_table_type out_(std::move(found_->second.table));
+			if (p_last_entry == &(found_->second))
+			{
+				p_last_entry = nullptr;
+			}
+			chunks.erase(found_);
+			lru_order.pop_back();
+			return out_;
+		}
+
+		/// <summary> Inserts an entry for the provided chunk at the front of the LRU order, taking ownership of the passed table. The chunk must not already be cached. </summary>
+		inline _chunk_entry& _insert(const chunk_coordinate_type& chunk_coords_, chunk_table_type&& table_)
+		{
+			++num_misses;
+			const key_type key_ = _make_key(chunk_coords_);
+			lru_order.push_front(key_);
+			_chunk_entry& entry_ = chunks[key_];
+			entry_.table = std::move(table_);
+			entry_.lru_position = lru_order.begin();
+			p_last_entry = &entry_;
+			last_chunk_coords = key_;
+			return entry_;
+		}
+
+		/// <summary>
+		/// <para> Generates the chunk at the provided chunk coordinates into the passed table_, reusing its storage where possible. </para>
+		/// <para> This does not modify the cache itself, so may be called concurrently for distinct tables. </para>
+		/// <para> Throws a std::out_of_range exception if the chunk contains major-dimension world coordinates which cannot be represented as a std::int32_t. </para>
+		/// </summary>
+		inline void _generate_chunk(chunk_table_type& table_, const chunk_coordinate_type& chunk_coords_, sample_processor_type sample_processor_) const
+		{
+			world_coordinate_type region_begin_;
+			for (std::size_t i = 0; i < num_dimensions; ++i)
+			{
+				region_begin_[i] = chunk_coords_[i] * static_cast<std::int64_t>(chunk_options.table_resolution[i]);
+			}
+
+			if (!table_.template GenerateNoiseRegion<NoiseType_, sample_processor_type>(chunk_options, region_begin_, chunk_options.table_resolution, sample_processor_))
+			{
+				throw std::out_of_range("Attempted to generate an EmuMath NoiseChunkCache chunk containing major-dimension world coordinates beyond the range of a 32-bit integer.");
+			}
+		}
+	};
+}
+
+#endif
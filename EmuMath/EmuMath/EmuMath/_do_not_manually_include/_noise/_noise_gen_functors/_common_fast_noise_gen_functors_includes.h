@@ -5,162 +5,247 @@
 #include "../../../../EmuSIMD/SIMDHelpers.h"
 #include "../../../../EmuCore/TMPHelpers/Values.h"
 #include <array>
+#include <climits>
+#include <cstdint>
+#include <type_traits>
 
 namespace EmuMath::Functors::_underlying_noise_gen
 {
-	template<>
-	struct perlin_gradients<3, __m128>
+	/// <summary>
+	/// <para> Common information for generating fast noise via width-generic implementations with the provided floating-point Register_. </para>
+	/// <para> Used by all fast noise functors, which are implemented once for __m128, __m256, and __m512. </para>
+	/// </summary>
+	template<class Register_>
+	struct _fast_noise_register_info
 	{
-	public:
-		using underlying_gradients_instance = perlin_gradients<3, float>;
-		using gradient_type = typename underlying_gradients_instance::gradient_type;
+		using register_type = EmuCore::TMP::remove_ref_cv_t<Register_>;
+		using int_register_type = EmuSIMD::TMP::integer_register_type_t<EmuSIMD::TMP::simd_register_width_v<register_type>>;
+		static constexpr std::size_t num_elements = EmuSIMD::TMP::simd_register_width_v<register_type> / (sizeof(float) * CHAR_BIT);
+	};
 
-		static constexpr std::size_t num_gradients = underlying_gradients_instance::num_gradients;
-		static constexpr std::size_t mask = underlying_gradients_instance::mask;
+	/// <summary> Converts the floats in the passed register to 32-bit integers, using the current rounding mode. </summary>
+	template<class Register_>
+	[[nodiscard]] inline typename _fast_noise_register_info<Register_>::int_register_type _fast_cvt_to_int(Register_ in_)
+	{
+		if constexpr (std::is_same_v<Register_, __m128>)
+		{
+			return _mm_cvtps_epi32(in_);
+		}
+		else if constexpr (std::is_same_v<Register_, __m256>)
+		{
+			return _mm256_cvtps_epi32(in_);
+		}
+		else if constexpr (std::is_same_v<Register_, __m512>)
+		{
+			return _mm512_cvtps_epi32(in_);
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to convert a register to integers for fast noise generation, but the provided Register_ is not a supported floating-point register. Supported registers: __m128, __m256, __m512.");
+		}
+	}
 
-		using register_array = std::array<const __m128, num_gradients>;
+	/// <summary> Converts the 32-bit integers in the passed register to floats, outputting the floating-point register of the same width. </summary>
+	template<class IntRegister_>
+	[[nodiscard]] inline auto _fast_cvt_to_float(IntRegister_ in_)
+	{
+		if constexpr (std::is_same_v<IntRegister_, __m128i>)
+		{
+			return _mm_cvtepi32_ps(in_);
+		}
+		else if constexpr (std::is_same_v<IntRegister_, __m256i>)
+		{
+			return _mm256_cvtepi32_ps(in_);
+		}
+		else if constexpr (std::is_same_v<IntRegister_, __m512i>)
+		{
+			return _mm512_cvtepi32_ps(in_);
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<IntRegister_>(), "Attempted to convert a register to floats for fast noise generation, but the provided IntRegister_ is not a supported integral register. Supported registers: __m128i, __m256i, __m512i.");
+		}
+	}
 
-		/// <summary>
-		/// <para> Constructs an array of SIMD 128f registers representing this selection of perlin gradients. </para>
-		/// <para> 4D registers are provided, but the gradients are 3D; one index may be duplicated, which defaults to Z but may be customised via the template arg. </para>
-		/// <para> SpareIndex_ args: 0 = X, 1 = Y, 2 = Z. </para>
-		/// </summary>
-		/// <returns>Array of registers representing this selection of perlin gradients.</returns>
-		template<std::size_t SpareIndex_ = 2>
-		[[nodiscard]] static inline register_array init_registers()
+	/// <summary>
+	/// <para> Outputs a register of the passed OutRegister_ type containing the items in p_table_ at the respective 32-bit indices_. </para>
+	/// <para> Scalar fallback for gathers, used when the instruction set for a hardware gather of the provided width is unavailable. </para>
+	/// </summary>
+	template<class OutRegister_, typename T_, class IntRegister_>
+	[[nodiscard]] inline OutRegister_ _fast_scalar_gather(const T_* p_table_, IntRegister_ indices_)
+	{
+		constexpr std::size_t num_elements = sizeof(IntRegister_) / sizeof(std::int32_t);
+		alignas(IntRegister_) std::int32_t indices_array_[num_elements];
+		alignas(OutRegister_) T_ out_[num_elements];
+		EmuSIMD::store(indices_, indices_array_);
+		for (std::size_t i = 0; i < num_elements; ++i)
 		{
-			if constexpr (SpareIndex_ <= 2)
-			{
-				return
-				{
-					_set_register<0, 1, 2, SpareIndex_>(underlying_gradients_instance::values[0]),
-					_set_register<0, 1, 2, SpareIndex_>(underlying_gradients_instance::values[1]),
-					_set_register<0, 1, 2, SpareIndex_>(underlying_gradients_instance::values[2]),
-					_set_register<0, 1, 2, SpareIndex_>(underlying_gradients_instance::values[3]),
-					_set_register<0, 1, 2, SpareIndex_>(underlying_gradients_instance::values[4]),
-					_set_register<0, 1, 2, SpareIndex_>(underlying_gradients_instance::values[5]),
-					_set_register<0, 1, 2, SpareIndex_>(underlying_gradients_instance::values[6]),
-					_set_register<0, 1, 2, SpareIndex_>(underlying_gradients_instance::values[7]),
-					_set_register<0, 1, 2, SpareIndex_>(underlying_gradients_instance::values[8]),
-					_set_register<0, 1, 2, SpareIndex_>(underlying_gradients_instance::values[9]),
-					_set_register<0, 1, 2, SpareIndex_>(underlying_gradients_instance::values[10]),
-					_set_register<0, 1, 2, SpareIndex_>(underlying_gradients_instance::values[11]),
-					_set_register<0, 1, 2, SpareIndex_>(underlying_gradients_instance::values[12]),
-					_set_register<0, 1, 2, SpareIndex_>(underlying_gradients_instance::values[13]),
-					_set_register<0, 1, 2, SpareIndex_>(underlying_gradients_instance::values[14]),
-					_set_register<0, 1, 2, SpareIndex_>(underlying_gradients_instance::values[15])
-				};
-			}
-			else
-			{
-				static_assert(EmuCore::TMP::get_false<std::size_t, SpareIndex_>(), "Provided an invalid Index_ arg to perlin_gradients<3, __m128>::init_registers. Valid indices are: 0, 1, 2.");
-				return register_array();
-			}
+			out_[i] = p_table_[indices_array_[i]];
 		}
+		return EmuSIMD::load<OutRegister_>(out_);
+	}
 
-	private:
-		template<std::size_t X_, std::size_t Y_, std::size_t Z_, std::size_t W_>
-		[[nodiscard]] static inline __m128 _set_register(const gradient_type& scalar_)
+	/// <summary>
+	/// <para> Outputs the 32-bit integers in p_table_ at the respective 32-bit indices_, without the indices leaving registers where possible. </para>
+	/// <para> Uses a hardware gather if AVX2 (for __m128i and __m256i) or AVX-512F (for __m512i) is available; otherwise, a scalar fallback is used. </para>
+	/// </summary>
+	template<class IntRegister_>
+	[[nodiscard]] inline IntRegister_ _fast_gather_int32(const std::int32_t* p_table_, IntRegister_ indices_)
+	{
+		if constexpr (std::is_same_v<IntRegister_, __m128i>)
 		{
-			return EmuSIMD::set<__m128>(scalar_.at<W_>(), scalar_.at<Z_>(), scalar_.at<Y_>(), scalar_.at<X_>());
+#if defined(__AVX2__)
+			return _mm_i32gather_epi32(p_table_, indices_, 4);
+#else
+			return _fast_scalar_gather<IntRegister_>(p_table_, indices_);
+#endif
 		}
-	};
+		else if constexpr (std::is_same_v<IntRegister_, __m256i>)
+		{
+#if defined(__AVX2__)
+			return _mm256_i32gather_epi32(p_table_, indices_, 4);
+#else
+			return _fast_scalar_gather<IntRegister_>(p_table_, indices_);
+#endif
+		}
+		else if constexpr (std::is_same_v<IntRegister_, __m512i>)
+		{
+#if defined(__AVX512F__)
+			return _mm512_i32gather_epi32(indices_, p_table_, 4);
+#else
+			return _fast_scalar_gather<IntRegister_>(p_table_, indices_);
+#endif
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<IntRegister_>(), "Attempted to gather 32-bit integers for fast noise generation, but the provided IntRegister_ is not a supported integral register. Supported registers: __m128i, __m256i, __m512i.");
+		}
+	}
 
-	template<>
-	struct perlin_gradients<2, __m128>
+	/// <summary>
+	/// <para> Outputs the floats in p_table_ at the respective 32-bit indices_, as the floating-point register of the same width as the indices. </para>
+	/// <para> Uses a hardware gather if AVX2 (for __m128i and __m256i) or AVX-512F (for __m512i) is available; otherwise, a scalar fallback is used. </para>
+	/// </summary>
+	template<class IntRegister_>
+	[[nodiscard]] inline auto _fast_gather_float(const float* p_table_, IntRegister_ indices_)
 	{
-	public:
-		using underlying_gradients_instance = perlin_gradients<2, float>;
-		using gradient_type = typename underlying_gradients_instance::gradient_type;
+		if constexpr (std::is_same_v<IntRegister_, __m128i>)
+		{
+#if defined(__AVX2__)
+			return _mm_i32gather_ps(p_table_, indices_, 4);
+#else
+			return _fast_scalar_gather<__m128>(p_table_, indices_);
+#endif
+		}
+		else if constexpr (std::is_same_v<IntRegister_, __m256i>)
+		{
+#if defined(__AVX2__)
+			return _mm256_i32gather_ps(p_table_, indices_, 4);
+#else
+			return _fast_scalar_gather<__m256>(p_table_, indices_);
+#endif
+		}
+		else if constexpr (std::is_same_v<IntRegister_, __m512i>)
+		{
+#if defined(__AVX512F__)
+			return _mm512_i32gather_ps(indices_, p_table_, 4);
+#else
+			return _fast_scalar_gather<__m512>(p_table_, indices_);
+#endif
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<IntRegister_>(), "Attempted to gather floats for fast noise generation, but the provided IntRegister_ is not a supported integral register. Supported registers: __m128i, __m256i, __m512i.");
+		}
+	}
 
-		static constexpr std::size_t num_gradients = underlying_gradients_instance::num_gradients;
-		static constexpr std::size_t mask = underlying_gradients_instance::mask;
+	/// <summary>
+	/// <para> Outputs permutations_[(hashes_ + offsets_) &amp; mask_] for each element, chaining a permutation lookup entirely within registers. </para>
+	/// <para> Equivalent to the scalar noise functors' `permutations_[(perm + i) &amp; mask]` lookups when used with a FastNoisePermutations table. </para>
+	/// </summary>
+	template<class IntRegister_>
+	[[nodiscard]] inline IntRegister_ _fast_permute(const std::int32_t* p_permutations_, IntRegister_ hashes_, IntRegister_ offsets_, IntRegister_ mask_)
+	{
+		return _fast_gather_int32(p_permutations_, EmuSIMD::bitwise_and(EmuSIMD::add<32>(hashes_, offsets_), mask_));
+	}
 
-		using register_array = std::array<const __m128, num_gradients>;
+	/// <summary>
+	/// <para> Perlin gradients of the provided number of dimensions, stored as one contiguous table per component. </para>
+	/// <para> Allows gradients to be selected directly from permutations stored in integral registers, via gathers of each component. </para>
+	/// </summary>
+	template<std::size_t Dimensions_, class Register_>
+	struct _fast_perlin_gradient_table
+	{
+		using gradients = perlin_gradients<Dimensions_, float>;
+		using register_type = Register_;
+		using int_register_type = typename _fast_noise_register_info<Register_>::int_register_type;
+		static constexpr std::size_t num_gradients = gradients::num_gradients;
 
-		/// <summary>
-		/// <para> Constructs an array of SIMD 128f registers representing this selection of perlin gradients. </para>
-		/// <para> 4D registers are provided, but the gradients are 2D; two indices may be duplicated, which default to XY but may be customised via the template args. </para>
-		/// <para> SpareZ_ and SpareW_ args: 0 = X, 1 = Y </para>
-		/// </summary>
-		/// <returns>Array of registers representing this selection of perlin gradients.</returns>
-		template<std::size_t SpareZ_ = 0, std::size_t SpareW_ = 1>
-		[[nodiscard]] static inline register_array init_registers()
+		inline _fast_perlin_gradient_table() : 
+			components(),
+			mask(EmuSIMD::set1<int_register_type, 32>(static_cast<std::int32_t>(gradients::mask)))
 		{
-			if constexpr (SpareZ_ <= 1)
+			for (std::size_t i = 0; i < num_gradients; ++i)
 			{
-				if constexpr (SpareW_ <= 1)
+				components[0][i] = gradients::values[i].template at<0>();
+				if constexpr (Dimensions_ >= 2)
 				{
-					return
-					{
-						_set_register<0, 1, SpareZ_, SpareW_>(underlying_gradients_instance::values[0]),
-						_set_register<0, 1, SpareZ_, SpareW_>(underlying_gradients_instance::values[1]),
-						_set_register<0, 1, SpareZ_, SpareW_>(underlying_gradients_instance::values[2]),
-						_set_register<0, 1, SpareZ_, SpareW_>(underlying_gradients_instance::values[3]),
-						_set_register<0, 1, SpareZ_, SpareW_>(underlying_gradients_instance::values[4]),
-						_set_register<0, 1, SpareZ_, SpareW_>(underlying_gradients_instance::values[5]),
-						_set_register<0, 1, SpareZ_, SpareW_>(underlying_gradients_instance::values[6]),
-						_set_register<0, 1, SpareZ_, SpareW_>(underlying_gradients_instance::values[7])
-					};
+					components[1][i] = gradients::values[i].template at<1>();
 				}
-				else
+				if constexpr (Dimensions_ >= 3)
 				{
-					static_assert(EmuCore::TMP::get_false<std::size_t, SpareZ_>(), "Provided an invalid SpareW_ arg to perlin_gradients<2, __m128>::init_registers. Valid indices are: 0, 1.");
+					components[2][i] = gradients::values[i].template at<2>();
 				}
 			}
-			else
-			{
-				static_assert(EmuCore::TMP::get_false<std::size_t, SpareZ_>(), "Provided an invalid SpareZ_ arg to perlin_gradients<2, __m128>::init_registers. Valid indices are: 0, 1.");
-				return register_array();
-			}
 		}
 
-	private:
-		template<std::size_t X_, std::size_t Y_, std::size_t Z_, std::size_t W_>
-		[[nodiscard]] static inline __m128 _set_register(const gradient_type& scalar_)
+		/// <summary> Outputs the dot products of the gradients selected by the passed permutations_ with the provided weightings. Permutations are masked by this function. </summary>
+		template<class...Weightings_>
+		[[nodiscard]] inline register_type dot(int_register_type permutations_, Weightings_...weightings_) const
 		{
-			return EmuSIMD::set<__m128>(scalar_.at<W_>(), scalar_.at<Z_>(), scalar_.at<Y_>(), scalar_.at<X_>());
-		}
-	};
-
-	template<>
-	struct perlin_gradients<1, __m128>
-	{
-	public:
-		using underlying_gradients_instance = perlin_gradients<1, float>;
-		using gradient_type = typename underlying_gradients_instance::gradient_type;
+			static_assert(sizeof...(Weightings_) == Dimensions_, "Attempted to form a dot product with perlin gradients for fast noise generation, but the number of weightings does not match the number of dimensions.");
+			const int_register_type indices_ = EmuSIMD::bitwise_and(permutations_, mask);
+			const register_type weightings_array_[Dimensions_] = { weightings_... };
 
-		static constexpr std::size_t num_gradients = underlying_gradients_instance::num_gradients;
-		static constexpr std::size_t mask = underlying_gradients_instance::mask;
-
-		using register_array = std::array<const __m128, num_gradients>;
-
-		/// <summary>
-		/// <para> Constructs an array of SIMD 128f registers representing this selection of perlin gradients. </para>
-		/// <para> 4D registers are provided, but the gradients are 1D; two indices may be duplicated, all indices will be the same. </para>
-		/// <para> May alternatively provide 4 index arguments to form a register formed from the respective gradients. </para>
-		/// </summary>
-		/// <returns>Array of registers representing this selection of perlin gradients.</returns>
-		[[nodiscard]] static inline register_array init_registers()
-		{
-			return
+			register_type result_ = EmuSIMD::mul_all(_fast_gather_float(components[0], indices_), weightings_array_[0]);
+			for (std::size_t dimension_ = 1; dimension_ < Dimensions_; ++dimension_)
 			{
-				EmuSIMD::set1<__m128>(underlying_gradients_instance::values[0].at<0>()),
-				EmuSIMD::set1<__m128>(underlying_gradients_instance::values[1].at<0>()),
-			};
+				result_ = EmuSIMD::fmadd(_fast_gather_float(components[dimension_], indices_), weightings_array_[dimension_], result_);
+			}
+			return result_;
 		}
-		[[nodiscard]] static inline __m128 init_registers(std::size_t x_, std::size_t y_, std::size_t z_, std::size_t w_)
+
+		/// <summary> Outputs the components of the gradients selected by the passed permutations_ to out_components_, returning their dot products with the provided weightings. </summary>
+		template<class...Weightings_>
+		[[nodiscard]] inline register_type gather_and_dot(int_register_type permutations_, register_type (&out_components_)[Dimensions_], Weightings_...weightings_) const
 		{
-			return EmuSIMD::set<__m128>
-			(
-				underlying_gradients_instance::values[w_].at<0>(),
-				underlying_gradients_instance::values[z_].at<0>(),
-				underlying_gradients_instance::values[y_].at<0>(),
-				underlying_gradients_instance::values[x_].at<0>()
-			);
+			static_assert(sizeof...(Weightings_) == Dimensions_, "Attempted to form a dot product with perlin gradients for fast noise generation, but the number of weightings does not match the number of dimensions.");
+			const int_register_type indices_ = EmuSIMD::bitwise_and(permutations_, mask);
+			const register_type weightings_array_[Dimensions_] = { weightings_... };
+
+			out_components_[0] = _fast_gather_float(components[0], indices_);
+			register_type result_ = EmuSIMD::mul_all(out_components_[0], weightings_array_[0]);
+			for (std::size_t dimension_ = 1; dimension_ < Dimensions_; ++dimension_)
+			{
+				out_components_[dimension_] = _fast_gather_float(components[dimension_], indices_);
+				result_ = EmuSIMD::fmadd(out_components_[dimension_], weightings_array_[dimension_], result_);
+			}
+			return result_;
 		}
+
+		float components[Dimensions_][num_gradients];
+		int_register_type mask;
 	};
 
+	/// <summary> Falloff applied to simplex corner contributions, resulting from max(0, radius_squared_ - distance_squared_)^4 for each element. </summary>
+	template<class Register_>
+	[[nodiscard]] inline Register_ _fast_simplex_falloff(Register_ radius_squared_, Register_ distance_squared_)
+	{
+		Register_ t_ = EmuSIMD::clamp_min(EmuSIMD::sub(radius_squared_, distance_squared_), EmuSIMD::setzero<Register_>());
+		t_ = EmuSIMD::mul_all(t_, t_);
+		return EmuSIMD::mul_all(t_, t_);
+	}
+
 	template<class Register_>
 	struct _fast_smooth_t
 	{
@@ -175,7 +260,6 @@ namespace EmuMath::Functors::_underlying_noise_gen
 
 		[[nodiscard]] inline register_type operator()(register_type t_) const
 		{
-			register_type six_fifteen_ten_ = EmuSIMD::set<register_type>(0.0f, 10.0f, 15.0f, 6.0f);
 			register_type result_ = EmuSIMD::fmsub(t_, six, fifteen);
 			result_ = EmuSIMD::fmadd(t_, result_, ten);
 
@@ -187,6 +271,28 @@ namespace EmuMath::Functors::_underlying_noise_gen
 		register_type six;
 		register_type ten;
 	};
+
+	/// <summary> Derivative of _fast_smooth_t with respect to t, resulting from 30(t^2)(t - 1)^2 for each element. </summary>
+	template<class Register_>
+	struct _fast_smooth_t_derivative
+	{
+		using register_type = Register_;
+
+		inline _fast_smooth_t_derivative() :
+			thirty(EmuSIMD::set1<register_type>(30.0f)),
+			one(EmuSIMD::set1<register_type>(1.0f))
+		{
+		}
+
+		[[nodiscard]] inline register_type operator()(register_type t_) const
+		{
+			register_type result_ = EmuSIMD::mul_all(t_, EmuSIMD::sub(t_, one));
+			return EmuSIMD::mul_all(EmuSIMD::mul_all(result_, result_), thirty);
+		}
+
+		register_type thirty;
+		register_type one;
+	};
 }
 
 #endif
@@ -124,6 +124,57 @@ namespace EmuMath::Functors::_underlying_noise_gen
 		}
 	};
 
+	/// <summary>
+	/// <para> Constants used to generate simplex noise of the provided number of dimensions. </para>
+	/// <para> skew: Factor to skew input coordinates by to find the containing simplex cell. unskew: Factor to unskew cell coordinates back into input space. </para>
+	/// <para> radius_squared: Squared radius of each corner's contribution. scale: Multiplier applied to the summed contributions so that output targets the range -1:1. </para>
+	/// </summary>
+	template<std::size_t Dimensions_, typename T_>
+	struct simplex_info
+	{
+		constexpr simplex_info()
+		{
+			static_assert(EmuCore::TMP::get_false<T_>(), "Attempted to construct an unspecialised simplex_info instance.");
+		}
+	};
+	template<typename T_>
+	struct simplex_info<1, T_>
+	{
+		static constexpr T_ radius_squared = T_(1);
+		static constexpr T_ scale = T_(256) / T_(81);
+	};
+	template<typename T_>
+	struct simplex_info<2, T_>
+	{
+		// (sqrt(3) - 1) / 2
+		static constexpr T_ skew = T_(0.36602540378443864676);
+		// (3 - sqrt(3)) / 6
+		static constexpr T_ unskew = T_(0.21132486540518711775);
+		static constexpr T_ radius_squared = T_(0.5);
+		static constexpr T_ scale = T_(99.2);
+	};
+	template<typename T_>
+	struct simplex_info<3, T_>
+	{
+		static constexpr T_ skew = T_(1) / T_(3);
+		static constexpr T_ unskew = T_(1) / T_(6);
+		static constexpr T_ radius_squared = T_(0.5);
+		static constexpr T_ scale = T_(76.88);
+	};
+
+	/// <summary> Falloff applied to a simplex corner's contribution, resulting from max(0, radius_squared_ - distance_squared_)^4. </summary>
+	template<typename T_>
+	constexpr inline T_ simplex_falloff(T_ radius_squared_, T_ distance_squared_)
+	{
+		T_ t_ = radius_squared_ - distance_squared_;
+		if (t_ <= T_(0))
+		{
+			return T_(0);
+		}
+		t_ *= t_;
+		return t_ * t_;
+	}
+
 	/// <summary>Function applied to t_ to smooth it for smooth noise generation algorithms defined in EmuMath. </summary>
 	/// <returns>Smoothed float t_, resulting from 6(t^5) - 15(t^4) + 10(t^3) (where t^x == t to the power of x).</returns>
 	template<typename T_>
@@ -132,6 +183,15 @@ namespace EmuMath::Functors::_underlying_noise_gen
 		return t_ * t_ * t_ * (t_ * (t_ * T_(6) - T_(15)) + T_(10));
 	}
 
+	/// <summary> Derivative of smooth_t with respect to t_, for calculating analytic derivatives of smooth noise. </summary>
+	/// <returns>Derivative of smooth_t at t_, resulting from 30(t^2)(t - 1)^2.</returns>
+	template<typename T_>
+	constexpr inline T_ smooth_t_derivative(T_ t_)
+	{
+		T_ t_minus_one_ = t_ - T_(1);
+		return T_(30) * t_ * t_ * t_minus_one_ * t_minus_one_;
+	}
+
 	/// <summary>Function to perform a dot product with an EmuMath vector using precalculated values outside of a vector without needing to construct one.</summary>
 	/// <param name="vec_">Vector to form a dot product with.</param>
 	/// <param name="x_">X-component of a theoretical vector to form a dot product with.</param>
@@ -3,9 +3,49 @@
 
 #include "_common_noise_gen_functor_includes.h"
 #include "../_noise_info/_fractal_noise_info.h"
+#include <vector>
 
 namespace EmuMath::Functors
 {
+	namespace _underlying_implementations
+	{
+		/// <summary>
+		/// <para> Frequency and amplitude of each octave of fractal noise, and the reciprocal of the sum of all amplitudes. </para>
+		/// <para> These depend only on the starting frequency and FractalNoiseInfo, so are calculated once on construction of a fractal wrapper rather than for every sample. </para>
+		/// </summary>
+		template<typename T_>
+		struct _fractal_octave_info
+		{
+			template<class FractalInfo_>
+			inline _fractal_octave_info(T_ freq_, const FractalInfo_& fractal_info_) : freqs(), amplitudes(), reciprocal_range(T_(1))
+			{
+				const std::size_t num_octaves_ = fractal_info_.GetOctaves() != 0 ? fractal_info_.GetOctaves() : 1;
+				const T_ lacunarity_ = static_cast<T_>(fractal_info_.GetLacunarity());
+				const T_ gain_ = static_cast<T_>(fractal_info_.GetGain());
+				freqs.reserve(num_octaves_);
+				amplitudes.reserve(num_octaves_);
+
+				T_ amplitude_ = T_(1);
+				T_ range_ = T_(1);
+				freqs.push_back(freq_);
+				amplitudes.push_back(amplitude_);
+				for (std::size_t octave_ = 1; octave_ < num_octaves_; ++octave_)
+				{
+					freq_ *= lacunarity_;
+					amplitude_ *= gain_;
+					range_ += amplitude_;
+					freqs.push_back(freq_);
+					amplitudes.push_back(amplitude_);
+				}
+				reciprocal_range = T_(1) / range_;
+			}
+
+			std::vector<T_> freqs;
+			std::vector<T_> amplitudes;
+			T_ reciprocal_range;
+		};
+	}
+
 	template<class PerIterationGenerator_, typename OutT_>
 	struct no_fractal_noise_wrapper
 	{
@@ -43,6 +83,16 @@ namespace EmuMath::Functors
 			return generator(point_, freq, permutations);
 		}
 
+		/// <summary>
+		/// <para> Produces a sample along with its analytic partial derivatives with respect to each component of point_, in the form (sample, d/dx, d/dy, d/dz). </para>
+		/// <para> Only available where the generator provides a SampleWithDerivatives function. </para>
+		/// </summary>
+		template<typename Point_>
+		inline auto SampleWithDerivatives(const Point_& point_)
+		{
+			return generator.SampleWithDerivatives(point_, freq, permutations);
+		}
+
 		generator_type generator;
 		EmuMath::NoisePermutations permutations;
 		value_type freq;
@@ -57,56 +107,97 @@ namespace EmuMath::Functors
 		using fractal_info_type = EmuMath::Info::FractalNoiseInfo<value_type>;
 
 		template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<generator_type, GeneratorConstructorArgs_...>>>
-		constexpr fractal_noise_wrapper
+		inline fractal_noise_wrapper
 		(
 			float freq_,
 			const EmuMath::NoisePermutations& permutations_,
 			const fractal_info_type& fractal_info_,
 			GeneratorConstructorArgs_&&...generator_constructor_args_
 		) :
-			freq(freq_),
-			fractal_info(fractal_info_),
+			octaves(static_cast<value_type>(freq_), fractal_info_),
+			generator(generator_constructor_args_...),
 			permutations(permutations_),
-			generator(generator_constructor_args_...)
+			fractal_info(fractal_info_),
+			freq(static_cast<value_type>(freq_))
 		{
 		}
 		template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<generator_type, GeneratorConstructorArgs_...>>>
-		constexpr fractal_noise_wrapper
+		inline fractal_noise_wrapper
 		(
 			value_type freq_,
 			EmuMath::NoisePermutations&& permutations_,
 			const fractal_info_type& fractal_info_,
 			GeneratorConstructorArgs_&&...generator_constructor_args_
 		) :
-			freq(freq_),
-			fractal_info(fractal_info_),
+			octaves(static_cast<value_type>(freq_), fractal_info_),
+			generator(generator_constructor_args_...),
 			permutations(permutations_),
-			generator(generator_constructor_args_...)
+			fractal_info(fractal_info_),
+			freq(static_cast<value_type>(freq_))
 		{
 		}
 
 		template<typename Point_>
-		constexpr inline value_type operator()(const Point_& point_)
+		inline value_type operator()(const Point_& point_)
 		{
-			value_type freq_ = freq;
-			value_type result_ = generator(point_, freq_, permutations);
-			value_type range_ = value_type(1);
-			value_type amplitude_ = value_type(1);
-			value_type lacunarity_ = fractal_info.GetLacunarity();
-			value_type gain_ = fractal_info.GetGain();
-			for (std::size_t octave_ = 1, end_ = fractal_info.GetOctaves(); octave_ < end_; ++octave_)
+			value_type result_ = generator(point_, octaves.freqs[0], permutations);
+			const std::size_t end_ = octaves.freqs.size();
+			if (1 < end_)
 			{
-				freq_ *= lacunarity_;
-				amplitude_ *= gain_;
-				range_ += amplitude_;
-				result_ += generator(point_, freq_, permutations) * amplitude_;
+				for (std::size_t octave_ = 1; octave_ < end_; ++octave_)
+				{
+					result_ += generator(point_, octaves.freqs[octave_], permutations) * octaves.amplitudes[octave_];
+				}
+				return result_ * octaves.reciprocal_range;
+			}
+			else
+			{
+				return result_;
 			}
-			return result_ / range_;
 		}
 
-		fractal_info_type fractal_info;
+		/// <summary>
+		/// <para> Produces a fractal sample along with its analytic partial derivatives with respect to each component of point_, in the form (sample, d/dx, d/dy, d/dz). </para>
+		/// <para> Derivatives are accumulated with the same amplitudes as samples, so they remain the exact derivatives of the value produced by this wrapper's operator(). </para>
+		/// <para> Only available where the generator provides a SampleWithDerivatives function. </para>
+		/// </summary>
+		template<typename Point_>
+		inline auto SampleWithDerivatives(const Point_& point_)
+		{
+			auto result_ = generator.SampleWithDerivatives(point_, octaves.freqs[0], permutations);
+			const std::size_t end_ = octaves.freqs.size();
+			if (1 < end_)
+			{
+				for (std::size_t octave_ = 1; octave_ < end_; ++octave_)
+				{
+					result_ += generator.SampleWithDerivatives(point_, octaves.freqs[octave_], permutations) * octaves.amplitudes[octave_];
+				}
+				return result_ * octaves.reciprocal_range;
+			}
+			else
+			{
+				return result_;
+			}
+		}
+
+		/// <summary> Starting frequency used on construction. This is read-only, as the frequency of each octave is calculated from it once. </summary>
+		[[nodiscard]] inline value_type GetFreq() const
+		{
+			return freq;
+		}
+
+		/// <summary> Fractal information used on construction. This is read-only, as octaves are calculated from it once. </summary>
+		[[nodiscard]] inline const fractal_info_type& GetFractalInfo() const
+		{
+			return fractal_info;
+		}
+
+		_underlying_implementations::_fractal_octave_info<value_type> octaves;
 		generator_type generator;
 		EmuMath::NoisePermutations permutations;
+
+	private:
+		fractal_info_type fractal_info;
 		value_type freq;
 	};
 }
@@ -2,12 +2,20 @@
 #define EMU_MATH_NOISE_PERMUTATIONS_H_INC_ 1
 
 #include "../../../Random.h"
+#include <cstdint>
 
 namespace EmuMath
 {
 	using NoisePermutationValue = std::size_t;
 	/// <summary> Integer sequence used as noise permutations for default-defined EmuMath noise generation functors. </summary>
 	using NoisePermutations = EmuMath::ShuffledIntSequence<NoisePermutationValue>;
+
+	using FastNoisePermutationValue = std::int32_t;
+	/// <summary> 
+	/// <para> 32-bit integer sequence used as noise permutations for SIMD noise generation functors. </para>
+	/// <para> Values are the width of a SIMD integer lane, allowing permutations to be gathered directly into registers. </para>
+	/// </summary>
+	using FastNoisePermutations = EmuMath::ShuffledIntSequence<FastNoisePermutationValue>;
 }
 
 #endif
@@ -122,6 +122,43 @@ namespace EmuMath::Functors
 			return operator()(static_cast<value_type>(point_.at<0>()), freq_, permutations_);
 		}
 	};
+
+	/// <summary> Functor to produce 1-dimensional simplex noise, summing the contributions of the 2 surrounding points. Produced noise targets the range -1:1. </summary>
+	template<typename FP_>
+	struct make_noise_1d<EmuMath::NoiseType::SIMPLEX, FP_>
+	{
+		static_assert(std::is_floating_point_v<FP_>, "Invalid FP_ type argument provided to EmuMath::Functors::make_noise_1d; the type must be a floating point.");
+		using value_type = FP_;
+		using gradients = EmuMath::Functors::_underlying_noise_gen::perlin_gradients<1, value_type>;
+		using simplex_info = EmuMath::Functors::_underlying_noise_gen::simplex_info<1, value_type>;
+
+		EmuCore::do_floor<value_type> floor_;
+		constexpr make_noise_1d() : floor_()
+		{
+		}
+		inline value_type operator()(value_type point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
+		{
+			EmuMath::NoisePermutationValue mask_ = permutations_.HighestStoredValue();
+			point_ *= freq_;
+			EmuMath::NoisePermutationValue i_0_ = static_cast<EmuMath::NoisePermutationValue>(floor_(point_));
+			value_type t_0_ = point_ - static_cast<value_type>(i_0_);
+			value_type t_1_ = t_0_ - value_type(1);
+			i_0_ &= mask_;
+			EmuMath::NoisePermutationValue i_1_ = (i_0_ + 1) & mask_;
+
+			value_type val_0_ = EmuMath::Functors::_underlying_noise_gen::simplex_falloff(simplex_info::radius_squared, t_0_ * t_0_);
+			value_type val_1_ = EmuMath::Functors::_underlying_noise_gen::simplex_falloff(simplex_info::radius_squared, t_1_ * t_1_);
+			val_0_ *= gradients::values[permutations_[i_0_] & gradients::mask].template at<0>() * t_0_;
+			val_1_ *= gradients::values[permutations_[i_1_] & gradients::mask].template at<0>() * t_1_;
+
+			return (val_0_ + val_1_) * simplex_info::scale;
+		}
+		template<std::size_t Size_, typename T_>
+		inline value_type operator()(const EmuMath::Vector<Size_, T_>& point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
+		{
+			return operator()(static_cast<value_type>(point_.at<0>()), freq_, permutations_);
+		}
+	};
 }
 
 #endif
@@ -151,6 +151,81 @@ namespace EmuMath::Functors
 			return operator()(EmuMath::Vector<2, value_type>(point_), freq_, permutations_);
 		}
 	};
+
+	/// <summary> Functor to produce 2-dimensional simplex noise, summing the contributions of the 3 corners of the containing triangle. Produced noise targets the range -1:1. </summary>
+	template<typename FP_>
+	struct make_noise_2d<EmuMath::NoiseType::SIMPLEX, FP_>
+	{
+		static_assert(std::is_floating_point_v<FP_>, "Invalid FP_ type argument provided to EmuMath::Functors::make_noise_2d; the type must be a floating point.");
+		using value_type = FP_;
+		using gradients = EmuMath::Functors::_underlying_noise_gen::perlin_gradients<2, FP_>;
+		using simplex_info = EmuMath::Functors::_underlying_noise_gen::simplex_info<2, value_type>;
+
+		EmuCore::do_floor<value_type> floor_;
+		constexpr make_noise_2d() : floor_()
+		{
+		}
+		[[nodiscard]] inline value_type operator()(EmuMath::Vector<2, value_type> point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
+		{
+			EmuMath::NoisePermutationValue mask_ = permutations_.HighestStoredValue();
+			point_ *= freq_;
+
+			// Skew to find the containing cell, then unskew its origin to find offsets from the first corner
+			value_type skew_ = (point_.at<0>() + point_.at<1>()) * simplex_info::skew;
+			value_type cell_x_ = floor_(point_.at<0>() + skew_);
+			value_type cell_y_ = floor_(point_.at<1>() + skew_);
+			value_type unskew_ = (cell_x_ + cell_y_) * simplex_info::unskew;
+			value_type x_0_ = point_.at<0>() - (cell_x_ - unskew_);
+			value_type y_0_ = point_.at<1>() - (cell_y_ - unskew_);
+
+			// Middle corner is (1, 0) in the lower triangle, or (0, 1) in the upper triangle
+			EmuMath::NoisePermutationValue ix_1_offset_ = (x_0_ > y_0_) ? 1 : 0;
+			EmuMath::NoisePermutationValue iy_1_offset_ = 1 - ix_1_offset_;
+			value_type x_1_ = x_0_ - static_cast<value_type>(ix_1_offset_) + simplex_info::unskew;
+			value_type y_1_ = y_0_ - static_cast<value_type>(iy_1_offset_) + simplex_info::unskew;
+			value_type x_2_ = x_0_ - value_type(1) + (value_type(2) * simplex_info::unskew);
+			value_type y_2_ = y_0_ - value_type(1) + (value_type(2) * simplex_info::unskew);
+
+			EmuMath::NoisePermutationValue ix_0_ = static_cast<EmuMath::NoisePermutationValue>(cell_x_) & mask_;
+			EmuMath::NoisePermutationValue iy_0_ = static_cast<EmuMath::NoisePermutationValue>(cell_y_) & mask_;
+
+			return 
+			(
+				_corner(ix_0_, iy_0_, x_0_, y_0_, mask_, permutations_) +
+				_corner((ix_0_ + ix_1_offset_) & mask_, iy_0_ + iy_1_offset_, x_1_, y_1_, mask_, permutations_) +
+				_corner((ix_0_ + 1) & mask_, iy_0_ + 1, x_2_, y_2_, mask_, permutations_)
+			) * simplex_info::scale;
+		}
+		template<std::size_t Size_, typename T_, typename OnlyNonV2f = std::enable_if_t<Size_ != 2 || !std::is_same_v<value_type, T_>>>
+		[[nodiscard]] inline value_type operator()(const EmuMath::Vector<Size_, T_>& point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
+		{
+			return operator()(EmuMath::Vector<2, value_type>(point_), freq_, permutations_);
+		}
+
+	private:
+		[[nodiscard]] static inline value_type _corner
+		(
+			EmuMath::NoisePermutationValue ix_,
+			EmuMath::NoisePermutationValue iy_,
+			value_type x_,
+			value_type y_,
+			EmuMath::NoisePermutationValue mask_,
+			const EmuMath::NoisePermutations& permutations_
+		)
+		{
+			value_type falloff_ = EmuMath::Functors::_underlying_noise_gen::simplex_falloff(simplex_info::radius_squared, (x_ * x_) + (y_ * y_));
+			if (falloff_ != value_type(0))
+			{
+				std::size_t perm_x_ = static_cast<std::size_t>(permutations_[ix_]);
+				std::size_t perm_xy_ = static_cast<std::size_t>(permutations_[(perm_x_ + iy_) & mask_]);
+				return falloff_ * EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(gradients::values[perm_xy_ & gradients::mask], x_, y_);
+			}
+			else
+			{
+				return value_type(0);
+			}
+		}
+	};
 }
 
 #endif
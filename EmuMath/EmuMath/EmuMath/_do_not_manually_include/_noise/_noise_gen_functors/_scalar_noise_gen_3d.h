@@ -132,19 +132,101 @@ namespace EmuMath::Functors
 		}
 		[[nodiscard]] inline value_type operator()(EmuMath::Vector<3, value_type> point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
 		{
-			EmuMath::NoisePermutationValue mask_ = permutations_.HighestStoredValue();
 			point_ *= freq_;
+			value_type t_0_[3];
+			std::size_t gradient_indices_[8];
+			_find_cell(point_, permutations_, t_0_, gradient_indices_);
+
+			value_type corner_values_[8];
+			_corner_values(t_0_, gradient_indices_, corner_values_);
+			return _trilerp
+			(
+				corner_values_,
+				EmuMath::Functors::_underlying_noise_gen::smooth_t(t_0_[0]),
+				EmuMath::Functors::_underlying_noise_gen::smooth_t(t_0_[1]),
+				EmuMath::Functors::_underlying_noise_gen::smooth_t(t_0_[2])
+			);
+		}
+		template<std::size_t Size_, typename T_, typename OnlyNonV3f = std::enable_if_t<Size_ != 3 || !std::is_same_v<value_type, T_>>>
+		[[nodiscard]] inline value_type operator()(const EmuMath::Vector<Size_, T_>& point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
+		{
+			return operator()(EmuMath::Vector<3, value_type>(point_), freq_, permutations_);
+		}
+
+		/// <summary>
+		/// <para> Produces the same sample as this functor's operator(), along with its analytic partial derivatives with respect to each component of the passed point_. </para>
+		/// <para> Output is in the form (sample, d/dx, d/dy, d/dz). </para>
+		/// </summary>
+		[[nodiscard]] inline EmuMath::Vector<4, value_type> SampleWithDerivatives
+		(
+			EmuMath::Vector<3, value_type> point_,
+			value_type freq_,
+			const EmuMath::NoisePermutations& permutations_
+		) const
+		{
+			point_ *= freq_;
+			value_type t_0_[3];
+			std::size_t gradient_indices_[8];
+			_find_cell(point_, permutations_, t_0_, gradient_indices_);
+
+			value_type corner_values_[8];
+			_corner_values(t_0_, gradient_indices_, corner_values_);
+			const value_type tx_ = EmuMath::Functors::_underlying_noise_gen::smooth_t(t_0_[0]);
+			const value_type ty_ = EmuMath::Functors::_underlying_noise_gen::smooth_t(t_0_[1]);
+			const value_type tz_ = EmuMath::Functors::_underlying_noise_gen::smooth_t(t_0_[2]);
+
+			// Each derivative is the interpolated gradient component, plus the change in interpolation weight multiplied by the difference between the faces being interpolated
+			value_type corner_components_[3][8];
+			for (std::size_t i = 0; i < 8; ++i)
+			{
+				const typename gradients::gradient_type& gradient_ = gradients::values[gradient_indices_[i]];
+				corner_components_[0][i] = gradient_.template at<0>();
+				corner_components_[1][i] = gradient_.template at<1>();
+				corner_components_[2][i] = gradient_.template at<2>();
+			}
+			const value_type* v_ = corner_values_;
+			const value_type face_diff_x_ = lerp_(lerp_(v_[4] - v_[0], v_[6] - v_[2], ty_), lerp_(v_[5] - v_[1], v_[7] - v_[3], ty_), tz_);
+			const value_type face_diff_y_ = lerp_(lerp_(v_[2] - v_[0], v_[6] - v_[4], tx_), lerp_(v_[3] - v_[1], v_[7] - v_[5], tx_), tz_);
+			const value_type face_diff_z_ = lerp_(lerp_(v_[1] - v_[0], v_[5] - v_[4], tx_), lerp_(v_[3] - v_[2], v_[7] - v_[6], tx_), ty_);
+
+			return EmuMath::Vector<4, value_type>
+			(
+				_trilerp(corner_values_, tx_, ty_, tz_),
+				freq_ * (_trilerp(corner_components_[0], tx_, ty_, tz_) + (EmuMath::Functors::_underlying_noise_gen::smooth_t_derivative(t_0_[0]) * face_diff_x_)),
+				freq_ * (_trilerp(corner_components_[1], tx_, ty_, tz_) + (EmuMath::Functors::_underlying_noise_gen::smooth_t_derivative(t_0_[1]) * face_diff_y_)),
+				freq_ * (_trilerp(corner_components_[2], tx_, ty_, tz_) + (EmuMath::Functors::_underlying_noise_gen::smooth_t_derivative(t_0_[2]) * face_diff_z_))
+			);
+		}
+		template<std::size_t Size_, typename T_, typename OnlyNonV3f = std::enable_if_t<Size_ != 3 || !std::is_same_v<value_type, T_>>>
+		[[nodiscard]] inline EmuMath::Vector<4, value_type> SampleWithDerivatives
+		(
+			const EmuMath::Vector<Size_, T_>& point_,
+			value_type freq_,
+			const EmuMath::NoisePermutations& permutations_
+		) const
+		{
+			return SampleWithDerivatives(EmuMath::Vector<3, value_type>(point_), freq_, permutations_);
+		}
+
+	private:
+		/// <summary> Outputs the offset of point_ from the lowest corner of its cell, and the gradient index of each of the cell's 8 corners, ordered by their X, Y, and Z bits (i.e. 000, 001, 010, ..., 111). </summary>
+		inline void _find_cell
+		(
+			const EmuMath::Vector<3, value_type>& point_,
+			const EmuMath::NoisePermutations& permutations_,
+			value_type (&out_t_0_)[3],
+			std::size_t (&out_gradient_indices_)[8]
+		) const
+		{
+			EmuMath::NoisePermutationValue mask_ = permutations_.HighestStoredValue();
 
 			EmuMath::NoisePermutationValue ix_0_ = static_cast<EmuMath::NoisePermutationValue>(floor_(point_.at<0>()));
 			EmuMath::NoisePermutationValue iy_0_ = static_cast<EmuMath::NoisePermutationValue>(floor_(point_.at<1>()));
 			EmuMath::NoisePermutationValue iz_0_ = static_cast<EmuMath::NoisePermutationValue>(floor_(point_.at<2>()));
 
-			value_type tx_0_ = point_.at<0>() - ix_0_;
-			value_type ty_0_ = point_.at<1>() - iy_0_;
-			value_type tz_0_ = point_.at<2>() - iz_0_;
-			value_type tx_1_ = tx_0_ - value_type(1);
-			value_type ty_1_ = ty_0_ - value_type(1);
-			value_type tz_1_ = tz_0_ - value_type(1);
+			out_t_0_[0] = point_.at<0>() - ix_0_;
+			out_t_0_[1] = point_.at<1>() - iy_0_;
+			out_t_0_[2] = point_.at<2>() - iz_0_;
 
 			ix_0_ &= mask_;
 			iy_0_ &= mask_;
@@ -163,41 +245,262 @@ namespace EmuMath::Functors
 			std::size_t perm_10_ = static_cast<std::size_t>(permutations_[(perm_1_ + iy_0_) & mask_]);
 			std::size_t perm_11_ = static_cast<std::size_t>(permutations_[(perm_1_ + iy_1_) & mask_]);
 
-			std::size_t perm_000_ = static_cast<std::size_t>(permutations_[(perm_00_ + iz_0_) & mask_]);
-			std::size_t perm_001_ = static_cast<std::size_t>(permutations_[(perm_00_ + iz_1_) & mask_]);
-			std::size_t perm_010_ = static_cast<std::size_t>(permutations_[(perm_01_ + iz_0_) & mask_]);
-			std::size_t perm_011_ = static_cast<std::size_t>(permutations_[(perm_01_ + iz_1_) & mask_]);
-			std::size_t perm_100_ = static_cast<std::size_t>(permutations_[(perm_10_ + iz_0_) & mask_]);
-			std::size_t perm_101_ = static_cast<std::size_t>(permutations_[(perm_10_ + iz_1_) & mask_]);
-			std::size_t perm_110_ = static_cast<std::size_t>(permutations_[(perm_11_ + iz_0_) & mask_]);
-			std::size_t perm_111_ = static_cast<std::size_t>(permutations_[(perm_11_ + iz_1_) & mask_]);
-
-			value_type val_000_ = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(gradients::values[perm_000_ & gradients::mask], tx_0_, ty_0_, tz_0_);
-			value_type val_001_ = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(gradients::values[perm_001_ & gradients::mask], tx_0_, ty_0_, tz_1_);
-			value_type val_010_ = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(gradients::values[perm_010_ & gradients::mask], tx_0_, ty_1_, tz_0_);
-			value_type val_011_ = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(gradients::values[perm_011_ & gradients::mask], tx_0_, ty_1_, tz_1_);
-			value_type val_100_ = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(gradients::values[perm_100_ & gradients::mask], tx_1_, ty_0_, tz_0_);
-			value_type val_101_ = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(gradients::values[perm_101_ & gradients::mask], tx_1_, ty_0_, tz_1_);
-			value_type val_110_ = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(gradients::values[perm_110_ & gradients::mask], tx_1_, ty_1_, tz_0_);
-			value_type val_111_ = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(gradients::values[perm_111_ & gradients::mask], tx_1_, ty_1_, tz_1_);
-
-			value_type tx = EmuMath::Functors::_underlying_noise_gen::smooth_t(tx_0_);
-			value_type ty = EmuMath::Functors::_underlying_noise_gen::smooth_t(ty_0_);
-			value_type tz = EmuMath::Functors::_underlying_noise_gen::smooth_t(tz_0_);
+			out_gradient_indices_[0] = static_cast<std::size_t>(permutations_[(perm_00_ + iz_0_) & mask_]) & gradients::mask;
+			out_gradient_indices_[1] = static_cast<std::size_t>(permutations_[(perm_00_ + iz_1_) & mask_]) & gradients::mask;
+			out_gradient_indices_[2] = static_cast<std::size_t>(permutations_[(perm_01_ + iz_0_) & mask_]) & gradients::mask;
+			out_gradient_indices_[3] = static_cast<std::size_t>(permutations_[(perm_01_ + iz_1_) & mask_]) & gradients::mask;
+			out_gradient_indices_[4] = static_cast<std::size_t>(permutations_[(perm_10_ + iz_0_) & mask_]) & gradients::mask;
+			out_gradient_indices_[5] = static_cast<std::size_t>(permutations_[(perm_10_ + iz_1_) & mask_]) & gradients::mask;
+			out_gradient_indices_[6] = static_cast<std::size_t>(permutations_[(perm_11_ + iz_0_) & mask_]) & gradients::mask;
+			out_gradient_indices_[7] = static_cast<std::size_t>(permutations_[(perm_11_ + iz_1_) & mask_]) & gradients::mask;
+		}
 
+		/// <summary> Outputs the dot product of each corner's gradient with the offset from that corner, in the same order as _find_cell. </summary>
+		static inline void _corner_values(const value_type (&t_0_)[3], const std::size_t (&gradient_indices_)[8], value_type (&out_values_)[8])
+		{
+			const value_type t_[2][3] = { { t_0_[0], t_0_[1], t_0_[2] }, { t_0_[0] - value_type(1), t_0_[1] - value_type(1), t_0_[2] - value_type(1) } };
+			for (std::size_t i = 0; i < 8; ++i)
+			{
+				out_values_[i] = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar
+				(
+					gradients::values[gradient_indices_[i]],
+					t_[(i >> 2) & 1][0],
+					t_[(i >> 1) & 1][1],
+					t_[i & 1][2]
+				);
+			}
+		}
+
+		/// <summary> Trilinearly interpolates the passed corner values, ordered as in _find_cell, with the provided smoothed weightings. </summary>
+		[[nodiscard]] inline value_type _trilerp(const value_type (&corners_)[8], value_type tx_, value_type ty_, value_type tz_) const
+		{
 			return lerp_
 			(
-				lerp_(lerp_(val_000_, val_100_, tx), lerp_(val_010_, val_110_, tx), ty),
-				lerp_(lerp_(val_001_, val_101_, tx), lerp_(val_011_, val_111_, tx), ty),
-				tz
+				lerp_(lerp_(corners_[0], corners_[4], tx_), lerp_(corners_[2], corners_[6], tx_), ty_),
+				lerp_(lerp_(corners_[1], corners_[5], tx_), lerp_(corners_[3], corners_[7], tx_), ty_),
+				tz_
 			);
 		}
+	};
+
+	/// <summary> 
+	/// <para> Functor to produce 3-dimensional simplex noise. Produced noise targets the range -1:1. </para>
+	/// <para> Only the 4 corners of the containing tetrahedron contribute to each sample, compared to the 8 corners of the containing cube used by perlin noise. </para>
+	/// </summary>
+	template<typename FP_>
+	struct make_noise_3d<EmuMath::NoiseType::SIMPLEX, FP_>
+	{
+		static_assert(std::is_floating_point_v<FP_>, "Invalid FP_ type argument provided to EmuMath::Functors::make_noise_3d; the type must be a floating point.");
+		using value_type = FP_;
+		using gradients = EmuMath::Functors::_underlying_noise_gen::perlin_gradients<3, value_type>;
+		using simplex_info = EmuMath::Functors::_underlying_noise_gen::simplex_info<3, value_type>;
+
+		EmuCore::do_floor<value_type> floor_;
+		constexpr make_noise_3d() : floor_()
+		{
+		}
+		[[nodiscard]] inline value_type operator()(EmuMath::Vector<3, value_type> point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
+		{
+			EmuMath::NoisePermutationValue mask_ = permutations_.HighestStoredValue();
+			point_ *= freq_;
+
+			value_type offsets_[4][3];
+			EmuMath::NoisePermutationValue indices_[4][3];
+			_find_simplex(point_, mask_, offsets_, indices_);
+
+			return
+			(
+				_corner(indices_[0][0], indices_[0][1], indices_[0][2], offsets_[0][0], offsets_[0][1], offsets_[0][2], mask_, permutations_) +
+				_corner(indices_[1][0], indices_[1][1], indices_[1][2], offsets_[1][0], offsets_[1][1], offsets_[1][2], mask_, permutations_) +
+				_corner(indices_[2][0], indices_[2][1], indices_[2][2], offsets_[2][0], offsets_[2][1], offsets_[2][2], mask_, permutations_) +
+				_corner(indices_[3][0], indices_[3][1], indices_[3][2], offsets_[3][0], offsets_[3][1], offsets_[3][2], mask_, permutations_)
+			) * simplex_info::scale;
+		}
 		template<std::size_t Size_, typename T_, typename OnlyNonV3f = std::enable_if_t<Size_ != 3 || !std::is_same_v<value_type, T_>>>
 		[[nodiscard]] inline value_type operator()(const EmuMath::Vector<Size_, T_>& point_, value_type freq_, const EmuMath::NoisePermutations& permutations_) const
 		{
 			return operator()(EmuMath::Vector<3, value_type>(point_), freq_, permutations_);
 		}
+
+		/// <summary>
+		/// <para> Produces the same sample as this functor's operator(), along with its analytic partial derivatives with respect to each component of the passed point_. </para>
+		/// <para> Output is in the form (sample, d/dx, d/dy, d/dz). </para>
+		/// </summary>
+		[[nodiscard]] inline EmuMath::Vector<4, value_type> SampleWithDerivatives
+		(
+			EmuMath::Vector<3, value_type> point_,
+			value_type freq_,
+			const EmuMath::NoisePermutations& permutations_
+		) const
+		{
+			EmuMath::NoisePermutationValue mask_ = permutations_.HighestStoredValue();
+			point_ *= freq_;
+
+			value_type offsets_[4][3];
+			EmuMath::NoisePermutationValue indices_[4][3];
+			_find_simplex(point_, mask_, offsets_, indices_);
+
+			value_type sum_[4] = { value_type(0), value_type(0), value_type(0), value_type(0) };
+			for (std::size_t i = 0; i < 4; ++i)
+			{
+				_corner_with_derivatives(indices_[i][0], indices_[i][1], indices_[i][2], offsets_[i][0], offsets_[i][1], offsets_[i][2], mask_, permutations_, sum_);
+			}
+
+			const value_type derivative_scale_ = simplex_info::scale * freq_;
+			return EmuMath::Vector<4, value_type>
+			(
+				sum_[0] * simplex_info::scale,
+				sum_[1] * derivative_scale_,
+				sum_[2] * derivative_scale_,
+				sum_[3] * derivative_scale_
+			);
+		}
+		template<std::size_t Size_, typename T_, typename OnlyNonV3f = std::enable_if_t<Size_ != 3 || !std::is_same_v<value_type, T_>>>
+		[[nodiscard]] inline EmuMath::Vector<4, value_type> SampleWithDerivatives
+		(
+			const EmuMath::Vector<Size_, T_>& point_,
+			value_type freq_,
+			const EmuMath::NoisePermutations& permutations_
+		) const
+		{
+			return SampleWithDerivatives(EmuMath::Vector<3, value_type>(point_), freq_, permutations_);
+		}
+
+	private:
+		/// <summary> Outputs the offset of point_ from each of the 4 corners of its containing tetrahedron, and the unmasked cell indices of each corner (the X index is masked). </summary>
+		inline void _find_simplex
+		(
+			const EmuMath::Vector<3, value_type>& point_,
+			EmuMath::NoisePermutationValue mask_,
+			value_type (&out_offsets_)[4][3],
+			EmuMath::NoisePermutationValue (&out_indices_)[4][3]
+		) const
+		{
+			// Skew to find the containing cell, then unskew its origin to find offsets from the first corner
+			value_type skew_ = (point_.at<0>() + point_.at<1>() + point_.at<2>()) * simplex_info::skew;
+			value_type cell_x_ = floor_(point_.at<0>() + skew_);
+			value_type cell_y_ = floor_(point_.at<1>() + skew_);
+			value_type cell_z_ = floor_(point_.at<2>() + skew_);
+			value_type unskew_ = (cell_x_ + cell_y_ + cell_z_) * simplex_info::unskew;
+			value_type x_0_ = point_.at<0>() - (cell_x_ - unskew_);
+			value_type y_0_ = point_.at<1>() - (cell_y_ - unskew_);
+			value_type z_0_ = point_.at<2>() - (cell_z_ - unskew_);
+
+			// Rank offsets to find which tetrahedron of the cell contains the point; the second and third corners step along the largest offsets first
+			const bool x_ge_y_ = x_0_ >= y_0_;
+			const bool y_ge_z_ = y_0_ >= z_0_;
+			const bool x_ge_z_ = x_0_ >= z_0_;
+			EmuMath::NoisePermutationValue ix_1_offset_ = (x_ge_y_ && x_ge_z_) ? 1 : 0;
+			EmuMath::NoisePermutationValue iy_1_offset_ = (!x_ge_y_ && y_ge_z_) ? 1 : 0;
+			EmuMath::NoisePermutationValue iz_1_offset_ = (!x_ge_z_ && !y_ge_z_) ? 1 : 0;
+			EmuMath::NoisePermutationValue ix_2_offset_ = (x_ge_y_ || x_ge_z_) ? 1 : 0;
+			EmuMath::NoisePermutationValue iy_2_offset_ = (!x_ge_y_ || y_ge_z_) ? 1 : 0;
+			EmuMath::NoisePermutationValue iz_2_offset_ = (!x_ge_z_ || !y_ge_z_) ? 1 : 0;
+
+			out_offsets_[0][0] = x_0_;
+			out_offsets_[0][1] = y_0_;
+			out_offsets_[0][2] = z_0_;
+			out_offsets_[1][0] = x_0_ - static_cast<value_type>(ix_1_offset_) + simplex_info::unskew;
+			out_offsets_[1][1] = y_0_ - static_cast<value_type>(iy_1_offset_) + simplex_info::unskew;
+			out_offsets_[1][2] = z_0_ - static_cast<value_type>(iz_1_offset_) + simplex_info::unskew;
+			out_offsets_[2][0] = x_0_ - static_cast<value_type>(ix_2_offset_) + (value_type(2) * simplex_info::unskew);
+			out_offsets_[2][1] = y_0_ - static_cast<value_type>(iy_2_offset_) + (value_type(2) * simplex_info::unskew);
+			out_offsets_[2][2] = z_0_ - static_cast<value_type>(iz_2_offset_) + (value_type(2) * simplex_info::unskew);
+			out_offsets_[3][0] = x_0_ - value_type(1) + (value_type(3) * simplex_info::unskew);
+			out_offsets_[3][1] = y_0_ - value_type(1) + (value_type(3) * simplex_info::unskew);
+			out_offsets_[3][2] = z_0_ - value_type(1) + (value_type(3) * simplex_info::unskew);
+
+			EmuMath::NoisePermutationValue ix_0_ = static_cast<EmuMath::NoisePermutationValue>(cell_x_) & mask_;
+			EmuMath::NoisePermutationValue iy_0_ = static_cast<EmuMath::NoisePermutationValue>(cell_y_) & mask_;
+			EmuMath::NoisePermutationValue iz_0_ = static_cast<EmuMath::NoisePermutationValue>(cell_z_) & mask_;
+
+			out_indices_[0][0] = ix_0_;
+			out_indices_[0][1] = iy_0_;
+			out_indices_[0][2] = iz_0_;
+			out_indices_[1][0] = (ix_0_ + ix_1_offset_) & mask_;
+			out_indices_[1][1] = iy_0_ + iy_1_offset_;
+			out_indices_[1][2] = iz_0_ + iz_1_offset_;
+			out_indices_[2][0] = (ix_0_ + ix_2_offset_) & mask_;
+			out_indices_[2][1] = iy_0_ + iy_2_offset_;
+			out_indices_[2][2] = iz_0_ + iz_2_offset_;
+			out_indices_[3][0] = (ix_0_ + 1) & mask_;
+			out_indices_[3][1] = iy_0_ + 1;
+			out_indices_[3][2] = iz_0_ + 1;
+		}
+
+		[[nodiscard]] static inline std::size_t _gradient_index
+		(
+			EmuMath::NoisePermutationValue ix_,
+			EmuMath::NoisePermutationValue iy_,
+			EmuMath::NoisePermutationValue iz_,
+			EmuMath::NoisePermutationValue mask_,
+			const EmuMath::NoisePermutations& permutations_
+		)
+		{
+			// Forced store as size_t so we can handle width changes if EmuMath::NoisePermutationValue is not size_t width
+			std::size_t perm_x_ = static_cast<std::size_t>(permutations_[ix_]);
+			std::size_t perm_xy_ = static_cast<std::size_t>(permutations_[(perm_x_ + iy_) & mask_]);
+			std::size_t perm_xyz_ = static_cast<std::size_t>(permutations_[(perm_xy_ + iz_) & mask_]);
+			return perm_xyz_ & gradients::mask;
+		}
+
+		[[nodiscard]] static inline value_type _corner
+		(
+			EmuMath::NoisePermutationValue ix_,
+			EmuMath::NoisePermutationValue iy_,
+			EmuMath::NoisePermutationValue iz_,
+			value_type x_,
+			value_type y_,
+			value_type z_,
+			EmuMath::NoisePermutationValue mask_,
+			const EmuMath::NoisePermutations& permutations_
+		)
+		{
+			value_type falloff_ = EmuMath::Functors::_underlying_noise_gen::simplex_falloff(simplex_info::radius_squared, (x_ * x_) + (y_ * y_) + (z_ * z_));
+			if (falloff_ != value_type(0))
+			{
+				return falloff_ * EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(gradients::values[_gradient_index(ix_, iy_, iz_, mask_, permutations_)], x_, y_, z_);
+			}
+			else
+			{
+				return value_type(0);
+			}
+		}
+
+		/// <summary>
+		/// <para> Adds a corner's contribution and its unscaled partial derivatives to the respective elements of out_sum_, in the order (value, d/dx, d/dy, d/dz). </para>
+		/// <para> With t = radius_squared - |r|^2, the contribution is t^4 (g.r), and its derivative is t^4 g - 8 t^3 (g.r) r. </para>
+		/// </summary>
+		static inline void _corner_with_derivatives
+		(
+			EmuMath::NoisePermutationValue ix_,
+			EmuMath::NoisePermutationValue iy_,
+			EmuMath::NoisePermutationValue iz_,
+			value_type x_,
+			value_type y_,
+			value_type z_,
+			EmuMath::NoisePermutationValue mask_,
+			const EmuMath::NoisePermutations& permutations_,
+			value_type (&out_sum_)[4]
+		)
+		{
+			value_type t_ = simplex_info::radius_squared - ((x_ * x_) + (y_ * y_) + (z_ * z_));
+			if (t_ > value_type(0))
+			{
+				const typename gradients::gradient_type& gradient_ = gradients::values[_gradient_index(ix_, iy_, iz_, mask_, permutations_)];
+				const value_type dot_ = EmuMath::Functors::_underlying_noise_gen::dot_with_scalar(gradient_, x_, y_, z_);
+				const value_type t_2_ = t_ * t_;
+				const value_type falloff_ = t_2_ * t_2_;
+				const value_type radial_scale_ = value_type(-8) * t_2_ * t_ * dot_;
+
+				out_sum_[0] += falloff_ * dot_;
+				out_sum_[1] += (falloff_ * gradient_.template at<0>()) + (radial_scale_ * x_);
+				out_sum_[2] += (falloff_ * gradient_.template at<1>()) + (radial_scale_ * y_);
+				out_sum_[3] += (falloff_ * gradient_.template at<2>()) + (radial_scale_ * z_);
+			}
+		}
 	};
 }
 
+
 #endif
@@ -3,6 +3,7 @@
 
 #include "_fractal_noise_wrapper.h"
 #include "../../../../EmuSIMD/SIMDHelpers.h"
+#include <vector>
 
 namespace EmuMath::Functors
 {
@@ -38,14 +39,14 @@ namespace EmuMath::Functors
 				const fractal_info_type& fractal_info_,
 				GeneratorConstructorArgs_&&...generator_constructor_args_
 			) :
-				starting_freq_simd(EmuSIMD::set1<register_type>(freq_)),
-				lacunarity_simd(EmuSIMD::set1<register_type>(fractal_info_.GetLacunarity())),
-				gain_simd(EmuSIMD::set1<register_type>(fractal_info_.GetGain())),
+				octave_freqs_simd(),
+				octave_amplitudes_simd(),
+				reciprocal_range_simd(),
 				permutation_mask_simd(EmuSIMD::set1<integral_register_type>(permutations_.HighestStoredValue())),
-				fractal_info(fractal_info_),
 				permutations(permutations_),
 				generator(generator_constructor_args_...)
 			{
+				_make_octaves(freq_, fractal_info_);
 			}
 			template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<generator_type, GeneratorConstructorArgs_...>>>
 			inline _fast_fractal_noise_wrapper
@@ -55,51 +56,44 @@ namespace EmuMath::Functors
 				const fractal_info_type& fractal_info_,
 				GeneratorConstructorArgs_&&...generator_constructor_args_
 			) :
-				starting_freq_simd(EmuSIMD::set1<register_type>(freq_)),
-				lacunarity_simd(EmuSIMD::set1<register_type>(fractal_info_.GetLacunarity())),
-				gain_simd(EmuSIMD::set1<register_type>(fractal_info_.GetGain())),
+				octave_freqs_simd(),
+				octave_amplitudes_simd(),
+				reciprocal_range_simd(),
 				permutation_mask_simd(EmuSIMD::set1<integral_register_type>(permutations_.HighestStoredValue())),
-				fractal_info(fractal_info_),
 				permutations(permutations_),
 				generator(generator_constructor_args_...)
 			{
+				_make_octaves(freq_, fractal_info_);
 			}
 
-			[[nodiscard]] constexpr inline register_type operator()(register_type points_x_, register_type points_y_, register_type points_z_)
+			[[nodiscard]] inline register_type operator()(register_type points_x_, register_type points_y_, register_type points_z_)
 			{
 				constexpr bool is_valid_for_3d = std::is_invocable_r_v
 				<
 					register_type,
 					generator_type,
-					register_type, register_type, register_type, register_type, integral_register_type, EmuMath::NoisePermutations
+					register_type, register_type, register_type, register_type, integral_register_type, EmuMath::FastNoisePermutations
 				>;
 				if constexpr (is_valid_for_3d)
 				{
-					std::size_t end_ = fractal_info.GetOctaves();
+					register_type result_ = generator(points_x_, points_y_, points_z_, octave_freqs_simd[0], permutation_mask_simd, permutations);
+					const std::size_t end_ = octave_freqs_simd.size();
 					if (1 < end_)
 					{
-						std::size_t octave_ = 1;
-						register_type range_ = EmuSIMD::set1<register_type>(1);
-						register_type amplitude_ = range_;
-						register_type active_freq_ = starting_freq_simd;
-						register_type result_ = generator(points_x_, points_y_, points_z_, active_freq_, permutation_mask_simd, permutations);
-						do
+						for (std::size_t octave_ = 1; octave_ < end_; ++octave_)
 						{
-							active_freq_ = EmuSIMD::mul_all(active_freq_, lacunarity_simd);
-							amplitude_ = EmuSIMD::mul_all(amplitude_, gain_simd);
-							range_ = EmuSIMD::add(range_, amplitude_);
-							result_ = EmuSIMD::add
+							result_ = EmuSIMD::fmadd
 							(
-								result_,
-								EmuSIMD::mul(generator(points_x_, points_y_, points_z_, active_freq_, permutation_mask_simd, permutations), amplitude_)
+								generator(points_x_, points_y_, points_z_, octave_freqs_simd[octave_], permutation_mask_simd, permutations),
+								octave_amplitudes_simd[octave_],
+								result_
 							);
-							++octave_;
-						} while (octave_ < end_);
-						return EmuSIMD::div(result_, range_);
+						}
+						return EmuSIMD::mul_all(result_, reciprocal_range_simd);
 					}
 					else
 					{
-						return generator(points_x_, points_y_, points_z_, starting_freq_simd, permutation_mask_simd, permutations);
+						return result_;
 					}
 				}
 				else
@@ -107,45 +101,38 @@ namespace EmuMath::Functors
 					static_assert
 					(
 						false,
-						"Invalid generator type provided for a fast_fractal_noise_wrapper when invoked with 3 coordinate registers. The generator must return the provided register type, and take the following type arguments: register_type, register_type, register_type, register_type, integral_register_type, EmuMath::NoisePermutations, interpreted as: `points_x`, `points_y`, `points_z`, `freq`, `permutation_mask`, `permutations`"
+						"Invalid generator type provided for a fast_fractal_noise_wrapper when invoked with 3 coordinate registers. The generator must return the provided register type, and take the following type arguments: register_type, register_type, register_type, register_type, integral_register_type, EmuMath::FastNoisePermutations, interpreted as: `points_x`, `points_y`, `points_z`, `freq`, `permutation_mask`, `permutations`"
 					);
 				}
 			}
-			[[nodiscard]] constexpr inline register_type operator()(register_type points_x_, register_type points_y_)
+			[[nodiscard]] inline register_type operator()(register_type points_x_, register_type points_y_)
 			{
 				constexpr bool is_valid_for_2d = std::is_invocable_r_v
 				<
 					register_type,
 					generator_type,
-					register_type, register_type, register_type, integral_register_type, EmuMath::NoisePermutations
+					register_type, register_type, register_type, integral_register_type, EmuMath::FastNoisePermutations
 				>;
 				if constexpr (is_valid_for_2d)
 				{
-					std::size_t end_ = fractal_info.GetOctaves();
+					register_type result_ = generator(points_x_, points_y_, octave_freqs_simd[0], permutation_mask_simd, permutations);
+					const std::size_t end_ = octave_freqs_simd.size();
 					if (1 < end_)
 					{
-						std::size_t octave_ = 1;
-						register_type range_ = EmuSIMD::set1<register_type>(1);
-						register_type amplitude_ = range_;
-						register_type active_freq_ = starting_freq_simd;
-						register_type result_ = generator(points_x_, points_y_, active_freq_, permutation_mask_simd, permutations);
-						do
+						for (std::size_t octave_ = 1; octave_ < end_; ++octave_)
 						{
-							active_freq_ = EmuSIMD::mul_all(active_freq_, lacunarity_simd);
-							amplitude_ = EmuSIMD::mul_all(amplitude_, gain_simd);
-							range_ = EmuSIMD::add(range_, amplitude_);
-							result_ = EmuSIMD::add
+							result_ = EmuSIMD::fmadd
 							(
-								result_,
-								EmuSIMD::mul(generator(points_x_, points_y_, active_freq_, permutation_mask_simd, permutations), amplitude_)
+								generator(points_x_, points_y_, octave_freqs_simd[octave_], permutation_mask_simd, permutations),
+								octave_amplitudes_simd[octave_],
+								result_
 							);
-							++octave_;
-						} while (octave_ < end_);
-						return EmuSIMD::div(result_, range_);
+						}
+						return EmuSIMD::mul_all(result_, reciprocal_range_simd);
 					}
 					else
 					{
-						return generator(points_x_, points_y_, starting_freq_simd, permutation_mask_simd, permutations);
+						return result_;
 					}
 				}
 				else
@@ -153,45 +140,38 @@ namespace EmuMath::Functors
 					static_assert
 					(
 						false,
-						"Invalid generator type provided for a fast_fractal_noise_wrapper when invoked with 2 coordinate registers. The generator must return the provided register type, and take the following type arguments: register_type, register_type, register_type, integral_register_type, EmuMath::NoisePermutations, interpreted as: `points_x`, `points_y`, `freq`, `permutation_mask`, `permutations`"
+						"Invalid generator type provided for a fast_fractal_noise_wrapper when invoked with 2 coordinate registers. The generator must return the provided register type, and take the following type arguments: register_type, register_type, register_type, integral_register_type, EmuMath::FastNoisePermutations, interpreted as: `points_x`, `points_y`, `freq`, `permutation_mask`, `permutations`"
 					);
 				}
 			}
-			[[nodiscard]] constexpr inline register_type operator()(register_type points_x_)
+			[[nodiscard]] inline register_type operator()(register_type points_x_)
 			{
 				constexpr bool is_valid_for_1d = std::is_invocable_r_v
 				<
 					register_type,
 					generator_type,
-					register_type, register_type, integral_register_type, EmuMath::NoisePermutations
+					register_type, register_type, integral_register_type, EmuMath::FastNoisePermutations
 				>;
 				if constexpr (is_valid_for_1d)
 				{
-					std::size_t end_ = fractal_info.GetOctaves();
+					register_type result_ = generator(points_x_, octave_freqs_simd[0], permutation_mask_simd, permutations);
+					const std::size_t end_ = octave_freqs_simd.size();
 					if (1 < end_)
 					{
-						std::size_t octave_ = 1;
-						register_type range_ = EmuSIMD::set1<register_type>(1);
-						register_type amplitude_ = range_;
-						register_type active_freq_ = starting_freq_simd;
-						register_type result_ = generator(points_x_, active_freq_, permutation_mask_simd, permutations);
-						do
+						for (std::size_t octave_ = 1; octave_ < end_; ++octave_)
 						{
-							active_freq_ = EmuSIMD::mul_all(active_freq_, lacunarity_simd);
-							amplitude_ = EmuSIMD::mul_all(amplitude_, gain_simd);
-							range_ = EmuSIMD::add(range_, amplitude_);
-							result_ = EmuSIMD::add
+							result_ = EmuSIMD::fmadd
 							(
-								result_,
-								EmuSIMD::mul(generator(points_x_, active_freq_, permutation_mask_simd, permutations), amplitude_)
+								generator(points_x_, octave_freqs_simd[octave_], permutation_mask_simd, permutations),
+								octave_amplitudes_simd[octave_],
+								result_
 							);
-							++octave_;
-						} while (octave_ < end_);
-						return EmuSIMD::div(result_, range_);
+						}
+						return EmuSIMD::mul_all(result_, reciprocal_range_simd);
 					}
 					else
 					{
-						return generator(points_x_, starting_freq_simd, permutation_mask_simd, permutations);
+						return result_;
 					}
 				}
 				else
@@ -199,124 +179,291 @@ namespace EmuMath::Functors
 					static_assert
 					(
 						false,
-						"Invalid generator type provided for a fast_fractal_noise_wrapper when invoked with 1 coordinate register. The generator must return the provided register type, and take the following type arguments: register_type, register_type, integral_register_type, EmuMath::NoisePermutations, interpreted as: `points_x`, `freq`, `permutation_mask`, `permutations`"
+						"Invalid generator type provided for a fast_fractal_noise_wrapper when invoked with 1 coordinate register. The generator must return the provided register type, and take the following type arguments: register_type, register_type, integral_register_type, EmuMath::FastNoisePermutations, interpreted as: `points_x`, `freq`, `permutation_mask`, `permutations`"
 					);
 				}
 			}
 
+			/// <summary>
+			/// <para> Produces 3D fractal samples, which are returned, along with their analytic partial derivatives with respect to each coordinate, which are output via out_dx_, out_dy_, and out_dz_. </para>
+			/// <para> Derivatives are accumulated with the same amplitudes as samples, so they remain the exact derivatives of the values produced by this wrapper's operator(). </para>
+			/// <para> Only available where the generator provides a SampleWithDerivatives function. </para>
+			/// </summary>
+			[[nodiscard]] inline register_type SampleWithDerivatives
+			(
+				register_type points_x_,
+				register_type points_y_,
+				register_type points_z_,
+				register_type& out_dx_,
+				register_type& out_dy_,
+				register_type& out_dz_
+			)
+			{
+				register_type result_ = generator.SampleWithDerivatives
+				(
+					points_x_, points_y_, points_z_, octave_freqs_simd[0], permutation_mask_simd, permutations, out_dx_, out_dy_, out_dz_
+				);
+				const std::size_t end_ = octave_freqs_simd.size();
+				if (1 < end_)
+				{
+					register_type octave_dx_, octave_dy_, octave_dz_;
+					for (std::size_t octave_ = 1; octave_ < end_; ++octave_)
+					{
+						const register_type& amplitude_ = octave_amplitudes_simd[octave_];
+						register_type octave_result_ = generator.SampleWithDerivatives
+						(
+							points_x_, points_y_, points_z_, octave_freqs_simd[octave_], permutation_mask_simd, permutations, octave_dx_, octave_dy_, octave_dz_
+						);
+						result_ = EmuSIMD::fmadd(octave_result_, amplitude_, result_);
+						out_dx_ = EmuSIMD::fmadd(octave_dx_, amplitude_, out_dx_);
+						out_dy_ = EmuSIMD::fmadd(octave_dy_, amplitude_, out_dy_);
+						out_dz_ = EmuSIMD::fmadd(octave_dz_, amplitude_, out_dz_);
+					}
+					out_dx_ = EmuSIMD::mul_all(out_dx_, reciprocal_range_simd);
+					out_dy_ = EmuSIMD::mul_all(out_dy_, reciprocal_range_simd);
+					out_dz_ = EmuSIMD::mul_all(out_dz_, reciprocal_range_simd);
+					return EmuSIMD::mul_all(result_, reciprocal_range_simd);
+				}
+				else
+				{
+					return result_;
+				}
+			}
+
 		private:
-			register_type starting_freq_simd;
-			register_type lacunarity_simd;
-			register_type gain_simd;
+			/// <summary> Broadcasts the per-octave frequencies and amplitudes, and the reciprocal of their range, so that invocation only needs to load them. </summary>
+			inline void _make_octaves(value_type freq_, const fractal_info_type& fractal_info_)
+			{
+				const _fractal_octave_info<value_type> octaves_(freq_, fractal_info_);
+				const std::size_t num_octaves_ = octaves_.freqs.size();
+				octave_freqs_simd.reserve(num_octaves_);
+				octave_amplitudes_simd.reserve(num_octaves_);
+				for (std::size_t i = 0; i < num_octaves_; ++i)
+				{
+					octave_freqs_simd.push_back(EmuSIMD::set1<register_type>(octaves_.freqs[i]));
+					octave_amplitudes_simd.push_back(EmuSIMD::set1<register_type>(octaves_.amplitudes[i]));
+				}
+				reciprocal_range_simd = EmuSIMD::set1<register_type>(octaves_.reciprocal_range);
+			}
+
+			std::vector<register_type> octave_freqs_simd;
+			std::vector<register_type> octave_amplitudes_simd;
+			register_type reciprocal_range_simd;
 			integral_register_type permutation_mask_simd;
-			fractal_info_type fractal_info;
-			EmuMath::NoisePermutations permutations;
+			EmuMath::FastNoisePermutations permutations;
+			generator_type generator;
+		};
+
+		template<class PerIterationGenerator_, class Register_>
+		struct _fast_no_fractal_noise_wrapper
+		{
+		public:
+			using generator_type = PerIterationGenerator_;
+			using register_type = EmuCore::TMP::remove_ref_cv_t<Register_>;
+			using value_type = register_type;
+			using integral_register_type = typename EmuSIMD::TMP::integer_register_type<EmuSIMD::TMP::simd_register_width_v<register_type>>::type;
+
+			static_assert
+			(
+				EmuCore::TMP::is_any_comparison_true<std::is_same, register_type, __m128, __m256, __m512>::value,
+				"Invalid register type provided for a fast_no_fractal_noise_wrapper. Valid register types: __m128, __m256, __m512."
+			);
+
+			template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<generator_type, GeneratorConstructorArgs_...>>>
+			inline _fast_no_fractal_noise_wrapper
+			(
+				float freq_,
+				const EmuMath::NoisePermutations& permutations_,
+				GeneratorConstructorArgs_&&...generator_constructor_args_
+			) :
+				generator(generator_constructor_args_...),
+				permutations(permutations_),
+				permutations_mask(EmuSIMD::set1<integral_register_type, 32>(static_cast<std::int32_t>(permutations_.HighestStoredValue()))),
+				freq(EmuSIMD::set1<register_type>(freq_))
+			{
+			}
+			template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<generator_type, GeneratorConstructorArgs_...>>>
+			inline _fast_no_fractal_noise_wrapper
+			(
+				float freq_,
+				EmuMath::NoisePermutations&& permutations_,
+				GeneratorConstructorArgs_&&...generator_constructor_args_
+			) :
+				generator(generator_constructor_args_...),
+				permutations(std::move(permutations_)),
+				permutations_mask(EmuSIMD::set1<integral_register_type, 32>(static_cast<std::int32_t>(permutations.HighestStoredValue()))),
+				freq(EmuSIMD::set1<register_type>(freq_))
+			{
+			}
+
+			[[nodiscard]] inline register_type operator()(register_type points_x_, register_type points_y_, register_type points_z_)
+			{
+				constexpr bool is_valid_for_3d = std::is_invocable_r_v
+				<
+					register_type,
+					generator_type,
+					register_type, register_type, register_type, register_type, integral_register_type, EmuMath::FastNoisePermutations
+				>;
+				if constexpr (is_valid_for_3d)
+				{
+					return generator(points_x_, points_y_, points_z_, freq, permutations_mask, permutations);
+				}
+				else
+				{
+					static_assert
+					(
+						false,
+						"Invalid generator type provided for a no_fractal_noise_wrapper taking SIMD registers when invoked with 3 coordinate registers. The generator must return the provided register type, and take the following type arguments: register_type, register_type, register_type, register_type, integral_register_type, EmuMath::FastNoisePermutations, interpreted as: `points_x`, `points_y`, `points_z`, `freq`, `permutation_mask`, `permutations`"
+					);
+				}
+			}
+			[[nodiscard]] inline register_type operator()(register_type points_x_, register_type points_y_)
+			{
+				constexpr bool is_valid_for_2d = std::is_invocable_r_v
+				<
+					register_type,
+					generator_type,
+					register_type, register_type, register_type, integral_register_type, EmuMath::FastNoisePermutations
+				>;
+				if constexpr (is_valid_for_2d)
+				{
+					return generator(points_x_, points_y_, freq, permutations_mask, permutations);
+				}
+				else
+				{
+					static_assert
+					(
+						false,
+						"Invalid generator type provided for a no_fractal_noise_wrapper taking SIMD registers when invoked with 2 coordinate registers. The generator must return the provided register type, and take the following type arguments: register_type, register_type, register_type, integral_register_type, EmuMath::FastNoisePermutations, interpreted as: `points_x`, `points_y`, `freq`, `permutation_mask`, `permutations`"
+					);
+				}
+			}
+			[[nodiscard]] inline register_type operator()(register_type points_x_)
+			{
+				constexpr bool is_valid_for_1d = std::is_invocable_r_v
+				<
+					register_type,
+					generator_type,
+					register_type, register_type, integral_register_type, EmuMath::FastNoisePermutations
+				>;
+				if constexpr (is_valid_for_1d)
+				{
+					return generator(points_x_, freq, permutations_mask, permutations);
+				}
+				else
+				{
+					static_assert
+					(
+						false,
+						"Invalid generator type provided for a no_fractal_noise_wrapper taking SIMD registers when invoked with 1 coordinate register. The generator must return the provided register type, and take the following type arguments: register_type, register_type, integral_register_type, EmuMath::FastNoisePermutations, interpreted as: `points_x`, `freq`, `permutation_mask`, `permutations`"
+					);
+				}
+			}
+
+			/// <summary>
+			/// <para> Produces 3D samples, which are returned, along with their analytic partial derivatives with respect to each coordinate, which are output via out_dx_, out_dy_, and out_dz_. </para>
+			/// <para> Only available where the generator provides a SampleWithDerivatives function. </para>
+			/// </summary>
+			[[nodiscard]] inline register_type SampleWithDerivatives
+			(
+				register_type points_x_,
+				register_type points_y_,
+				register_type points_z_,
+				register_type& out_dx_,
+				register_type& out_dy_,
+				register_type& out_dz_
+			)
+			{
+				return generator.SampleWithDerivatives(points_x_, points_y_, points_z_, freq, permutations_mask, permutations, out_dx_, out_dy_, out_dz_);
+			}
+
 			generator_type generator;
+			EmuMath::FastNoisePermutations permutations;
+			integral_register_type permutations_mask;
+			register_type freq;
 		};
 	}
 
 
 	template<class PerIterationGenerator_>
-	struct no_fractal_noise_wrapper<PerIterationGenerator_, __m128>
+	struct no_fractal_noise_wrapper<PerIterationGenerator_, __m128> : public _underlying_implementations::_fast_no_fractal_noise_wrapper<PerIterationGenerator_, __m128>
 	{
-		using generator_type = PerIterationGenerator_;
-		using value_type = __m128;
+	private:
+		using parent_type = _underlying_implementations::_fast_no_fractal_noise_wrapper<PerIterationGenerator_, __m128>;
 
-		template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<generator_type, GeneratorConstructorArgs_...>>>
-		no_fractal_noise_wrapper
+	public:
+		template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<typename parent_type::generator_type, GeneratorConstructorArgs_...>>>
+		inline no_fractal_noise_wrapper
 		(
 			float freq_,
 			const EmuMath::NoisePermutations& permutations_,
 			GeneratorConstructorArgs_&&...generator_constructor_args_
-		) :
-			freq(_mm_set1_ps(freq_)),
-			permutations(permutations_),
-			generator(generator_constructor_args_...)
+		) : parent_type(freq_, permutations_, generator_constructor_args_...)
 		{
-			permutations_mask_128 = _mm_set1_epi32(static_cast<std::int32_t>(permutations.HighestStoredValue()));
 		}
-		template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<generator_type, GeneratorConstructorArgs_...>>>
-		no_fractal_noise_wrapper
+		template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<typename parent_type::generator_type, GeneratorConstructorArgs_...>>>
+		inline no_fractal_noise_wrapper
 		(
 			float freq_,
 			EmuMath::NoisePermutations&& permutations_,
 			GeneratorConstructorArgs_&&...generator_constructor_args_
-		) :
-			freq(_mm_set1_ps(freq_)),
-			permutations(permutations_),
-			generator(generator_constructor_args_...)
+		) : parent_type(freq_, std::move(permutations_), generator_constructor_args_...)
 		{
-			permutations_mask_128 = _mm_set1_epi32(static_cast<std::int32_t>(permutations.HighestStoredValue()));
 		}
+	};
 
-		[[nodiscard]] inline __m128 operator()(__m128 points_x_, __m128 points_y_, __m128 points_z_)
+	template<class PerIterationGenerator_>
+	struct no_fractal_noise_wrapper<PerIterationGenerator_, __m256> : public _underlying_implementations::_fast_no_fractal_noise_wrapper<PerIterationGenerator_, __m256>
+	{
+	private:
+		using parent_type = _underlying_implementations::_fast_no_fractal_noise_wrapper<PerIterationGenerator_, __m256>;
+
+	public:
+		template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<typename parent_type::generator_type, GeneratorConstructorArgs_...>>>
+		inline no_fractal_noise_wrapper
+		(
+			float freq_,
+			const EmuMath::NoisePermutations& permutations_,
+			GeneratorConstructorArgs_&&...generator_constructor_args_
+		) : parent_type(freq_, permutations_, generator_constructor_args_...)
 		{
-			constexpr bool is_valid_for_3d = std::is_invocable_r_v
-			<
-				__m128,
-				generator_type,
-				__m128, __m128, __m128, __m128, __m128i, EmuMath::NoisePermutations
-			>;
-			if constexpr (is_valid_for_3d)
-			{
-				return generator(points_x_, points_y_, points_z_, freq, permutations_mask_128, permutations);
-			}
-			else
-			{
-				static_assert
-				(
-					false,
-					"Invalid generator type provided for a no_fractal_noise_wrapper taking __m128 values when invoked with 3 coordinate registers. The generator must return the __m128 type, and take the following type arguments: __m128, __m128, __m128, __m128, __m128i, EmuMath::NoisePermutations, interpreted as: `points_x`, `points_y`, `points_z`, `freq`, `permutation_mask`, `permutations`"
-				);
-			}
 		}
-		[[nodiscard]] inline __m128 operator()(__m128 points_x_, __m128 points_y_)
+		template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<typename parent_type::generator_type, GeneratorConstructorArgs_...>>>
+		inline no_fractal_noise_wrapper
+		(
+			float freq_,
+			EmuMath::NoisePermutations&& permutations_,
+			GeneratorConstructorArgs_&&...generator_constructor_args_
+		) : parent_type(freq_, std::move(permutations_), generator_constructor_args_...)
 		{
-			constexpr bool is_valid_for_2d = std::is_invocable_r_v
-			<
-				__m128,
-				generator_type,
-				__m128, __m128, __m128, __m128i, EmuMath::NoisePermutations
-			>;
-			if constexpr (is_valid_for_2d)
-			{
-				return generator(points_x_, points_y_, freq, permutations_mask_128, permutations);
-			}
-			else
-			{
-				static_assert
-				(
-					false,
-					"Invalid generator type provided for a no_fractal_noise_wrapper taking __m128 values when invoked with 2 coordinate registers. The generator must return the __m128 type, and take the following type arguments: __m128, __m128, __m128, __m128i, EmuMath::NoisePermutations, interpreted as: `points_x`, `points_y`, `freq`, `permutation_mask`, `permutations`"
-				);
-			}
 		}
-		[[nodiscard]] inline __m128 operator()(__m128 points_x_)
+	};
+
+	template<class PerIterationGenerator_>
+	struct no_fractal_noise_wrapper<PerIterationGenerator_, __m512> : public _underlying_implementations::_fast_no_fractal_noise_wrapper<PerIterationGenerator_, __m512>
+	{
+	private:
+		using parent_type = _underlying_implementations::_fast_no_fractal_noise_wrapper<PerIterationGenerator_, __m512>;
+
+	public:
+		template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<typename parent_type::generator_type, GeneratorConstructorArgs_...>>>
+		inline no_fractal_noise_wrapper
+		(
+			float freq_,
+			const EmuMath::NoisePermutations& permutations_,
+			GeneratorConstructorArgs_&&...generator_constructor_args_
+		) : parent_type(freq_, permutations_, generator_constructor_args_...)
+		{
+		}
+		template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<typename parent_type::generator_type, GeneratorConstructorArgs_...>>>
+		inline no_fractal_noise_wrapper
+		(
+			float freq_,
+			EmuMath::NoisePermutations&& permutations_,
+			GeneratorConstructorArgs_&&...generator_constructor_args_
+		) : parent_type(freq_, std::move(permutations_), generator_constructor_args_...)
 		{
-			constexpr bool is_valid_for_1d = std::is_invocable_r_v
-			<
-				__m128,
-				generator_type,
-				__m128, __m128, __m128i, EmuMath::NoisePermutations
-			>;
-			if constexpr (is_valid_for_1d)
-			{
-				return generator(points_x_, freq, permutations_mask_128, permutations);
-			}
-			else
-			{
-				static_assert
-				(
-					false,
-					"Invalid generator type provided for a no_fractal_noise_wrapper taking __m128 values when invoked with 1 coordinate register. The generator must return the __m128 type, and take the following type arguments: __m128, __m128, __m128i, EmuMath::NoisePermutations, interpreted as: `points_x`, `freq`, `permutation_mask`, `permutations`"
-				);
-			}
 		}
-
-		generator_type generator;
-		EmuMath::NoisePermutations permutations;
-		__m128i permutations_mask_128;
-		__m128 freq;
 	};
 
 	template<class PerIterationGenerator_>
@@ -347,6 +494,64 @@ namespace EmuMath::Functors
 		{
 		}
 	};
+
+	template<class PerIterationGenerator_>
+	struct fractal_noise_wrapper<PerIterationGenerator_, __m256> : public _underlying_implementations::_fast_fractal_noise_wrapper<PerIterationGenerator_, __m256>
+	{
+	private:
+		using parent_type = _underlying_implementations::_fast_fractal_noise_wrapper<PerIterationGenerator_, __m256>;
+
+	public:
+		template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<typename parent_type::generator_type, GeneratorConstructorArgs_...>>>
+		inline fractal_noise_wrapper
+		(
+			typename parent_type::value_type freq_,
+			const EmuMath::NoisePermutations& permutations_,
+			const typename parent_type::fractal_info_type& fractal_info_,
+			GeneratorConstructorArgs_&&...generator_constructor_args_
+		) : parent_type(freq_, permutations_, fractal_info_, generator_constructor_args_...)
+		{
+		}
+		template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<typename parent_type::generator_type, GeneratorConstructorArgs_...>>>
+		inline fractal_noise_wrapper
+		(
+			typename parent_type::value_type freq_,
+			EmuMath::NoisePermutations&& permutations_,
+			const typename parent_type::fractal_info_type& fractal_info_,
+			GeneratorConstructorArgs_&&...generator_constructor_args_
+		) : parent_type(freq_, permutations_, fractal_info_, generator_constructor_args_...)
+		{
+		}
+	};
+
+	template<class PerIterationGenerator_>
+	struct fractal_noise_wrapper<PerIterationGenerator_, __m512> : public _underlying_implementations::_fast_fractal_noise_wrapper<PerIterationGenerator_, __m512>
+	{
+	private:
+		using parent_type = _underlying_implementations::_fast_fractal_noise_wrapper<PerIterationGenerator_, __m512>;
+
+	public:
+		template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<typename parent_type::generator_type, GeneratorConstructorArgs_...>>>
+		inline fractal_noise_wrapper
+		(
+			typename parent_type::value_type freq_,
+			const EmuMath::NoisePermutations& permutations_,
+			const typename parent_type::fractal_info_type& fractal_info_,
+			GeneratorConstructorArgs_&&...generator_constructor_args_
+		) : parent_type(freq_, permutations_, fractal_info_, generator_constructor_args_...)
+		{
+		}
+		template<typename...GeneratorConstructorArgs_, typename = std::enable_if_t<std::is_constructible_v<typename parent_type::generator_type, GeneratorConstructorArgs_...>>>
+		inline fractal_noise_wrapper
+		(
+			typename parent_type::value_type freq_,
+			EmuMath::NoisePermutations&& permutations_,
+			const typename parent_type::fractal_info_type& fractal_info_,
+			GeneratorConstructorArgs_&&...generator_constructor_args_
+		) : parent_type(freq_, permutations_, fractal_info_, generator_constructor_args_...)
+		{
+		}
+	};
 }
 
 #endif
@@ -10,13 +10,13 @@ namespace EmuMath::Validity
 	template<class Reg_>
 	[[nodiscard]] static constexpr inline bool _assert_fast_noise_1d_valid_register()
 	{
-		if constexpr (std::is_same_v<__m128, Reg_>)
+		if constexpr (EmuCore::TMP::is_any_comparison_true<std::is_same, Reg_, __m128, __m256, __m512>::value)
 		{
 			return true;
 		}
 		else
 		{
-			static_assert(EmuCore::TMP::get_false<Reg_>(), "Provided an unsupported register for fast_noise_1d. There is only support for the following floating-point SIMD registers: __m128.");
+			static_assert(EmuCore::TMP::get_false<Reg_>(), "Provided an unsupported register for fast_noise_1d. There is only support for the following floating-point SIMD registers: __m128, __m256, __m512.");
 			return false;
 		}
 	}
@@ -35,117 +35,165 @@ namespace EmuMath::Functors
 		}
 	};
 
-	template<>
-	struct make_fast_noise_1d<EmuMath::NoiseType::VALUE, __m128>
+	// Implementations below are width-generic, covering __m128, __m256, and __m512 registers.
+	// --- Permutation hashing remains within integral registers, via gathers from a 32-bit FastNoisePermutations table.
+
+	template<class Register_>
+	struct make_fast_noise_1d<EmuMath::NoiseType::VALUE, Register_>
 	{
-		[[nodiscard]] inline __m128 operator()
+		static_assert(EmuMath::Validity::_assert_fast_noise_1d_valid_register<Register_>(), "Invalid Register_ type argument provided to EmuMath::Functors::make_fast_noise_1d.");
+		using register_info = EmuMath::Functors::_underlying_noise_gen::_fast_noise_register_info<Register_>;
+		using int_register_type = typename register_info::int_register_type;
+
+		inline make_fast_noise_1d()
+		{
+		}
+
+		[[nodiscard]] inline Register_ operator()
 		(
-			__m128 points_x_,
-			__m128 freq_,
-			__m128i permutations_mask_128_,
-			const EmuMath::NoisePermutations& permutations_
+			Register_ points_x_,
+			Register_ freq_,
+			int_register_type permutations_mask_,
+			const EmuMath::FastNoisePermutations& permutations_
 		)
 		{
 			points_x_ = EmuSIMD::floor(EmuSIMD::mul_all(points_x_, freq_));
-			int i_[4];
-			EmuSIMD::store(EmuSIMD::bitwise_and(_mm_cvtps_epi32(points_x_), permutations_mask_128_), i_);
-			__m128 perms_ = EmuSIMD::set<__m128>(permutations_[i_[3]], permutations_[i_[2]], permutations_[i_[1]], permutations_[i_[0]]);
-			return EmuSIMD::div(perms_, _mm_cvtepi32_ps(permutations_mask_128_));
+			int_register_type ix_ = EmuSIMD::bitwise_and(EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(points_x_), permutations_mask_);
+
+			int_register_type perms_ = EmuMath::Functors::_underlying_noise_gen::_fast_gather_int32(permutations_.data(), ix_);
+			return EmuSIMD::div
+			(
+				EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(perms_),
+				EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(permutations_mask_)
+			);
 		}
 	};
 
-	template<>
-	struct make_fast_noise_1d<EmuMath::NoiseType::VALUE_SMOOTH, __m128>
+	template<class Register_>
+	struct make_fast_noise_1d<EmuMath::NoiseType::VALUE_SMOOTH, Register_>
 	{
+		static_assert(EmuMath::Validity::_assert_fast_noise_1d_valid_register<Register_>(), "Invalid Register_ type argument provided to EmuMath::Functors::make_fast_noise_1d.");
+		using register_info = EmuMath::Functors::_underlying_noise_gen::_fast_noise_register_info<Register_>;
+		using int_register_type = typename register_info::int_register_type;
+
 		inline make_fast_noise_1d() : smooth_t()
 		{
 		}
 
-		[[nodiscard]] inline __m128 operator()
+		[[nodiscard]] inline Register_ operator()
 		(
-			__m128 points_x_,
-			__m128 freq_,
-			__m128i permutations_mask_128_,
-			const EmuMath::NoisePermutations& permutations_
+			Register_ points_x_,
+			Register_ freq_,
+			int_register_type permutations_mask_,
+			const EmuMath::FastNoisePermutations& permutations_
 		)
 		{
 			points_x_ = EmuSIMD::mul_all(points_x_, freq_);
-			__m128 t_ = EmuSIMD::floor(points_x_);
-			__m128i i0_128_ = EmuSIMD::bitwise_and(_mm_cvtps_epi32(t_), permutations_mask_128_);
+			Register_ t_ = EmuSIMD::floor(points_x_);
+			int_register_type ix_0_ = EmuSIMD::bitwise_and(EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(t_), permutations_mask_);
 			t_ = EmuSIMD::sub(points_x_, t_);
-			__m128i i1_128_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(i0_128_, EmuSIMD::set1<__m128i, 32>(1)), permutations_mask_128_);
-
-			int i0_[4];
-			int i1_[4];
-			EmuSIMD::store(i0_128_, i0_);
-			EmuSIMD::store(i1_128_, i1_);
-
-			float perms_0_[4];
-			float perms_1_[4];
-			for (std::size_t i = 0; i < 4; ++i)
-			{
-				perms_0_[i] = static_cast<float>(permutations_[i0_[i]]);
-				perms_1_[i] = static_cast<float>(permutations_[i1_[i]]);
-			}
-
-			__m128 lerped_ = EmuSIMD::fused_lerp(EmuSIMD::load<__m128>(perms_0_), EmuSIMD::load<__m128>(perms_1_), smooth_t(t_));
-			return EmuSIMD::div(lerped_, _mm_cvtepi32_ps(permutations_mask_128_));
+			int_register_type ix_1_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(ix_0_, EmuSIMD::set1<int_register_type, 32>(1)), permutations_mask_);
+
+			const std::int32_t* p_permutations_ = permutations_.data();
+			Register_ perms_0_ = EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(EmuMath::Functors::_underlying_noise_gen::_fast_gather_int32(p_permutations_, ix_0_));
+			Register_ perms_1_ = EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(EmuMath::Functors::_underlying_noise_gen::_fast_gather_int32(p_permutations_, ix_1_));
+
+			Register_ lerped_ = EmuSIMD::fused_lerp(perms_0_, perms_1_, smooth_t(t_));
+			return EmuSIMD::div(lerped_, EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(permutations_mask_));
 		}
 
-		EmuMath::Functors::_underlying_noise_gen::_fast_smooth_t<__m128> smooth_t;
+		EmuMath::Functors::_underlying_noise_gen::_fast_smooth_t<Register_> smooth_t;
 	};
 
-	template<>
-	struct make_fast_noise_1d<EmuMath::NoiseType::PERLIN, __m128>
+	template<class Register_>
+	struct make_fast_noise_1d<EmuMath::NoiseType::PERLIN, Register_>
 	{
-		using gradients = EmuMath::Functors::_underlying_noise_gen::perlin_gradients<1, __m128>;
+		static_assert(EmuMath::Validity::_assert_fast_noise_1d_valid_register<Register_>(), "Invalid Register_ type argument provided to EmuMath::Functors::make_fast_noise_1d.");
+		using register_info = EmuMath::Functors::_underlying_noise_gen::_fast_noise_register_info<Register_>;
+		using int_register_type = typename register_info::int_register_type;
+		using gradient_table_type = EmuMath::Functors::_underlying_noise_gen::_fast_perlin_gradient_table<1, Register_>;
 
-		inline make_fast_noise_1d() : smooth_t()
+		inline make_fast_noise_1d() : smooth_t(), gradients()
 		{
 		}
 
-		[[nodiscard]] inline __m128 operator()
+		[[nodiscard]] inline Register_ operator()
 		(
-			__m128 points_x_,
-			__m128 freq_,
-			__m128i permutations_mask_128_,
-			const EmuMath::NoisePermutations& permutations_
+			Register_ points_x_,
+			Register_ freq_,
+			int_register_type permutations_mask_,
+			const EmuMath::FastNoisePermutations& permutations_
 		)
 		{
 			// Start weightings and indices
 			points_x_ = EmuSIMD::mul_all(points_x_, freq_);
-			__m128 t0_ = EmuSIMD::floor(points_x_);
-			__m128i i0_128_ = EmuSIMD::bitwise_and(_mm_cvtps_epi32(t0_), permutations_mask_128_);
+			Register_ t0_ = EmuSIMD::floor(points_x_);
+			int_register_type ix_0_ = EmuSIMD::bitwise_and(EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(t0_), permutations_mask_);
 
 			// Finish weightings
 			t0_ = EmuSIMD::sub(points_x_, t0_);
-			__m128 one_ = EmuSIMD::set1<__m128>(1.0f);
-			__m128 t1_ = EmuSIMD::sub(t0_, one_);
+			Register_ t1_ = EmuSIMD::sub(t0_, EmuSIMD::set1<Register_>(1.0f));
 
 			// Finish indices
-			__m128i i1_128_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(i0_128_, _mm_cvtps_epi32(one_)), permutations_mask_128_);
-			int i0_[4];
-			int i1_[4];
-			EmuSIMD::store(i0_128_, i0_);
-			EmuSIMD::store(i1_128_, i1_);
-
-			std::size_t perms_0_[4];
-			std::size_t perms_1_[4];
-			for (std::size_t i = 0; i < 4; ++i)
-			{
-				perms_0_[i] = permutations_[i0_[i]] & gradients::mask;
-				perms_1_[i] = permutations_[i1_[i]] & gradients::mask;
-			}
-
-			__m128 gradients_0_ = gradients::init_registers(perms_0_[0], perms_0_[1], perms_0_[2], perms_0_[3]);
-			__m128 gradients_1_ = gradients::init_registers(perms_1_[0], perms_1_[1], perms_1_[2], perms_1_[3]);
-			gradients_0_ = EmuSIMD::mul_all(gradients_0_, t0_);
-			gradients_1_ = EmuSIMD::mul_all(gradients_1_, t1_);
-			
+			int_register_type ix_1_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(ix_0_, EmuSIMD::set1<int_register_type, 32>(1)), permutations_mask_);
+
+			const std::int32_t* p_permutations_ = permutations_.data();
+			Register_ gradients_0_ = gradients.dot(EmuMath::Functors::_underlying_noise_gen::_fast_gather_int32(p_permutations_, ix_0_), t0_);
+			Register_ gradients_1_ = gradients.dot(EmuMath::Functors::_underlying_noise_gen::_fast_gather_int32(p_permutations_, ix_1_), t1_);
 			return EmuSIMD::fused_lerp(gradients_0_, gradients_1_, smooth_t(t0_));
 		}
 
-		EmuMath::Functors::_underlying_noise_gen::_fast_smooth_t<__m128> smooth_t;
+		EmuMath::Functors::_underlying_noise_gen::_fast_smooth_t<Register_> smooth_t;
+		gradient_table_type gradients;
+	};
+
+	template<class Register_>
+	struct make_fast_noise_1d<EmuMath::NoiseType::SIMPLEX, Register_>
+	{
+		static_assert(EmuMath::Validity::_assert_fast_noise_1d_valid_register<Register_>(), "Invalid Register_ type argument provided to EmuMath::Functors::make_fast_noise_1d.");
+		using register_info = EmuMath::Functors::_underlying_noise_gen::_fast_noise_register_info<Register_>;
+		using int_register_type = typename register_info::int_register_type;
+		using gradient_table_type = EmuMath::Functors::_underlying_noise_gen::_fast_perlin_gradient_table<1, Register_>;
+		using simplex_info = EmuMath::Functors::_underlying_noise_gen::simplex_info<1, float>;
+
+		inline make_fast_noise_1d() :
+			gradients(),
+			radius_squared(EmuSIMD::set1<Register_>(simplex_info::radius_squared)),
+			scale(EmuSIMD::set1<Register_>(simplex_info::scale))
+		{
+		}
+
+		[[nodiscard]] inline Register_ operator()
+		(
+			Register_ points_x_,
+			Register_ freq_,
+			int_register_type permutations_mask_,
+			const EmuMath::FastNoisePermutations& permutations_
+		)
+		{
+			// Start weightings and indices
+			points_x_ = EmuSIMD::mul_all(points_x_, freq_);
+			Register_ t0_ = EmuSIMD::floor(points_x_);
+			int_register_type ix_0_ = EmuSIMD::bitwise_and(EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(t0_), permutations_mask_);
+
+			// Finish weightings
+			t0_ = EmuSIMD::sub(points_x_, t0_);
+			Register_ t1_ = EmuSIMD::sub(t0_, EmuSIMD::set1<Register_>(1.0f));
+
+			// Finish indices
+			int_register_type ix_1_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(ix_0_, EmuSIMD::set1<int_register_type, 32>(1)), permutations_mask_);
+
+			const std::int32_t* p_permutations_ = permutations_.data();
+			Register_ val_0_ = EmuMath::Functors::_underlying_noise_gen::_fast_simplex_falloff(radius_squared, EmuSIMD::mul_all(t0_, t0_));
+			Register_ val_1_ = EmuMath::Functors::_underlying_noise_gen::_fast_simplex_falloff(radius_squared, EmuSIMD::mul_all(t1_, t1_));
+			val_0_ = EmuSIMD::mul_all(val_0_, gradients.dot(EmuMath::Functors::_underlying_noise_gen::_fast_gather_int32(p_permutations_, ix_0_), t0_));
+			val_1_ = EmuSIMD::mul_all(val_1_, gradients.dot(EmuMath::Functors::_underlying_noise_gen::_fast_gather_int32(p_permutations_, ix_1_), t1_));
+			return EmuSIMD::mul_all(EmuSIMD::add(val_0_, val_1_), scale);
+		}
+
+		gradient_table_type gradients;
+		Register_ radius_squared;
+		Register_ scale;
 	};
 }
 
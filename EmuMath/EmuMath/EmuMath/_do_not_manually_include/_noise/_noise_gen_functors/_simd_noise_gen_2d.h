@@ -10,13 +10,13 @@ namespace EmuMath::Validity
 	template<class Reg_>
 	[[nodiscard]] static constexpr inline bool _assert_fast_noise_2d_valid_register()
 	{
-		if constexpr (std::is_same_v<__m128, Reg_>)
+		if constexpr (EmuCore::TMP::is_any_comparison_true<std::is_same, Reg_, __m128, __m256, __m512>::value)
 		{
 			return true;
 		}
 		else
 		{
-			static_assert(EmuCore::TMP::get_false<Reg_>(), "Provided an unsupported register for fast_noise_2d. There is only support for the following floating-point SIMD registers: __m128.");
+			static_assert(EmuCore::TMP::get_false<Reg_>(), "Provided an unsupported register for fast_noise_2d. There is only support for the following floating-point SIMD registers: __m128, __m256, __m512.");
 			return false;
 		}
 	}
@@ -35,253 +35,258 @@ namespace EmuMath::Functors
 		}
 	};
 
-	template<>
-	struct make_fast_noise_2d<EmuMath::NoiseType::VALUE, __m128>
+	// Implementations below are width-generic, covering __m128, __m256, and __m512 registers.
+	// --- Permutation hashing remains within integral registers, via gathers from a 32-bit FastNoisePermutations table.
+
+	template<class Register_>
+	struct make_fast_noise_2d<EmuMath::NoiseType::VALUE, Register_>
 	{
+		static_assert(EmuMath::Validity::_assert_fast_noise_2d_valid_register<Register_>(), "Invalid Register_ type argument provided to EmuMath::Functors::make_fast_noise_2d.");
+		using register_info = EmuMath::Functors::_underlying_noise_gen::_fast_noise_register_info<Register_>;
+		using int_register_type = typename register_info::int_register_type;
+
 		inline make_fast_noise_2d()
 		{
 		}
 
-		[[nodiscard]] inline __m128 operator()
+		[[nodiscard]] inline Register_ operator()
 		(
-			__m128 points_x_,
-			__m128 points_y_,
-			__m128 freq_,
-			__m128i permutations_mask_128_,
-			const EmuMath::NoisePermutations& permutations_
+			Register_ points_x_,
+			Register_ points_y_,
+			Register_ freq_,
+			int_register_type permutations_mask_,
+			const EmuMath::FastNoisePermutations& permutations_
 		)
 		{
 			points_x_ = EmuSIMD::floor(EmuSIMD::mul_all(points_x_, freq_));
 			points_y_ = EmuSIMD::floor(EmuSIMD::mul_all(points_y_, freq_));
-
-			__m128i ix_128_ = EmuSIMD::bitwise_and(_mm_cvtps_epi32(points_x_), permutations_mask_128_);
-			__m128i iy_128_ = EmuSIMD::bitwise_and(_mm_cvtps_epi32(points_y_), permutations_mask_128_);
-			int ix_[4];
-			int iy_[4];
-			EmuSIMD::store(iy_128_, iy_);
-			EmuSIMD::store(ix_128_, ix_);
-			float perms_[4];
-			std::size_t mask_ = static_cast<std::size_t>(permutations_.HighestStoredValue());
-
-			for (std::size_t i = 0; i < 4; ++i)
-			{
-				perms_[i] = static_cast<float>(permutations_[(static_cast<std::size_t>(permutations_[ix_[i]]) + iy_[i]) & mask_]);
-			}
-			return EmuSIMD::div(EmuSIMD::load<__m128>(perms_), _mm_cvtepi32_ps(permutations_mask_128_));
+			int_register_type ix_ = EmuSIMD::bitwise_and(EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(points_x_), permutations_mask_);
+			int_register_type iy_ = EmuSIMD::bitwise_and(EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(points_y_), permutations_mask_);
+
+			const std::int32_t* p_permutations_ = permutations_.data();
+			int_register_type perms_ = EmuMath::Functors::_underlying_noise_gen::_fast_gather_int32(p_permutations_, ix_);
+			perms_ = EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perms_, iy_, permutations_mask_);
+			return EmuSIMD::div
+			(
+				EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(perms_),
+				EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(permutations_mask_)
+			);
 		}
 	};
 
-	template<>
-	struct make_fast_noise_2d<EmuMath::NoiseType::VALUE_SMOOTH, __m128>
+	template<class Register_>
+	struct make_fast_noise_2d<EmuMath::NoiseType::VALUE_SMOOTH, Register_>
 	{
+		static_assert(EmuMath::Validity::_assert_fast_noise_2d_valid_register<Register_>(), "Invalid Register_ type argument provided to EmuMath::Functors::make_fast_noise_2d.");
+		using register_info = EmuMath::Functors::_underlying_noise_gen::_fast_noise_register_info<Register_>;
+		using int_register_type = typename register_info::int_register_type;
+
 		inline make_fast_noise_2d() : smooth_t()
 		{
 		}
 
-		[[nodiscard]] inline __m128 operator()
+		[[nodiscard]] inline Register_ operator()
 		(
-			__m128 points_x_,
-			__m128 points_y_,
-			__m128 freq_,
-			__m128i permutations_mask_128_,
-			const EmuMath::NoisePermutations& permutations_
+			Register_ points_x_,
+			Register_ points_y_,
+			Register_ freq_,
+			int_register_type permutations_mask_,
+			const EmuMath::FastNoisePermutations& permutations_
 		)
 		{
 			points_x_ = EmuSIMD::mul_all(points_x_, freq_);
 			points_y_ = EmuSIMD::mul_all(points_y_, freq_);
 
 			// Get weightings and start of indices
-			__m128 tx_ = EmuSIMD::floor(points_x_);
-			__m128i ix_0_128_ = EmuSIMD::bitwise_and(_mm_cvtps_epi32(tx_), permutations_mask_128_);
+			Register_ tx_ = EmuSIMD::floor(points_x_);
+			int_register_type ix_0_ = EmuSIMD::bitwise_and(EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(tx_), permutations_mask_);
 			tx_ = smooth_t(EmuSIMD::sub(points_x_, tx_));
 
-			__m128 ty_ = EmuSIMD::floor(points_y_);
-			__m128i iy_0_128_ = EmuSIMD::bitwise_and(_mm_cvtps_epi32(ty_), permutations_mask_128_);
+			Register_ ty_ = EmuSIMD::floor(points_y_);
+			int_register_type iy_0_ = EmuSIMD::bitwise_and(EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(ty_), permutations_mask_);
 			ty_ = smooth_t(EmuSIMD::sub(points_y_, ty_));
 
 			// Finish indices
-			__m128i one_128i_ = EmuSIMD::set1<__m128i, 32>(1);
-			__m128i ix_1_128_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(ix_0_128_, one_128i_), permutations_mask_128_);
-			__m128i iy_1_128_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(iy_0_128_, one_128i_), permutations_mask_128_);
-
-			int ix_0_[4];
-			int ix_1_[4];
-			int iy_0_[4];
-			int iy_1_[4];
-			EmuSIMD::store(ix_0_128_, ix_0_);
-			EmuSIMD::store(ix_1_128_, ix_1_);
-			EmuSIMD::store(iy_0_128_, iy_0_);
-			EmuSIMD::store(iy_1_128_, iy_1_);
-
-			float perms_00_[4];
-			float perms_01_[4];
-			float perms_10_[4];
-			float perms_11_[4];
-			std::size_t mask_ = static_cast<std::size_t>(permutations_.HighestStoredValue());
-			for (std::size_t i = 0; i < 4; ++i)
-			{
-				std::size_t perm_0_ = static_cast<std::size_t>(permutations_[ix_0_[i]]);
-				std::size_t perm_1_ = static_cast<std::size_t>(permutations_[ix_1_[i]]);
-
-				perms_00_[i] = static_cast<float>(permutations_[(perm_0_ + iy_0_[i]) & mask_]);
-				perms_01_[i] = static_cast<float>(permutations_[(perm_0_ + iy_1_[i]) & mask_]);
-				perms_10_[i] = static_cast<float>(permutations_[(perm_1_ + iy_0_[i]) & mask_]);
-				perms_11_[i] = static_cast<float>(permutations_[(perm_1_ + iy_1_[i]) & mask_]);
-			}
-
-			__m128 lerp_0_ = EmuSIMD::fused_lerp(EmuSIMD::load<__m128>(perms_00_), EmuSIMD::load<__m128>(perms_10_), tx_);
-			__m128 lerp_1_ = EmuSIMD::fused_lerp(EmuSIMD::load<__m128>(perms_01_), EmuSIMD::load<__m128>(perms_11_), tx_);
-			return EmuSIMD::div(EmuSIMD::fused_lerp(lerp_0_, lerp_1_, ty_), _mm_cvtepi32_ps(permutations_mask_128_));
+			int_register_type one_ = EmuSIMD::set1<int_register_type, 32>(1);
+			int_register_type ix_1_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(ix_0_, one_), permutations_mask_);
+			int_register_type iy_1_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(iy_0_, one_), permutations_mask_);
+
+			// Hash corners
+			const std::int32_t* p_permutations_ = permutations_.data();
+			int_register_type perm_0_ = EmuMath::Functors::_underlying_noise_gen::_fast_gather_int32(p_permutations_, ix_0_);
+			int_register_type perm_1_ = EmuMath::Functors::_underlying_noise_gen::_fast_gather_int32(p_permutations_, ix_1_);
+
+			Register_ perms_00_ = EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_0_, iy_0_, permutations_mask_));
+			Register_ perms_01_ = EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_0_, iy_1_, permutations_mask_));
+			Register_ perms_10_ = EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_1_, iy_0_, permutations_mask_));
+			Register_ perms_11_ = EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_1_, iy_1_, permutations_mask_));
+
+			Register_ lerp_0_ = EmuSIMD::fused_lerp(perms_00_, perms_10_, tx_);
+			Register_ lerp_1_ = EmuSIMD::fused_lerp(perms_01_, perms_11_, tx_);
+			return EmuSIMD::div(EmuSIMD::fused_lerp(lerp_0_, lerp_1_, ty_), EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(permutations_mask_));
 		}
 
-		EmuMath::Functors::_underlying_noise_gen::_fast_smooth_t<__m128> smooth_t;
+		EmuMath::Functors::_underlying_noise_gen::_fast_smooth_t<Register_> smooth_t;
 	};
 
-	template<>
-	struct make_fast_noise_2d<EmuMath::NoiseType::PERLIN, __m128>
+	template<class Register_>
+	struct make_fast_noise_2d<EmuMath::NoiseType::PERLIN, Register_>
 	{
-		using gradients = EmuMath::Functors::_underlying_noise_gen::perlin_gradients<2, __m128>;
-
-		/// <summary> Gradients for calculation. Z index contains a duplicate of X; W index contains a duplicate of Y. </summary>
-		const typename gradients::register_array _gradients_128;
-		static constexpr EmuMath::Vector<2, std::size_t> _duplicate_gradient_indices = EmuMath::Vector<2, std::size_t>(0, 1);
+		static_assert(EmuMath::Validity::_assert_fast_noise_2d_valid_register<Register_>(), "Invalid Register_ type argument provided to EmuMath::Functors::make_fast_noise_2d.");
+		using register_info = EmuMath::Functors::_underlying_noise_gen::_fast_noise_register_info<Register_>;
+		using int_register_type = typename register_info::int_register_type;
+		using gradient_table_type = EmuMath::Functors::_underlying_noise_gen::_fast_perlin_gradient_table<2, Register_>;
 
-		inline make_fast_noise_2d() : 
-			smooth_t(),
-			_gradients_128(gradients::init_registers<_duplicate_gradient_indices.at<0>(), _duplicate_gradient_indices.at<1>()>())
+		inline make_fast_noise_2d() : smooth_t(), gradients()
 		{
 		}
 
-		[[nodiscard]] inline __m128 operator()
+		[[nodiscard]] inline Register_ operator()
 		(
-			__m128 points_x_,
-			__m128 points_y_,
-			__m128 freq_,
-			__m128i permutations_mask_128_,
-			const EmuMath::NoisePermutations& permutations_
+			Register_ points_x_,
+			Register_ points_y_,
+			Register_ freq_,
+			int_register_type permutations_mask_,
+			const EmuMath::FastNoisePermutations& permutations_
 		)
 		{
 			points_x_ = EmuSIMD::mul_all(points_x_, freq_);
 			points_y_ = EmuSIMD::mul_all(points_y_, freq_);
 
 			// Start of weightings and indices
-			__m128 tx_0_ = EmuSIMD::floor(points_x_);
-			__m128 ty_0_ = EmuSIMD::floor(points_y_);
-			__m128i ix_0_128_ = _mm_cvtps_epi32(tx_0_);
-			__m128i iy_0_128_ = _mm_cvtps_epi32(ty_0_);
+			Register_ tx_0_ = EmuSIMD::floor(points_x_);
+			Register_ ty_0_ = EmuSIMD::floor(points_y_);
+			int_register_type ix_0_ = EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(tx_0_);
+			int_register_type iy_0_ = EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(ty_0_);
 
 			// Finish off weightings
-			__m128i one_128i_ = EmuSIMD::set1<__m128i>(1);
-			__m128 one_128f_ = _mm_cvtepi32_ps(one_128i_);
+			Register_ one_ = EmuSIMD::set1<Register_>(1.0f);
 			tx_0_ = EmuSIMD::sub(points_x_, tx_0_);
-			__m128 tx_1_ = EmuSIMD::sub(tx_0_, one_128f_);
+			Register_ tx_1_ = EmuSIMD::sub(tx_0_, one_);
 			ty_0_ = EmuSIMD::sub(points_y_, ty_0_);
-			__m128 ty_1_ = EmuSIMD::sub(ty_0_, one_128f_);
+			Register_ ty_1_ = EmuSIMD::sub(ty_0_, one_);
 
 			// Finish off indices
-			ix_0_128_ = EmuSIMD::bitwise_and(ix_0_128_, permutations_mask_128_);
-			__m128i ix_1_128_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(ix_0_128_, one_128i_), permutations_mask_128_);
-			iy_0_128_ = EmuSIMD::bitwise_and(iy_0_128_, permutations_mask_128_);
-			__m128i iy_1_128_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(iy_0_128_, one_128i_), permutations_mask_128_);
-
-			int ix_0_[4];
-			int ix_1_[4];
-			int iy_0_[4];
-			int iy_1_[4];
-			EmuSIMD::store(ix_0_128_, ix_0_);
-			EmuSIMD::store(ix_1_128_, ix_1_);
-			EmuSIMD::store(iy_0_128_, iy_0_);
-			EmuSIMD::store(iy_1_128_, iy_1_);
-
-			std::size_t perms_00_[4];
-			std::size_t perms_01_[4];
-			std::size_t perms_10_[4];
-			std::size_t perms_11_[4];
-			std::size_t perm_mask_ = permutations_.HighestStoredValue();
-
-			for (std::size_t i = 0; i < 4; ++i)
-			{
-				std::size_t perm_0_ = static_cast<std::size_t>(permutations_[ix_0_[i]]);
-				std::size_t perm_1_ = static_cast<std::size_t>(permutations_[ix_1_[i]]);
-				perms_00_[i] = permutations_[(perm_0_ + iy_0_[i]) & perm_mask_] & gradients::mask;
-				perms_01_[i] = permutations_[(perm_0_ + iy_1_[i]) & perm_mask_] & gradients::mask;
-				perms_10_[i] = permutations_[(perm_1_ + iy_0_[i]) & perm_mask_] & gradients::mask;
-				perms_11_[i] = permutations_[(perm_1_ + iy_1_[i]) & perm_mask_] & gradients::mask;
-			}
-
-			// 00
-			__m128 gradient_0_ = _gradients_128[perms_00_[0]];
-			__m128 gradient_1_ = _gradients_128[perms_00_[1]];
-			__m128 gradient_2_ = _gradients_128[perms_00_[2]];
-			__m128 gradient_3_ = _gradients_128[perms_00_[3]];
-
-			// X - prepare Y to be shuffled in next segment too
-			__m128 temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
-			__m128 temp_1_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_2_, gradient_3_);
-			__m128 row_ = EmuSIMD::shuffle<0, 2, 0, 2>(temp_0_, temp_1_);
-			__m128 vals_00_ = EmuSIMD::mul_all(row_, tx_0_);
-
-			// Y
-			row_ = EmuSIMD::shuffle<1, 3, 1, 3>(temp_0_, temp_1_);
-			vals_00_ = EmuSIMD::add(vals_00_, EmuSIMD::mul_all(row_, ty_0_));
-
-			// ABOVE COMMENTS APPLY TO SUBSEQUENT OUTPUTS
-			// 01
-			gradient_0_ = _gradients_128[perms_01_[0]];
-			gradient_1_ = _gradients_128[perms_01_[1]];
-			gradient_2_ = _gradients_128[perms_01_[2]];
-			gradient_3_ = _gradients_128[perms_01_[3]];
-
-			// X
-			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
-			temp_1_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_2_, gradient_3_);
-			row_ = EmuSIMD::shuffle<0, 2, 0, 2>(temp_0_, temp_1_);
-			__m128 vals_01_ = EmuSIMD::mul_all(row_, tx_0_);
-
-			// Y
-			row_ = EmuSIMD::shuffle<1, 3, 1, 3>(temp_0_, temp_1_);
-			vals_01_ = EmuSIMD::add(vals_01_, EmuSIMD::mul_all(row_, ty_1_));
-
-			// 10
-			gradient_0_ = _gradients_128[perms_10_[0]];
-			gradient_1_ = _gradients_128[perms_10_[1]];
-			gradient_2_ = _gradients_128[perms_10_[2]];
-			gradient_3_ = _gradients_128[perms_10_[3]];
-
-			// X
-			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
-			temp_1_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_2_, gradient_3_);
-			row_ = EmuSIMD::shuffle<0, 2, 0, 2>(temp_0_, temp_1_);
-			__m128 vals_10_ = EmuSIMD::mul_all(row_, tx_1_);
-
-			// Y
-			row_ = EmuSIMD::shuffle<1, 3, 1, 3>(temp_0_, temp_1_);
-			vals_10_ = EmuSIMD::add(vals_10_, EmuSIMD::mul_all(row_, ty_0_));
-
-			// 11
-			gradient_0_ = _gradients_128[perms_11_[0]];
-			gradient_1_ = _gradients_128[perms_11_[1]];
-			gradient_2_ = _gradients_128[perms_11_[2]];
-			gradient_3_ = _gradients_128[perms_11_[3]];
-
-			// X
-			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
-			temp_1_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_2_, gradient_3_);
-			row_ = EmuSIMD::shuffle<0, 2, 0, 2>(temp_0_, temp_1_);
-			__m128 vals_11_ = EmuSIMD::mul_all(row_, tx_1_);
-
-			// Y
-			row_ = EmuSIMD::shuffle<1, 3, 1, 3>(temp_0_, temp_1_);
-			vals_11_ = EmuSIMD::add(vals_11_, EmuSIMD::mul_all(row_, ty_1_));
+			int_register_type one_int_ = EmuSIMD::set1<int_register_type, 32>(1);
+			ix_0_ = EmuSIMD::bitwise_and(ix_0_, permutations_mask_);
+			int_register_type ix_1_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(ix_0_, one_int_), permutations_mask_);
+			iy_0_ = EmuSIMD::bitwise_and(iy_0_, permutations_mask_);
+			int_register_type iy_1_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(iy_0_, one_int_), permutations_mask_);
+
+			// Hash corners and form dot products with their gradients
+			const std::int32_t* p_permutations_ = permutations_.data();
+			int_register_type perm_0_ = EmuMath::Functors::_underlying_noise_gen::_fast_gather_int32(p_permutations_, ix_0_);
+			int_register_type perm_1_ = EmuMath::Functors::_underlying_noise_gen::_fast_gather_int32(p_permutations_, ix_1_);
+
+			Register_ vals_00_ = gradients.dot(EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_0_, iy_0_, permutations_mask_), tx_0_, ty_0_);
+			Register_ vals_01_ = gradients.dot(EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_0_, iy_1_, permutations_mask_), tx_0_, ty_1_);
+			Register_ vals_10_ = gradients.dot(EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_1_, iy_0_, permutations_mask_), tx_1_, ty_0_);
+			Register_ vals_11_ = gradients.dot(EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_1_, iy_1_, permutations_mask_), tx_1_, ty_1_);
 
 			// Lerp gradients
 			tx_0_ = smooth_t(tx_0_);
-			__m128 lerp_0_ = EmuSIMD::fused_lerp(vals_00_, vals_10_, tx_0_);
-			__m128 lerp_1_ = EmuSIMD::fused_lerp(vals_01_, vals_11_, tx_0_);
+			Register_ lerp_0_ = EmuSIMD::fused_lerp(vals_00_, vals_10_, tx_0_);
+			Register_ lerp_1_ = EmuSIMD::fused_lerp(vals_01_, vals_11_, tx_0_);
 			return EmuSIMD::fused_lerp(lerp_0_, lerp_1_, smooth_t(ty_0_));
 		}
 
-		EmuMath::Functors::_underlying_noise_gen::_fast_smooth_t<__m128> smooth_t;
+		EmuMath::Functors::_underlying_noise_gen::_fast_smooth_t<Register_> smooth_t;
+		gradient_table_type gradients;
+	};
+
+	template<class Register_>
+	struct make_fast_noise_2d<EmuMath::NoiseType::SIMPLEX, Register_>
+	{
+		static_assert(EmuMath::Validity::_assert_fast_noise_2d_valid_register<Register_>(), "Invalid Register_ type argument provided to EmuMath::Functors::make_fast_noise_2d.");
+		using register_info = EmuMath::Functors::_underlying_noise_gen::_fast_noise_register_info<Register_>;
+		using int_register_type = typename register_info::int_register_type;
+		using gradient_table_type = EmuMath::Functors::_underlying_noise_gen::_fast_perlin_gradient_table<2, Register_>;
+		using simplex_info = EmuMath::Functors::_underlying_noise_gen::simplex_info<2, float>;
+
+		inline make_fast_noise_2d() :
+			gradients(),
+			skew(EmuSIMD::set1<Register_>(simplex_info::skew)),
+			unskew(EmuSIMD::set1<Register_>(simplex_info::unskew)),
+			radius_squared(EmuSIMD::set1<Register_>(simplex_info::radius_squared)),
+			scale(EmuSIMD::set1<Register_>(simplex_info::scale))
+		{
+		}
+
+		[[nodiscard]] inline Register_ operator()
+		(
+			Register_ points_x_,
+			Register_ points_y_,
+			Register_ freq_,
+			int_register_type permutations_mask_,
+			const EmuMath::FastNoisePermutations& permutations_
+		)
+		{
+			points_x_ = EmuSIMD::mul_all(points_x_, freq_);
+			points_y_ = EmuSIMD::mul_all(points_y_, freq_);
+
+			// Skew to find the containing cell, then unskew its origin to find offsets from the first corner
+			Register_ temp_ = EmuSIMD::mul_all(EmuSIMD::add(points_x_, points_y_), skew);
+			Register_ cell_x_ = EmuSIMD::floor(EmuSIMD::add(points_x_, temp_));
+			Register_ cell_y_ = EmuSIMD::floor(EmuSIMD::add(points_y_, temp_));
+			temp_ = EmuSIMD::mul_all(EmuSIMD::add(cell_x_, cell_y_), unskew);
+			Register_ x_0_ = EmuSIMD::sub(points_x_, EmuSIMD::sub(cell_x_, temp_));
+			Register_ y_0_ = EmuSIMD::sub(points_y_, EmuSIMD::sub(cell_y_, temp_));
+
+			// Middle corner is (1, 0) in the lower triangle, or (0, 1) in the upper triangle
+			Register_ one_ = EmuSIMD::set1<Register_>(1.0f);
+			Register_ lower_ = EmuSIMD::cmpgt(x_0_, y_0_);
+			Register_ x_1_offset_ = EmuSIMD::bitwise_and(lower_, one_);
+			Register_ y_1_offset_ = EmuSIMD::sub(one_, x_1_offset_);
+			Register_ x_1_ = EmuSIMD::add(EmuSIMD::sub(x_0_, x_1_offset_), unskew);
+			Register_ y_1_ = EmuSIMD::add(EmuSIMD::sub(y_0_, y_1_offset_), unskew);
+			temp_ = EmuSIMD::fmsub(unskew, EmuSIMD::set1<Register_>(2.0f), one_);
+			Register_ x_2_ = EmuSIMD::add(x_0_, temp_);
+			Register_ y_2_ = EmuSIMD::add(y_0_, temp_);
+
+			// Indices of all corners
+			int_register_type one_int_ = EmuSIMD::set1<int_register_type, 32>(1);
+			int_register_type ix_0_ = EmuSIMD::bitwise_and(EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(cell_x_), permutations_mask_);
+			int_register_type iy_0_ = EmuSIMD::bitwise_and(EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(cell_y_), permutations_mask_);
+			int_register_type ix_1_offset_ = EmuSIMD::bitwise_and(EmuSIMD::cast<int_register_type>(lower_), one_int_);
+			int_register_type iy_1_offset_ = EmuSIMD::sub<32>(one_int_, ix_1_offset_);
+
+			const std::int32_t* p_permutations_ = permutations_.data();
+			Register_ result_ = _corner(ix_0_, iy_0_, x_0_, y_0_, permutations_mask_, p_permutations_);
+			result_ = EmuSIMD::add
+			(
+				result_,
+				_corner(EmuSIMD::add<32>(ix_0_, ix_1_offset_), EmuSIMD::add<32>(iy_0_, iy_1_offset_), x_1_, y_1_, permutations_mask_, p_permutations_)
+			);
+			result_ = EmuSIMD::add
+			(
+				result_,
+				_corner(EmuSIMD::add<32>(ix_0_, one_int_), EmuSIMD::add<32>(iy_0_, one_int_), x_2_, y_2_, permutations_mask_, p_permutations_)
+			);
+			return EmuSIMD::mul_all(result_, scale);
+		}
+
+		gradient_table_type gradients;
+		Register_ skew;
+		Register_ unskew;
+		Register_ radius_squared;
+		Register_ scale;
+
+	private:
+		[[nodiscard]] inline Register_ _corner
+		(
+			int_register_type ix_,
+			int_register_type iy_,
+			Register_ x_,
+			Register_ y_,
+			int_register_type permutations_mask_,
+			const std::int32_t* p_permutations_
+		) const
+		{
+			Register_ falloff_ = EmuMath::Functors::_underlying_noise_gen::_fast_simplex_falloff(radius_squared, EmuSIMD::fmadd(x_, x_, EmuSIMD::mul_all(y_, y_)));
+			int_register_type perms_ = EmuMath::Functors::_underlying_noise_gen::_fast_gather_int32(p_permutations_, EmuSIMD::bitwise_and(ix_, permutations_mask_));
+			perms_ = EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perms_, iy_, permutations_mask_);
+			return EmuSIMD::mul_all(falloff_, gradients.dot(perms_, x_, y_));
+		}
 	};
 }
 
@@ -10,13 +10,13 @@ namespace EmuMath::Validity
 	template<class Reg_>
 	[[nodiscard]] static constexpr inline bool _assert_fast_noise_3d_valid_register()
 	{
-		if constexpr (std::is_same_v<__m128, Reg_>)
+		if constexpr (EmuCore::TMP::is_any_comparison_true<std::is_same, Reg_, __m128, __m256, __m512>::value)
 		{
 			return true;
 		}
 		else
 		{
-			static_assert(EmuCore::TMP::get_false<Reg_>(), "Provided an unsupported register for fast_noise_3d. There is only support for the following floating-point SIMD registers: __m128.");
+			static_assert(EmuCore::TMP::get_false<Reg_>(), "Provided an unsupported register for fast_noise_3d. There is only support for the following floating-point SIMD registers: __m128, __m256, __m512.");
 			return false;
 		}
 	}
@@ -35,518 +35,540 @@ namespace EmuMath::Functors
 		}
 	};
 
-	template<>
-	struct make_fast_noise_3d<EmuMath::NoiseType::VALUE, __m128>
+	// Implementations below are width-generic, covering __m128, __m256, and __m512 registers.
+	// --- Permutation hashing remains within integral registers, via gathers from a 32-bit FastNoisePermutations table.
+
+	template<class Register_>
+	struct make_fast_noise_3d<EmuMath::NoiseType::VALUE, Register_>
 	{
+		static_assert(EmuMath::Validity::_assert_fast_noise_3d_valid_register<Register_>(), "Invalid Register_ type argument provided to EmuMath::Functors::make_fast_noise_3d.");
+		using register_info = EmuMath::Functors::_underlying_noise_gen::_fast_noise_register_info<Register_>;
+		using int_register_type = typename register_info::int_register_type;
+
 		inline make_fast_noise_3d()
 		{
 		}
 
-		[[nodiscard]] inline __m128 operator()
+		[[nodiscard]] inline Register_ operator()
 		(
-			__m128 points_x_,
-			__m128 points_y_,
-			__m128 points_z_,
-			__m128 freq_,
-			__m128i permutations_mask_128_,
-			const EmuMath::NoisePermutations& permutations_
+			Register_ points_x_,
+			Register_ points_y_,
+			Register_ points_z_,
+			Register_ freq_,
+			int_register_type permutations_mask_,
+			const EmuMath::FastNoisePermutations& permutations_
 		)
 		{
 			points_x_ = EmuSIMD::floor(EmuSIMD::mul_all(points_x_, freq_));
 			points_y_ = EmuSIMD::floor(EmuSIMD::mul_all(points_y_, freq_));
 			points_z_ = EmuSIMD::floor(EmuSIMD::mul_all(points_z_, freq_));
-
-			__m128i ix_128i_ = EmuSIMD::bitwise_and(_mm_cvtps_epi32(points_x_), permutations_mask_128_);
-			__m128i iy_128i_ = EmuSIMD::bitwise_and(_mm_cvtps_epi32(points_y_), permutations_mask_128_);
-			__m128i iz_128i_ = EmuSIMD::bitwise_and(_mm_cvtps_epi32(points_z_), permutations_mask_128_);
-
-			int ix_[4];
-			int iy_[4];
-			int iz_[4];
-			EmuSIMD::store(iz_128i_, iz_);
-			EmuSIMD::store(iy_128i_, iy_);
-			EmuSIMD::store(ix_128i_, ix_);
-
-			float perms_[4];
-			std::size_t mask_ = static_cast<std::size_t>(permutations_.HighestStoredValue());
-			for (std::size_t i = 0; i < 4; ++i)
-			{
-				std::size_t perm_x_ = static_cast<std::size_t>(permutations_[ix_[i]]);
-				std::size_t perm_xyz_ = (static_cast<std::size_t>(permutations_[(perm_x_ + iy_[i]) & mask_]) + iz_[i]) & mask_;
-				perms_[i] = static_cast<float>(permutations_[perm_xyz_]);
-			}
-
-			return EmuSIMD::div(EmuSIMD::load<__m128>(perms_), _mm_cvtepi32_ps(permutations_mask_128_));
+			int_register_type ix_ = EmuSIMD::bitwise_and(EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(points_x_), permutations_mask_);
+			int_register_type iy_ = EmuSIMD::bitwise_and(EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(points_y_), permutations_mask_);
+			int_register_type iz_ = EmuSIMD::bitwise_and(EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(points_z_), permutations_mask_);
+
+			const std::int32_t* p_permutations_ = permutations_.data();
+			int_register_type perms_ = EmuMath::Functors::_underlying_noise_gen::_fast_gather_int32(p_permutations_, ix_);
+			perms_ = EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perms_, iy_, permutations_mask_);
+			perms_ = EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perms_, iz_, permutations_mask_);
+			return EmuSIMD::div
+			(
+				EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(perms_),
+				EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(permutations_mask_)
+			);
 		}
 	};
 
-	template<>
-	struct make_fast_noise_3d<EmuMath::NoiseType::VALUE_SMOOTH, __m128>
+	template<class Register_>
+	struct make_fast_noise_3d<EmuMath::NoiseType::VALUE_SMOOTH, Register_>
 	{
+		static_assert(EmuMath::Validity::_assert_fast_noise_3d_valid_register<Register_>(), "Invalid Register_ type argument provided to EmuMath::Functors::make_fast_noise_3d.");
+		using register_info = EmuMath::Functors::_underlying_noise_gen::_fast_noise_register_info<Register_>;
+		using int_register_type = typename register_info::int_register_type;
+
 		inline make_fast_noise_3d() : smooth_t()
 		{
 		}
 
-		[[nodiscard]] inline __m128 operator()
+		[[nodiscard]] inline Register_ operator()
 		(
-			__m128 points_x_,
-			__m128 points_y_,
-			__m128 points_z_,
-			__m128 freq_,
-			__m128i permutations_mask_128_,
-			const EmuMath::NoisePermutations& permutations_
+			Register_ points_x_,
+			Register_ points_y_,
+			Register_ points_z_,
+			Register_ freq_,
+			int_register_type permutations_mask_,
+			const EmuMath::FastNoisePermutations& permutations_
 		)
 		{
 			points_x_ = EmuSIMD::mul_all(points_x_, freq_);
 			points_y_ = EmuSIMD::mul_all(points_y_, freq_);
 			points_z_ = EmuSIMD::mul_all(points_z_, freq_);
 
-			// Weightings and start of indices
-			__m128 tx_ = EmuSIMD::floor(points_x_);
-			__m128i ix_0_128i_ = _mm_cvtps_epi32(tx_);
+			// Get weightings and start of indices
+			Register_ tx_ = EmuSIMD::floor(points_x_);
+			int_register_type ix_0_ = EmuSIMD::bitwise_and(EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(tx_), permutations_mask_);
 			tx_ = smooth_t(EmuSIMD::sub(points_x_, tx_));
 
-			__m128 ty_ = EmuSIMD::floor(points_y_);
-			__m128i iy_0_128i_ = _mm_cvtps_epi32(ty_);
+			Register_ ty_ = EmuSIMD::floor(points_y_);
+			int_register_type iy_0_ = EmuSIMD::bitwise_and(EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(ty_), permutations_mask_);
 			ty_ = smooth_t(EmuSIMD::sub(points_y_, ty_));
 
-			__m128 tz_ = EmuSIMD::floor(points_z_);
-			__m128i iz_0_128i_ = _mm_cvtps_epi32(tz_);
+			Register_ tz_ = EmuSIMD::floor(points_z_);
+			int_register_type iz_0_ = EmuSIMD::bitwise_and(EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(tz_), permutations_mask_);
 			tz_ = smooth_t(EmuSIMD::sub(points_z_, tz_));
 
-			// Mask indices and get alternatives to lerp
-			ix_0_128i_ = EmuSIMD::bitwise_and(ix_0_128i_, permutations_mask_128_);
-			iy_0_128i_ = EmuSIMD::bitwise_and(iy_0_128i_, permutations_mask_128_);
-			iz_0_128i_ = EmuSIMD::bitwise_and(iz_0_128i_, permutations_mask_128_);
-			__m128i one_128i_ = EmuSIMD::set1<__m128i, 32>(1);
-			__m128i iz_1_128i_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(iz_0_128i_, one_128i_), permutations_mask_128_);
-			__m128i iy_1_128i_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(iy_0_128i_, one_128i_), permutations_mask_128_);
-			__m128i ix_1_128i_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(ix_0_128i_, one_128i_), permutations_mask_128_);
-
-			// Store 0 indices
-			int ix_0_[4];
-			int iy_0_[4];
-			int iz_0_[4];
-			EmuSIMD::store(ix_0_128i_, ix_0_);
-			EmuSIMD::store(iy_0_128i_, iy_0_);
-			EmuSIMD::store(iz_0_128i_, iz_0_);
-
-			// Store 1 indices
-			int ix_1_[4];
-			int iy_1_[4];
-			int iz_1_[4];
-			EmuSIMD::store(ix_1_128i_, ix_1_);
-			EmuSIMD::store(iy_1_128i_, iy_1_);
-			EmuSIMD::store(iz_1_128i_, iz_1_);
-
-			float perms_000_[4];
-			float perms_001_[4];
-			float perms_010_[4];
-			float perms_011_[4];
-			float perms_100_[4];
-			float perms_101_[4];
-			float perms_110_[4];
-			float perms_111_[4];
-			std::size_t mask_ = permutations_.HighestStoredValue();
-
-			for (std::size_t i = 0; i < 4; ++i)
-			{
-				// Forced store as size_t so we can handle width changes if EmuMath::NoisePermutationValue is not size_t width
-				std::size_t perm_0_ = static_cast<std::size_t>(permutations_[ix_0_[i]]);
-				std::size_t perm_1_ = static_cast<std::size_t>(permutations_[ix_1_[i]]);
-
-				std::size_t perm_00_ = static_cast<std::size_t>(permutations_[(perm_0_ + iy_0_[i]) & mask_]);
-				std::size_t perm_01_ = static_cast<std::size_t>(permutations_[(perm_0_ + iy_1_[i]) & mask_]);
-				std::size_t perm_10_ = static_cast<std::size_t>(permutations_[(perm_1_ + iy_0_[i]) & mask_]);
-				std::size_t perm_11_ = static_cast<std::size_t>(permutations_[(perm_1_ + iy_1_[i]) & mask_]);
-
-				perms_000_[i] = static_cast<float>(permutations_[(perm_00_ + iz_0_[i]) & mask_]);
-				perms_001_[i] = static_cast<float>(permutations_[(perm_00_ + iz_1_[i]) & mask_]);
-				perms_010_[i] = static_cast<float>(permutations_[(perm_01_ + iz_0_[i]) & mask_]);
-				perms_011_[i] = static_cast<float>(permutations_[(perm_01_ + iz_1_[i]) & mask_]);
-				perms_100_[i] = static_cast<float>(permutations_[(perm_10_ + iz_0_[i]) & mask_]);
-				perms_101_[i] = static_cast<float>(permutations_[(perm_10_ + iz_1_[i]) & mask_]);
-				perms_110_[i] = static_cast<float>(permutations_[(perm_11_ + iz_0_[i]) & mask_]);
-				perms_111_[i] = static_cast<float>(permutations_[(perm_11_ + iz_1_[i]) & mask_]);
-			}
-
-			// X-lerps
-			__m128 lerp_0_ = EmuSIMD::fused_lerp(EmuSIMD::load<__m128>(perms_000_), EmuSIMD::load<__m128>(perms_100_), tx_);
-			__m128 lerp_1_ = EmuSIMD::fused_lerp(EmuSIMD::load<__m128>(perms_010_), EmuSIMD::load<__m128>(perms_110_), tx_);
-			__m128 lerp_2_ = EmuSIMD::fused_lerp(EmuSIMD::load<__m128>(perms_001_), EmuSIMD::load<__m128>(perms_101_), tx_);
-			__m128 lerp_3_ = EmuSIMD::fused_lerp(EmuSIMD::load<__m128>(perms_011_), EmuSIMD::load<__m128>(perms_111_), tx_);
-
-			// Y-lerps
+			// Finish indices
+			int_register_type one_ = EmuSIMD::set1<int_register_type, 32>(1);
+			int_register_type ix_1_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(ix_0_, one_), permutations_mask_);
+			int_register_type iy_1_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(iy_0_, one_), permutations_mask_);
+			int_register_type iz_1_ = EmuSIMD::bitwise_and(EmuSIMD::add<32>(iz_0_, one_), permutations_mask_);
+
+			// Hash corners
+			const std::int32_t* p_permutations_ = permutations_.data();
+			int_register_type perm_0_ = EmuMath::Functors::_underlying_noise_gen::_fast_gather_int32(p_permutations_, ix_0_);
+			int_register_type perm_1_ = EmuMath::Functors::_underlying_noise_gen::_fast_gather_int32(p_permutations_, ix_1_);
+
+			int_register_type perm_00_ = EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_0_, iy_0_, permutations_mask_);
+			int_register_type perm_01_ = EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_0_, iy_1_, permutations_mask_);
+			int_register_type perm_10_ = EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_1_, iy_0_, permutations_mask_);
+			int_register_type perm_11_ = EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_1_, iy_1_, permutations_mask_);
+
+			Register_ perms_000_ = EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_00_, iz_0_, permutations_mask_));
+			Register_ perms_001_ = EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_00_, iz_1_, permutations_mask_));
+			Register_ perms_010_ = EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_01_, iz_0_, permutations_mask_));
+			Register_ perms_011_ = EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_01_, iz_1_, permutations_mask_));
+			Register_ perms_100_ = EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_10_, iz_0_, permutations_mask_));
+			Register_ perms_101_ = EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_10_, iz_1_, permutations_mask_));
+			Register_ perms_110_ = EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_11_, iz_0_, permutations_mask_));
+			Register_ perms_111_ = EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_11_, iz_1_, permutations_mask_));
+
+			// Lerp along X
+			Register_ lerp_0_ = EmuSIMD::fused_lerp(perms_000_, perms_100_, tx_);
+			Register_ lerp_1_ = EmuSIMD::fused_lerp(perms_010_, perms_110_, tx_);
+			Register_ lerp_2_ = EmuSIMD::fused_lerp(perms_001_, perms_101_, tx_);
+			Register_ lerp_3_ = EmuSIMD::fused_lerp(perms_011_, perms_111_, tx_);
+
+			// Lerp along Y
 			lerp_0_ = EmuSIMD::fused_lerp(lerp_0_, lerp_1_, ty_);
 			lerp_2_ = EmuSIMD::fused_lerp(lerp_2_, lerp_3_, ty_);
 
-			// Final Z-lerp and normalise
-			return EmuSIMD::div(EmuSIMD::fused_lerp(lerp_0_, lerp_2_, tz_), _mm_cvtepi32_ps(permutations_mask_128_));
+			// Lerp along Z and normalise
+			return EmuSIMD::div(EmuSIMD::fused_lerp(lerp_0_, lerp_2_, tz_), EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_float(permutations_mask_));
 		}
 
-		EmuMath::Functors::_underlying_noise_gen::_fast_smooth_t<__m128> smooth_t;
+		EmuMath::Functors::_underlying_noise_gen::_fast_smooth_t<Register_> smooth_t;
 	};
 
-	template<>
-	struct make_fast_noise_3d<EmuMath::NoiseType::PERLIN, __m128>
+	template<class Register_>
+	struct make_fast_noise_3d<EmuMath::NoiseType::PERLIN, Register_>
 	{
-	public:
-		using gradients = EmuMath::Functors::_underlying_noise_gen::perlin_gradients<3, __m128>;
-
-		/// <summary> Gradients for calculation. W index contains a duplicate of the Z index. </summary>
-		const typename gradients::register_array _gradients_128;
-		static constexpr std::size_t _duplicate_gradient_index = 2;
-
-		make_fast_noise_3d() :
-			smooth_t(),
-			ix_0(),
-			ix_1(),
-			iy_0(),
-			iy_1(),
-			iz_0(),
-			iz_1(),
-			_gradients_128(gradients::init_registers<_duplicate_gradient_index>())
+		static_assert(EmuMath::Validity::_assert_fast_noise_3d_valid_register<Register_>(), "Invalid Register_ type argument provided to EmuMath::Functors::make_fast_noise_3d.");
+		using register_info = EmuMath::Functors::_underlying_noise_gen::_fast_noise_register_info<Register_>;
+		using int_register_type = typename register_info::int_register_type;
+		using gradient_table_type = EmuMath::Functors::_underlying_noise_gen::_fast_perlin_gradient_table<3, Register_>;
+
+		inline make_fast_noise_3d() : smooth_t(), smooth_t_derivative(), gradients()
 		{
 		}
 
-		[[nodiscard]] inline __m128 operator()
+		[[nodiscard]] inline Register_ operator()
 		(
-			__m128 points_x_,
-			__m128 points_y_,
-			__m128 points_z_,
-			__m128 freq_,
-			__m128i permutations_mask_128_,
-			const EmuMath::NoisePermutations& permutations_
+			Register_ points_x_,
+			Register_ points_y_,
+			Register_ points_z_,
+			Register_ freq_,
+			int_register_type permutations_mask_,
+			const EmuMath::FastNoisePermutations& permutations_
 		)
 		{
-			points_x_ = EmuSIMD::mul_all(points_x_, freq_);
-			points_y_ = EmuSIMD::mul_all(points_y_, freq_);
-			points_z_ = EmuSIMD::mul_all(points_z_, freq_);
+			Register_ t_[2][3];
+			int_register_type hashes_[8];
+			_find_cell
+			(
+				EmuSIMD::mul_all(points_x_, freq_),
+				EmuSIMD::mul_all(points_y_, freq_),
+				EmuSIMD::mul_all(points_z_, freq_),
+				permutations_mask_,
+				permutations_,
+				t_,
+				hashes_
+			);
+
+			// Form dot products of corner gradients and weightings
+			Register_ vals_[8];
+			for (std::size_t i = 0; i < 8; ++i)
+			{
+				vals_[i] = gradients.dot(hashes_[i], t_[(i >> 2) & 1][0], t_[(i >> 1) & 1][1], t_[i & 1][2]);
+			}
+			return _trilerp(vals_, smooth_t(t_[0][0]), smooth_t(t_[0][1]), smooth_t(t_[0][2]));
+		}
+
+		/// <summary>
+		/// <para> Produces the same samples as this functor's operator(), along with their analytic partial derivatives with respect to each component of the passed points. </para>
+		/// <para> Derivatives are output via out_dx_, out_dy_, and out_dz_, and samples are returned. </para>
+		/// </summary>
+		[[nodiscard]] inline Register_ SampleWithDerivatives
+		(
+			Register_ points_x_,
+			Register_ points_y_,
+			Register_ points_z_,
+			Register_ freq_,
+			int_register_type permutations_mask_,
+			const EmuMath::FastNoisePermutations& permutations_,
+			Register_& out_dx_,
+			Register_& out_dy_,
+			Register_& out_dz_
+		)
+		{
+			Register_ t_[2][3];
+			int_register_type hashes_[8];
+			_find_cell
+			(
+				EmuSIMD::mul_all(points_x_, freq_),
+				EmuSIMD::mul_all(points_y_, freq_),
+				EmuSIMD::mul_all(points_z_, freq_),
+				permutations_mask_,
+				permutations_,
+				t_,
+				hashes_
+			);
+
+			// Form dot products of corner gradients and weightings, keeping the gradients for derivatives
+			Register_ vals_[8];
+			Register_ corner_components_[3][8];
+			for (std::size_t i = 0; i < 8; ++i)
+			{
+				Register_ components_[3];
+				vals_[i] = gradients.gather_and_dot(hashes_[i], components_, t_[(i >> 2) & 1][0], t_[(i >> 1) & 1][1], t_[i & 1][2]);
+				corner_components_[0][i] = components_[0];
+				corner_components_[1][i] = components_[1];
+				corner_components_[2][i] = components_[2];
+			}
+
+			Register_ tx_ = smooth_t(t_[0][0]);
+			Register_ ty_ = smooth_t(t_[0][1]);
+			Register_ tz_ = smooth_t(t_[0][2]);
+
+			// Each derivative is the interpolated gradient component, plus the change in interpolation weight multiplied by the difference between the faces being interpolated
+			Register_ face_diff_ = EmuSIMD::fused_lerp
+			(
+				EmuSIMD::fused_lerp(EmuSIMD::sub(vals_[4], vals_[0]), EmuSIMD::sub(vals_[6], vals_[2]), ty_),
+				EmuSIMD::fused_lerp(EmuSIMD::sub(vals_[5], vals_[1]), EmuSIMD::sub(vals_[7], vals_[3]), ty_),
+				tz_
+			);
+			out_dx_ = EmuSIMD::mul_all(EmuSIMD::fmadd(smooth_t_derivative(t_[0][0]), face_diff_, _trilerp(corner_components_[0], tx_, ty_, tz_)), freq_);
+
+			face_diff_ = EmuSIMD::fused_lerp
+			(
+				EmuSIMD::fused_lerp(EmuSIMD::sub(vals_[2], vals_[0]), EmuSIMD::sub(vals_[6], vals_[4]), tx_),
+				EmuSIMD::fused_lerp(EmuSIMD::sub(vals_[3], vals_[1]), EmuSIMD::sub(vals_[7], vals_[5]), tx_),
+				tz_
+			);
+			out_dy_ = EmuSIMD::mul_all(EmuSIMD::fmadd(smooth_t_derivative(t_[0][1]), face_diff_, _trilerp(corner_components_[1], tx_, ty_, tz_)), freq_);
+
+			face_diff_ = EmuSIMD::fused_lerp
+			(
+				EmuSIMD::fused_lerp(EmuSIMD::sub(vals_[1], vals_[0]), EmuSIMD::sub(vals_[5], vals_[4]), tx_),
+				EmuSIMD::fused_lerp(EmuSIMD::sub(vals_[3], vals_[2]), EmuSIMD::sub(vals_[7], vals_[6]), tx_),
+				ty_
+			);
+			out_dz_ = EmuSIMD::mul_all(EmuSIMD::fmadd(smooth_t_derivative(t_[0][2]), face_diff_, _trilerp(corner_components_[2], tx_, ty_, tz_)), freq_);
+
+			return _trilerp(vals_, tx_, ty_, tz_);
+		}
+
+		EmuMath::Functors::_underlying_noise_gen::_fast_smooth_t<Register_> smooth_t;
+		EmuMath::Functors::_underlying_noise_gen::_fast_smooth_t_derivative<Register_> smooth_t_derivative;
+		gradient_table_type gradients;
 
+	private:
+		/// <summary>
+		/// <para> Outputs the offsets of the passed (frequency-scaled) points from the lowest (out_t_[0]) and highest (out_t_[1]) corners of their cells. </para>
+		/// <para> Also outputs the permutation hashes of each cell's 8 corners, ordered by their X, Y, and Z bits (i.e. 000, 001, 010, ..., 111). </para>
+		/// </summary>
+		inline void _find_cell
+		(
+			Register_ points_x_,
+			Register_ points_y_,
+			Register_ points_z_,
+			int_register_type permutations_mask_,
+			const EmuMath::FastNoisePermutations& permutations_,
+			Register_ (&out_t_)[2][3],
+			int_register_type (&out_hashes_)[8]
+		) const
+		{
 			// temp_0: floor(x)...
-			__m128 temp_0_128_ = EmuSIMD::floor(points_x_);
-			__m128 tx_0_128_ = EmuSIMD::sub(points_x_, temp_0_128_);
-			__m128i ix_0_128_ = _mm_cvtps_epi32(temp_0_128_);
+			Register_ temp_0_ = EmuSIMD::floor(points_x_);
+			out_t_[0][0] = EmuSIMD::sub(points_x_, temp_0_);
+			int_register_type ix_0_ = EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(temp_0_);
 
 			// temp_0: floor(y)...
-			temp_0_128_ = EmuSIMD::floor(points_y_);
-			__m128 ty_0_128_ = EmuSIMD::sub(points_y_, temp_0_128_);
-			__m128i iy_0_128_ = _mm_cvtps_epi32(temp_0_128_);
+			temp_0_ = EmuSIMD::floor(points_y_);
+			out_t_[0][1] = EmuSIMD::sub(points_y_, temp_0_);
+			int_register_type iy_0_ = EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(temp_0_);
 
 			// temp_0: floor(z)...
-			temp_0_128_ = EmuSIMD::floor(points_z_);
-			__m128 tz_0_128_ = EmuSIMD::sub(points_z_, temp_0_128_);
-			__m128i iz_0_128_ = _mm_cvtps_epi32(temp_0_128_);
+			temp_0_ = EmuSIMD::floor(points_z_);
+			out_t_[0][2] = EmuSIMD::sub(points_z_, temp_0_);
+			int_register_type iz_0_ = EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(temp_0_);
 
 			// Get secondary lerp weightings
-			// --- temp_0: { 1, 1, 1, 1 }
-			temp_0_128_ = _mm_set1_ps(1.0f);
-			__m128 tx_1_128_ = EmuSIMD::sub(tx_0_128_, temp_0_128_);
-			__m128 ty_1_128_ = EmuSIMD::sub(ty_0_128_, temp_0_128_);
-			__m128 tz_1_128_ = EmuSIMD::sub(tz_0_128_, temp_0_128_);
+			temp_0_ = EmuSIMD::set1<Register_>(1.0f);
+			out_t_[1][0] = EmuSIMD::sub(out_t_[0][0], temp_0_);
+			out_t_[1][1] = EmuSIMD::sub(out_t_[0][1], temp_0_);
+			out_t_[1][2] = EmuSIMD::sub(out_t_[0][2], temp_0_);
 
 			// Mask and find secondaries to permutation indices
-			ix_0_128_ = EmuSIMD::bitwise_and(permutations_mask_128_, ix_0_128_);
-			iy_0_128_ = EmuSIMD::bitwise_and(permutations_mask_128_, iy_0_128_);
-			iz_0_128_ = EmuSIMD::bitwise_and(permutations_mask_128_, iz_0_128_);
-			__m128i one_128i_ = _mm_cvtps_epi32(temp_0_128_);
-			__m128i ix_1_128_ = EmuSIMD::bitwise_and(permutations_mask_128_, EmuSIMD::add<32>(ix_0_128_, one_128i_));
-			__m128i iy_1_128_ = EmuSIMD::bitwise_and(permutations_mask_128_, EmuSIMD::add<32>(iy_0_128_, one_128i_));
-			__m128i iz_1_128_ = EmuSIMD::bitwise_and(permutations_mask_128_, EmuSIMD::add<32>(iz_0_128_, one_128i_));
-
-			// Store last calculated values first for best chance at a cache hit
-			EmuSIMD::store(iz_1_128_, iz_1.data());
-			EmuSIMD::store(iz_0_128_, iz_0.data());
-
-			EmuSIMD::store(iy_1_128_, iy_1.data());
-			EmuSIMD::store(iy_0_128_, iy_0.data());
-
-			EmuSIMD::store(ix_1_128_, ix_1.data());
-			EmuSIMD::store(ix_0_128_, ix_0.data());
-
-			// Find the gradients we'll be making use of in interpolations
-			// --- No benefit from manually inlining this part within the function in release, so best to just keep this function cleaner
-			__m128 vals_000_, vals_001_, vals_010_, vals_011_, vals_100_, vals_101_, vals_110_, vals_111_;
-			_calculate_values_to_lerp
-			(
-				permutations_,
-				tx_0_128_,
-				ty_0_128_,
-				tz_0_128_,
-				tx_1_128_,
-				ty_1_128_,
-				tz_1_128_,
-				vals_000_,
-				vals_001_,
-				vals_010_,
-				vals_011_,
-				vals_100_,
-				vals_101_,
-				vals_110_,
-				vals_111_
-			);
-			
-			// Apply smooth (or fade) function to our weightings
-			tx_0_128_ = smooth_t(tx_0_128_);
-			ty_0_128_ = smooth_t(ty_0_128_);
-			tz_0_128_ = smooth_t(tz_0_128_);
-
-			// Primary lerps
-			// --- Use fused lerps to skip 7 floating-point rounding operations
-			__m128 lerp_0_ = EmuSIMD::fused_lerp(vals_000_, vals_100_, tx_0_128_);
-			__m128 lerp_1_ = EmuSIMD::fused_lerp(vals_010_, vals_110_, tx_0_128_);
-			__m128 lerp_2_ = EmuSIMD::fused_lerp(vals_001_, vals_101_, tx_0_128_);
-			__m128 lerp_3_ = EmuSIMD::fused_lerp(vals_011_, vals_111_, tx_0_128_);
-
-			// Secondary lerps
-			lerp_0_ = EmuSIMD::fused_lerp(lerp_0_, lerp_1_, ty_0_128_);
-			lerp_2_ = EmuSIMD::fused_lerp(lerp_2_, lerp_3_, ty_0_128_);
-
-			// Final tertiary lerp
-			return EmuSIMD::fused_lerp(lerp_0_, lerp_2_, tz_0_128_);
+			int_register_type one_int_ = EmuSIMD::set1<int_register_type, 32>(1);
+			ix_0_ = EmuSIMD::bitwise_and(permutations_mask_, ix_0_);
+			iy_0_ = EmuSIMD::bitwise_and(permutations_mask_, iy_0_);
+			iz_0_ = EmuSIMD::bitwise_and(permutations_mask_, iz_0_);
+			int_register_type ix_1_ = EmuSIMD::bitwise_and(permutations_mask_, EmuSIMD::add<32>(ix_0_, one_int_));
+			int_register_type iy_1_ = EmuSIMD::bitwise_and(permutations_mask_, EmuSIMD::add<32>(iy_0_, one_int_));
+			int_register_type iz_1_ = EmuSIMD::bitwise_and(permutations_mask_, EmuSIMD::add<32>(iz_0_, one_int_));
+
+			// Hash corners
+			const std::int32_t* p_permutations_ = permutations_.data();
+			int_register_type perm_0_ = EmuMath::Functors::_underlying_noise_gen::_fast_gather_int32(p_permutations_, ix_0_);
+			int_register_type perm_1_ = EmuMath::Functors::_underlying_noise_gen::_fast_gather_int32(p_permutations_, ix_1_);
+
+			int_register_type perm_00_ = EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_0_, iy_0_, permutations_mask_);
+			int_register_type perm_01_ = EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_0_, iy_1_, permutations_mask_);
+			int_register_type perm_10_ = EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_1_, iy_0_, permutations_mask_);
+			int_register_type perm_11_ = EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_1_, iy_1_, permutations_mask_);
+
+			out_hashes_[0] = EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_00_, iz_0_, permutations_mask_);
+			out_hashes_[1] = EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_00_, iz_1_, permutations_mask_);
+			out_hashes_[2] = EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_01_, iz_0_, permutations_mask_);
+			out_hashes_[3] = EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_01_, iz_1_, permutations_mask_);
+			out_hashes_[4] = EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_10_, iz_0_, permutations_mask_);
+			out_hashes_[5] = EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_10_, iz_1_, permutations_mask_);
+			out_hashes_[6] = EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_11_, iz_0_, permutations_mask_);
+			out_hashes_[7] = EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perm_11_, iz_1_, permutations_mask_);
 		}
 
-	private:
-		inline void _calculate_values_to_lerp
+		/// <summary> Trilinearly interpolates the passed corner values, ordered as in _find_cell, with the provided smoothed weightings. </summary>
+		[[nodiscard]] static inline Register_ _trilerp(const Register_ (&corners_)[8], Register_ tx_, Register_ ty_, Register_ tz_)
+		{
+			// Lerp along X
+			Register_ lerp_0_ = EmuSIMD::fused_lerp(corners_[0], corners_[4], tx_);
+			Register_ lerp_1_ = EmuSIMD::fused_lerp(corners_[2], corners_[6], tx_);
+			Register_ lerp_2_ = EmuSIMD::fused_lerp(corners_[1], corners_[5], tx_);
+			Register_ lerp_3_ = EmuSIMD::fused_lerp(corners_[3], corners_[7], tx_);
+
+			// Lerp along Y
+			lerp_0_ = EmuSIMD::fused_lerp(lerp_0_, lerp_1_, ty_);
+			lerp_2_ = EmuSIMD::fused_lerp(lerp_2_, lerp_3_, ty_);
+
+			// Lerp along Z
+			return EmuSIMD::fused_lerp(lerp_0_, lerp_2_, tz_);
+		}
+	};
+
+	template<class Register_>
+	struct make_fast_noise_3d<EmuMath::NoiseType::SIMPLEX, Register_>
+	{
+		static_assert(EmuMath::Validity::_assert_fast_noise_3d_valid_register<Register_>(), "Invalid Register_ type argument provided to EmuMath::Functors::make_fast_noise_3d.");
+		using register_info = EmuMath::Functors::_underlying_noise_gen::_fast_noise_register_info<Register_>;
+		using int_register_type = typename register_info::int_register_type;
+		using gradient_table_type = EmuMath::Functors::_underlying_noise_gen::_fast_perlin_gradient_table<3, Register_>;
+		using simplex_info = EmuMath::Functors::_underlying_noise_gen::simplex_info<3, float>;
+
+		inline make_fast_noise_3d() :
+			gradients(),
+			skew(EmuSIMD::set1<Register_>(simplex_info::skew)),
+			unskew(EmuSIMD::set1<Register_>(simplex_info::unskew)),
+			radius_squared(EmuSIMD::set1<Register_>(simplex_info::radius_squared)),
+			scale(EmuSIMD::set1<Register_>(simplex_info::scale))
+		{
+		}
+
+		[[nodiscard]] inline Register_ operator()
 		(
-			const EmuMath::NoisePermutations& permutations_,
-			__m128 tx_0_,
-			__m128 ty_0_,
-			__m128 tz_0_,
-			__m128 tx_1_,
-			__m128 ty_1_,
-			__m128 tz_1_,
-			__m128& vals_000_,
-			__m128& vals_001_,
-			__m128& vals_010_,
-			__m128& vals_011_,
-			__m128& vals_100_,
-			__m128& vals_101_,
-			__m128& vals_110_,
-			__m128& vals_111_
+			Register_ points_x_,
+			Register_ points_y_,
+			Register_ points_z_,
+			Register_ freq_,
+			int_register_type permutations_mask_,
+			const EmuMath::FastNoisePermutations& permutations_
 		)
 		{
-			// Find our permutation values; all will be initialised in the upcoming loop
-			std::size_t perm_000_[4];
-			std::size_t perm_001_[4];
-			std::size_t perm_010_[4];
-			std::size_t perm_011_[4];
-			std::size_t perm_100_[4];
-			std::size_t perm_101_[4];
-			std::size_t perm_110_[4];
-			std::size_t perm_111_[4];
-			std::size_t perm_0_, perm_1_, perm_00_, perm_01_, perm_10_, perm_11_;
-			std::size_t mask_ = static_cast<std::size_t>(permutations_.HighestStoredValue());
-
-			// One permutation per value per item; since we're working with 4 outputs, this means we need to loop 4 times
+			Register_ offsets_[4][3];
+			int_register_type indices_[4][3];
+			_find_simplex(EmuSIMD::mul_all(points_x_, freq_), EmuSIMD::mul_all(points_y_, freq_), EmuSIMD::mul_all(points_z_, freq_), permutations_mask_, offsets_, indices_);
+
+			// Sum contributions of the 4 corners
+			const std::int32_t* p_permutations_ = permutations_.data();
+			Register_ result_ = _corner(indices_[0], offsets_[0], permutations_mask_, p_permutations_);
+			result_ = EmuSIMD::add(result_, _corner(indices_[1], offsets_[1], permutations_mask_, p_permutations_));
+			result_ = EmuSIMD::add(result_, _corner(indices_[2], offsets_[2], permutations_mask_, p_permutations_));
+			result_ = EmuSIMD::add(result_, _corner(indices_[3], offsets_[3], permutations_mask_, p_permutations_));
+			return EmuSIMD::mul_all(result_, scale);
+		}
+
+		/// <summary>
+		/// <para> Produces the same samples as this functor's operator(), along with their analytic partial derivatives with respect to each component of the passed points. </para>
+		/// <para> Derivatives are output via out_dx_, out_dy_, and out_dz_, and samples are returned. </para>
+		/// </summary>
+		[[nodiscard]] inline Register_ SampleWithDerivatives
+		(
+			Register_ points_x_,
+			Register_ points_y_,
+			Register_ points_z_,
+			Register_ freq_,
+			int_register_type permutations_mask_,
+			const EmuMath::FastNoisePermutations& permutations_,
+			Register_& out_dx_,
+			Register_& out_dy_,
+			Register_& out_dz_
+		)
+		{
+			Register_ offsets_[4][3];
+			int_register_type indices_[4][3];
+			_find_simplex(EmuSIMD::mul_all(points_x_, freq_), EmuSIMD::mul_all(points_y_, freq_), EmuSIMD::mul_all(points_z_, freq_), permutations_mask_, offsets_, indices_);
+
+			// Sum contributions and unscaled derivatives of the 4 corners
+			const std::int32_t* p_permutations_ = permutations_.data();
+			Register_ sum_[4] = { EmuSIMD::setzero<Register_>(), EmuSIMD::setzero<Register_>(), EmuSIMD::setzero<Register_>(), EmuSIMD::setzero<Register_>() };
 			for (std::size_t i = 0; i < 4; ++i)
 			{
-				perm_0_ = static_cast<std::size_t>(permutations_[ix_0[i]]);
-				perm_1_ = static_cast<std::size_t>(permutations_[ix_1[i]]);
-
-				perm_00_ = static_cast<std::size_t>(permutations_[(perm_0_ + iy_0[i]) & mask_]);
-				perm_01_ = static_cast<std::size_t>(permutations_[(perm_0_ + iy_1[i]) & mask_]);
-				perm_10_ = static_cast<std::size_t>(permutations_[(perm_1_ + iy_0[i]) & mask_]);
-				perm_11_ = static_cast<std::size_t>(permutations_[(perm_1_ + iy_1[i]) & mask_]);
-
-				perm_000_[i] = static_cast<std::size_t>(permutations_[(perm_00_ + iz_0[i]) & mask_]) & gradients::mask;
-				perm_001_[i] = static_cast<std::size_t>(permutations_[(perm_00_ + iz_1[i]) & mask_]) & gradients::mask;
-				perm_010_[i] = static_cast<std::size_t>(permutations_[(perm_01_ + iz_0[i]) & mask_]) & gradients::mask;
-				perm_011_[i] = static_cast<std::size_t>(permutations_[(perm_01_ + iz_1[i]) & mask_]) & gradients::mask;
-				perm_100_[i] = static_cast<std::size_t>(permutations_[(perm_10_ + iz_0[i]) & mask_]) & gradients::mask;
-				perm_101_[i] = static_cast<std::size_t>(permutations_[(perm_10_ + iz_1[i]) & mask_]) & gradients::mask;
-				perm_110_[i] = static_cast<std::size_t>(permutations_[(perm_11_ + iz_0[i]) & mask_]) & gradients::mask;
-				perm_111_[i] = static_cast<std::size_t>(permutations_[(perm_11_ + iz_1[i]) & mask_]) & gradients::mask;
+				_corner_with_derivatives(indices_[i], offsets_[i], permutations_mask_, p_permutations_, sum_);
 			}
 
-			// Use discovered permutations to form gradient dot products for our output values
-			// 000
-			__m128 gradient_0_ = _gradients_128[perm_000_[0]];
-			__m128 gradient_1_ = _gradients_128[perm_000_[1]];
-			__m128 gradient_2_ = _gradients_128[perm_000_[2]];
-			__m128 gradient_3_ = _gradients_128[perm_000_[3]];
-			
-			// X - Pre-store the Y components in the indices [1] and [3] from each temp shuffle
-			__m128 temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
-			__m128 temp_1_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_2_, gradient_3_);
-			__m128 row_ = EmuSIMD::shuffle<0, 2, 0, 2>(temp_0_, temp_1_);
-			vals_000_ = _mm_mul_ps(row_, tx_0_);
-			
-			// Y - Already prestored Y in previous two shuffles, so we can form row straight away
-			row_ = EmuSIMD::shuffle<1, 3, 1, 3>(temp_0_, temp_1_);
-			vals_000_ = _mm_add_ps(vals_000_, _mm_mul_ps(row_, ty_0_));
-			
-			// Z - One more batch of shuffles to extract the Z-coordinates of the gradients
-			// --- We can, however, take advantage of the duplicate Z in the W-element to use blends and a "shuffle" (optimised by templates)
-			temp_0_ = EmuSIMD::blend<0, 0, 0, 1>(gradient_0_, gradient_1_);
-			temp_1_ = EmuSIMD::blend<0, 0, 0, 1>(gradient_2_, gradient_3_);
-			row_ = EmuSIMD::shuffle<2, 3, 2, 3>(temp_0_, temp_1_);
-			vals_000_ = _mm_add_ps(vals_000_, _mm_mul_ps(row_, tz_0_));
-			
-			// ABOVE COMMENTS APPLY TO SUBSEQUENT OUTPUTS
-			// 001
-			gradient_0_ = _gradients_128[perm_001_[0]];
-			gradient_1_ = _gradients_128[perm_001_[1]];
-			gradient_2_ = _gradients_128[perm_001_[2]];
-			gradient_3_ = _gradients_128[perm_001_[3]];
-			
-			// X
-			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
-			temp_1_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_2_, gradient_3_);
-			row_ = EmuSIMD::shuffle<0, 2, 0, 2>(temp_0_, temp_1_);
-			vals_001_ = _mm_mul_ps(row_, tx_0_);
-			
-			// Y
-			row_ = EmuSIMD::shuffle<1, 3, 1, 3>(temp_0_, temp_1_);
-			vals_001_ = _mm_add_ps(vals_001_, _mm_mul_ps(row_, ty_0_));
-			
-			// Z
-			temp_0_ = EmuSIMD::blend<0, 0, 0, 1>(gradient_0_, gradient_1_);
-			temp_1_ = EmuSIMD::blend<0, 0, 0, 1>(gradient_2_, gradient_3_);
-			row_ = EmuSIMD::shuffle<2, 3, 2, 3>(temp_0_, temp_1_);
-			vals_001_ = _mm_add_ps(vals_001_, _mm_mul_ps(row_, tz_1_));
-			
-			// 010
-			gradient_0_ = _gradients_128[perm_010_[0]];
-			gradient_1_ = _gradients_128[perm_010_[1]];
-			gradient_2_ = _gradients_128[perm_010_[2]];
-			gradient_3_ = _gradients_128[perm_010_[3]];
-			
-			// X
-			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
-			temp_1_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_2_, gradient_3_);
-			row_ = EmuSIMD::shuffle<0, 2, 0, 2>(temp_0_, temp_1_);
-			vals_010_ = _mm_mul_ps(row_, tx_0_);
-			
-			// Y
-			row_ = EmuSIMD::shuffle<1, 3, 1, 3>(temp_0_, temp_1_);
-			vals_010_ = _mm_add_ps(vals_010_, _mm_mul_ps(row_, ty_1_));
-			
-			// Z
-			temp_0_ = EmuSIMD::blend<0, 0, 0, 1>(gradient_0_, gradient_1_);
-			temp_1_ = EmuSIMD::blend<0, 0, 0, 1>(gradient_2_, gradient_3_);
-			row_ = EmuSIMD::shuffle<2, 3, 2, 3>(temp_0_, temp_1_);
-			vals_010_ = _mm_add_ps(vals_010_, _mm_mul_ps(row_, tz_0_));
-			
-			// 011
-			gradient_0_ = _gradients_128[perm_011_[0]];
-			gradient_1_ = _gradients_128[perm_011_[1]];
-			gradient_2_ = _gradients_128[perm_011_[2]];
-			gradient_3_ = _gradients_128[perm_011_[3]];
-			
-			// X
-			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
-			temp_1_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_2_, gradient_3_);
-			row_ = EmuSIMD::shuffle<0, 2, 0, 2>(temp_0_, temp_1_);
-			vals_011_ = _mm_mul_ps(row_, tx_0_);
-			
-			// Y
-			row_ = EmuSIMD::shuffle<1, 3, 1, 3>(temp_0_, temp_1_);
-			vals_011_ = _mm_add_ps(vals_011_, _mm_mul_ps(row_, ty_1_));
-			
-			// Z
-			temp_0_ = EmuSIMD::blend<0, 0, 0, 1>(gradient_0_, gradient_1_);
-			temp_1_ = EmuSIMD::blend<0, 0, 0, 1>(gradient_2_, gradient_3_);
-			row_ = EmuSIMD::shuffle<2, 3, 2, 3>(temp_0_, temp_1_);
-			vals_011_ = _mm_add_ps(vals_011_, _mm_mul_ps(row_, tz_1_));
-			
-			// 100
-			gradient_0_ = _gradients_128[perm_100_[0]];
-			gradient_1_ = _gradients_128[perm_100_[1]];
-			gradient_2_ = _gradients_128[perm_100_[2]];
-			gradient_3_ = _gradients_128[perm_100_[3]];
-			
-			// X
-			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
-			temp_1_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_2_, gradient_3_);
-			row_ = EmuSIMD::shuffle<0, 2, 0, 2>(temp_0_, temp_1_);
-			vals_100_ = _mm_mul_ps(row_, tx_1_);
-			
-			// Y
-			row_ = EmuSIMD::shuffle<1, 3, 1, 3>(temp_0_, temp_1_);
-			vals_100_ = _mm_add_ps(vals_100_, _mm_mul_ps(row_, ty_0_));
-			
-			// Z
-			temp_0_ = EmuSIMD::blend<0, 0, 0, 1>(gradient_0_, gradient_1_);
-			temp_1_ = EmuSIMD::blend<0, 0, 0, 1>(gradient_2_, gradient_3_);
-			row_ = EmuSIMD::shuffle<2, 3, 2, 3>(temp_0_, temp_1_);
-			vals_100_ = _mm_add_ps(vals_100_, _mm_mul_ps(row_, tz_0_));
-			
-			// 101
-			gradient_0_ = _gradients_128[perm_101_[0]];
-			gradient_1_ = _gradients_128[perm_101_[1]];
-			gradient_2_ = _gradients_128[perm_101_[2]];
-			gradient_3_ = _gradients_128[perm_101_[3]];
-			
-			// X
-			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
-			temp_1_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_2_, gradient_3_);
-			row_ = EmuSIMD::shuffle<0, 2, 0, 2>(temp_0_, temp_1_);
-			vals_101_ = _mm_mul_ps(row_, tx_1_);
-			
-			// Y
-			row_ = EmuSIMD::shuffle<1, 3, 1, 3>(temp_0_, temp_1_);
-			vals_101_ = _mm_add_ps(vals_101_, _mm_mul_ps(row_, ty_0_));
-			
-			// Z
-			temp_0_ = EmuSIMD::blend<0, 0, 0, 1>(gradient_0_, gradient_1_);
-			temp_1_ = EmuSIMD::blend<0, 0, 0, 1>(gradient_2_, gradient_3_);
-			row_ = EmuSIMD::shuffle<2, 3, 2, 3>(temp_0_, temp_1_);
-			vals_101_ = _mm_add_ps(vals_101_, _mm_mul_ps(row_, tz_1_));
-			
-			// 110
-			gradient_0_ = _gradients_128[perm_110_[0]];
-			gradient_1_ = _gradients_128[perm_110_[1]];
-			gradient_2_ = _gradients_128[perm_110_[2]];
-			gradient_3_ = _gradients_128[perm_110_[3]];
-			
-			// X
-			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
-			temp_1_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_2_, gradient_3_);
-			row_ = EmuSIMD::shuffle<0, 2, 0, 2>(temp_0_, temp_1_);
-			vals_110_ = _mm_mul_ps(row_, tx_1_);
-			
-			// Y
-			row_ = EmuSIMD::shuffle<1, 3, 1, 3>(temp_0_, temp_1_);
-			vals_110_ = _mm_add_ps(vals_110_, _mm_mul_ps(row_, ty_1_));
-			
-			// Z
-			temp_0_ = EmuSIMD::blend<0, 0, 0, 1>(gradient_0_, gradient_1_);
-			temp_1_ = EmuSIMD::blend<0, 0, 0, 1>(gradient_2_, gradient_3_);
-			row_ = EmuSIMD::shuffle<2, 3, 2, 3>(temp_0_, temp_1_);
-			vals_110_ = _mm_add_ps(vals_110_, _mm_mul_ps(row_, tz_0_));
-			
-			// 111
-			gradient_0_ = _gradients_128[perm_111_[0]];
-			gradient_1_ = _gradients_128[perm_111_[1]];
-			gradient_2_ = _gradients_128[perm_111_[2]];
-			gradient_3_ = _gradients_128[perm_111_[3]];
-			
-			// X
-			temp_0_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_0_, gradient_1_);
-			temp_1_ = EmuSIMD::shuffle<0, 1, 0, 1>(gradient_2_, gradient_3_);
-			row_ = EmuSIMD::shuffle<0, 2, 0, 2>(temp_0_, temp_1_);
-			vals_111_ = _mm_mul_ps(row_, tx_1_);
-			
-			// Y
-			row_ = EmuSIMD::shuffle<1, 3, 1, 3>(temp_0_, temp_1_);
-			vals_111_ = _mm_add_ps(vals_111_, _mm_mul_ps(row_, ty_1_));
-			
-			// Z
-			temp_0_ = EmuSIMD::blend<0, 0, 0, 1>(gradient_0_, gradient_1_);
-			temp_1_ = EmuSIMD::blend<0, 0, 0, 1>(gradient_2_, gradient_3_);
-			row_ = EmuSIMD::shuffle<2, 3, 2, 3>(temp_0_, temp_1_);
-			vals_111_ = _mm_add_ps(vals_111_, _mm_mul_ps(row_, tz_1_));
+			Register_ derivative_scale_ = EmuSIMD::mul_all(scale, freq_);
+			out_dx_ = EmuSIMD::mul_all(sum_[1], derivative_scale_);
+			out_dy_ = EmuSIMD::mul_all(sum_[2], derivative_scale_);
+			out_dz_ = EmuSIMD::mul_all(sum_[3], derivative_scale_);
+			return EmuSIMD::mul_all(sum_[0], scale);
 		}
 
+		gradient_table_type gradients;
+		Register_ skew;
+		Register_ unskew;
+		Register_ radius_squared;
+		Register_ scale;
 
-		std::array<int, 4> ix_0;
-		std::array<int, 4> ix_1;
-		std::array<int, 4> iy_0;
-		std::array<int, 4> iy_1;
-		std::array<int, 4> iz_0;
-		std::array<int, 4> iz_1;
-		EmuMath::Functors::_underlying_noise_gen::_fast_smooth_t<__m128> smooth_t;
+	private:
+		/// <summary> Outputs the offsets of the passed (frequency-scaled) points from each of the 4 corners of their containing tetrahedrons, and the cell indices of each corner. </summary>
+		inline void _find_simplex
+		(
+			Register_ points_x_,
+			Register_ points_y_,
+			Register_ points_z_,
+			int_register_type permutations_mask_,
+			Register_ (&out_offsets_)[4][3],
+			int_register_type (&out_indices_)[4][3]
+		) const
+		{
+			// Skew to find the containing cell, then unskew its origin to find offsets from the first corner
+			Register_ temp_ = EmuSIMD::mul_all(EmuSIMD::add(EmuSIMD::add(points_x_, points_y_), points_z_), skew);
+			Register_ cell_x_ = EmuSIMD::floor(EmuSIMD::add(points_x_, temp_));
+			Register_ cell_y_ = EmuSIMD::floor(EmuSIMD::add(points_y_, temp_));
+			Register_ cell_z_ = EmuSIMD::floor(EmuSIMD::add(points_z_, temp_));
+			temp_ = EmuSIMD::mul_all(EmuSIMD::add(EmuSIMD::add(cell_x_, cell_y_), cell_z_), unskew);
+			Register_ x_0_ = EmuSIMD::sub(points_x_, EmuSIMD::sub(cell_x_, temp_));
+			Register_ y_0_ = EmuSIMD::sub(points_y_, EmuSIMD::sub(cell_y_, temp_));
+			Register_ z_0_ = EmuSIMD::sub(points_z_, EmuSIMD::sub(cell_z_, temp_));
+
+			// Rank offsets to find which tetrahedron of the cell contains each point; the second and third corners step along the largest offsets first
+			Register_ x_ge_y_ = EmuSIMD::cmpge(x_0_, y_0_);
+			Register_ y_ge_z_ = EmuSIMD::cmpge(y_0_, z_0_);
+			Register_ x_ge_z_ = EmuSIMD::cmpge(x_0_, z_0_);
+			Register_ x_1_mask_ = EmuSIMD::bitwise_and(x_ge_y_, x_ge_z_);
+			Register_ y_1_mask_ = EmuSIMD::bitwise_andnot(x_ge_y_, y_ge_z_);
+			Register_ z_1_mask_ = EmuSIMD::bitwise_not(EmuSIMD::bitwise_or(x_ge_z_, y_ge_z_));
+			Register_ x_2_mask_ = EmuSIMD::bitwise_or(x_ge_y_, x_ge_z_);
+			Register_ y_2_mask_ = EmuSIMD::bitwise_not(EmuSIMD::bitwise_andnot(y_ge_z_, x_ge_y_));
+			Register_ z_2_mask_ = EmuSIMD::bitwise_not(EmuSIMD::bitwise_and(x_ge_z_, y_ge_z_));
+
+			// Offsets from all corners
+			Register_ one_ = EmuSIMD::set1<Register_>(1.0f);
+			out_offsets_[0][0] = x_0_;
+			out_offsets_[0][1] = y_0_;
+			out_offsets_[0][2] = z_0_;
+			out_offsets_[1][0] = EmuSIMD::add(EmuSIMD::sub(x_0_, EmuSIMD::bitwise_and(x_1_mask_, one_)), unskew);
+			out_offsets_[1][1] = EmuSIMD::add(EmuSIMD::sub(y_0_, EmuSIMD::bitwise_and(y_1_mask_, one_)), unskew);
+			out_offsets_[1][2] = EmuSIMD::add(EmuSIMD::sub(z_0_, EmuSIMD::bitwise_and(z_1_mask_, one_)), unskew);
+			temp_ = EmuSIMD::add(unskew, unskew);
+			out_offsets_[2][0] = EmuSIMD::add(EmuSIMD::sub(x_0_, EmuSIMD::bitwise_and(x_2_mask_, one_)), temp_);
+			out_offsets_[2][1] = EmuSIMD::add(EmuSIMD::sub(y_0_, EmuSIMD::bitwise_and(y_2_mask_, one_)), temp_);
+			out_offsets_[2][2] = EmuSIMD::add(EmuSIMD::sub(z_0_, EmuSIMD::bitwise_and(z_2_mask_, one_)), temp_);
+			temp_ = EmuSIMD::fmsub(unskew, EmuSIMD::set1<Register_>(3.0f), one_);
+			out_offsets_[3][0] = EmuSIMD::add(x_0_, temp_);
+			out_offsets_[3][1] = EmuSIMD::add(y_0_, temp_);
+			out_offsets_[3][2] = EmuSIMD::add(z_0_, temp_);
+
+			// Indices of all corners
+			int_register_type one_int_ = EmuSIMD::set1<int_register_type, 32>(1);
+			int_register_type ix_0_ = EmuSIMD::bitwise_and(EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(cell_x_), permutations_mask_);
+			int_register_type iy_0_ = EmuSIMD::bitwise_and(EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(cell_y_), permutations_mask_);
+			int_register_type iz_0_ = EmuSIMD::bitwise_and(EmuMath::Functors::_underlying_noise_gen::_fast_cvt_to_int(cell_z_), permutations_mask_);
+			out_indices_[0][0] = ix_0_;
+			out_indices_[0][1] = iy_0_;
+			out_indices_[0][2] = iz_0_;
+			out_indices_[1][0] = EmuSIMD::add<32>(ix_0_, EmuSIMD::bitwise_and(EmuSIMD::cast<int_register_type>(x_1_mask_), one_int_));
+			out_indices_[1][1] = EmuSIMD::add<32>(iy_0_, EmuSIMD::bitwise_and(EmuSIMD::cast<int_register_type>(y_1_mask_), one_int_));
+			out_indices_[1][2] = EmuSIMD::add<32>(iz_0_, EmuSIMD::bitwise_and(EmuSIMD::cast<int_register_type>(z_1_mask_), one_int_));
+			out_indices_[2][0] = EmuSIMD::add<32>(ix_0_, EmuSIMD::bitwise_and(EmuSIMD::cast<int_register_type>(x_2_mask_), one_int_));
+			out_indices_[2][1] = EmuSIMD::add<32>(iy_0_, EmuSIMD::bitwise_and(EmuSIMD::cast<int_register_type>(y_2_mask_), one_int_));
+			out_indices_[2][2] = EmuSIMD::add<32>(iz_0_, EmuSIMD::bitwise_and(EmuSIMD::cast<int_register_type>(z_2_mask_), one_int_));
+			out_indices_[3][0] = EmuSIMD::add<32>(ix_0_, one_int_);
+			out_indices_[3][1] = EmuSIMD::add<32>(iy_0_, one_int_);
+			out_indices_[3][2] = EmuSIMD::add<32>(iz_0_, one_int_);
+		}
+
+		[[nodiscard]] static inline int_register_type _hash_corner
+		(
+			const int_register_type (&indices_)[3],
+			int_register_type permutations_mask_,
+			const std::int32_t* p_permutations_
+		)
+		{
+			int_register_type perms_ = EmuMath::Functors::_underlying_noise_gen::_fast_gather_int32(p_permutations_, EmuSIMD::bitwise_and(indices_[0], permutations_mask_));
+			perms_ = EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perms_, indices_[1], permutations_mask_);
+			return EmuMath::Functors::_underlying_noise_gen::_fast_permute(p_permutations_, perms_, indices_[2], permutations_mask_);
+		}
+
+		[[nodiscard]] inline Register_ _corner
+		(
+			const int_register_type (&indices_)[3],
+			const Register_ (&offsets_)[3],
+			int_register_type permutations_mask_,
+			const std::int32_t* p_permutations_
+		) const
+		{
+			Register_ distance_squared_ = EmuSIMD::fmadd(offsets_[0], offsets_[0], EmuSIMD::fmadd(offsets_[1], offsets_[1], EmuSIMD::mul_all(offsets_[2], offsets_[2])));
+			Register_ falloff_ = EmuMath::Functors::_underlying_noise_gen::_fast_simplex_falloff(radius_squared, distance_squared_);
+			return EmuSIMD::mul_all(falloff_, gradients.dot(_hash_corner(indices_, permutations_mask_, p_permutations_), offsets_[0], offsets_[1], offsets_[2]));
+		}
+
+		/// <summary>
+		/// <para> Adds a corner's contributions and their unscaled partial derivatives to the respective registers of out_sum_, in the order (value, d/dx, d/dy, d/dz). </para>
+		/// <para> With t = max(0, radius_squared - |r|^2), the contribution is t^4 (g.r), and its derivative is t^4 g - 8 t^3 (g.r) r. </para>
+		/// </summary>
+		inline void _corner_with_derivatives
+		(
+			const int_register_type (&indices_)[3],
+			const Register_ (&offsets_)[3],
+			int_register_type permutations_mask_,
+			const std::int32_t* p_permutations_,
+			Register_ (&out_sum_)[4]
+		) const
+		{
+			Register_ distance_squared_ = EmuSIMD::fmadd(offsets_[0], offsets_[0], EmuSIMD::fmadd(offsets_[1], offsets_[1], EmuSIMD::mul_all(offsets_[2], offsets_[2])));
+			Register_ t_ = EmuSIMD::clamp_min(EmuSIMD::sub(radius_squared, distance_squared_), EmuSIMD::setzero<Register_>());
+			Register_ t_squared_ = EmuSIMD::mul_all(t_, t_);
+			Register_ falloff_ = EmuSIMD::mul_all(t_squared_, t_squared_);
+
+			Register_ components_[3];
+			Register_ dot_ = gradients.gather_and_dot(_hash_corner(indices_, permutations_mask_, p_permutations_), components_, offsets_[0], offsets_[1], offsets_[2]);
+			Register_ radial_scale_ = EmuSIMD::mul_all(EmuSIMD::mul_all(EmuSIMD::mul_all(t_squared_, t_), dot_), EmuSIMD::set1<Register_>(-8.0f));
+
+			out_sum_[0] = EmuSIMD::fmadd(falloff_, dot_, out_sum_[0]);
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				out_sum_[i + 1] = EmuSIMD::fmadd(falloff_, components_[i], EmuSIMD::fmadd(radial_scale_, offsets_[i], out_sum_[i + 1]));
+			}
+		}
 	};
 }
 
@@ -14,7 +14,9 @@ namespace EmuMath
 		// Value noise with no smoothing
 		VALUE = 0x02,
 		// Value noise with smoothing applied
-		VALUE_SMOOTH = 0x04
+		VALUE_SMOOTH = 0x04,
+		// Simplex noise, summing the contributions of Dimensions + 1 corners per sample (e.g. 4 corners in 3D, compared to Perlin's 8)
+		SIMPLEX = 0x08
 	};
 
 	namespace Validity
@@ -25,7 +27,8 @@ namespace EmuMath
 			(
 				noise_type_ == NoiseType::PERLIN ||
 				noise_type_ == NoiseType::VALUE ||
-				noise_type_ == NoiseType::VALUE_SMOOTH
+				noise_type_ == NoiseType::VALUE_SMOOTH ||
+				noise_type_ == NoiseType::SIMPLEX
 			);
 		}
 
@@ -0,0 +1,112 @@
+#ifndef EMU_MATH_QUATERNION_SOA_HELPERS_H_INC_
+#define EMU_MATH_QUATERNION_SOA_HELPERS_H_INC_ 1
+
+#include "_quaternion_soa_underlying.h"
+
+// CONTAINS (QuaternionSoA overloads only):
+// --- multiply
+// --- conjugate
+// --- nlerp
+// --- slerp
+// --- rotate_vector
+//
+// QuaternionSoA is a VectorSoA of 4 components, so normalisation, dot products, and conversion to and from contiguous Vectors use the VectorSoA helpers and members.
+// Outputs are resized to the lowest count of all SoA inputs.
+
+namespace EmuMath::Helpers
+{
+#pragma region ARITHMETIC_FUNCS
+	/// <summary> Outputs the Hamilton product of respective Quaternions in a_ and b_ to the provided out_soa_. out_soa_ may be the same object as an input. </summary>
+	/// <param name="out_soa_">: EmuMath QuaternionSoA to output to.</param>
+	/// <param name="a_">: EmuMath QuaternionSoA appearing on the left-hand side of multiplication.</param>
+	/// <param name="b_">: EmuMath QuaternionSoA appearing on the right-hand side of multiplication.</param>
+	template<typename T_>
+	inline void quaternion_multiply(EmuMath::QuaternionSoA<T_>& out_soa_, const EmuMath::QuaternionSoA<T_>& a_, const EmuMath::QuaternionSoA<T_>& b_)
+	{
+		_quaternion_underlying::_quaternion_soa_multiply(out_soa_, a_, b_);
+	}
+	template<typename T_>
+	[[nodiscard]] inline EmuMath::QuaternionSoA<T_> quaternion_multiply(const EmuMath::QuaternionSoA<T_>& a_, const EmuMath::QuaternionSoA<T_>& b_)
+	{
+		EmuMath::QuaternionSoA<T_> out_;
+		quaternion_multiply(out_, a_, b_);
+		return out_;
+	}
+
+	/// <summary> Outputs the conjugate of every Quaternion in in_ to the provided out_soa_. out_soa_ may be the same object as in_. </summary>
+	template<typename T_>
+	inline void quaternion_conjugate(EmuMath::QuaternionSoA<T_>& out_soa_, const EmuMath::QuaternionSoA<T_>& in_)
+	{
+		_quaternion_underlying::_quaternion_soa_conjugate(out_soa_, in_);
+	}
+	template<typename T_>
+	[[nodiscard]] inline EmuMath::QuaternionSoA<T_> quaternion_conjugate(const EmuMath::QuaternionSoA<T_>& in_)
+	{
+		EmuMath::QuaternionSoA<T_> out_;
+		quaternion_conjugate(out_, in_);
+		return out_;
+	}
+#pragma endregion
+
+#pragma region INTERPOLATION_FUNCS
+	/// <summary> Outputs the normalised linear interpolation of respective Quaternions in a_ and b_ by t_ to the provided out_soa_, taking the shortest path. </summary>
+	/// <param name="out_soa_">: EmuMath QuaternionSoA to output to. This may be the same object as an input.</param>
+	/// <param name="a_">: EmuMath QuaternionSoA to interpolate from.</param>
+	/// <param name="b_">: EmuMath QuaternionSoA to interpolate to.</param>
+	/// <param name="t_">: Scalar weighting used for all elements, or a VectorSoA of 1 component providing a weighting for respective elements.</param>
+	template<typename T_, class Weighting_>
+	inline void quaternion_nlerp(EmuMath::QuaternionSoA<T_>& out_soa_, const EmuMath::QuaternionSoA<T_>& a_, const EmuMath::QuaternionSoA<T_>& b_, const Weighting_& t_)
+	{
+		_quaternion_underlying::_quaternion_soa_interpolate<false>(out_soa_, a_, b_, t_);
+	}
+	template<typename T_, class Weighting_>
+	[[nodiscard]] inline EmuMath::QuaternionSoA<T_> quaternion_nlerp(const EmuMath::QuaternionSoA<T_>& a_, const EmuMath::QuaternionSoA<T_>& b_, const Weighting_& t_)
+	{
+		EmuMath::QuaternionSoA<T_> out_;
+		quaternion_nlerp(out_, a_, b_, t_);
+		return out_;
+	}
+
+	/// <summary>
+	/// <para> Outputs the spherical linear interpolation of respective unit Quaternions in a_ and b_ by t_ to the provided out_soa_, taking the shortest path. </para>
+	/// <para> Nearly-parallel Quaternions are interpolated via nlerp to avoid instability. </para>
+	/// </summary>
+	/// <param name="out_soa_">: EmuMath QuaternionSoA to output to. This may be the same object as an input.</param>
+	/// <param name="a_">: EmuMath QuaternionSoA to interpolate from.</param>
+	/// <param name="b_">: EmuMath QuaternionSoA to interpolate to.</param>
+	/// <param name="t_">: Scalar weighting used for all elements, or a VectorSoA of 1 component providing a weighting for respective elements.</param>
+	template<typename T_, class Weighting_>
+	inline void quaternion_slerp(EmuMath::QuaternionSoA<T_>& out_soa_, const EmuMath::QuaternionSoA<T_>& a_, const EmuMath::QuaternionSoA<T_>& b_, const Weighting_& t_)
+	{
+		_quaternion_underlying::_quaternion_soa_interpolate<true>(out_soa_, a_, b_, t_);
+	}
+	template<typename T_, class Weighting_>
+	[[nodiscard]] inline EmuMath::QuaternionSoA<T_> quaternion_slerp(const EmuMath::QuaternionSoA<T_>& a_, const EmuMath::QuaternionSoA<T_>& b_, const Weighting_& t_)
+	{
+		EmuMath::QuaternionSoA<T_> out_;
+		quaternion_slerp(out_, a_, b_, t_);
+		return out_;
+	}
+#pragma endregion
+
+#pragma region ROTATION_FUNCS
+	/// <summary> Outputs respective 3D Vectors in vectors_ rotated by respective unit Quaternions in quaternions_ to the provided out_soa_. </summary>
+	/// <param name="out_soa_">: EmuMath VectorSoA to output to. This may be the same object as vectors_.</param>
+	/// <param name="quaternions_">: EmuMath QuaternionSoA of normalised Quaternions to rotate by.</param>
+	/// <param name="vectors_">: EmuMath VectorSoA of 3D Vectors to rotate.</param>
+	template<typename T_>
+	inline void quaternion_rotate_vector(EmuMath::VectorSoA<3, T_>& out_soa_, const EmuMath::QuaternionSoA<T_>& quaternions_, const EmuMath::VectorSoA<3, T_>& vectors_)
+	{
+		_quaternion_underlying::_quaternion_soa_rotate_vector(out_soa_, quaternions_, vectors_);
+	}
+	template<typename T_>
+	[[nodiscard]] inline EmuMath::VectorSoA<3, T_> quaternion_rotate_vector(const EmuMath::QuaternionSoA<T_>& quaternions_, const EmuMath::VectorSoA<3, T_>& vectors_)
+	{
+		EmuMath::VectorSoA<3, T_> out_;
+		quaternion_rotate_vector(out_, quaternions_, vectors_);
+		return out_;
+	}
+#pragma endregion
+}
+
+#endif
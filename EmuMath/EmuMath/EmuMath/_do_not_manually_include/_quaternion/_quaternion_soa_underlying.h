@@ -0,0 +1,184 @@
+#ifndef EMU_MATH_QUATERNION_SOA_UNDERLYING_H_INC_
+#define EMU_MATH_QUATERNION_SOA_UNDERLYING_H_INC_ 1
+
+#include "_quaternion_underlying.h"
+#include "../_vector_soa/_vector_soa_underlying.h"
+#include <algorithm>
+#include <cstddef>
+
+namespace EmuMath
+{
+	/// <summary>
+	/// <para> Structure-of-arrays container of Quaternions, storing lanes in the order (x, y, z, w) to match EmuMath::Quaternion. </para>
+	/// <para> This is a VectorSoA of 4 components, so all VectorSoA helpers (such as `vector_normalise` or `vector_dot`) may also be used with it. </para>
+	/// </summary>
+	template<typename T_>
+	using QuaternionSoA = EmuMath::VectorSoA<4, T_>;
+}
+
+namespace EmuMath::Helpers::_quaternion_underlying
+{
+	template<typename T_>
+	using _quaternion_soa_operand = EmuMath::Helpers::_vector_soa_underlying::_soa_lanes_operand<typename EmuMath::QuaternionSoA<T_>::register_type, 4, T_>;
+
+	/// <summary> Outputs the Hamilton product of respective Quaternions in a_ and b_ to out_. out_ may be the same object as either input. </summary>
+	template<typename T_>
+	inline void _quaternion_soa_multiply(EmuMath::QuaternionSoA<T_>& out_, const EmuMath::QuaternionSoA<T_>& a_, const EmuMath::QuaternionSoA<T_>& b_)
+	{
+		using soa_type = EmuMath::QuaternionSoA<T_>;
+		using register_type = typename soa_type::register_type;
+		const std::size_t count_ = (std::min)(a_.Count(), b_.Count());
+		out_.Resize(count_);
+
+		const _quaternion_soa_operand<T_> a_operand_(a_);
+		const _quaternion_soa_operand<T_> b_operand_(b_);
+		auto kernel_ = [&](std::size_t i_)
+		{
+			const register_type ax_ = a_operand_.Get(0, i_), ay_ = a_operand_.Get(1, i_), az_ = a_operand_.Get(2, i_), aw_ = a_operand_.Get(3, i_);
+			const register_type bx_ = b_operand_.Get(0, i_), by_ = b_operand_.Get(1, i_), bz_ = b_operand_.Get(2, i_), bw_ = b_operand_.Get(3, i_);
+
+			// All inputs are read before any output is written, so out_ may be either input
+			EmuSIMD::store(EmuSIMD::fmsub(ay_, bz_, EmuSIMD::fmsub(az_, by_, EmuSIMD::fmadd(ax_, bw_, EmuSIMD::mul_all(aw_, bx_)))), out_.Lane(0) + i_);
+			EmuSIMD::store(EmuSIMD::fmadd(az_, bx_, EmuSIMD::fmsub(ay_, bw_, EmuSIMD::fmsub(ax_, bz_, EmuSIMD::mul_all(aw_, by_)))), out_.Lane(1) + i_);
+			EmuSIMD::store(EmuSIMD::fmadd(az_, bw_, EmuSIMD::fmsub(ax_, by_, EmuSIMD::fmsub(ay_, bx_, EmuSIMD::mul_all(aw_, bz_)))), out_.Lane(2) + i_);
+			EmuSIMD::store(EmuSIMD::fmsub(aw_, bw_, EmuSIMD::fmadd(az_, bz_, EmuSIMD::fmadd(ay_, by_, EmuSIMD::mul_all(ax_, bx_)))), out_.Lane(3) + i_);
+		};
+		EmuMath::Helpers::_vector_soa_underlying::_soa_for_each_register<soa_type>(count_, kernel_);
+	}
+
+	template<typename T_>
+	inline void _quaternion_soa_conjugate(EmuMath::QuaternionSoA<T_>& out_, const EmuMath::QuaternionSoA<T_>& in_)
+	{
+		using soa_type = EmuMath::QuaternionSoA<T_>;
+		const std::size_t count_ = in_.Count();
+		out_.Resize(count_);
+
+		const _quaternion_soa_operand<T_> in_operand_(in_);
+		auto kernel_ = [&](std::size_t i_)
+		{
+			EmuSIMD::store(EmuSIMD::negate(in_operand_.Get(0, i_)), out_.Lane(0) + i_);
+			EmuSIMD::store(EmuSIMD::negate(in_operand_.Get(1, i_)), out_.Lane(1) + i_);
+			EmuSIMD::store(EmuSIMD::negate(in_operand_.Get(2, i_)), out_.Lane(2) + i_);
+			EmuSIMD::store(in_operand_.Get(3, i_), out_.Lane(3) + i_);
+		};
+		EmuMath::Helpers::_vector_soa_underlying::_soa_for_each_register<soa_type>(count_, kernel_);
+	}
+
+	/// <summary>
+	/// <para> Outputs the interpolation between respective Quaternions in a_ and b_ by t_ to out_, taking the shortest path. out_ may be the same object as either input. </para>
+	/// <para> If Slerp_ is false, this is a normalised linear interpolation. </para>
+	/// <para>
+	///		If Slerp_ is true, this is a spherical linear interpolation: dot products and blend weights are calculated in SIMD registers,
+	///		while the trigonometric weights of each element are calculated as scalars. Nearly-parallel elements fall back to nlerp weights.
+	/// </para>
+	/// <para> t_ may be a scalar used for all elements, or a VectorSoA of 1 component providing a weighting for each element. </para>
+	/// </summary>
+	template<bool Slerp_, typename T_, class Weighting_>
+	inline void _quaternion_soa_interpolate(EmuMath::QuaternionSoA<T_>& out_, const EmuMath::QuaternionSoA<T_>& a_, const EmuMath::QuaternionSoA<T_>& b_, const Weighting_& t_)
+	{
+		using soa_type = EmuMath::QuaternionSoA<T_>;
+		using register_type = typename soa_type::register_type;
+		constexpr std::size_t step_ = soa_type::elements_per_register;
+		const std::size_t count_ = (std::min)((std::min)(a_.Count(), b_.Count()), EmuMath::Helpers::_vector_soa_underlying::_soa_operand_count(t_));
+		out_.Resize(count_);
+
+		const _quaternion_soa_operand<T_> a_operand_(a_);
+		const _quaternion_soa_operand<T_> b_operand_(b_);
+		const auto t_operand_ = EmuMath::Helpers::_vector_soa_underlying::_make_soa_operand<EmuMath::VectorSoA<1, T_>>(t_);
+		const register_type sign_mask_ = EmuSIMD::set1<register_type>(T_(-0.0));
+		auto kernel_ = [&](std::size_t i_)
+		{
+			const register_type dot_ = EmuMath::Helpers::_vector_soa_underlying::_soa_dot_register<4, T_>(a_operand_, b_operand_, i_);
+			const register_type t_register_ = t_operand_.Get(0, i_);
+			register_type weight_a_;
+			register_type weight_b_;
+			if constexpr (Slerp_)
+			{
+				alignas(register_type) T_ dots_[step_];
+				alignas(register_type) T_ ts_[step_];
+				alignas(register_type) T_ weights_a_[step_];
+				alignas(register_type) T_ weights_b_[step_];
+				EmuSIMD::store(dot_, dots_);
+				EmuSIMD::store(t_register_, ts_);
+				for (std::size_t j_ = 0; j_ < step_; ++j_)
+				{
+					const T_ cos_theta_ = dots_[j_] < T_(0) ? -dots_[j_] : dots_[j_];
+					if (cos_theta_ > _slerp_nlerp_threshold<T_>)
+					{
+						weights_a_[j_] = T_(1) - ts_[j_];
+						weights_b_[j_] = ts_[j_];
+					}
+					else
+					{
+						const T_ theta_ = static_cast<T_>(EmuCore::do_acos<T_>()(cos_theta_));
+						const T_ reciprocal_sin_theta_ = T_(1) / static_cast<T_>(EmuCore::do_sqrt<T_>()(T_(1) - (cos_theta_ * cos_theta_)));
+						weights_a_[j_] = static_cast<T_>(EmuCore::do_sin<T_>()((T_(1) - ts_[j_]) * theta_)) * reciprocal_sin_theta_;
+						weights_b_[j_] = static_cast<T_>(EmuCore::do_sin<T_>()(ts_[j_] * theta_)) * reciprocal_sin_theta_;
+					}
+				}
+				weight_a_ = EmuSIMD::load<register_type>(weights_a_);
+				weight_b_ = EmuSIMD::load<register_type>(weights_b_);
+			}
+			else
+			{
+				weight_a_ = EmuSIMD::sub(EmuSIMD::set1<register_type>(T_(1)), t_register_);
+				weight_b_ = t_register_;
+			}
+
+			// Take the shortest path by flipping the sign of b's weighting where the dot product is negative
+			weight_b_ = EmuSIMD::bitwise_xor(weight_b_, EmuSIMD::bitwise_and(dot_, sign_mask_));
+
+			register_type out_x_ = EmuSIMD::fmadd(weight_b_, b_operand_.Get(0, i_), EmuSIMD::mul_all(weight_a_, a_operand_.Get(0, i_)));
+			register_type out_y_ = EmuSIMD::fmadd(weight_b_, b_operand_.Get(1, i_), EmuSIMD::mul_all(weight_a_, a_operand_.Get(1, i_)));
+			register_type out_z_ = EmuSIMD::fmadd(weight_b_, b_operand_.Get(2, i_), EmuSIMD::mul_all(weight_a_, a_operand_.Get(2, i_)));
+			register_type out_w_ = EmuSIMD::fmadd(weight_b_, b_operand_.Get(3, i_), EmuSIMD::mul_all(weight_a_, a_operand_.Get(3, i_)));
+
+			// Always normalised, as this is required for nlerp and for slerp elements which fell back to nlerp weights
+			register_type magnitude_ = EmuSIMD::fmadd(out_x_, out_x_, EmuSIMD::mul_all(out_y_, out_y_));
+			magnitude_ = EmuSIMD::fmadd(out_z_, out_z_, magnitude_);
+			magnitude_ = EmuSIMD::sqrt(EmuSIMD::fmadd(out_w_, out_w_, magnitude_));
+			EmuSIMD::store(EmuSIMD::div(out_x_, magnitude_), out_.Lane(0) + i_);
+			EmuSIMD::store(EmuSIMD::div(out_y_, magnitude_), out_.Lane(1) + i_);
+			EmuSIMD::store(EmuSIMD::div(out_z_, magnitude_), out_.Lane(2) + i_);
+			EmuSIMD::store(EmuSIMD::div(out_w_, magnitude_), out_.Lane(3) + i_);
+		};
+		EmuMath::Helpers::_vector_soa_underlying::_soa_for_each_register<soa_type>(count_, kernel_);
+	}
+
+	/// <summary> Outputs respective Vectors in vectors_ rotated by respective unit Quaternions in quaternions_ to out_. out_ may be the same object as vectors_. </summary>
+	template<typename T_>
+	inline void _quaternion_soa_rotate_vector(EmuMath::VectorSoA<3, T_>& out_, const EmuMath::QuaternionSoA<T_>& quaternions_, const EmuMath::VectorSoA<3, T_>& vectors_)
+	{
+		using soa_type = EmuMath::QuaternionSoA<T_>;
+		using register_type = typename soa_type::register_type;
+		const std::size_t count_ = (std::min)(quaternions_.Count(), vectors_.Count());
+		out_.Resize(count_);
+
+		const _quaternion_soa_operand<T_> q_operand_(quaternions_);
+		const EmuMath::Helpers::_vector_soa_underlying::_soa_lanes_operand<register_type, 3, T_> v_operand_(vectors_);
+		auto kernel_ = [&](std::size_t i_)
+		{
+			const register_type qx_ = q_operand_.Get(0, i_), qy_ = q_operand_.Get(1, i_), qz_ = q_operand_.Get(2, i_), qw_ = q_operand_.Get(3, i_);
+			const register_type vx_ = v_operand_.Get(0, i_), vy_ = v_operand_.Get(1, i_), vz_ = v_operand_.Get(2, i_);
+
+			// t = 2 * cross(q.xyz, v)
+			register_type tx_ = EmuSIMD::fmsub(qy_, vz_, EmuSIMD::mul_all(qz_, vy_));
+			register_type ty_ = EmuSIMD::fmsub(qz_, vx_, EmuSIMD::mul_all(qx_, vz_));
+			register_type tz_ = EmuSIMD::fmsub(qx_, vy_, EmuSIMD::mul_all(qy_, vx_));
+			tx_ = EmuSIMD::add(tx_, tx_);
+			ty_ = EmuSIMD::add(ty_, ty_);
+			tz_ = EmuSIMD::add(tz_, tz_);
+
+			// v' = v + (w * t) + cross(q.xyz, t)
+			const register_type cx_ = EmuSIMD::fmsub(qy_, tz_, EmuSIMD::mul_all(qz_, ty_));
+			const register_type cy_ = EmuSIMD::fmsub(qz_, tx_, EmuSIMD::mul_all(qx_, tz_));
+			const register_type cz_ = EmuSIMD::fmsub(qx_, ty_, EmuSIMD::mul_all(qy_, tx_));
+			EmuSIMD::store(EmuSIMD::fmadd(qw_, tx_, EmuSIMD::add(vx_, cx_)), out_.Lane(0) + i_);
+			EmuSIMD::store(EmuSIMD::fmadd(qw_, ty_, EmuSIMD::add(vy_, cy_)), out_.Lane(1) + i_);
+			EmuSIMD::store(EmuSIMD::fmadd(qw_, tz_, EmuSIMD::add(vz_, cz_)), out_.Lane(2) + i_);
+		};
+		EmuMath::Helpers::_vector_soa_underlying::_soa_for_each_register<soa_type>(count_, kernel_);
+	}
+}
+
+#endif
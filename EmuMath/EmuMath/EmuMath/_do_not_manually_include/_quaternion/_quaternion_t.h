@@ -0,0 +1,279 @@
+#ifndef EMU_MATH_QUATERNION_T_H_INC_
+#define EMU_MATH_QUATERNION_T_H_INC_ 1
+
+#include "_quaternion_underlying.h"
+#include <type_traits>
+
+namespace EmuMath
+{
+	/// <summary>
+	/// <para> Quaternion representing a 3D rotation, stored as a 4-element EmuMath Vector in the order (x, y, z, w), where w is the real part. </para>
+	/// <para> Storage is aligned to the size of all 4 components, allowing float Quaternions to be loaded as a single 128-bit register for multiplication and interpolation. </para>
+	/// <para> Operations which interpret this Quaternion as a rotation (such as `RotateVector`, `Slerp`, and `ToMatrix`) expect it to be normalised. </para>
+	/// <para> Only float and double T_ arguments are valid. </para>
+	/// </summary>
+	/// <typeparam name="T_">Floating-point type of each component.</typeparam>
+	template<typename T_>
+	class alignas(4 * sizeof(T_)) Quaternion
+	{
+#pragma region COMMON_STATIC_INFO
+	public:
+		using this_type = Quaternion<T_>;
+		using value_type = T_;
+		using vector_type = EmuMath::Vector<4, T_>;
+		using vector3_type = EmuMath::Vector<3, T_>;
+
+		[[nodiscard]] static constexpr inline bool is_valid()
+		{
+			return std::is_same_v<value_type, float> || std::is_same_v<value_type, double>;
+		}
+
+		static_assert
+		(
+			is_valid(),
+			"Invalid EmuMath::Quaternion instantiation: T_ must be float or double."
+		);
+#pragma endregion
+
+#pragma region CONSTRUCTORS
+	public:
+		/// <summary> Constructs an identity Quaternion, representing no rotation. </summary>
+		constexpr inline Quaternion() : _data(T_(0), T_(0), T_(0), T_(1))
+		{
+		}
+
+		constexpr inline Quaternion(const this_type&) = default;
+		constexpr inline Quaternion(this_type&&) = default;
+
+		/// <summary> Constructs a Quaternion with the provided components, where (x_, y_, z_) are the imaginary part and w_ is the real part. </summary>
+		constexpr inline Quaternion(const T_& x_, const T_& y_, const T_& z_, const T_& w_) : _data(x_, y_, z_, w_)
+		{
+		}
+
+		/// <summary> Constructs a Quaternion from the passed Vector, interpreted in the order (x, y, z, w). </summary>
+		constexpr explicit inline Quaternion(const vector_type& xyzw_) : _data(xyzw_)
+		{
+		}
+#pragma endregion
+
+#pragma region STATIC_BUILDERS
+	public:
+		[[nodiscard]] static constexpr inline this_type Identity()
+		{
+			return this_type();
+		}
+
+		/// <summary> Creates a Quaternion rotating by angle_rads_ radians about the passed axis_, which is expected to be normalised. </summary>
+		/// <param name="axis_">: Unit-length axis to rotate about. Only its first 3 elements are used.</param>
+		/// <param name="angle_rads_">: Angle to rotate by, in radians.</param>
+		template<std::size_t AxisSize_, typename AxisT_>
+		[[nodiscard]] static inline this_type FromAxisAngle(const EmuMath::Vector<AxisSize_, AxisT_>& axis_, const T_& angle_rads_)
+		{
+			this_type out_;
+			EmuMath::Helpers::_quaternion_underlying::_quaternion_from_axis_angle(axis_, angle_rads_, out_.data());
+			return out_;
+		}
+
+		/// <summary>
+		/// <para> Creates a Quaternion rotating about the X-axis, then the Y-axis, then the Z-axis by the respective angles in radians. </para>
+		/// <para> This uses the same convention as `matrix_make_rotation_euler`, such that `FromEuler(x, y, z).ToMatrix()` is equivalent to that rotation Matrix. </para>
+		/// </summary>
+		[[nodiscard]] static inline this_type FromEuler(const T_& x_rads_, const T_& y_rads_, const T_& z_rads_)
+		{
+			this_type out_;
+			EmuMath::Helpers::_quaternion_underlying::_quaternion_from_euler(x_rads_, y_rads_, z_rads_, out_.data());
+			return out_;
+		}
+
+		/// <summary> Creates a Quaternion equivalent to the rotation stored in the upper-left 3x3 of the passed Matrix, which is expected to contain no scale or shear. </summary>
+		template<std::size_t NumColumns_, std::size_t NumRows_, typename MatT_, bool ColumnMajor_>
+		[[nodiscard]] static inline this_type FromMatrix(const EmuMath::Matrix<NumColumns_, NumRows_, MatT_, ColumnMajor_>& matrix_)
+		{
+			static_assert
+			(
+				NumColumns_ >= 3 && NumRows_ >= 3,
+				"Attempted to create an EmuMath Quaternion from a Matrix with fewer than 3 columns or rows."
+			);
+			this_type out_;
+			EmuMath::Helpers::_quaternion_underlying::_quaternion_from_matrix<T_>(matrix_, out_.data());
+			return out_;
+		}
+#pragma endregion
+
+#pragma region ACCESS
+	public:
+		template<std::size_t Index_>
+		[[nodiscard]] constexpr inline T_& at()
+		{
+			static_assert(Index_ < 4, "Attempted to access an EmuMath Quaternion component with an index greater than 3.");
+			return _data.template at<Index_>();
+		}
+
+		template<std::size_t Index_>
+		[[nodiscard]] constexpr inline const T_& at() const
+		{
+			static_assert(Index_ < 4, "Attempted to access an EmuMath Quaternion component with an index greater than 3.");
+			return _data.template at<Index_>();
+		}
+
+		[[nodiscard]] constexpr inline T_& X() { return _data.template at<0>(); }
+		[[nodiscard]] constexpr inline const T_& X() const { return _data.template at<0>(); }
+		[[nodiscard]] constexpr inline T_& Y() { return _data.template at<1>(); }
+		[[nodiscard]] constexpr inline const T_& Y() const { return _data.template at<1>(); }
+		[[nodiscard]] constexpr inline T_& Z() { return _data.template at<2>(); }
+		[[nodiscard]] constexpr inline const T_& Z() const { return _data.template at<2>(); }
+		[[nodiscard]] constexpr inline T_& W() { return _data.template at<3>(); }
+		[[nodiscard]] constexpr inline const T_& W() const { return _data.template at<3>(); }
+
+		/// <summary> Accesses this Quaternion's components as a 4-element Vector in the order (x, y, z, w). </summary>
+		[[nodiscard]] constexpr inline vector_type& AsVector()
+		{
+			return _data;
+		}
+
+		[[nodiscard]] constexpr inline const vector_type& AsVector() const
+		{
+			return _data;
+		}
+
+		[[nodiscard]] constexpr inline T_* data()
+		{
+			return _data.data();
+		}
+
+		[[nodiscard]] constexpr inline const T_* data() const
+		{
+			return _data.data();
+		}
+#pragma endregion
+
+#pragma region ASSIGNMENT
+	public:
+		constexpr inline this_type& operator=(const this_type&) = default;
+		constexpr inline this_type& operator=(this_type&&) = default;
+#pragma endregion
+
+#pragma region ARITHMETIC
+	public:
+		/// <summary>
+		/// <para> Outputs the Hamilton product of this Quaternion and rhs_. </para>
+		/// <para> The resulting rotation is equivalent to applying rhs_ first, followed by this Quaternion. </para>
+		/// </summary>
+		[[nodiscard]] inline this_type Multiply(const this_type& rhs_) const
+		{
+			this_type out_;
+			EmuMath::Helpers::_quaternion_underlying::_quaternion_multiply(data(), rhs_.data(), out_.data());
+			return out_;
+		}
+
+		[[nodiscard]] inline this_type operator*(const this_type& rhs_) const
+		{
+			return Multiply(rhs_);
+		}
+
+		inline this_type& operator*=(const this_type& rhs_)
+		{
+			EmuMath::Helpers::_quaternion_underlying::_quaternion_multiply(data(), rhs_.data(), data());
+			return *this;
+		}
+
+		/// <summary> Outputs this Quaternion with its imaginary part negated. For unit Quaternions, this is the inverse rotation. </summary>
+		[[nodiscard]] constexpr inline this_type Conjugate() const
+		{
+			return this_type(-X(), -Y(), -Z(), W());
+		}
+
+		/// <summary> Outputs the multiplicative inverse of this Quaternion. For unit Quaternions, `Conjugate` is equivalent and cheaper. </summary>
+		[[nodiscard]] constexpr inline this_type Inverse() const
+		{
+			const T_ reciprocal_square_mag_ = T_(1) / SquareMagnitude();
+			return this_type(-X() * reciprocal_square_mag_, -Y() * reciprocal_square_mag_, -Z() * reciprocal_square_mag_, W() * reciprocal_square_mag_);
+		}
+
+		[[nodiscard]] constexpr inline T_ Dot(const this_type& rhs_) const
+		{
+			return EmuMath::Helpers::vector_dot<T_>(_data, rhs_._data);
+		}
+
+		[[nodiscard]] constexpr inline T_ SquareMagnitude() const
+		{
+			return Dot(*this);
+		}
+
+		[[nodiscard]] constexpr inline T_ Magnitude() const
+		{
+			return EmuMath::Helpers::vector_magnitude<T_>(_data);
+		}
+
+		/// <summary> Outputs this Quaternion scaled to a magnitude of 1. </summary>
+		[[nodiscard]] constexpr inline this_type Normalise() const
+		{
+			return this_type(EmuMath::Helpers::vector_normalise(_data));
+		}
+
+		/// <summary> Outputs this Quaternion scaled to a magnitude of approximately 1, using a fast reciprocal square root. See `vector_normalise_fast`. </summary>
+		[[nodiscard]] inline this_type NormaliseFast() const
+		{
+			return this_type(EmuMath::Helpers::vector_normalise_fast(_data));
+		}
+#pragma endregion
+
+#pragma region INTERPOLATION
+	public:
+		/// <summary>
+		/// <para> Outputs the normalised linear interpolation from this Quaternion to b_ by t_, taking the shortest path. </para>
+		/// <para> This is cheaper than `Slerp`, but does not interpolate at a constant angular velocity. </para>
+		/// </summary>
+		[[nodiscard]] inline this_type Nlerp(const this_type& b_, const T_& t_) const
+		{
+			this_type out_;
+			EmuMath::Helpers::_quaternion_underlying::_quaternion_nlerp(data(), b_.data(), Dot(b_), t_, out_.data());
+			return out_;
+		}
+
+		/// <summary>
+		/// <para> Outputs the spherical linear interpolation from this Quaternion to b_ by t_, taking the shortest path. Both Quaternions are expected to be normalised. </para>
+		/// <para> Nearly-parallel Quaternions are interpolated via `Nlerp` to avoid instability. </para>
+		/// </summary>
+		[[nodiscard]] inline this_type Slerp(const this_type& b_, const T_& t_) const
+		{
+			this_type out_;
+			EmuMath::Helpers::_quaternion_underlying::_quaternion_slerp(data(), b_.data(), Dot(b_), t_, out_.data());
+			return out_;
+		}
+#pragma endregion
+
+#pragma region ROTATION
+	public:
+		/// <summary> Outputs the passed 3D vector_ rotated by this Quaternion, which is expected to be normalised. Only the first 3 elements of vector_ are used. </summary>
+		template<std::size_t Size_, typename VecT_>
+		[[nodiscard]] inline vector3_type RotateVector(const EmuMath::Vector<Size_, VecT_>& vector_) const
+		{
+			return EmuMath::Helpers::_quaternion_underlying::_quaternion_rotate_vector(data(), vector_);
+		}
+
+		template<std::size_t Size_, typename VecT_>
+		[[nodiscard]] inline vector3_type operator*(const EmuMath::Vector<Size_, VecT_>& vector_) const
+		{
+			return RotateVector(vector_);
+		}
+#pragma endregion
+
+#pragma region CONVERSIONS
+	public:
+		/// <summary> Outputs a 4x4 rotation Matrix equivalent to this Quaternion, which is expected to be normalised. </summary>
+		/// <typeparam name="OutT_">Type of value contained in the output Matrix. Defaults to this Quaternion's value_type.</typeparam>
+		/// <typeparam name="OutColumnMajor_">Major-order of the output Matrix. Defaults to column-major.</typeparam>
+		template<typename OutT_ = value_type, bool OutColumnMajor_ = true>
+		[[nodiscard]] inline EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_> ToMatrix() const
+		{
+			return EmuMath::Helpers::_quaternion_underlying::_quaternion_to_matrix<EmuMath::Matrix<4, 4, OutT_, OutColumnMajor_>>(data());
+		}
+#pragma endregion
+
+	private:
+		vector_type _data;
+	};
+}
+
+#endif
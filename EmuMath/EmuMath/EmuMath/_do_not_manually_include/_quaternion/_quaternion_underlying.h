@@ -0,0 +1,284 @@
+#ifndef EMU_MATH_QUATERNION_UNDERLYING_H_INC_
+#define EMU_MATH_QUATERNION_UNDERLYING_H_INC_ 1
+
+#include "../../Matrix.h"
+#include "../../Vector.h"
+#include "../../../EmuCore/Functors/Arithmetic.h"
+#include "../../../EmuCore/Functors/MiscMath.h"
+#include "../../../EmuSIMD/SIMDHelpers.h"
+#include <cstddef>
+#include <type_traits>
+
+// Kernels operate on 4 contiguous elements in the order (x, y, z, w), where (x, y, z) is the imaginary part and w is the real part.
+// float quaternions are processed in a single 128-bit register; other types use scalar arithmetic.
+
+namespace EmuMath::Helpers::_quaternion_underlying
+{
+	template<typename T_>
+	static constexpr bool _is_simd_quaternion_value_v = std::is_same_v<T_, float>;
+
+	/// <summary> Dot products of quaternions above this threshold are considered close enough that slerp falls back to nlerp, avoiding division by a near-zero sine. </summary>
+	template<typename T_>
+	static constexpr T_ _slerp_nlerp_threshold = T_(0.9995);
+
+#pragma region MULTIPLY
+	/// <summary> Outputs the Hamilton product `a_ * b_` to p_out_. p_out_ may point to either input. </summary>
+	template<typename T_>
+	inline void _quaternion_multiply(const T_* p_a_, const T_* p_b_, T_* p_out_)
+	{
+		if constexpr (_is_simd_quaternion_value_v<T_>)
+		{
+			const __m128 a_ = EmuSIMD::load_unaligned<__m128>(p_a_);
+			const __m128 b_ = EmuSIMD::load_unaligned<__m128>(p_b_);
+
+			// Each broadcast component of a_ multiplies a permutation of b_, with signs applied via XOR of the sign bit
+			__m128 out_ = EmuSIMD::mul_all(EmuSIMD::shuffle<3, 3, 3, 3>(a_), b_);
+			out_ = EmuSIMD::fmadd
+			(
+				EmuSIMD::shuffle<0, 0, 0, 0>(a_),
+				EmuSIMD::bitwise_xor(EmuSIMD::shuffle<3, 2, 1, 0>(b_), EmuSIMD::setr<__m128>(0.0f, -0.0f, 0.0f, -0.0f)),
+				out_
+			);
+			out_ = EmuSIMD::fmadd
+			(
+				EmuSIMD::shuffle<1, 1, 1, 1>(a_),
+				EmuSIMD::bitwise_xor(EmuSIMD::shuffle<2, 3, 0, 1>(b_), EmuSIMD::setr<__m128>(0.0f, 0.0f, -0.0f, -0.0f)),
+				out_
+			);
+			out_ = EmuSIMD::fmadd
+			(
+				EmuSIMD::shuffle<2, 2, 2, 2>(a_),
+				EmuSIMD::bitwise_xor(EmuSIMD::shuffle<1, 0, 3, 2>(b_), EmuSIMD::setr<__m128>(-0.0f, 0.0f, 0.0f, -0.0f)),
+				out_
+			);
+			EmuSIMD::store_unaligned(out_, p_out_);
+		}
+		else
+		{
+			const T_ ax_ = p_a_[0], ay_ = p_a_[1], az_ = p_a_[2], aw_ = p_a_[3];
+			const T_ bx_ = p_b_[0], by_ = p_b_[1], bz_ = p_b_[2], bw_ = p_b_[3];
+			p_out_[0] = (aw_ * bx_) + (ax_ * bw_) + (ay_ * bz_) - (az_ * by_);
+			p_out_[1] = (aw_ * by_) - (ax_ * bz_) + (ay_ * bw_) + (az_ * bx_);
+			p_out_[2] = (aw_ * bz_) + (ax_ * by_) - (ay_ * bx_) + (az_ * bw_);
+			p_out_[3] = (aw_ * bw_) - (ax_ * bx_) - (ay_ * by_) - (az_ * bz_);
+		}
+	}
+#pragma endregion
+
+#pragma region INTERPOLATION
+	/// <summary> Outputs `(a_ * weight_a_) + (b_ * weight_b_)` to p_out_, normalising the result if Normalise_ is true. p_out_ may point to either input. </summary>
+	template<bool Normalise_, typename T_>
+	inline void _quaternion_weighted_sum(const T_* p_a_, const T_* p_b_, const T_& weight_a_, const T_& weight_b_, T_* p_out_)
+	{
+		if constexpr (_is_simd_quaternion_value_v<T_>)
+		{
+			const __m128 a_ = EmuSIMD::load_unaligned<__m128>(p_a_);
+			const __m128 b_ = EmuSIMD::load_unaligned<__m128>(p_b_);
+			__m128 out_ = EmuSIMD::fmadd(EmuSIMD::set1<__m128>(weight_b_), b_, EmuSIMD::mul_all(EmuSIMD::set1<__m128>(weight_a_), a_));
+			if constexpr (Normalise_)
+			{
+				out_ = EmuSIMD::div(out_, EmuSIMD::sqrt(EmuSIMD::dot_fill(out_, out_)));
+			}
+			EmuSIMD::store_unaligned(out_, p_out_);
+		}
+		else
+		{
+			T_ out_[4];
+			for (std::size_t i_ = 0; i_ < 4; ++i_)
+			{
+				out_[i_] = (p_a_[i_] * weight_a_) + (p_b_[i_] * weight_b_);
+			}
+
+			if constexpr (Normalise_)
+			{
+				const T_ reciprocal_mag_ = T_(1) / static_cast<T_>(EmuCore::do_sqrt<T_>()((out_[0] * out_[0]) + (out_[1] * out_[1]) + (out_[2] * out_[2]) + (out_[3] * out_[3])));
+				for (std::size_t i_ = 0; i_ < 4; ++i_)
+				{
+					out_[i_] *= reciprocal_mag_;
+				}
+			}
+
+			for (std::size_t i_ = 0; i_ < 4; ++i_)
+			{
+				p_out_[i_] = out_[i_];
+			}
+		}
+	}
+
+	/// <summary>
+	/// <para> Outputs the normalised linear interpolation between a_ and b_ to p_out_, using the provided dot product of a_ and b_. </para>
+	/// <para> If the dot product is negative, b_ is negated so that the shortest path is taken. </para>
+	/// </summary>
+	template<typename T_>
+	inline void _quaternion_nlerp(const T_* p_a_, const T_* p_b_, const T_& dot_, const T_& t_, T_* p_out_)
+	{
+		const T_ weight_b_ = dot_ < T_(0) ? -t_ : t_;
+		_quaternion_weighted_sum<true>(p_a_, p_b_, T_(1) - t_, weight_b_, p_out_);
+	}
+
+	/// <summary>
+	/// <para> Outputs the spherical linear interpolation between unit quaternions a_ and b_ to p_out_, using the provided dot product of a_ and b_. </para>
+	/// <para> If the dot product is negative, b_ is negated so that the shortest path is taken. Nearly-parallel quaternions fall back to nlerp. </para>
+	/// </summary>
+	template<typename T_>
+	inline void _quaternion_slerp(const T_* p_a_, const T_* p_b_, const T_& dot_, const T_& t_, T_* p_out_)
+	{
+		const bool negate_b_ = dot_ < T_(0);
+		const T_ cos_theta_ = negate_b_ ? -dot_ : dot_;
+		if (cos_theta_ > _slerp_nlerp_threshold<T_>)
+		{
+			_quaternion_nlerp(p_a_, p_b_, dot_, t_, p_out_);
+		}
+		else
+		{
+			const T_ theta_ = static_cast<T_>(EmuCore::do_acos<T_>()(cos_theta_));
+			const T_ reciprocal_sin_theta_ = T_(1) / static_cast<T_>(EmuCore::do_sqrt<T_>()(T_(1) - (cos_theta_ * cos_theta_)));
+			const T_ weight_a_ = static_cast<T_>(EmuCore::do_sin<T_>()((T_(1) - t_) * theta_)) * reciprocal_sin_theta_;
+			T_ weight_b_ = static_cast<T_>(EmuCore::do_sin<T_>()(t_ * theta_)) * reciprocal_sin_theta_;
+			if (negate_b_)
+			{
+				weight_b_ = -weight_b_;
+			}
+			_quaternion_weighted_sum<false>(p_a_, p_b_, weight_a_, weight_b_, p_out_);
+		}
+	}
+#pragma endregion
+
+#pragma region ROTATION
+	/// <summary>
+	/// <para> Rotates the 3D vector_ by the unit quaternion pointed to by p_quaternion_. </para>
+	/// <para> This uses the form `v + (w * t) + cross(q.xyz, t)`, where `t = 2 * cross(q.xyz, v)`, which avoids forming a rotation matrix. </para>
+	/// </summary>
+	template<typename T_, std::size_t Size_, typename VecT_>
+	[[nodiscard]] inline EmuMath::Vector<3, T_> _quaternion_rotate_vector(const T_* p_quaternion_, const EmuMath::Vector<Size_, VecT_>& vector_)
+	{
+		const EmuMath::Vector<3, T_> imaginary_(p_quaternion_[0], p_quaternion_[1], p_quaternion_[2]);
+		const EmuMath::Vector<3, T_> in_
+		(
+			static_cast<T_>(vector_.template AtTheoretical<0>()),
+			static_cast<T_>(vector_.template AtTheoretical<1>()),
+			static_cast<T_>(vector_.template AtTheoretical<2>())
+		);
+		const EmuMath::Vector<3, T_> t_ = EmuMath::Helpers::vector_multiply(EmuMath::Helpers::vector_cross_3d(imaginary_, in_), T_(2));
+		return EmuMath::Helpers::vector_add
+		(
+			EmuMath::Helpers::vector_add(in_, EmuMath::Helpers::vector_multiply(t_, p_quaternion_[3])),
+			EmuMath::Helpers::vector_cross_3d(imaginary_, t_)
+		);
+	}
+#pragma endregion
+
+#pragma region CONVERSIONS
+	/// <summary> Outputs the unit quaternion rotating by angle_rads_ about the passed unit axis_ to p_out_. </summary>
+	template<typename T_, std::size_t Size_, typename AxisT_>
+	inline void _quaternion_from_axis_angle(const EmuMath::Vector<Size_, AxisT_>& axis_, const T_& angle_rads_, T_* p_out_)
+	{
+		const T_ half_angle_ = angle_rads_ * T_(0.5);
+		const T_ sin_ = static_cast<T_>(EmuCore::do_sin<T_>()(half_angle_));
+		p_out_[0] = static_cast<T_>(axis_.template AtTheoretical<0>()) * sin_;
+		p_out_[1] = static_cast<T_>(axis_.template AtTheoretical<1>()) * sin_;
+		p_out_[2] = static_cast<T_>(axis_.template AtTheoretical<2>()) * sin_;
+		p_out_[3] = static_cast<T_>(EmuCore::do_cos<T_>()(half_angle_));
+	}
+
+	/// <summary> Outputs the unit quaternion rotating about X, then Y, then Z by the passed angles to p_out_, matching `matrix_make_rotation_euler`. </summary>
+	template<typename T_>
+	inline void _quaternion_from_euler(const T_& x_rads_, const T_& y_rads_, const T_& z_rads_, T_* p_out_)
+	{
+		const T_ cx_ = static_cast<T_>(EmuCore::do_cos<T_>()(x_rads_ * T_(0.5)));
+		const T_ sx_ = static_cast<T_>(EmuCore::do_sin<T_>()(x_rads_ * T_(0.5)));
+		const T_ cy_ = static_cast<T_>(EmuCore::do_cos<T_>()(y_rads_ * T_(0.5)));
+		const T_ sy_ = static_cast<T_>(EmuCore::do_sin<T_>()(y_rads_ * T_(0.5)));
+		const T_ cz_ = static_cast<T_>(EmuCore::do_cos<T_>()(z_rads_ * T_(0.5)));
+		const T_ sz_ = static_cast<T_>(EmuCore::do_sin<T_>()(z_rads_ * T_(0.5)));
+
+		// Equivalent to z * y * x
+		p_out_[0] = (sx_ * cy_ * cz_) - (cx_ * sy_ * sz_);
+		p_out_[1] = (cx_ * sy_ * cz_) + (sx_ * cy_ * sz_);
+		p_out_[2] = (cx_ * cy_ * sz_) - (sx_ * sy_ * cz_);
+		p_out_[3] = (cx_ * cy_ * cz_) + (sx_ * sy_ * sz_);
+	}
+
+	/// <summary>
+	/// <para> Outputs the unit quaternion represented by the upper-left 3x3 rotation of the passed Matrix to p_out_. </para>
+	/// <para> The largest of the quaternion's components is calculated first to avoid precision loss from dividing by small values. </para>
+	/// </summary>
+	template<typename T_, class Matrix_>
+	inline void _quaternion_from_matrix(const Matrix_& matrix_, T_* p_out_)
+	{
+		// mRC_ refers to row R, column C
+		const T_ m00_ = static_cast<T_>(matrix_.template at<0, 0>());
+		const T_ m01_ = static_cast<T_>(matrix_.template at<1, 0>());
+		const T_ m02_ = static_cast<T_>(matrix_.template at<2, 0>());
+		const T_ m10_ = static_cast<T_>(matrix_.template at<0, 1>());
+		const T_ m11_ = static_cast<T_>(matrix_.template at<1, 1>());
+		const T_ m12_ = static_cast<T_>(matrix_.template at<2, 1>());
+		const T_ m20_ = static_cast<T_>(matrix_.template at<0, 2>());
+		const T_ m21_ = static_cast<T_>(matrix_.template at<1, 2>());
+		const T_ m22_ = static_cast<T_>(matrix_.template at<2, 2>());
+		const T_ trace_ = m00_ + m11_ + m22_;
+
+		EmuCore::do_sqrt<T_> sqrt_;
+		if (trace_ > T_(0))
+		{
+			const T_ s_ = static_cast<T_>(sqrt_(trace_ + T_(1))) * T_(2);
+			const T_ reciprocal_s_ = T_(1) / s_;
+			p_out_[0] = (m21_ - m12_) * reciprocal_s_;
+			p_out_[1] = (m02_ - m20_) * reciprocal_s_;
+			p_out_[2] = (m10_ - m01_) * reciprocal_s_;
+			p_out_[3] = s_ * T_(0.25);
+		}
+		else if (m00_ > m11_ && m00_ > m22_)
+		{
+			const T_ s_ = static_cast<T_>(sqrt_(T_(1) + m00_ - m11_ - m22_)) * T_(2);
+			const T_ reciprocal_s_ = T_(1) / s_;
+			p_out_[0] = s_ * T_(0.25);
+			p_out_[1] = (m01_ + m10_) * reciprocal_s_;
+			p_out_[2] = (m02_ + m20_) * reciprocal_s_;
+			p_out_[3] = (m21_ - m12_) * reciprocal_s_;
+		}
+		else if (m11_ > m22_)
+		{
+			const T_ s_ = static_cast<T_>(sqrt_(T_(1) + m11_ - m00_ - m22_)) * T_(2);
+			const T_ reciprocal_s_ = T_(1) / s_;
+			p_out_[0] = (m01_ + m10_) * reciprocal_s_;
+			p_out_[1] = s_ * T_(0.25);
+			p_out_[2] = (m12_ + m21_) * reciprocal_s_;
+			p_out_[3] = (m02_ - m20_) * reciprocal_s_;
+		}
+		else
+		{
+			const T_ s_ = static_cast<T_>(sqrt_(T_(1) + m22_ - m00_ - m11_)) * T_(2);
+			const T_ reciprocal_s_ = T_(1) / s_;
+			p_out_[0] = (m02_ + m20_) * reciprocal_s_;
+			p_out_[1] = (m12_ + m21_) * reciprocal_s_;
+			p_out_[2] = s_ * T_(0.25);
+			p_out_[3] = (m10_ - m01_) * reciprocal_s_;
+		}
+	}
+
+	/// <summary> Outputs a 4x4 rotation Matrix of type Out_ equivalent to the unit quaternion pointed to by p_quaternion_. </summary>
+	template<class Out_, typename T_>
+	[[nodiscard]] inline Out_ _quaternion_to_matrix(const T_* p_quaternion_)
+	{
+		using out_value = typename Out_::value_type_uq;
+		const out_value x_ = static_cast<out_value>(p_quaternion_[0]);
+		const out_value y_ = static_cast<out_value>(p_quaternion_[1]);
+		const out_value z_ = static_cast<out_value>(p_quaternion_[2]);
+		const out_value w_ = static_cast<out_value>(p_quaternion_[3]);
+		const out_value x2_ = x_ + x_, y2_ = y_ + y_, z2_ = z_ + z_;
+		const out_value xx_ = x_ * x2_, yy_ = y_ * y2_, zz_ = z_ * z2_;
+		const out_value xy_ = x_ * y2_, xz_ = x_ * z2_, yz_ = y_ * z2_;
+		const out_value wx_ = w_ * x2_, wy_ = w_ * y2_, wz_ = w_ * z2_;
+		constexpr out_value one_ = out_value(1);
+		return EmuMath::Helpers::_matrix_underlying::_matrix_make_rotation_from_3x3<Out_, out_value>
+		(
+			one_ - (yy_ + zz_), xy_ - wz_, xz_ + wy_,
+			xy_ + wz_, one_ - (xx_ + zz_), yz_ - wx_,
+			xz_ - wy_, yz_ + wx_, one_ - (xx_ + yy_)
+		);
+	}
+#pragma endregion
+}
+
+#endif
@@ -52,6 +52,16 @@ namespace EmuMath
 		{
 			Shuffle(shuffle_seed_64_);
 		}
+		/// <summary> Creates a copy of the passed sequence, with each of its items converted to this sequence's value_type. </summary>
+		/// <param name="to_convert_">Sequence to copy the items of.</param>
+		template<typename OtherT_>
+		explicit ShuffledIntSequence(const ShuffledIntSequence<OtherT_>& to_convert_) : items(to_convert_.size()), max_contained_value(static_cast<value_type>(to_convert_.HighestStoredValue()))
+		{
+			for (std::size_t i = 0, end_ = items.size(); i < end_; ++i)
+			{
+				items[i] = static_cast<value_type>(to_convert_[i]);
+			}
+		}
 		ShuffledIntSequence(ShuffledIntSequence<value_type>&& to_move_) noexcept : ShuffledIntSequence()
 		{
 			items.swap(to_move_.items);
@@ -161,6 +171,12 @@ namespace EmuMath
 			return items.size();
 		}
 
+		/// <summary> Pointer to the contiguous storage of this sequence's items, valid until this sequence is next modified. </summary>
+		[[nodiscard]] inline const value_type* data() const
+		{
+			return items.data();
+		}
+
 		inline void swap(ShuffledIntSequence& to_swap_with_)
 		{
 			items.swap(to_swap_with_.items);
@@ -0,0 +1,286 @@
+#ifndef EMU_MATH_VECTOR_EXPRESSION_NODES_H_INC_
+#define EMU_MATH_VECTOR_EXPRESSION_NODES_H_INC_ 1
+
+#include "../_vectors/_vector_t.h"
+#include "../../../EmuCore/Functors/Arithmetic.h"
+#include "../../../EmuSIMD/SIMDHelpers.h"
+#include <cstddef>
+#include <type_traits>
+
+// Nodes used to build lazy Vector expressions. Every node provides the following:
+// --- value_type: Type of value output by the node
+// --- size: Number of elements output by the node
+// --- is_simd_loadable: True if the node may be evaluated a full SIMD register at a time via Load, which requires all of its operands to share its value_type
+// --- is_multiply: True if the node is a multiplication that may be fused into a parent addition or subtraction
+// --- At<Index_>(): Calculates the element at the provided Index_
+// --- Load<Register_>(index_): Calculates the elements starting at the provided index_ as a SIMD register
+
+namespace EmuMath::Helpers::_vector_expression_underlying
+{
+#pragma region LEAVES
+	/// <summary> Leaf node reading elements from an EmuMath Vector. The referenced Vector must outlive the expression's evaluation. </summary>
+	template<std::size_t Size_, typename T_>
+	struct _expr_vector_leaf
+	{
+		using vector_type = EmuMath::Vector<Size_, T_>;
+		using value_type = typename vector_type::value_type_uq;
+		static constexpr std::size_t size = Size_;
+		static constexpr bool is_simd_loadable = !vector_type::contains_ref;
+		static constexpr bool is_multiply = false;
+
+		constexpr explicit inline _expr_vector_leaf(const vector_type& vector_) : p_vector(&vector_)
+		{
+		}
+
+		template<std::size_t Index_>
+		[[nodiscard]] constexpr inline value_type At() const
+		{
+			return p_vector->template at<Index_>();
+		}
+
+		template<class Register_>
+		[[nodiscard]] inline Register_ Load(std::size_t index_) const
+		{
+			return EmuSIMD::load_unaligned<Register_>(p_vector->data() + index_);
+		}
+
+		const vector_type* p_vector;
+	};
+
+	/// <summary> Leaf node providing the same scalar for every element. </summary>
+	template<typename T_>
+	struct _expr_scalar_leaf
+	{
+		using value_type = T_;
+		static constexpr std::size_t size = 0;
+		static constexpr bool is_simd_loadable = true;
+		static constexpr bool is_multiply = false;
+
+		constexpr explicit inline _expr_scalar_leaf(const T_& scalar_) : scalar(scalar_)
+		{
+		}
+
+		template<std::size_t Index_>
+		[[nodiscard]] constexpr inline value_type At() const
+		{
+			return scalar;
+		}
+
+		template<class Register_>
+		[[nodiscard]] inline Register_ Load(std::size_t) const
+		{
+			return EmuSIMD::set1<Register_>(scalar);
+		}
+
+		T_ scalar;
+	};
+#pragma endregion
+
+#pragma region OPERATIONS
+	struct _expr_op_add
+	{
+		template<typename T_>
+		[[nodiscard]] static constexpr inline T_ Scalar(const T_& lhs_, const T_& rhs_)
+		{
+			return EmuCore::do_add<T_, T_>()(lhs_, rhs_);
+		}
+		template<class Register_>
+		[[nodiscard]] static inline Register_ Simd(Register_ lhs_, Register_ rhs_)
+		{
+			return EmuSIMD::add(lhs_, rhs_);
+		}
+	};
+
+	struct _expr_op_subtract
+	{
+		template<typename T_>
+		[[nodiscard]] static constexpr inline T_ Scalar(const T_& lhs_, const T_& rhs_)
+		{
+			return EmuCore::do_subtract<T_, T_>()(lhs_, rhs_);
+		}
+		template<class Register_>
+		[[nodiscard]] static inline Register_ Simd(Register_ lhs_, Register_ rhs_)
+		{
+			return EmuSIMD::sub(lhs_, rhs_);
+		}
+	};
+
+	struct _expr_op_multiply
+	{
+		template<typename T_>
+		[[nodiscard]] static constexpr inline T_ Scalar(const T_& lhs_, const T_& rhs_)
+		{
+			return EmuCore::do_multiply<T_, T_>()(lhs_, rhs_);
+		}
+		template<class Register_>
+		[[nodiscard]] static inline Register_ Simd(Register_ lhs_, Register_ rhs_)
+		{
+			return EmuSIMD::mul_all(lhs_, rhs_);
+		}
+	};
+
+	struct _expr_op_divide
+	{
+		template<typename T_>
+		[[nodiscard]] static constexpr inline T_ Scalar(const T_& lhs_, const T_& rhs_)
+		{
+			return EmuCore::do_divide<T_, T_>()(lhs_, rhs_);
+		}
+		template<class Register_>
+		[[nodiscard]] static inline Register_ Simd(Register_ lhs_, Register_ rhs_)
+		{
+			return EmuSIMD::div(lhs_, rhs_);
+		}
+	};
+#pragma endregion
+
+#pragma region NODES
+	/// <summary>
+	/// <para> True if the passed Node_ may be loaded as registers of Value_ elements. </para>
+	/// <para> Loads reinterpret memory rather than converting it, so this is only true where Node_ is SIMD-loadable and its value_type is Value_. </para>
+	/// </summary>
+	template<class Node_, typename Value_>
+	static constexpr bool _expr_is_simd_loadable_as_v = Node_::is_simd_loadable && std::is_same_v<typename Node_::value_type, Value_>;
+
+	/// <summary> Size of an expression combining the two passed nodes, where scalar leaves (of size 0) adopt the size of the other node. </summary>
+	template<class Lhs_, class Rhs_>
+	[[nodiscard]] constexpr inline std::size_t _expr_combined_size()
+	{
+		return Lhs_::size == 0 ? Rhs_::size : Lhs_::size;
+	}
+
+	/// <summary> Node applying Op_ to respective elements of its Lhs_ and Rhs_ nodes. </summary>
+	template<class Op_, class Lhs_, class Rhs_>
+	struct _expr_binary
+	{
+		using lhs_type = Lhs_;
+		using rhs_type = Rhs_;
+		using value_type = typename Lhs_::value_type;
+		static constexpr std::size_t size = _expr_combined_size<Lhs_, Rhs_>();
+		static constexpr bool is_simd_loadable = _expr_is_simd_loadable_as_v<Lhs_, value_type> && _expr_is_simd_loadable_as_v<Rhs_, value_type>;
+		static constexpr bool is_multiply = std::is_same_v<Op_, _expr_op_multiply>;
+
+		static_assert
+		(
+			Lhs_::size == 0 || Rhs_::size == 0 || Lhs_::size == Rhs_::size,
+			"Attempted to combine two EmuMath Vector expressions of different sizes. All Vectors within a lazy expression must be the same size."
+		);
+
+		constexpr inline _expr_binary(const Lhs_& lhs_, const Rhs_& rhs_) : lhs(lhs_), rhs(rhs_)
+		{
+		}
+
+		template<std::size_t Index_>
+		[[nodiscard]] constexpr inline value_type At() const
+		{
+			return Op_::Scalar(lhs.template At<Index_>(), static_cast<value_type>(rhs.template At<Index_>()));
+		}
+
+		template<class Register_>
+		[[nodiscard]] inline Register_ Load(std::size_t index_) const
+		{
+			return Op_::Simd(lhs.template Load<Register_>(index_), rhs.template Load<Register_>(index_));
+		}
+
+		Lhs_ lhs;
+		Rhs_ rhs;
+	};
+
+	/// <summary>
+	/// <para> Node calculating `(a * b) + c` if Subtract_ is false, or `(a * b) - c` if Subtract_ is true, using a single fused multiply-add/subtract per register. </para>
+	/// <para> If NegateProduct_ is true, the product is negated before the addition, calculating `c - (a * b)`. </para>
+	/// </summary>
+	template<bool Subtract_, bool NegateProduct_, class A_, class B_, class C_>
+	struct _expr_fused_multiply
+	{
+		using value_type = typename A_::value_type;
+		static constexpr std::size_t size = _expr_combined_size<_expr_binary<_expr_op_multiply, A_, B_>, C_>();
+		static constexpr bool is_simd_loadable =
+		(
+			_expr_is_simd_loadable_as_v<A_, value_type> &&
+			_expr_is_simd_loadable_as_v<B_, value_type> &&
+			_expr_is_simd_loadable_as_v<C_, value_type>
+		);
+		static constexpr bool is_multiply = false;
+
+		static_assert
+		(
+			_expr_binary<_expr_op_multiply, A_, B_>::size == 0 || C_::size == 0 || _expr_binary<_expr_op_multiply, A_, B_>::size == C_::size,
+			"Attempted to combine two EmuMath Vector expressions of different sizes. All Vectors within a lazy expression must be the same size."
+		);
+
+		constexpr inline _expr_fused_multiply(const A_& a_, const B_& b_, const C_& c_) : a(a_), b(b_), c(c_)
+		{
+		}
+
+		template<std::size_t Index_>
+		[[nodiscard]] constexpr inline value_type At() const
+		{
+			value_type product_ = _expr_op_multiply::Scalar(a.template At<Index_>(), static_cast<value_type>(b.template At<Index_>()));
+			value_type c_value_ = static_cast<value_type>(c.template At<Index_>());
+			if constexpr (NegateProduct_)
+			{
+				return _expr_op_subtract::Scalar(c_value_, product_);
+			}
+			else if constexpr (Subtract_)
+			{
+				return _expr_op_subtract::Scalar(product_, c_value_);
+			}
+			else
+			{
+				return _expr_op_add::Scalar(product_, c_value_);
+			}
+		}
+
+		template<class Register_>
+		[[nodiscard]] inline Register_ Load(std::size_t index_) const
+		{
+			if constexpr (NegateProduct_)
+			{
+				return EmuSIMD::fmadd(EmuSIMD::negate(a.template Load<Register_>(index_)), b.template Load<Register_>(index_), c.template Load<Register_>(index_));
+			}
+			else if constexpr (Subtract_)
+			{
+				return EmuSIMD::fmsub(a.template Load<Register_>(index_), b.template Load<Register_>(index_), c.template Load<Register_>(index_));
+			}
+			else
+			{
+				return EmuSIMD::fmadd(a.template Load<Register_>(index_), b.template Load<Register_>(index_), c.template Load<Register_>(index_));
+			}
+		}
+
+		A_ a;
+		B_ b;
+		C_ c;
+	};
+
+	/// <summary>
+	/// <para> Combines the passed nodes via Op_. </para>
+	/// <para> Additions and subtractions where either side is a multiplication are fused into a single multiply-add or multiply-subtract node. </para>
+	/// </summary>
+	template<class Op_, class Lhs_, class Rhs_>
+	[[nodiscard]] constexpr inline auto _combine_expr_nodes(const Lhs_& lhs_, const Rhs_& rhs_)
+	{
+		constexpr bool is_add_ = std::is_same_v<Op_, _expr_op_add>;
+		constexpr bool is_subtract_ = std::is_same_v<Op_, _expr_op_subtract>;
+		if constexpr ((is_add_ || is_subtract_) && Lhs_::is_multiply)
+		{
+			using a_type = typename Lhs_::lhs_type;
+			using b_type = typename Lhs_::rhs_type;
+			return _expr_fused_multiply<is_subtract_, false, a_type, b_type, Rhs_>(lhs_.lhs, lhs_.rhs, rhs_);
+		}
+		else if constexpr ((is_add_ || is_subtract_) && Rhs_::is_multiply)
+		{
+			using a_type = typename Rhs_::lhs_type;
+			using b_type = typename Rhs_::rhs_type;
+			return _expr_fused_multiply<false, is_subtract_, a_type, b_type, Lhs_>(rhs_.lhs, rhs_.rhs, lhs_);
+		}
+		else
+		{
+			return _expr_binary<Op_, Lhs_, Rhs_>(lhs_, rhs_);
+		}
+	}
+#pragma endregion
+}
+
+#endif
@@ -0,0 +1,294 @@
+#ifndef EMU_MATH_VECTOR_EXPRESSION_T_H_INC_
+#define EMU_MATH_VECTOR_EXPRESSION_T_H_INC_ 1
+
+#include "_vector_expression_nodes.h"
+#include <climits>
+#include <type_traits>
+#include <utility>
+
+namespace EmuMath
+{
+	/// <summary>
+	/// <para> Lazily-evaluated arithmetic expression of EmuMath Vectors, created via `EmuMath::lazy`. </para>
+	/// <para>
+	///		Arithmetic operators on a VectorExpression do not calculate anything, and instead build a new VectorExpression describing the combined operation.
+	///		The full expression is calculated in a single pass when it is evaluated (via `Evaluate`, `EvaluateTo`, or conversion to an EmuMath Vector),
+	///		so no temporary Vectors are created for intermediate results.
+	/// </para>
+	/// <para>
+	///		Where an addition or subtraction has a multiplication on either side, the two are fused into a single multiply-add.
+	///		float and double expressions of at least one full register are evaluated in 256-bit SIMD registers, using FMA instructions for fused nodes.
+	/// </para>
+	/// <para>
+	///		The left-hand operand of each operation must be a VectorExpression or a scalar (e.g. `lazy(a) + lazy(b) * c - d`),
+	///		as EmuMath Vector operators would otherwise evaluate the operation immediately.
+	/// </para>
+	/// <para> Expressions reference their Vector operands, so must be evaluated before any of those Vectors are destroyed or modified. </para>
+	/// </summary>
+	/// <typeparam name="Expr_">Underlying node type describing this expression.</typeparam>
+	template<class Expr_>
+	class VectorExpression
+	{
+#pragma region COMMON_STATIC_INFO
+	public:
+		using this_type = VectorExpression<Expr_>;
+		using expression_type = Expr_;
+		using value_type = typename Expr_::value_type;
+		static constexpr std::size_t size = Expr_::size;
+		using vector_type = EmuMath::Vector<size, value_type>;
+
+		/// <summary> True if this expression will be evaluated in SIMD registers when output to its vector_type. </summary>
+		static constexpr bool is_simd_evaluated =
+		(
+			Expr_::is_simd_loadable &&
+			(std::is_same_v<value_type, float> || std::is_same_v<value_type, double>) &&
+			size >= (256 / (sizeof(value_type) * CHAR_BIT))
+		);
+#pragma endregion
+
+#pragma region CONSTRUCTORS
+	public:
+		constexpr explicit inline VectorExpression(const Expr_& expression_) : _expression(expression_)
+		{
+		}
+#pragma endregion
+
+#pragma region ACCESS
+	public:
+		/// <summary> Calculates only the element at the provided Index_ of this expression. </summary>
+		/// <returns>Result of this expression at the provided Index_.</returns>
+		template<std::size_t Index_>
+		[[nodiscard]] constexpr inline value_type at() const
+		{
+			if constexpr (Index_ < size)
+			{
+				return _expression.template At<Index_>();
+			}
+			else
+			{
+				static_assert
+				(
+					EmuCore::TMP::get_false<std::size_t, Index_>(),
+					"Attempted to access an element at an invalid Index_ within an EmuMath VectorExpression via its template `at<Index_>` member. Valid indices are in the inclusive range 0:size-1."
+				);
+			}
+		}
+
+		/// <summary> Provides access to the underlying node of this expression. </summary>
+		[[nodiscard]] constexpr inline const Expr_& Expression() const
+		{
+			return _expression;
+		}
+#pragma endregion
+
+#pragma region EVALUATION
+	public:
+		/// <summary> Calculates the full result of this expression in a single pass. </summary>
+		/// <returns>EmuMath Vector containing the results of this expression.</returns>
+		[[nodiscard]] inline vector_type Evaluate() const
+		{
+			if constexpr (is_simd_evaluated)
+			{
+				vector_type out_;
+				_evaluate_simd(out_.data());
+				return out_;
+			}
+			else
+			{
+				return _evaluate_scalar(std::make_index_sequence<size>());
+			}
+		}
+
+		/// <summary>
+		/// <para> Calculates the full result of this expression in a single pass, outputting it to the provided out_vector_. </para>
+		/// <para> Indices in out_vector_ beyond this expression's size are set to 0. </para>
+		/// <para> out_vector_ must not be one of this expression's operands, unless it is only read at the same index that is being written. </para>
+		/// </summary>
+		/// <param name="out_vector_">: EmuMath Vector to output to.</param>
+		template<std::size_t OutSize_, typename OutT_>
+		inline void EvaluateTo(EmuMath::Vector<OutSize_, OutT_>& out_vector_) const
+		{
+			using out_vector_type = EmuMath::Vector<OutSize_, OutT_>;
+			if constexpr (is_simd_evaluated && OutSize_ == size && std::is_same_v<OutT_, value_type> && !out_vector_type::contains_ref)
+			{
+				_evaluate_simd(out_vector_.data());
+			}
+			else
+			{
+				_evaluate_to_scalar(out_vector_, std::make_index_sequence<OutSize_>());
+			}
+		}
+
+		[[nodiscard]] inline operator vector_type() const
+		{
+			return Evaluate();
+		}
+#pragma endregion
+
+	private:
+		inline void _evaluate_simd(value_type* p_out_) const
+		{
+			using register_type = EmuSIMD::TMP::register_type_t<value_type, 256>;
+			constexpr std::size_t width_ = 256 / (sizeof(value_type) * CHAR_BIT);
+			constexpr std::size_t simd_end_ = size - (size % width_);
+			for (std::size_t i_ = 0; i_ < simd_end_; i_ += width_)
+			{
+				EmuSIMD::store_unaligned(_expression.template Load<register_type>(i_), p_out_ + i_);
+			}
+			_evaluate_tail<simd_end_>(p_out_, std::make_index_sequence<size - simd_end_>());
+		}
+
+		template<std::size_t Offset_, std::size_t...Indices_>
+		inline void _evaluate_tail(value_type* p_out_, std::index_sequence<Indices_...>) const
+		{
+			((p_out_[Offset_ + Indices_] = _expression.template At<Offset_ + Indices_>()), ...);
+		}
+
+		template<std::size_t...Indices_>
+		[[nodiscard]] constexpr inline vector_type _evaluate_scalar(std::index_sequence<Indices_...>) const
+		{
+			return vector_type(_expression.template At<Indices_>()...);
+		}
+
+		template<std::size_t OutSize_, typename OutT_, std::size_t...Indices_>
+		inline void _evaluate_to_scalar(EmuMath::Vector<OutSize_, OutT_>& out_vector_, std::index_sequence<Indices_...>) const
+		{
+			using out_value_uq = typename EmuMath::Vector<OutSize_, OutT_>::value_type_uq;
+			((out_vector_.template at<Indices_>() = static_cast<out_value_uq>(_evaluate_index_or_zero<Indices_>())), ...);
+		}
+
+		template<std::size_t Index_>
+		[[nodiscard]] constexpr inline value_type _evaluate_index_or_zero() const
+		{
+			if constexpr (Index_ < size)
+			{
+				return _expression.template At<Index_>();
+			}
+			else
+			{
+				return value_type(0);
+			}
+		}
+
+		Expr_ _expression;
+	};
+}
+
+namespace EmuMath::TMP
+{
+	template<class T_>
+	struct is_emu_vector_expression
+	{
+		static constexpr bool value = std::conditional_t
+		<
+			std::is_same_v<T_, EmuCore::TMP::remove_ref_cv_t<T_>>,
+			std::false_type,
+			is_emu_vector_expression<EmuCore::TMP::remove_ref_cv_t<T_>>
+		>::value;
+	};
+	template<class Expr_>
+	struct is_emu_vector_expression<EmuMath::VectorExpression<Expr_>>
+	{
+		static constexpr bool value = true;
+	};
+	template<class T_>
+	static constexpr bool is_emu_vector_expression_v = is_emu_vector_expression<T_>::value;
+}
+
+namespace EmuMath::Helpers::_vector_expression_underlying
+{
+	template<std::size_t Size_, typename T_>
+	[[nodiscard]] constexpr inline _expr_vector_leaf<Size_, T_> _make_expr_vector_leaf(const EmuMath::Vector<Size_, T_>& vector_)
+	{
+		return _expr_vector_leaf<Size_, T_>(vector_);
+	}
+
+	/// <summary> Converts the passed operand into an expression node, where scalars are converted to the provided Value_ type. </summary>
+	template<typename Value_, class Operand_>
+	[[nodiscard]] constexpr inline auto _make_expr_node(const Operand_& operand_)
+	{
+		if constexpr (EmuMath::TMP::is_emu_vector_expression_v<Operand_>)
+		{
+			return operand_.Expression();
+		}
+		else if constexpr (EmuMath::TMP::is_emu_vector_v<Operand_>)
+		{
+			return _make_expr_vector_leaf(operand_);
+		}
+		else if constexpr (std::is_arithmetic_v<Operand_>)
+		{
+			return _expr_scalar_leaf<Value_>(static_cast<Value_>(operand_));
+		}
+		else
+		{
+			static_assert
+			(
+				EmuCore::TMP::get_false<Operand_>(),
+				"Attempted to use an invalid operand within an EmuMath VectorExpression. Operands must be a VectorExpression, an EmuMath Vector, or an arithmetic scalar."
+			);
+		}
+	}
+
+	template<class Op_, class Lhs_, class Rhs_>
+	[[nodiscard]] constexpr inline auto _make_expression(const Lhs_& lhs_, const Rhs_& rhs_)
+	{
+		// Scalars adopt the value_type of the expression on the other side of the operation
+		using value_type = typename std::conditional_t
+		<
+			EmuMath::TMP::is_emu_vector_expression_v<Lhs_>,
+			Lhs_,
+			Rhs_
+		>::value_type;
+		auto node_ = _combine_expr_nodes<Op_>(_make_expr_node<value_type>(lhs_), _make_expr_node<value_type>(rhs_));
+		return EmuMath::VectorExpression<decltype(node_)>(node_);
+	}
+
+	template<class Lhs_, class Rhs_>
+	static constexpr bool _is_valid_expression_operator_args_v =
+	(
+		(EmuMath::TMP::is_emu_vector_expression_v<Lhs_> && (EmuMath::TMP::is_emu_vector_expression_v<Rhs_> || EmuMath::TMP::is_emu_vector_v<Rhs_> || std::is_arithmetic_v<Rhs_>)) ||
+		(std::is_arithmetic_v<Lhs_> && EmuMath::TMP::is_emu_vector_expression_v<Rhs_>)
+	);
+}
+
+namespace EmuMath
+{
+	/// <summary>
+	/// <para> Wraps the passed EmuMath Vector as a lazily-evaluated VectorExpression, allowing chained arithmetic to be calculated in a single pass. </para>
+	/// <para> The passed Vector is referenced rather than copied, and must outlive evaluation of any expression built from the output. </para>
+	/// </summary>
+	/// <param name="vector_">: EmuMath Vector to begin a lazy expression with.</param>
+	/// <returns>VectorExpression reading directly from the passed vector_.</returns>
+	template<std::size_t Size_, typename T_>
+	[[nodiscard]] constexpr inline auto lazy(const EmuMath::Vector<Size_, T_>& vector_)
+	{
+		using node_type = EmuMath::Helpers::_vector_expression_underlying::_expr_vector_leaf<Size_, T_>;
+		return EmuMath::VectorExpression<node_type>(node_type(vector_));
+	}
+
+	template<class Lhs_, class Rhs_, typename = std::enable_if_t<EmuMath::Helpers::_vector_expression_underlying::_is_valid_expression_operator_args_v<Lhs_, Rhs_>>>
+	[[nodiscard]] constexpr inline auto operator+(const Lhs_& lhs_, const Rhs_& rhs_)
+	{
+		return EmuMath::Helpers::_vector_expression_underlying::_make_expression<EmuMath::Helpers::_vector_expression_underlying::_expr_op_add>(lhs_, rhs_);
+	}
+
+	template<class Lhs_, class Rhs_, typename = std::enable_if_t<EmuMath::Helpers::_vector_expression_underlying::_is_valid_expression_operator_args_v<Lhs_, Rhs_>>>
+	[[nodiscard]] constexpr inline auto operator-(const Lhs_& lhs_, const Rhs_& rhs_)
+	{
+		return EmuMath::Helpers::_vector_expression_underlying::_make_expression<EmuMath::Helpers::_vector_expression_underlying::_expr_op_subtract>(lhs_, rhs_);
+	}
+
+	template<class Lhs_, class Rhs_, typename = std::enable_if_t<EmuMath::Helpers::_vector_expression_underlying::_is_valid_expression_operator_args_v<Lhs_, Rhs_>>>
+	[[nodiscard]] constexpr inline auto operator*(const Lhs_& lhs_, const Rhs_& rhs_)
+	{
+		return EmuMath::Helpers::_vector_expression_underlying::_make_expression<EmuMath::Helpers::_vector_expression_underlying::_expr_op_multiply>(lhs_, rhs_);
+	}
+
+	template<class Lhs_, class Rhs_, typename = std::enable_if_t<EmuMath::Helpers::_vector_expression_underlying::_is_valid_expression_operator_args_v<Lhs_, Rhs_>>>
+	[[nodiscard]] constexpr inline auto operator/(const Lhs_& lhs_, const Rhs_& rhs_)
+	{
+		return EmuMath::Helpers::_vector_expression_underlying::_make_expression<EmuMath::Helpers::_vector_expression_underlying::_expr_op_divide>(lhs_, rhs_);
+	}
+}
+
+#endif
@@ -0,0 +1,324 @@
+#ifndef EMU_MATH_VECTOR_SOA_HELPERS_H_INC_
+#define EMU_MATH_VECTOR_SOA_HELPERS_H_INC_ 1
+
+#include "_vector_soa_underlying.h"
+
+// CONTAINS (VectorSoA overloads only):
+// --- add
+// --- subtract
+// --- multiply
+// --- divide
+// --- min
+// --- max
+// --- clamp
+// --- lerp
+// --- dot
+// --- square_magnitude
+// --- magnitude
+// --- normalise
+// --- normalise_fast
+// --- cross_3d
+// --- cmp_near
+// --- cmp_all_near
+
+// Operands named `rhs_`, `b_`, `t_`, `min_`, and `max_` may be any of the following:
+// --- An EmuMath VectorSoA of the same type as the output, where respective components of respective elements are used
+// --- An EmuMath VectorSoA of the same value_type with a size of 1, where the single lane is used for every component of respective elements
+// --- An EmuMath Vector, where each component is used for the respective component of every element
+// --- A scalar convertible to the output value_type, which is used for every component of every element
+// Outputs are resized to the lowest count of all VectorSoA inputs.
+
+namespace EmuMath::Helpers
+{
+#pragma region BASIC_ARITHMETIC_FUNCS
+	/// <summary> Outputs the results of adding lhs_ and rhs_ to the provided out_soa_. out_soa_ may be the same object as an input. </summary>
+	/// <param name="out_soa_">: EmuMath VectorSoA to output to.</param>
+	/// <param name="lhs_">: EmuMath VectorSoA appearing on the left-hand side of addition.</param>
+	/// <param name="rhs_">: VectorSoA, Vector, or scalar appearing on the right-hand side of addition.</param>
+	template<std::size_t Size_, typename T_, class Rhs_>
+	inline void vector_add(EmuMath::VectorSoA<Size_, T_>& out_soa_, const EmuMath::VectorSoA<Size_, T_>& lhs_, const Rhs_& rhs_)
+	{
+		_vector_soa_underlying::_vector_soa_mutate<_vector_soa_underlying::_soa_simd_add>(out_soa_, lhs_, rhs_);
+	}
+	template<std::size_t Size_, typename T_, class Rhs_>
+	[[nodiscard]] inline EmuMath::VectorSoA<Size_, T_> vector_add(const EmuMath::VectorSoA<Size_, T_>& lhs_, const Rhs_& rhs_)
+	{
+		EmuMath::VectorSoA<Size_, T_> out_;
+		vector_add(out_, lhs_, rhs_);
+		return out_;
+	}
+
+	/// <summary> Outputs the results of subtracting rhs_ from lhs_ to the provided out_soa_. out_soa_ may be the same object as an input. </summary>
+	/// <param name="out_soa_">: EmuMath VectorSoA to output to.</param>
+	/// <param name="lhs_">: EmuMath VectorSoA appearing on the left-hand side of subtraction.</param>
+	/// <param name="rhs_">: VectorSoA, Vector, or scalar appearing on the right-hand side of subtraction.</param>
+	template<std::size_t Size_, typename T_, class Rhs_>
+	inline void vector_subtract(EmuMath::VectorSoA<Size_, T_>& out_soa_, const EmuMath::VectorSoA<Size_, T_>& lhs_, const Rhs_& rhs_)
+	{
+		_vector_soa_underlying::_vector_soa_mutate<_vector_soa_underlying::_soa_simd_sub>(out_soa_, lhs_, rhs_);
+	}
+	template<std::size_t Size_, typename T_, class Rhs_>
+	[[nodiscard]] inline EmuMath::VectorSoA<Size_, T_> vector_subtract(const EmuMath::VectorSoA<Size_, T_>& lhs_, const Rhs_& rhs_)
+	{
+		EmuMath::VectorSoA<Size_, T_> out_;
+		vector_subtract(out_, lhs_, rhs_);
+		return out_;
+	}
+
+	/// <summary> Outputs the results of multiplying lhs_ by rhs_ to the provided out_soa_. out_soa_ may be the same object as an input. </summary>
+	/// <param name="out_soa_">: EmuMath VectorSoA to output to.</param>
+	/// <param name="lhs_">: EmuMath VectorSoA appearing on the left-hand side of multiplication.</param>
+	/// <param name="rhs_">: VectorSoA, Vector, or scalar appearing on the right-hand side of multiplication.</param>
+	template<std::size_t Size_, typename T_, class Rhs_>
+	inline void vector_multiply(EmuMath::VectorSoA<Size_, T_>& out_soa_, const EmuMath::VectorSoA<Size_, T_>& lhs_, const Rhs_& rhs_)
+	{
+		_vector_soa_underlying::_vector_soa_mutate<_vector_soa_underlying::_soa_simd_mul>(out_soa_, lhs_, rhs_);
+	}
+	template<std::size_t Size_, typename T_, class Rhs_>
+	[[nodiscard]] inline EmuMath::VectorSoA<Size_, T_> vector_multiply(const EmuMath::VectorSoA<Size_, T_>& lhs_, const Rhs_& rhs_)
+	{
+		EmuMath::VectorSoA<Size_, T_> out_;
+		vector_multiply(out_, lhs_, rhs_);
+		return out_;
+	}
+
+	/// <summary> Outputs the results of dividing lhs_ by rhs_ to the provided out_soa_. out_soa_ may be the same object as an input. </summary>
+	/// <param name="out_soa_">: EmuMath VectorSoA to output to.</param>
+	/// <param name="lhs_">: EmuMath VectorSoA appearing on the left-hand side of division.</param>
+	/// <param name="rhs_">: VectorSoA, Vector, or scalar appearing on the right-hand side of division.</param>
+	template<std::size_t Size_, typename T_, class Rhs_>
+	inline void vector_divide(EmuMath::VectorSoA<Size_, T_>& out_soa_, const EmuMath::VectorSoA<Size_, T_>& lhs_, const Rhs_& rhs_)
+	{
+		_vector_soa_underlying::_vector_soa_mutate<_vector_soa_underlying::_soa_simd_div>(out_soa_, lhs_, rhs_);
+	}
+	template<std::size_t Size_, typename T_, class Rhs_>
+	[[nodiscard]] inline EmuMath::VectorSoA<Size_, T_> vector_divide(const EmuMath::VectorSoA<Size_, T_>& lhs_, const Rhs_& rhs_)
+	{
+		EmuMath::VectorSoA<Size_, T_> out_;
+		vector_divide(out_, lhs_, rhs_);
+		return out_;
+	}
+#pragma endregion
+
+#pragma region MISC_ARITHMETIC_FUNCS
+	/// <summary> Outputs the lowest of respective components in lhs_ and rhs_ to the provided out_soa_. out_soa_ may be the same object as an input. </summary>
+	/// <param name="out_soa_">: EmuMath VectorSoA to output to.</param>
+	/// <param name="lhs_">: EmuMath VectorSoA to compare.</param>
+	/// <param name="rhs_">: VectorSoA, Vector, or scalar to compare.</param>
+	template<std::size_t Size_, typename T_, class Rhs_>
+	inline void vector_min(EmuMath::VectorSoA<Size_, T_>& out_soa_, const EmuMath::VectorSoA<Size_, T_>& lhs_, const Rhs_& rhs_)
+	{
+		_vector_soa_underlying::_vector_soa_mutate<_vector_soa_underlying::_soa_simd_min>(out_soa_, lhs_, rhs_);
+	}
+	template<std::size_t Size_, typename T_, class Rhs_>
+	[[nodiscard]] inline EmuMath::VectorSoA<Size_, T_> vector_min(const EmuMath::VectorSoA<Size_, T_>& lhs_, const Rhs_& rhs_)
+	{
+		EmuMath::VectorSoA<Size_, T_> out_;
+		vector_min(out_, lhs_, rhs_);
+		return out_;
+	}
+
+	/// <summary> Outputs the greatest of respective components in lhs_ and rhs_ to the provided out_soa_. out_soa_ may be the same object as an input. </summary>
+	/// <param name="out_soa_">: EmuMath VectorSoA to output to.</param>
+	/// <param name="lhs_">: EmuMath VectorSoA to compare.</param>
+	/// <param name="rhs_">: VectorSoA, Vector, or scalar to compare.</param>
+	template<std::size_t Size_, typename T_, class Rhs_>
+	inline void vector_max(EmuMath::VectorSoA<Size_, T_>& out_soa_, const EmuMath::VectorSoA<Size_, T_>& lhs_, const Rhs_& rhs_)
+	{
+		_vector_soa_underlying::_vector_soa_mutate<_vector_soa_underlying::_soa_simd_max>(out_soa_, lhs_, rhs_);
+	}
+	template<std::size_t Size_, typename T_, class Rhs_>
+	[[nodiscard]] inline EmuMath::VectorSoA<Size_, T_> vector_max(const EmuMath::VectorSoA<Size_, T_>& lhs_, const Rhs_& rhs_)
+	{
+		EmuMath::VectorSoA<Size_, T_> out_;
+		vector_max(out_, lhs_, rhs_);
+		return out_;
+	}
+
+	/// <summary> Outputs the components of in_soa_ clamped into the inclusive range min_:max_ to the provided out_soa_. out_soa_ may be the same object as an input. </summary>
+	/// <param name="out_soa_">: EmuMath VectorSoA to output to.</param>
+	/// <param name="in_soa_">: EmuMath VectorSoA to clamp.</param>
+	/// <param name="min_">: VectorSoA, Vector, or scalar used as the inclusive lower bound.</param>
+	/// <param name="max_">: VectorSoA, Vector, or scalar used as the inclusive upper bound.</param>
+	template<std::size_t Size_, typename T_, class Min_, class Max_>
+	inline void vector_clamp(EmuMath::VectorSoA<Size_, T_>& out_soa_, const EmuMath::VectorSoA<Size_, T_>& in_soa_, const Min_& min_, const Max_& max_)
+	{
+		_vector_soa_underlying::_vector_soa_clamp(out_soa_, in_soa_, min_, max_);
+	}
+	template<std::size_t Size_, typename T_, class Min_, class Max_>
+	[[nodiscard]] inline EmuMath::VectorSoA<Size_, T_> vector_clamp(const EmuMath::VectorSoA<Size_, T_>& in_soa_, const Min_& min_, const Max_& max_)
+	{
+		EmuMath::VectorSoA<Size_, T_> out_;
+		vector_clamp(out_, in_soa_, min_, max_);
+		return out_;
+	}
+
+	/// <summary>
+	/// <para> Outputs the results of linearly interpolating soa_a_ toward b_ using weightings t_, in the form `a + ((b - a) * t)`, to the provided out_soa_. </para>
+	/// <para> out_soa_ may be the same object as an input. </para>
+	/// </summary>
+	/// <param name="out_soa_">: EmuMath VectorSoA to output to.</param>
+	/// <param name="soa_a_">: EmuMath VectorSoA used as the starting points of interpolation.</param>
+	/// <param name="b_">: VectorSoA, Vector, or scalar used as the target points of interpolation.</param>
+	/// <param name="t_">: VectorSoA, Vector, or scalar used as the weightings of interpolation.</param>
+	template<std::size_t Size_, typename T_, class B_, class Weighting_>
+	inline void vector_lerp(EmuMath::VectorSoA<Size_, T_>& out_soa_, const EmuMath::VectorSoA<Size_, T_>& soa_a_, const B_& b_, const Weighting_& t_)
+	{
+		_vector_soa_underlying::_vector_soa_lerp(out_soa_, soa_a_, b_, t_);
+	}
+	template<std::size_t Size_, typename T_, class B_, class Weighting_>
+	[[nodiscard]] inline EmuMath::VectorSoA<Size_, T_> vector_lerp(const EmuMath::VectorSoA<Size_, T_>& soa_a_, const B_& b_, const Weighting_& t_)
+	{
+		EmuMath::VectorSoA<Size_, T_> out_;
+		vector_lerp(out_, soa_a_, b_, t_);
+		return out_;
+	}
+#pragma endregion
+
+#pragma region SPECIAL_OPERATION_FUNCS
+	/// <summary> Outputs the dot product of respective Vectors in soa_a_ and soa_b_ to the single lane of the provided out_soa_. </summary>
+	/// <param name="out_soa_">: Single-lane EmuMath VectorSoA to output dot products to.</param>
+	/// <param name="soa_a_">: EmuMath VectorSoA containing Vectors `a` for finding dot products.</param>
+	/// <param name="soa_b_">: EmuMath VectorSoA containing Vectors `b` for finding dot products.</param>
+	template<std::size_t Size_, typename T_>
+	inline void vector_dot(EmuMath::VectorSoA<1, T_>& out_soa_, const EmuMath::VectorSoA<Size_, T_>& soa_a_, const EmuMath::VectorSoA<Size_, T_>& soa_b_)
+	{
+		_vector_soa_underlying::_vector_soa_dot<false>(out_soa_, soa_a_, soa_b_);
+	}
+	template<std::size_t Size_, typename T_>
+	[[nodiscard]] inline EmuMath::VectorSoA<1, T_> vector_dot(const EmuMath::VectorSoA<Size_, T_>& soa_a_, const EmuMath::VectorSoA<Size_, T_>& soa_b_)
+	{
+		EmuMath::VectorSoA<1, T_> out_;
+		vector_dot(out_, soa_a_, soa_b_);
+		return out_;
+	}
+
+	/// <summary> Outputs the squared magnitude of every Vector in in_soa_ to the single lane of the provided out_soa_. </summary>
+	/// <param name="out_soa_">: Single-lane EmuMath VectorSoA to output squared magnitudes to.</param>
+	/// <param name="in_soa_">: EmuMath VectorSoA to calculate the squared magnitudes of.</param>
+	template<std::size_t Size_, typename T_>
+	inline void vector_square_magnitude(EmuMath::VectorSoA<1, T_>& out_soa_, const EmuMath::VectorSoA<Size_, T_>& in_soa_)
+	{
+		_vector_soa_underlying::_vector_soa_dot<false>(out_soa_, in_soa_, in_soa_);
+	}
+	template<std::size_t Size_, typename T_>
+	[[nodiscard]] inline EmuMath::VectorSoA<1, T_> vector_square_magnitude(const EmuMath::VectorSoA<Size_, T_>& in_soa_)
+	{
+		EmuMath::VectorSoA<1, T_> out_;
+		vector_square_magnitude(out_, in_soa_);
+		return out_;
+	}
+
+	/// <summary> Outputs the magnitude of every Vector in in_soa_ to the single lane of the provided out_soa_. </summary>
+	/// <param name="out_soa_">: Single-lane EmuMath VectorSoA to output magnitudes to.</param>
+	/// <param name="in_soa_">: EmuMath VectorSoA to calculate the magnitudes of.</param>
+	template<std::size_t Size_, typename T_>
+	inline void vector_magnitude(EmuMath::VectorSoA<1, T_>& out_soa_, const EmuMath::VectorSoA<Size_, T_>& in_soa_)
+	{
+		_vector_soa_underlying::_vector_soa_dot<true>(out_soa_, in_soa_, in_soa_);
+	}
+	template<std::size_t Size_, typename T_>
+	[[nodiscard]] inline EmuMath::VectorSoA<1, T_> vector_magnitude(const EmuMath::VectorSoA<Size_, T_>& in_soa_)
+	{
+		EmuMath::VectorSoA<1, T_> out_;
+		vector_magnitude(out_, in_soa_);
+		return out_;
+	}
+
+	/// <summary>
+	/// <para> Outputs the normalised form of every Vector in in_soa_ to the provided out_soa_. out_soa_ may be the same object as in_soa_. </para>
+	/// <para> As with EmuMath Vectors, no check is made for zero-length Vectors, which will produce non-finite results. </para>
+	/// </summary>
+	/// <param name="out_soa_">: EmuMath VectorSoA to output to.</param>
+	/// <param name="in_soa_">: EmuMath VectorSoA to calculate the normalised forms of.</param>
+	template<std::size_t Size_, typename T_>
+	inline void vector_normalise(EmuMath::VectorSoA<Size_, T_>& out_soa_, const EmuMath::VectorSoA<Size_, T_>& in_soa_)
+	{
+		_vector_soa_underlying::_vector_soa_normalise<false>(out_soa_, in_soa_);
+	}
+	template<std::size_t Size_, typename T_>
+	[[nodiscard]] inline EmuMath::VectorSoA<Size_, T_> vector_normalise(const EmuMath::VectorSoA<Size_, T_>& in_soa_)
+	{
+		EmuMath::VectorSoA<Size_, T_> out_;
+		vector_normalise(out_, in_soa_);
+		return out_;
+	}
+
+	/// <summary>
+	/// <para> Outputs an approximately normalised form of every Vector in in_soa_ to the provided out_soa_. out_soa_ may be the same object as in_soa_. </para>
+	/// <para> Components are multiplied by a reciprocal square root of each square magnitude. For float VectorSoAs this has a relative error of roughly 1e-4 or better. </para>
+	/// </summary>
+	/// <param name="out_soa_">: EmuMath VectorSoA to output to.</param>
+	/// <param name="in_soa_">: EmuMath VectorSoA to calculate the normalised forms of.</param>
+	template<std::size_t Size_, typename T_>
+	inline void vector_normalise_fast(EmuMath::VectorSoA<Size_, T_>& out_soa_, const EmuMath::VectorSoA<Size_, T_>& in_soa_)
+	{
+		_vector_soa_underlying::_vector_soa_normalise<true>(out_soa_, in_soa_);
+	}
+	template<std::size_t Size_, typename T_>
+	[[nodiscard]] inline EmuMath::VectorSoA<Size_, T_> vector_normalise_fast(const EmuMath::VectorSoA<Size_, T_>& in_soa_)
+	{
+		EmuMath::VectorSoA<Size_, T_> out_;
+		vector_normalise_fast(out_, in_soa_);
+		return out_;
+	}
+
+	/// <summary> Outputs the 3D cross product of respective Vectors in soa_a_ and soa_b_ to the provided out_soa_. out_soa_ may be the same object as an input. </summary>
+	/// <param name="out_soa_">: 3-lane EmuMath VectorSoA to output to.</param>
+	/// <param name="soa_a_">: 3-lane EmuMath VectorSoA appearing as `a_` in the cross products.</param>
+	/// <param name="soa_b_">: 3-lane EmuMath VectorSoA appearing as `b_` in the cross products.</param>
+	template<typename T_>
+	inline void vector_cross_3d(EmuMath::VectorSoA<3, T_>& out_soa_, const EmuMath::VectorSoA<3, T_>& soa_a_, const EmuMath::VectorSoA<3, T_>& soa_b_)
+	{
+		_vector_soa_underlying::_vector_soa_cross_3d(out_soa_, soa_a_, soa_b_);
+	}
+	template<typename T_>
+	[[nodiscard]] inline EmuMath::VectorSoA<3, T_> vector_cross_3d(const EmuMath::VectorSoA<3, T_>& soa_a_, const EmuMath::VectorSoA<3, T_>& soa_b_)
+	{
+		EmuMath::VectorSoA<3, T_> out_;
+		vector_cross_3d(out_, soa_a_, soa_b_);
+		return out_;
+	}
+#pragma endregion
+
+#pragma region CMP_NEAR_FUNCS
+	/// <summary>
+	/// <para> Returns true if every component of every Vector in lhs_ is near-equal to the respective component of rhs_, intended for safer floating-point equality checks. </para>
+	/// <para> If epsilon_ is not provided, the machine epsilon of the VectorSoA's value_type is used, matching EmuMath Vector near-comparisons. </para>
+	/// </summary>
+	/// <param name="lhs_">: EmuMath VectorSoA appearing on the left of comparison.</param>
+	/// <param name="rhs_">: VectorSoA, Vector, or scalar appearing on the right of comparison.</param>
+	/// <param name="epsilon_">: Maximum absolute difference for two components to be considered near-equal.</param>
+	/// <returns>True if all compared components are near-equal, otherwise false.</returns>
+	template<std::size_t Size_, typename T_, class Rhs_>
+	[[nodiscard]] inline bool vector_cmp_all_near(const EmuMath::VectorSoA<Size_, T_>& lhs_, const Rhs_& rhs_, typename EmuMath::VectorSoA<Size_, T_>::value_type epsilon_)
+	{
+		return _vector_soa_underlying::_vector_soa_cmp_all_near(lhs_, rhs_, epsilon_);
+	}
+	template<std::size_t Size_, typename T_, class Rhs_>
+	[[nodiscard]] inline bool vector_cmp_all_near(const EmuMath::VectorSoA<Size_, T_>& lhs_, const Rhs_& rhs_)
+	{
+		return _vector_soa_underlying::_vector_soa_cmp_all_near(lhs_, rhs_, EmuCore::epsilon<T_>::get());
+	}
+
+	/// <summary>
+	/// <para> Returns true if every component of every Vector in lhs_ is near-equal to the respective component of rhs_. Equivalent to vector_cmp_all_near. </para>
+	/// <para> Unlike its EmuMath Vector counterpart, a scalar rhs_ is compared per-component rather than with magnitudes. </para>
+	/// </summary>
+	/// <param name="lhs_">: EmuMath VectorSoA appearing on the left of comparison.</param>
+	/// <param name="rhs_">: VectorSoA, Vector, or scalar appearing on the right of comparison.</param>
+	/// <returns>True if all compared components are near-equal, otherwise false.</returns>
+	template<std::size_t Size_, typename T_, class Rhs_>
+	[[nodiscard]] inline bool vector_cmp_near(const EmuMath::VectorSoA<Size_, T_>& lhs_, const Rhs_& rhs_)
+	{
+		return vector_cmp_all_near(lhs_, rhs_);
+	}
+	template<std::size_t Size_, typename T_, class Rhs_>
+	[[nodiscard]] inline bool vector_cmp_near(const EmuMath::VectorSoA<Size_, T_>& lhs_, const Rhs_& rhs_, typename EmuMath::VectorSoA<Size_, T_>::value_type epsilon_)
+	{
+		return vector_cmp_all_near(lhs_, rhs_, epsilon_);
+	}
+#pragma endregion
+}
+
+#endif
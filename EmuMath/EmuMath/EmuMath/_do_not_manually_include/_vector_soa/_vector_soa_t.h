@@ -0,0 +1,418 @@
+#ifndef EMU_MATH_VECTOR_SOA_T_H_INC_
+#define EMU_MATH_VECTOR_SOA_T_H_INC_ 1
+
+#include "../_vectors/_vector_t.h"
+#include "../../../EmuSIMD/SIMDHelpers.h"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace EmuMath
+{
+	/// <summary>
+	/// <para> Structure-of-arrays container of EmuMath Vectors, storing each component of its Vectors in its own contiguous lane. </para>
+	/// <para>
+	///		All lanes are aligned to `lane_alignment` bytes and padded to a multiple of `elements_per_block` elements,
+	///		allowing bulk helpers (such as the VectorSoA overloads of `vector_add` or `vector_normalise`) to process full SIMD registers without any scalar tail.
+	///		Padding elements beyond `Count()` are not considered part of the container, and their values are unspecified.
+	/// </para>
+	/// <para> Conversion to and from contiguous arrays of EmuMath Vectors is provided via `GatherFrom` and `ScatterTo`, allowing existing code to adopt this container incrementally. </para>
+	/// <para> Only float and double T_ arguments are valid. </para>
+	/// </summary>
+	/// <typeparam name="Size_">Number of components in each contained Vector, and thus number of lanes stored.</typeparam>
+	/// <typeparam name="T_">Floating-point type of each component.</typeparam>
+	template<std::size_t Size_, typename T_>
+	class VectorSoA
+	{
+#pragma region COMMON_STATIC_INFO
+	public:
+		using this_type = VectorSoA<Size_, T_>;
+		using value_type = T_;
+		using vector_type = EmuMath::Vector<Size_, T_>;
+
+		static constexpr std::size_t size = Size_;
+		static constexpr std::size_t element_width = sizeof(value_type) * CHAR_BIT;
+
+		[[nodiscard]] static constexpr inline bool is_valid()
+		{
+			return size != 0 && (std::is_same_v<value_type, float> || std::is_same_v<value_type, double>);
+		}
+
+		static_assert
+		(
+			is_valid(),
+			"Invalid EmuMath::VectorSoA instantiation: Size_ must be greater than 0, and T_ must be float or double."
+		);
+
+		/// <summary> SIMD register type used by bulk VectorSoA helpers to process this container's lanes. </summary>
+		using register_type = EmuSIMD::TMP::register_type_t<value_type, 256>;
+
+		/// <summary> Number of elements of a single lane contained within a register_type. </summary>
+		static constexpr std::size_t elements_per_register = 256 / element_width;
+
+		/// <summary> Byte alignment of the start of every lane. </summary>
+		static constexpr std::size_t lane_alignment = 64;
+
+		/// <summary>
+		/// <para> Number of elements that bulk helpers process in a single iteration, equal to 2 registers (16 floats or 8 doubles). </para>
+		/// <para> Lane capacities are always a multiple of this value. </para>
+		/// </summary>
+		static constexpr std::size_t elements_per_block = lane_alignment / sizeof(value_type);
+#pragma endregion
+
+#pragma region CONSTRUCTORS
+	public:
+		/// <summary> Constructs an empty VectorSoA without allocating. </summary>
+		inline VectorSoA() noexcept : p_data_(nullptr), count_(0), capacity_(0)
+		{
+		}
+
+		/// <summary> Constructs a VectorSoA containing count_ Vectors with all components set to 0. </summary>
+		/// <param name="count_">: Number of Vectors to contain.</param>
+		explicit inline VectorSoA(std::size_t count_) : VectorSoA()
+		{
+			Resize(count_);
+		}
+
+		/// <summary> Constructs a VectorSoA containing count_ copies of the passed fill_vector_. </summary>
+		/// <param name="count_">: Number of Vectors to contain.</param>
+		/// <param name="fill_vector_">: EmuMath Vector to copy into every element.</param>
+		template<typename InT_>
+		inline VectorSoA(std::size_t count_, const EmuMath::Vector<Size_, InT_>& fill_vector_) : VectorSoA()
+		{
+			Resize(count_);
+			_fill_lanes(fill_vector_, std::make_index_sequence<size>());
+		}
+
+		/// <summary> Constructs a VectorSoA by gathering the count_ contiguous EmuMath Vectors pointed to by p_vectors_. </summary>
+		/// <param name="p_vectors_">: Pointer to the first of count_ contiguous EmuMath Vectors to gather.</param>
+		/// <param name="count_">: Number of Vectors to gather.</param>
+		template<typename InT_>
+		inline VectorSoA(const EmuMath::Vector<Size_, InT_>* p_vectors_, std::size_t count_) : VectorSoA()
+		{
+			GatherFrom(p_vectors_, count_);
+		}
+
+		inline VectorSoA(const this_type& to_copy_) : VectorSoA()
+		{
+			_copy_from(to_copy_);
+		}
+
+		inline VectorSoA(this_type&& to_move_) noexcept : p_data_(to_move_.p_data_), count_(to_move_.count_), capacity_(to_move_.capacity_)
+		{
+			to_move_.p_data_ = nullptr;
+			to_move_.count_ = 0;
+			to_move_.capacity_ = 0;
+		}
+
+		inline ~VectorSoA()
+		{
+			_deallocate(p_data_);
+		}
+#pragma endregion
+
+#pragma region ASSIGNMENT
+	public:
+		inline this_type& operator=(const this_type& to_copy_)
+		{
+			if (this != &to_copy_)
+			{
+				_copy_from(to_copy_);
+			}
+			return *this;
+		}
+
+		inline this_type& operator=(this_type&& to_move_) noexcept
+		{
+			if (this != &to_move_)
+			{
+				_deallocate(p_data_);
+				p_data_ = to_move_.p_data_;
+				count_ = to_move_.count_;
+				capacity_ = to_move_.capacity_;
+				to_move_.p_data_ = nullptr;
+				to_move_.count_ = 0;
+				to_move_.capacity_ = 0;
+			}
+			return *this;
+		}
+#pragma endregion
+
+#pragma region SIZE_FUNCS
+	public:
+		/// <summary> Returns the number of Vectors contained within this VectorSoA. </summary>
+		[[nodiscard]] inline std::size_t Count() const noexcept
+		{
+			return count_;
+		}
+
+		/// <summary> Returns the number of Vectors this VectorSoA may contain before it must reallocate. </summary>
+		[[nodiscard]] inline std::size_t Capacity() const noexcept
+		{
+			return capacity_;
+		}
+
+		/// <summary>
+		/// <para> Returns Count() rounded up to the next multiple of elements_per_block. </para>
+		/// <para> All indices below this value are safe to read and write via aligned SIMD loads and stores in every lane. </para>
+		/// </summary>
+		[[nodiscard]] inline std::size_t PaddedCount() const noexcept
+		{
+			return _round_to_block(count_);
+		}
+
+		[[nodiscard]] inline bool Empty() const noexcept
+		{
+			return count_ == 0;
+		}
+
+		/// <summary> Ensures that this VectorSoA has capacity for at least min_capacity_ Vectors, reallocating if needed. </summary>
+		/// <param name="min_capacity_">: Minimum number of Vectors that this VectorSoA should be able to contain without reallocating.</param>
+		inline void Reserve(std::size_t min_capacity_)
+		{
+			if (min_capacity_ > capacity_)
+			{
+				_reallocate(_round_to_block(min_capacity_));
+			}
+		}
+
+		/// <summary>
+		/// <para> Resizes this VectorSoA to contain new_count_ Vectors. </para>
+		/// <para> If new_count_ is greater than the current count, all new Vectors will have all components set to 0. </para>
+		/// </summary>
+		/// <param name="new_count_">: Number of Vectors that this VectorSoA should contain.</param>
+		inline void Resize(std::size_t new_count_)
+		{
+			if (new_count_ > capacity_)
+			{
+				// Grow geometrically to keep repeated PushBack calls amortised
+				std::size_t new_capacity_ = capacity_ + (capacity_ / 2);
+				_reallocate(_round_to_block(new_capacity_ > new_count_ ? new_capacity_ : new_count_));
+			}
+
+			if (new_count_ > count_)
+			{
+				const std::size_t zero_count_ = _round_to_block(new_count_) - count_;
+				for (std::size_t lane_ = 0; lane_ < size; ++lane_)
+				{
+					std::memset(_lane_ptr(lane_) + count_, 0, zero_count_ * sizeof(value_type));
+				}
+			}
+			count_ = new_count_;
+		}
+
+		/// <summary> Removes all Vectors from this VectorSoA, without releasing its allocated capacity. </summary>
+		inline void Clear() noexcept
+		{
+			count_ = 0;
+		}
+#pragma endregion
+
+#pragma region ACCESS
+	public:
+		/// <summary>
+		/// <para> Provides a pointer to the contiguous lane of the specified Component_ (e.g. 0 for all x-components) within this VectorSoA. </para>
+		/// <para> The pointer is aligned to lane_alignment bytes, and may be accessed up to PaddedCount() elements. </para>
+		/// </summary>
+		/// <returns>Pointer to the first element of the specified Component_'s lane.</returns>
+		template<std::size_t Component_>
+		[[nodiscard]] inline value_type* Lane() noexcept
+		{
+			if constexpr (Component_ < size)
+			{
+				return _lane_ptr(Component_);
+			}
+			else
+			{
+				static_assert(EmuCore::TMP::get_false<std::size_t, Component_>(), "Attempted to access a lane of an EmuMath VectorSoA via its template `Lane<Component_>` member, but the provided Component_ was invalid. Valid components are in the inclusive range 0:size-1.");
+			}
+		}
+		template<std::size_t Component_>
+		[[nodiscard]] inline const value_type* Lane() const noexcept
+		{
+			return const_cast<this_type*>(this)->template Lane<Component_>();
+		}
+
+		/// <summary>
+		/// <para> Provides a pointer to the contiguous lane of the specified component_ within this VectorSoA. No bounds checks are performed. </para>
+		/// <para> The pointer is aligned to lane_alignment bytes, and may be accessed up to PaddedCount() elements. </para>
+		/// </summary>
+		/// <param name="component_">: Index of the component to retrieve the lane of, in the inclusive range 0:size-1.</param>
+		/// <returns>Pointer to the first element of the specified component_'s lane.</returns>
+		[[nodiscard]] inline value_type* Lane(std::size_t component_) noexcept
+		{
+			return _lane_ptr(component_);
+		}
+		[[nodiscard]] inline const value_type* Lane(std::size_t component_) const noexcept
+		{
+			return _lane_ptr(component_);
+		}
+
+		/// <summary> Gathers the Vector at the provided index_ within this VectorSoA. No bounds checks are performed. </summary>
+		/// <param name="index_">: Index of the Vector to retrieve.</param>
+		/// <returns>EmuMath Vector containing respective components of the Vector at the provided index_.</returns>
+		[[nodiscard]] inline vector_type At(std::size_t index_) const
+		{
+			return _gather_one(index_, std::make_index_sequence<size>());
+		}
+
+		/// <summary> Scatters the passed Vector's components to the provided index_ within this VectorSoA. No bounds checks are performed. </summary>
+		/// <param name="index_">: Index of the Vector to set.</param>
+		/// <param name="to_set_">: EmuMath Vector to copy the components of.</param>
+		template<typename InT_>
+		inline void Set(std::size_t index_, const EmuMath::Vector<Size_, InT_>& to_set_)
+		{
+			_scatter_one(index_, to_set_, std::make_index_sequence<size>());
+		}
+
+		/// <summary> Appends a copy of the passed Vector to the end of this VectorSoA. </summary>
+		/// <param name="to_push_">: EmuMath Vector to append.</param>
+		template<typename InT_>
+		inline void PushBack(const EmuMath::Vector<Size_, InT_>& to_push_)
+		{
+			const std::size_t index_ = count_;
+			Resize(count_ + 1);
+			Set(index_, to_push_);
+		}
+#pragma endregion
+
+#pragma region CONVERSIONS
+	public:
+		/// <summary>
+		/// <para> Replaces the contents of this VectorSoA with the count_ contiguous EmuMath Vectors pointed to by p_vectors_. </para>
+		/// <para> Components are converted to this VectorSoA's value_type via static_cast. </para>
+		/// </summary>
+		/// <param name="p_vectors_">: Pointer to the first of count_ contiguous EmuMath Vectors to gather.</param>
+		/// <param name="count_">: Number of Vectors to gather.</param>
+		template<typename InT_>
+		inline void GatherFrom(const EmuMath::Vector<Size_, InT_>* p_vectors_, std::size_t count_)
+		{
+			Resize(count_);
+			for (std::size_t i_ = 0; i_ < count_; ++i_)
+			{
+				_scatter_one(i_, p_vectors_[i_], std::make_index_sequence<size>());
+			}
+		}
+
+		/// <summary>
+		/// <para> Outputs every Vector contained within this VectorSoA to the contiguous EmuMath Vectors pointed to by p_out_vectors_. </para>
+		/// <para> The pointed-to memory must have space for at least Count() Vectors. </para>
+		/// </summary>
+		/// <param name="p_out_vectors_">: Pointer to the first of Count() contiguous EmuMath Vectors to output to.</param>
+		template<typename OutT_>
+		inline void ScatterTo(EmuMath::Vector<Size_, OutT_>* p_out_vectors_) const
+		{
+			for (std::size_t i_ = 0; i_ < count_; ++i_)
+			{
+				_copy_one_to(i_, p_out_vectors_[i_], std::make_index_sequence<size>());
+			}
+		}
+
+		/// <summary> Creates a std::vector of EmuMath Vectors containing every Vector in this VectorSoA, in order. </summary>
+		/// <returns>std::vector of EmuMath Vectors containing the same Vectors as this VectorSoA.</returns>
+		[[nodiscard]] inline std::vector<vector_type> ToVectors() const
+		{
+			std::vector<vector_type> out_(count_);
+			ScatterTo(out_.data());
+			return out_;
+		}
+#pragma endregion
+
+	private:
+		[[nodiscard]] static constexpr inline std::size_t _round_to_block(std::size_t count_)
+		{
+			return ((count_ + elements_per_block - 1) / elements_per_block) * elements_per_block;
+		}
+
+		[[nodiscard]] inline value_type* _lane_ptr(std::size_t component_) const noexcept
+		{
+			return p_data_ + (component_ * capacity_);
+		}
+
+		[[nodiscard]] static inline value_type* _allocate(std::size_t capacity_)
+		{
+			const std::size_t num_bytes_ = capacity_ * size * sizeof(value_type);
+			return static_cast<value_type*>(::operator new(num_bytes_, std::align_val_t(lane_alignment)));
+		}
+
+		static inline void _deallocate(value_type* p_data_) noexcept
+		{
+			if (p_data_ != nullptr)
+			{
+				::operator delete(p_data_, std::align_val_t(lane_alignment));
+			}
+		}
+
+		inline void _reallocate(std::size_t new_capacity_)
+		{
+			value_type* p_new_data_ = _allocate(new_capacity_);
+			const std::size_t copy_count_ = _round_to_block(count_);
+			for (std::size_t lane_ = 0; lane_ < size; ++lane_)
+			{
+				if (copy_count_ != 0)
+				{
+					std::memcpy(p_new_data_ + (lane_ * new_capacity_), _lane_ptr(lane_), copy_count_ * sizeof(value_type));
+				}
+			}
+			_deallocate(p_data_);
+			p_data_ = p_new_data_;
+			capacity_ = new_capacity_;
+		}
+
+		inline void _copy_from(const this_type& to_copy_)
+		{
+			count_ = 0;
+			Reserve(to_copy_.count_);
+			const std::size_t copy_count_ = to_copy_.PaddedCount();
+			for (std::size_t lane_ = 0; lane_ < size; ++lane_)
+			{
+				if (copy_count_ != 0)
+				{
+					std::memcpy(_lane_ptr(lane_), to_copy_._lane_ptr(lane_), copy_count_ * sizeof(value_type));
+				}
+			}
+			count_ = to_copy_.count_;
+		}
+
+		template<typename InT_, std::size_t...Components_>
+		inline void _fill_lanes(const EmuMath::Vector<Size_, InT_>& fill_vector_, std::index_sequence<Components_...>)
+		{
+			(
+				std::fill
+				(
+					_lane_ptr(Components_),
+					_lane_ptr(Components_) + count_,
+					static_cast<value_type>(fill_vector_.template at<Components_>())
+				), ...
+			);
+		}
+
+		template<std::size_t...Components_>
+		[[nodiscard]] inline vector_type _gather_one(std::size_t index_, std::index_sequence<Components_...>) const
+		{
+			return vector_type(_lane_ptr(Components_)[index_]...);
+		}
+
+		template<typename InT_, std::size_t...Components_>
+		inline void _scatter_one(std::size_t index_, const EmuMath::Vector<Size_, InT_>& in_, std::index_sequence<Components_...>)
+		{
+			((_lane_ptr(Components_)[index_] = static_cast<value_type>(in_.template at<Components_>())), ...);
+		}
+
+		template<typename OutT_, std::size_t...Components_>
+		inline void _copy_one_to(std::size_t index_, EmuMath::Vector<Size_, OutT_>& out_, std::index_sequence<Components_...>) const
+		{
+			((out_.template at<Components_>() = static_cast<OutT_>(_lane_ptr(Components_)[index_])), ...);
+		}
+
+		value_type* p_data_;
+		std::size_t count_;
+		std::size_t capacity_;
+	};
+}
+
+#endif
@@ -0,0 +1,456 @@
+#ifndef EMU_MATH_VECTOR_SOA_UNDERLYING_H_INC_
+#define EMU_MATH_VECTOR_SOA_UNDERLYING_H_INC_ 1
+
+#include "_vector_soa_t.h"
+#include "../../../EmuCore/ArithmeticHelpers/CommonMath.h"
+#include "../../../EmuSIMD/SIMDHelpers.h"
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace EmuMath::TMP
+{
+	template<class T_>
+	struct is_emu_vector_soa
+	{
+		static constexpr bool value = std::conditional_t
+		<
+			std::is_same_v<T_, EmuCore::TMP::remove_ref_cv_t<T_>>,
+			std::false_type,
+			is_emu_vector_soa<EmuCore::TMP::remove_ref_cv_t<T_>>
+		>::value;
+	};
+	template<std::size_t Size_, typename T_>
+	struct is_emu_vector_soa<EmuMath::VectorSoA<Size_, T_>>
+	{
+		static constexpr bool value = true;
+	};
+	template<class T_>
+	static constexpr bool is_emu_vector_soa_v = is_emu_vector_soa<T_>::value;
+}
+
+namespace EmuMath::Helpers::_vector_soa_underlying
+{
+#pragma region OPERANDS
+	/// <summary>
+	/// <para> Reads registers from the lanes of a VectorSoA. </para>
+	/// <para> If the read VectorSoA only has 1 lane, that lane is used for every component, allowing per-element scalars to be applied to all components. </para>
+	/// </summary>
+	template<class Register_, std::size_t Size_, typename T_>
+	struct _soa_lanes_operand
+	{
+		explicit inline _soa_lanes_operand(const EmuMath::VectorSoA<Size_, T_>& soa_) : p_lanes()
+		{
+			for (std::size_t component_ = 0; component_ < Size_; ++component_)
+			{
+				p_lanes[component_] = soa_.Lane(component_);
+			}
+		}
+
+		[[nodiscard]] inline Register_ Get(std::size_t component_, std::size_t index_) const
+		{
+			if constexpr (Size_ == 1)
+			{
+				return EmuSIMD::load<Register_>(p_lanes[0] + index_);
+			}
+			else
+			{
+				return EmuSIMD::load<Register_>(p_lanes[component_] + index_);
+			}
+		}
+
+		const T_* p_lanes[Size_];
+	};
+
+	/// <summary> Provides the same broadcast register for every component and index. </summary>
+	template<class Register_>
+	struct _soa_scalar_operand
+	{
+		template<typename T_>
+		explicit inline _soa_scalar_operand(const T_& scalar_) : value(EmuSIMD::set1<Register_>(scalar_))
+		{
+		}
+
+		[[nodiscard]] inline Register_ Get(std::size_t, std::size_t) const
+		{
+			return value;
+		}
+
+		Register_ value;
+	};
+
+	/// <summary> Provides a broadcast of the respective component of an EmuMath Vector for every index. </summary>
+	template<class Register_, std::size_t Size_>
+	struct _soa_vector_operand
+	{
+		template<std::size_t InSize_, typename InT_, typename Value_>
+		inline _soa_vector_operand(const EmuMath::Vector<InSize_, InT_>& vector_, Value_ dummy_) :
+			_soa_vector_operand(vector_, dummy_, std::make_index_sequence<Size_>())
+		{
+		}
+
+		[[nodiscard]] inline Register_ Get(std::size_t component_, std::size_t) const
+		{
+			return values[component_];
+		}
+
+		Register_ values[Size_];
+
+	private:
+		template<std::size_t InSize_, typename InT_, typename Value_, std::size_t...Components_>
+		inline _soa_vector_operand(const EmuMath::Vector<InSize_, InT_>& vector_, Value_, std::index_sequence<Components_...>) :
+			values{ EmuSIMD::set1<Register_>(static_cast<Value_>(vector_.template AtTheoretical<Components_>()))... }
+		{
+		}
+	};
+
+	/// <summary> Returns the number of elements that an operand may provide: the count of a VectorSoA, or the maximum std::size_t for broadcast operands. </summary>
+	template<class Operand_>
+	[[nodiscard]] inline std::size_t _soa_operand_count(const Operand_& operand_)
+	{
+		if constexpr (EmuMath::TMP::is_emu_vector_soa_v<Operand_>)
+		{
+			return operand_.Count();
+		}
+		else
+		{
+			return (std::numeric_limits<std::size_t>::max)();
+		}
+	}
+
+	/// <summary>
+	/// <para> Creates an operand for reading registers for the provided output VectorSoA type. </para>
+	/// <para> VectorSoA operands must have the same value_type as OutSoA_, and either the same size or a size of 1. </para>
+	/// <para> EmuMath Vector operands have each component broadcast to the respective lane. Any other operand must be convertible to the output value_type and is broadcast to all lanes. </para>
+	/// </summary>
+	template<class OutSoA_, class Operand_>
+	[[nodiscard]] inline auto _make_soa_operand(const Operand_& operand_)
+	{
+		using register_type = typename OutSoA_::register_type;
+		using value_type = typename OutSoA_::value_type;
+		using operand_uq = EmuCore::TMP::remove_ref_cv_t<Operand_>;
+
+		if constexpr (EmuMath::TMP::is_emu_vector_soa_v<operand_uq>)
+		{
+			if constexpr (std::is_same_v<typename operand_uq::value_type, value_type> && (operand_uq::size == OutSoA_::size || operand_uq::size == 1))
+			{
+				return _soa_lanes_operand<register_type, operand_uq::size, value_type>(operand_);
+			}
+			else
+			{
+				static_assert(EmuCore::TMP::get_false<Operand_>(), "Attempted to use an EmuMath VectorSoA as an operand in a bulk VectorSoA operation, but its size or value_type was not valid. VectorSoA operands must share the output's value_type, and have either the output's size or a size of 1.");
+			}
+		}
+		else if constexpr (EmuMath::TMP::is_emu_vector_v<operand_uq>)
+		{
+			return _soa_vector_operand<register_type, OutSoA_::size>(operand_, value_type());
+		}
+		else if constexpr (std::is_convertible_v<const Operand_&, value_type>)
+		{
+			return _soa_scalar_operand<register_type>(static_cast<value_type>(operand_));
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<Operand_>(), "Attempted to use an invalid operand in a bulk VectorSoA operation. Operands must be an EmuMath VectorSoA, an EmuMath Vector, or a scalar convertible to the output VectorSoA's value_type.");
+		}
+	}
+#pragma endregion
+
+#pragma region SIMD_FUNCS
+	struct _soa_simd_add
+	{
+		template<class Register_>
+		[[nodiscard]] inline Register_ operator()(Register_ lhs_, Register_ rhs_) const
+		{
+			return EmuSIMD::add(lhs_, rhs_);
+		}
+	};
+
+	struct _soa_simd_sub
+	{
+		template<class Register_>
+		[[nodiscard]] inline Register_ operator()(Register_ lhs_, Register_ rhs_) const
+		{
+			return EmuSIMD::sub(lhs_, rhs_);
+		}
+	};
+
+	struct _soa_simd_mul
+	{
+		template<class Register_>
+		[[nodiscard]] inline Register_ operator()(Register_ lhs_, Register_ rhs_) const
+		{
+			return EmuSIMD::mul_all(lhs_, rhs_);
+		}
+	};
+
+	struct _soa_simd_div
+	{
+		template<class Register_>
+		[[nodiscard]] inline Register_ operator()(Register_ lhs_, Register_ rhs_) const
+		{
+			return EmuSIMD::div(lhs_, rhs_);
+		}
+	};
+
+	struct _soa_simd_min
+	{
+		template<class Register_>
+		[[nodiscard]] inline Register_ operator()(Register_ lhs_, Register_ rhs_) const
+		{
+			return EmuSIMD::vector_min(lhs_, rhs_);
+		}
+	};
+
+	struct _soa_simd_max
+	{
+		template<class Register_>
+		[[nodiscard]] inline Register_ operator()(Register_ lhs_, Register_ rhs_) const
+		{
+			return EmuSIMD::vector_max(lhs_, rhs_);
+		}
+	};
+#pragma endregion
+
+#pragma region KERNELS
+	/// <summary>
+	/// <para> Invokes func_ with the starting index of every register within the first count_ elements of a VectorSoA's lanes, rounded up to a full block. </para>
+	/// <para> Two registers are processed per iteration, matching the VectorSoA's block size. </para>
+	/// </summary>
+	template<class Soa_, class Func_>
+	inline void _soa_for_each_register(std::size_t count_, Func_& func_)
+	{
+		constexpr std::size_t block_ = Soa_::elements_per_block;
+		constexpr std::size_t step_ = Soa_::elements_per_register;
+		const std::size_t padded_count_ = ((count_ + block_ - 1) / block_) * block_;
+		for (std::size_t i_ = 0; i_ < padded_count_; i_ += block_)
+		{
+			func_(i_);
+			func_(i_ + step_);
+		}
+	}
+
+	/// <summary> Outputs Func_(lhs_, rhs_) for every component of every element to out_. out_ is resized to the lowest count of its VectorSoA inputs. </summary>
+	template<class Func_, std::size_t Size_, typename T_, class Rhs_>
+	inline void _vector_soa_mutate(EmuMath::VectorSoA<Size_, T_>& out_, const EmuMath::VectorSoA<Size_, T_>& lhs_, const Rhs_& rhs_)
+	{
+		using soa_type = EmuMath::VectorSoA<Size_, T_>;
+		using register_type = typename soa_type::register_type;
+		const std::size_t count_ = (std::min)(lhs_.Count(), _soa_operand_count(rhs_));
+		out_.Resize(count_);
+
+		const _soa_lanes_operand<register_type, Size_, T_> lhs_operand_(lhs_);
+		const auto rhs_operand_ = _make_soa_operand<soa_type>(rhs_);
+		Func_ func_ = Func_();
+		auto kernel_ = [&](std::size_t i_)
+		{
+			for (std::size_t component_ = 0; component_ < Size_; ++component_)
+			{
+				EmuSIMD::store(func_(lhs_operand_.Get(component_, i_), rhs_operand_.Get(component_, i_)), out_.Lane(component_) + i_);
+			}
+		};
+		_soa_for_each_register<soa_type>(count_, kernel_);
+	}
+
+	template<std::size_t Size_, typename T_, class B_, class Weighting_>
+	inline void _vector_soa_lerp(EmuMath::VectorSoA<Size_, T_>& out_, const EmuMath::VectorSoA<Size_, T_>& a_, const B_& b_, const Weighting_& t_)
+	{
+		using soa_type = EmuMath::VectorSoA<Size_, T_>;
+		using register_type = typename soa_type::register_type;
+		const std::size_t count_ = (std::min)((std::min)(a_.Count(), _soa_operand_count(b_)), _soa_operand_count(t_));
+		out_.Resize(count_);
+
+		const _soa_lanes_operand<register_type, Size_, T_> a_operand_(a_);
+		const auto b_operand_ = _make_soa_operand<soa_type>(b_);
+		const auto t_operand_ = _make_soa_operand<soa_type>(t_);
+		auto kernel_ = [&](std::size_t i_)
+		{
+			for (std::size_t component_ = 0; component_ < Size_; ++component_)
+			{
+				register_type result_ = EmuSIMD::fused_lerp(a_operand_.Get(component_, i_), b_operand_.Get(component_, i_), t_operand_.Get(component_, i_));
+				EmuSIMD::store(result_, out_.Lane(component_) + i_);
+			}
+		};
+		_soa_for_each_register<soa_type>(count_, kernel_);
+	}
+
+	template<std::size_t Size_, typename T_, class Min_, class Max_>
+	inline void _vector_soa_clamp(EmuMath::VectorSoA<Size_, T_>& out_, const EmuMath::VectorSoA<Size_, T_>& in_, const Min_& min_, const Max_& max_)
+	{
+		using soa_type = EmuMath::VectorSoA<Size_, T_>;
+		using register_type = typename soa_type::register_type;
+		const std::size_t count_ = (std::min)((std::min)(in_.Count(), _soa_operand_count(min_)), _soa_operand_count(max_));
+		out_.Resize(count_);
+
+		const _soa_lanes_operand<register_type, Size_, T_> in_operand_(in_);
+		const auto min_operand_ = _make_soa_operand<soa_type>(min_);
+		const auto max_operand_ = _make_soa_operand<soa_type>(max_);
+		auto kernel_ = [&](std::size_t i_)
+		{
+			for (std::size_t component_ = 0; component_ < Size_; ++component_)
+			{
+				register_type result_ = EmuSIMD::clamp(in_operand_.Get(component_, i_), min_operand_.Get(component_, i_), max_operand_.Get(component_, i_));
+				EmuSIMD::store(result_, out_.Lane(component_) + i_);
+			}
+		};
+		_soa_for_each_register<soa_type>(count_, kernel_);
+	}
+
+	template<std::size_t Size_, typename T_>
+	[[nodiscard]] inline typename EmuMath::VectorSoA<Size_, T_>::register_type _soa_dot_register
+	(
+		const _soa_lanes_operand<typename EmuMath::VectorSoA<Size_, T_>::register_type, Size_, T_>& a_,
+		const _soa_lanes_operand<typename EmuMath::VectorSoA<Size_, T_>::register_type, Size_, T_>& b_,
+		std::size_t i_
+	)
+	{
+		auto dot_ = EmuSIMD::mul_all(a_.Get(0, i_), b_.Get(0, i_));
+		for (std::size_t component_ = 1; component_ < Size_; ++component_)
+		{
+			dot_ = EmuSIMD::fmadd(a_.Get(component_, i_), b_.Get(component_, i_), dot_);
+		}
+		return dot_;
+	}
+
+	/// <summary> Outputs the dot product of respective Vectors in a_ and b_ to the single lane of out_. If Sqrt_ is true, the square root of each dot product is output instead. </summary>
+	template<bool Sqrt_, std::size_t Size_, typename T_>
+	inline void _vector_soa_dot(EmuMath::VectorSoA<1, T_>& out_, const EmuMath::VectorSoA<Size_, T_>& a_, const EmuMath::VectorSoA<Size_, T_>& b_)
+	{
+		using soa_type = EmuMath::VectorSoA<Size_, T_>;
+		using register_type = typename soa_type::register_type;
+		const std::size_t count_ = (std::min)(a_.Count(), b_.Count());
+		out_.Resize(count_);
+
+		const _soa_lanes_operand<register_type, Size_, T_> a_operand_(a_);
+		const _soa_lanes_operand<register_type, Size_, T_> b_operand_(b_);
+		T_* p_out_ = out_.Lane(0);
+		auto kernel_ = [&](std::size_t i_)
+		{
+			register_type dot_ = _soa_dot_register<Size_, T_>(a_operand_, b_operand_, i_);
+			if constexpr (Sqrt_)
+			{
+				dot_ = EmuSIMD::sqrt(dot_);
+			}
+			EmuSIMD::store(dot_, p_out_ + i_);
+		};
+		_soa_for_each_register<soa_type>(count_, kernel_);
+	}
+
+	/// <summary> Outputs the normalised form of every Vector in in_ to out_. If Fast_ is true, elements are multiplied by an approximate reciprocal square root instead of divided by an exact magnitude. </summary>
+	template<bool Fast_, std::size_t Size_, typename T_>
+	inline void _vector_soa_normalise(EmuMath::VectorSoA<Size_, T_>& out_, const EmuMath::VectorSoA<Size_, T_>& in_)
+	{
+		using soa_type = EmuMath::VectorSoA<Size_, T_>;
+		using register_type = typename soa_type::register_type;
+		const std::size_t count_ = in_.Count();
+		out_.Resize(count_);
+
+		const _soa_lanes_operand<register_type, Size_, T_> in_operand_(in_);
+		auto kernel_ = [&](std::size_t i_)
+		{
+			const register_type square_magnitude_ = _soa_dot_register<Size_, T_>(in_operand_, in_operand_, i_);
+			if constexpr (Fast_)
+			{
+				const register_type reciprocal_magnitude_ = EmuSIMD::rsqrt(square_magnitude_);
+				for (std::size_t component_ = 0; component_ < Size_; ++component_)
+				{
+					EmuSIMD::store(EmuSIMD::mul_all(in_operand_.Get(component_, i_), reciprocal_magnitude_), out_.Lane(component_) + i_);
+				}
+			}
+			else
+			{
+				const register_type magnitude_ = EmuSIMD::sqrt(square_magnitude_);
+				for (std::size_t component_ = 0; component_ < Size_; ++component_)
+				{
+					EmuSIMD::store(EmuSIMD::div(in_operand_.Get(component_, i_), magnitude_), out_.Lane(component_) + i_);
+				}
+			}
+		};
+		_soa_for_each_register<soa_type>(count_, kernel_);
+	}
+
+	template<typename T_>
+	inline void _vector_soa_cross_3d(EmuMath::VectorSoA<3, T_>& out_, const EmuMath::VectorSoA<3, T_>& a_, const EmuMath::VectorSoA<3, T_>& b_)
+	{
+		using soa_type = EmuMath::VectorSoA<3, T_>;
+		using register_type = typename soa_type::register_type;
+		const std::size_t count_ = (std::min)(a_.Count(), b_.Count());
+		out_.Resize(count_);
+
+		const _soa_lanes_operand<register_type, 3, T_> a_operand_(a_);
+		const _soa_lanes_operand<register_type, 3, T_> b_operand_(b_);
+		T_* p_out_x_ = out_.template Lane<0>();
+		T_* p_out_y_ = out_.template Lane<1>();
+		T_* p_out_z_ = out_.template Lane<2>();
+		auto kernel_ = [&](std::size_t i_)
+		{
+			const register_type ax_ = a_operand_.Get(0, i_);
+			const register_type ay_ = a_operand_.Get(1, i_);
+			const register_type az_ = a_operand_.Get(2, i_);
+			const register_type bx_ = b_operand_.Get(0, i_);
+			const register_type by_ = b_operand_.Get(1, i_);
+			const register_type bz_ = b_operand_.Get(2, i_);
+
+			// All inputs are read before any output is written, so out_ may be either input
+			EmuSIMD::store(EmuSIMD::fmsub(ay_, bz_, EmuSIMD::mul_all(az_, by_)), p_out_x_ + i_);
+			EmuSIMD::store(EmuSIMD::fmsub(az_, bx_, EmuSIMD::mul_all(ax_, bz_)), p_out_y_ + i_);
+			EmuSIMD::store(EmuSIMD::fmsub(ax_, by_, EmuSIMD::mul_all(ay_, bx_)), p_out_z_ + i_);
+		};
+		_soa_for_each_register<soa_type>(count_, kernel_);
+	}
+
+	/// <summary>
+	/// <para> Returns true if every component of every element in lhs_ is within epsilon_ of the respective component of rhs_. </para>
+	/// <para> Only the lowest count of the two VectorSoA inputs is compared. Elements in the final partial block are compared as scalars, so padding never affects the result. </para>
+	/// </summary>
+	template<std::size_t Size_, typename T_, class Rhs_>
+	[[nodiscard]] inline bool _vector_soa_cmp_all_near(const EmuMath::VectorSoA<Size_, T_>& lhs_, const Rhs_& rhs_, T_ epsilon_)
+	{
+		using soa_type = EmuMath::VectorSoA<Size_, T_>;
+		using register_type = typename soa_type::register_type;
+		constexpr std::size_t step_ = soa_type::elements_per_register;
+		const std::size_t count_ = (std::min)(lhs_.Count(), _soa_operand_count(rhs_));
+		const std::size_t simd_count_ = count_ - (count_ % step_);
+
+		const _soa_lanes_operand<register_type, Size_, T_> lhs_operand_(lhs_);
+		const auto rhs_operand_ = _make_soa_operand<soa_type>(rhs_);
+		const register_type epsilon_register_ = EmuSIMD::set1<register_type>(epsilon_);
+		const register_type sign_mask_ = EmuSIMD::set1<register_type>(T_(-0.0));
+
+		for (std::size_t i_ = 0; i_ < simd_count_; i_ += step_)
+		{
+			for (std::size_t component_ = 0; component_ < Size_; ++component_)
+			{
+				register_type abs_diff_ = EmuSIMD::bitwise_andnot(sign_mask_, EmuSIMD::sub(lhs_operand_.Get(component_, i_), rhs_operand_.Get(component_, i_)));
+				if (!EmuSIMD::cmp_all_le(abs_diff_, epsilon_register_))
+				{
+					return false;
+				}
+			}
+		}
+
+		if (simd_count_ != count_)
+		{
+			// Read the final register in full, but only compare elements within count_
+			alignas(register_type) T_ lhs_tail_[step_];
+			alignas(register_type) T_ rhs_tail_[step_];
+			for (std::size_t component_ = 0; component_ < Size_; ++component_)
+			{
+				EmuSIMD::store(lhs_operand_.Get(component_, simd_count_), lhs_tail_);
+				EmuSIMD::store(rhs_operand_.Get(component_, simd_count_), rhs_tail_);
+				for (std::size_t i_ = 0; i_ < (count_ - simd_count_); ++i_)
+				{
+					if (!EmuCore::do_cmp_near_equal<T_, T_, T_>()(lhs_tail_[i_], rhs_tail_[i_], epsilon_))
+					{
+						return false;
+					}
+				}
+			}
+		}
+		return true;
+	}
+#pragma endregion
+}
+
+#endif
@@ -5,6 +5,7 @@
 
 // CONTAINS:
 // --- shuffle
+// --- shuffle_constexpr
 // --- shuffle_theoretical
 // --- mutate
 // --- concat
@@ -18,6 +19,11 @@ namespace EmuMath::Helpers
 	/// <para> OutT_ is optional, and defaults to the passed vector_'s value_type_uq. </para>
 	/// <para> There is no upper limit for the amount of indices to be provided, but at least 1 argument must be provided for Indices_. </para>
 	/// <para> This may not be used to access theoretical indices; for such behaviour, use `vector_shuffle_theoretical` instead. </para>
+	/// <para>
+	///		When the input and output are non-reference float, double, or 32-bit integer Vectors which fit within a 128-bit register, 
+	///		shuffles are performed as a single SIMD shuffle instead of element-by-element.
+	/// </para>
+	/// <para> This does not provide a guarantee to be constexpr where possible. For such behaviour, use `vector_shuffle_constexpr`. </para>
 	/// </summary>
 	/// <typeparam name="OutT_">T_ argument for the output Vector. Defaults to the passed vector_'s value_type_uq.</typeparam>
 	/// <param name="vector_">EmuMath Vector to retrieve indices from.</param>
@@ -25,7 +31,7 @@ namespace EmuMath::Helpers
 	template<typename OutT_, std::size_t...Indices_, std::size_t Size_, typename T_, typename = std::enable_if_t<sizeof...(Indices_) != 0>>
 	[[nodiscard]] constexpr inline EmuMath::Vector<sizeof...(Indices_), OutT_> vector_shuffle(EmuMath::Vector<Size_, T_>& vector_)
 	{
-		return _vector_underlying::_vector_shuffle<OutT_, false, Indices_...>(vector_);
+		return _vector_underlying::_vector_shuffle<OutT_, false, true, Indices_...>(vector_);
 	}
 	template<std::size_t...Indices_, std::size_t Size_, typename T_, typename = std::enable_if_t<sizeof...(Indices_) != 0>>
 	[[nodiscard]] constexpr inline EmuMath::Vector<sizeof...(Indices_), typename EmuMath::Vector<Size_, T_>::value_type_uq> vector_shuffle
@@ -33,13 +39,13 @@ namespace EmuMath::Helpers
 		EmuMath::Vector<Size_, T_>& vector_
 	)
 	{
-		return _vector_underlying::_vector_shuffle<typename EmuMath::Vector<Size_, T_>::value_type_uq, false, Indices_...>(vector_);
+		return _vector_underlying::_vector_shuffle<typename EmuMath::Vector<Size_, T_>::value_type_uq, false, true, Indices_...>(vector_);
 	}
 
 	template<typename OutT_, std::size_t...Indices_, std::size_t Size_, typename T_, typename = std::enable_if_t<sizeof...(Indices_) != 0>>
 	[[nodiscard]] constexpr inline EmuMath::Vector<sizeof...(Indices_), OutT_> vector_shuffle(const EmuMath::Vector<Size_, T_>& vector_)
 	{
-		return _vector_underlying::_vector_shuffle<OutT_, false, Indices_...>(vector_);
+		return _vector_underlying::_vector_shuffle<OutT_, false, true, Indices_...>(vector_);
 	}
 	template<std::size_t...Indices_, std::size_t Size_, typename T_, typename = std::enable_if_t<sizeof...(Indices_) != 0>>
 	[[nodiscard]] constexpr inline EmuMath::Vector<sizeof...(Indices_), typename EmuMath::Vector<Size_, T_>::value_type_uq> vector_shuffle
@@ -47,7 +53,49 @@ namespace EmuMath::Helpers
 		const EmuMath::Vector<Size_, T_>& vector_
 	)
 	{
-		return _vector_underlying::_vector_shuffle<typename EmuMath::Vector<Size_, T_>::value_type_uq, false, Indices_...>(vector_);
+		return _vector_underlying::_vector_shuffle<typename EmuMath::Vector<Size_, T_>::value_type_uq, false, true, Indices_...>(vector_);
+	}
+
+	/// <summary>
+	/// <para> Creates a new EmuMath Vector, with the provided OutT_ used as the output Vector's T_ argument, via specified indices within the input vector_. </para>
+	/// <para> The Size_ of the output Vector will be equal to the provided number of Indices_. </para>
+	/// <para> OutT_ is optional, and defaults to the passed vector_'s value_type_uq. </para>
+	/// <para> There is no upper limit for the amount of indices to be provided, but at least 1 argument must be provided for Indices_. </para>
+	/// <para> This may not be used to access theoretical indices; for such behaviour, use `vector_shuffle_theoretical` instead. </para>
+	/// <para>
+	///		Provides a guarantee to be constexpr-evaluable if possible. Note that this may make sacrifices to performance, 
+	///		and as a result one may prefer to use `vector_shuffle` if it is guaranteed to be executed at runtime.
+	/// </para>
+	/// </summary>
+	/// <typeparam name="OutT_">T_ argument for the output Vector. Defaults to the passed vector_'s value_type_uq.</typeparam>
+	/// <param name="vector_">EmuMath Vector to retrieve indices from.</param>
+	/// <returns>EmuMath Vector with a number of elements equal to the number of Indices_ arguments, constructed from shuffled indices within the passed vector_.</returns>
+	template<typename OutT_, std::size_t...Indices_, std::size_t Size_, typename T_, typename = std::enable_if_t<sizeof...(Indices_) != 0>>
+	[[nodiscard]] constexpr inline EmuMath::Vector<sizeof...(Indices_), OutT_> vector_shuffle_constexpr(EmuMath::Vector<Size_, T_>& vector_)
+	{
+		return _vector_underlying::_vector_shuffle<OutT_, false, false, Indices_...>(vector_);
+	}
+	template<std::size_t...Indices_, std::size_t Size_, typename T_, typename = std::enable_if_t<sizeof...(Indices_) != 0>>
+	[[nodiscard]] constexpr inline EmuMath::Vector<sizeof...(Indices_), typename EmuMath::Vector<Size_, T_>::value_type_uq> vector_shuffle_constexpr
+	(
+		EmuMath::Vector<Size_, T_>& vector_
+	)
+	{
+		return _vector_underlying::_vector_shuffle<typename EmuMath::Vector<Size_, T_>::value_type_uq, false, false, Indices_...>(vector_);
+	}
+
+	template<typename OutT_, std::size_t...Indices_, std::size_t Size_, typename T_, typename = std::enable_if_t<sizeof...(Indices_) != 0>>
+	[[nodiscard]] constexpr inline EmuMath::Vector<sizeof...(Indices_), OutT_> vector_shuffle_constexpr(const EmuMath::Vector<Size_, T_>& vector_)
+	{
+		return _vector_underlying::_vector_shuffle<OutT_, false, false, Indices_...>(vector_);
+	}
+	template<std::size_t...Indices_, std::size_t Size_, typename T_, typename = std::enable_if_t<sizeof...(Indices_) != 0>>
+	[[nodiscard]] constexpr inline EmuMath::Vector<sizeof...(Indices_), typename EmuMath::Vector<Size_, T_>::value_type_uq> vector_shuffle_constexpr
+	(
+		const EmuMath::Vector<Size_, T_>& vector_
+	)
+	{
+		return _vector_underlying::_vector_shuffle<typename EmuMath::Vector<Size_, T_>::value_type_uq, false, false, Indices_...>(vector_);
 	}
 
 	/// <summary>
@@ -63,7 +111,7 @@ namespace EmuMath::Helpers
 	template<typename OutT_, std::size_t...Indices_, std::size_t Size_, typename T_, typename = std::enable_if_t<sizeof...(Indices_) != 0>>
 	[[nodiscard]] constexpr inline EmuMath::Vector<sizeof...(Indices_), OutT_> vector_shuffle_theoretical(EmuMath::Vector<Size_, T_>& vector_)
 	{
-		return _vector_underlying::_vector_shuffle<OutT_, true, Indices_...>(vector_);
+		return _vector_underlying::_vector_shuffle<OutT_, true, false, Indices_...>(vector_);
 	}
 	template<std::size_t...Indices_, std::size_t Size_, typename T_, typename = std::enable_if_t<sizeof...(Indices_) != 0>>
 	[[nodiscard]] constexpr inline EmuMath::Vector<sizeof...(Indices_), typename EmuMath::Vector<Size_, T_>::value_type_uq> vector_shuffle_theoretical
@@ -71,13 +119,13 @@ namespace EmuMath::Helpers
 		EmuMath::Vector<Size_, T_>& vector_
 	)
 	{
-		return _vector_underlying::_vector_shuffle<typename EmuMath::Vector<Size_, T_>::value_type_uq, true, Indices_...>(vector_);
+		return _vector_underlying::_vector_shuffle<typename EmuMath::Vector<Size_, T_>::value_type_uq, true, false, Indices_...>(vector_);
 	}
 
 	template<typename OutT_, std::size_t...Indices_, std::size_t Size_, typename T_, typename = std::enable_if_t<sizeof...(Indices_) != 0>>
 	[[nodiscard]] constexpr inline EmuMath::Vector<sizeof...(Indices_), OutT_> vector_shuffle_theoretical(const EmuMath::Vector<Size_, T_>& vector_)
 	{
-		return _vector_underlying::_vector_shuffle<OutT_, true, Indices_...>(vector_);
+		return _vector_underlying::_vector_shuffle<OutT_, true, false, Indices_...>(vector_);
 	}
 	template<std::size_t...Indices_, std::size_t Size_, typename T_, typename = std::enable_if_t<sizeof...(Indices_) != 0>>
 	[[nodiscard]] constexpr inline EmuMath::Vector<sizeof...(Indices_), typename EmuMath::Vector<Size_, T_>::value_type_uq> vector_shuffle_theoretical
@@ -85,7 +133,7 @@ namespace EmuMath::Helpers
 		const EmuMath::Vector<Size_, T_>& vector_
 	)
 	{
-		return _vector_underlying::_vector_shuffle<typename EmuMath::Vector<Size_, T_>::value_type_uq, true, Indices_...>(vector_);
+		return _vector_underlying::_vector_shuffle<typename EmuMath::Vector<Size_, T_>::value_type_uq, true, false, Indices_...>(vector_);
 	}
 #pragma endregion
 
@@ -9,8 +9,10 @@
 // --- square_magnitude
 // --- magnitude_constexpr
 // --- magnitude
+// --- magnitude_fast
 // --- normalise_constexpr
 // --- normalise
+// --- normalise_fast
 // --- angle_cos_constexpr
 // --- angle_cos
 // --- angle
@@ -207,6 +209,49 @@ namespace EmuMath::Helpers
 	}
 #pragma endregion
 
+#pragma region MAGNITUDE_FAST_FUNCS
+	/// <summary>
+	/// <para> Calculates an approximate magnitude of the passed EmuMath Vector, using a reciprocal square root instead of a square root. </para>
+	/// <para>
+	///		For float calculations this uses a hardware approximation refined by a single Newton-Raphson step, with a relative error of roughly 1e-4 or better. 
+	///		Other types fall back to exact calculations, and as such are better served by `vector_magnitude`.
+	/// </para>
+	/// </summary>
+	/// <typeparam name="Out_">Type to output the magnitude as, defaulting to the passed Vector's preferred_floating_point.</typeparam>
+	/// <param name="vector_">: EmuMath Vector to calculate the magnitude of.</param>
+	/// <returns>Approximate magnitude of the passed EmuMath Vector.</returns>
+	template<typename Out_, std::size_t Size_, typename T_>
+	[[nodiscard]] inline Out_ vector_magnitude_fast(const EmuMath::Vector<Size_, T_>& vector_)
+	{
+		return _vector_underlying::_vector_mag_fast<Out_>(vector_);
+	}
+	template<std::size_t Size_, typename T_>
+	[[nodiscard]] inline typename EmuMath::Vector<Size_, T_>::preferred_floating_point vector_magnitude_fast(const EmuMath::Vector<Size_, T_>& vector_)
+	{
+		return _vector_underlying::_vector_mag_fast<typename EmuMath::Vector<Size_, T_>::preferred_floating_point>(vector_);
+	}
+
+	/// <summary>
+	/// <para> Calculates an approximate magnitude of the passed EmuMath Vector, using indices within the provided range only. </para>
+	/// <para> BeginIndex_: Inclusive index at which to start reading from the passed Vector for calculations. </para>
+	/// <para> EndIndex_: Exclusive index at which to stop reading from the passed Vector for calculations. </para>
+	/// <para> Accuracy is as described for the non-range `vector_magnitude_fast`. </para>
+	/// </summary>
+	/// <typeparam name="Out_">Type to output the magnitude as, defaulting to the passed Vector's preferred_floating_point.</typeparam>
+	/// <param name="vector_">: EmuMath Vector to calculate the magnitude of.</param>
+	/// <returns>Approximate magnitude of the passed EmuMath Vector, using the provided index range.</returns>
+	template<std::size_t BeginIndex_, std::size_t EndIndex_, typename Out_, std::size_t Size_, typename T_>
+	[[nodiscard]] inline Out_ vector_magnitude_fast(const EmuMath::Vector<Size_, T_>& vector_)
+	{
+		return _vector_underlying::_vector_mag_fast<BeginIndex_, EndIndex_, Out_>(vector_);
+	}
+	template<std::size_t BeginIndex_, std::size_t EndIndex_, std::size_t Size_, typename T_>
+	[[nodiscard]] inline typename EmuMath::Vector<Size_, T_>::preferred_floating_point vector_magnitude_fast(const EmuMath::Vector<Size_, T_>& vector_)
+	{
+		return _vector_underlying::_vector_mag_fast<BeginIndex_, EndIndex_, typename EmuMath::Vector<Size_, T_>::preferred_floating_point>(vector_);
+	}
+#pragma endregion
+
 #pragma region NORMALISE_CONSTEXPR_FUNCS
 	/// <summary>
 	/// <para> Outputs a normalised form of the provided in_vector_, built as an EmuMath Vector using the provided OutSize_ and OutT_ arguments. </para>
@@ -423,6 +468,112 @@ namespace EmuMath::Helpers
 	}
 #pragma endregion
 
+#pragma region NORMALISE_FAST_FUNCS
+	/// <summary>
+	/// <para> Outputs an approximately normalised form of the provided in_vector_, built as an EmuMath Vector using the provided OutSize_ and OutT_ arguments. </para>
+	/// <para>
+	///		Elements are multiplied by a reciprocal square root of the square magnitude instead of being divided by the magnitude. 
+	///		For float calculations this uses a hardware approximation refined by a single Newton-Raphson step, with a relative error of roughly 1e-4 or better. 
+	///		Other types fall back to exact calculations, and as such are better served by `vector_normalise`.
+	/// </para>
+	/// </summary>
+	/// <param name="in_vector_">: EmuMath Vector to calculate the normalised form of.</param>
+	/// <returns>Approximately normalised form of the passed EmuMath Vector.</returns>
+	template<std::size_t OutSize_, typename OutT_, std::size_t InSize_, typename InT_>
+	[[nodiscard]] inline EmuMath::Vector<OutSize_, OutT_> vector_normalise_fast(const EmuMath::Vector<InSize_, InT_>& in_vector_)
+	{
+		return _vector_underlying::_vector_normalise_fast<OutSize_, OutT_>(in_vector_);
+	}
+	template<typename OutT_, std::size_t InSize_, typename InT_>
+	[[nodiscard]] inline EmuMath::Vector<InSize_, OutT_> vector_normalise_fast(const EmuMath::Vector<InSize_, InT_>& in_vector_)
+	{
+		return _vector_underlying::_vector_normalise_fast<InSize_, OutT_>(in_vector_);
+	}
+	template<std::size_t OutSize_, std::size_t InSize_, typename InT_>
+	[[nodiscard]] inline EmuMath::Vector<OutSize_, typename EmuMath::Vector<InSize_, InT_>::preferred_floating_point> vector_normalise_fast
+	(
+		const EmuMath::Vector<InSize_, InT_>& in_vector_
+	)
+	{
+		using out_arg = typename EmuMath::Vector<InSize_, InT_>::preferred_floating_point;
+		return _vector_underlying::_vector_normalise_fast<OutSize_, out_arg>(in_vector_);
+	}
+	template<typename InT_, std::size_t InSize_>
+	[[nodiscard]] inline EmuMath::Vector<InSize_, typename EmuMath::Vector<InSize_, InT_>::preferred_floating_point> vector_normalise_fast
+	(
+		const EmuMath::Vector<InSize_, InT_>& in_vector_
+	)
+	{
+		using out_arg = typename EmuMath::Vector<InSize_, InT_>::preferred_floating_point;
+		return _vector_underlying::_vector_normalise_fast<InSize_, out_arg>(in_vector_);
+	}
+
+	/// <summary>
+	/// <para> Outputs an approximately normalised form of the provided in_vector_, via the provided out_vector_. </para>
+	/// <para> Accuracy is as described for the returning `vector_normalise_fast`. </para>
+	/// </summary>
+	/// <param name="out_vector_">: EmuMath Vector to output to.</param>
+	/// <param name="in_vector_">: EmuMath Vector to calculate the normalised form of.</param>
+	template<std::size_t OutSize_, typename OutT_, std::size_t InSize_, typename InT_>
+	inline void vector_normalise_fast(EmuMath::Vector<OutSize_, OutT_>& out_vector_, const EmuMath::Vector<InSize_, InT_>& in_vector_)
+	{
+		_vector_underlying::_vector_normalise_fast(out_vector_, in_vector_);
+	}
+
+	/// <summary>
+	/// <para> Outputs an approximately normalised form of the provided in_vector_, built as an EmuMath Vector using the provided OutSize_ and OutT_ arguments. </para>
+	/// <para> Only indices in the provided range will be normalised; indices outside of said range will be copied without modification. </para>
+	/// <para> BeginIndex_: Inclusive index at which to start normalising elements. </para>
+	/// <para> EndIndex_: Exclusive index at which to stop normalising elements. </para>
+	/// <para> Accuracy is as described for the non-range `vector_normalise_fast`. </para>
+	/// </summary>
+	/// <param name="in_vector_">: EmuMath Vector to calculate the normalised form of.</param>
+	/// <returns>Approximately normalised form of the passed EmuMath Vector.</returns>
+	template<std::size_t BeginIndex_, std::size_t EndIndex_, std::size_t OutSize_, typename OutT_, std::size_t InSize_, typename InT_>
+	[[nodiscard]] inline EmuMath::Vector<OutSize_, OutT_> vector_normalise_range_fast(const EmuMath::Vector<InSize_, InT_>& in_vector_)
+	{
+		return _vector_underlying::_vector_normalise_fast<OutSize_, OutT_, BeginIndex_, EndIndex_>(in_vector_);
+	}
+	template<std::size_t BeginIndex_, std::size_t EndIndex_, typename OutT_, std::size_t InSize_, typename InT_>
+	[[nodiscard]] inline EmuMath::Vector<InSize_, OutT_> vector_normalise_range_fast(const EmuMath::Vector<InSize_, InT_>& in_vector_)
+	{
+		return _vector_underlying::_vector_normalise_fast<InSize_, OutT_, BeginIndex_, EndIndex_>(in_vector_);
+	}
+	template<std::size_t BeginIndex_, std::size_t EndIndex_, std::size_t OutSize_, std::size_t InSize_, typename InT_>
+	[[nodiscard]] inline EmuMath::Vector<OutSize_, typename EmuMath::Vector<InSize_, InT_>::preferred_floating_point> vector_normalise_range_fast
+	(
+		const EmuMath::Vector<InSize_, InT_>& in_vector_
+	)
+	{
+		using out_arg = typename EmuMath::Vector<InSize_, InT_>::preferred_floating_point;
+		return _vector_underlying::_vector_normalise_fast<OutSize_, out_arg, BeginIndex_, EndIndex_>(in_vector_);
+	}
+	template<std::size_t BeginIndex_, std::size_t EndIndex_, typename InT_, std::size_t InSize_>
+	[[nodiscard]] inline EmuMath::Vector<InSize_, typename EmuMath::Vector<InSize_, InT_>::preferred_floating_point> vector_normalise_range_fast
+	(
+		const EmuMath::Vector<InSize_, InT_>& in_vector_
+	)
+	{
+		using out_arg = typename EmuMath::Vector<InSize_, InT_>::preferred_floating_point;
+		return _vector_underlying::_vector_normalise_fast<InSize_, out_arg, BeginIndex_, EndIndex_>(in_vector_);
+	}
+
+	/// <summary>
+	/// <para> Outputs an approximately normalised form of the provided in_vector_, via the provided out_vector_. </para>
+	/// <para> Only indices in the provided range will be normalised; indices outside of said range will be copied without modification. </para>
+	/// <para> BeginIndex_: Inclusive index at which to start normalising elements. </para>
+	/// <para> EndIndex_: Exclusive index at which to stop normalising elements. </para>
+	/// <para> Accuracy is as described for the non-range `vector_normalise_fast`. </para>
+	/// </summary>
+	/// <param name="out_vector_">: EmuMath Vector to output to.</param>
+	/// <param name="in_vector_">: EmuMath Vector to calculate the normalised form of.</param>
+	template<std::size_t BeginIndex_, std::size_t EndIndex_, std::size_t OutSize_, typename OutT_, std::size_t InSize_, typename InT_>
+	inline void vector_normalise_range_fast(EmuMath::Vector<OutSize_, OutT_>& out_vector_, const EmuMath::Vector<InSize_, InT_>& in_vector_)
+	{
+		_vector_underlying::_vector_normalise_fast<BeginIndex_, EndIndex_>(out_vector_, in_vector_);
+	}
+#pragma endregion
+
 #pragma region ANGLE_FUNCS
 	/// <summary>
 	/// <para> Calculates the cosine of the angle between the two passed EmuMath Vectors. </para>
@@ -5,6 +5,8 @@
 #include "_vector_get_underlying.h"
 #include "_vector_tmp.h"
 #include "../../../../EmuCore/TMPHelpers/VariadicHelpers.h"
+#include "../../../../EmuCore/Functors/Arithmetic.h"
+#include "../../../../EmuSIMD/SIMDHelpers.h"
 
 namespace EmuMath::Helpers::_vector_underlying
 {
@@ -407,7 +409,81 @@ namespace EmuMath::Helpers::_vector_underlying
 #pragma endregion
 
 #pragma region SHUFFLES
-	template<typename OutT_, bool UseTheoreticalIndices_, std::size_t...Indices_, class InVector_>
+	/// <summary>
+	/// <para> Information on whether a shuffle of the provided InVector_ to a Vector of OutT_ may be lowered to a single SIMD shuffle. </para>
+	/// <para> This is possible when both the input and output are non-reference Vectors of the same float, double, or 32-bit integer type which fit in a 128-bit register. </para>
+	/// </summary>
+	template<class InVector_, typename OutT_, std::size_t...Indices_>
+	struct _vector_shuffle_simd_info
+	{
+	private:
+		using _in_vector_uq = typename EmuCore::TMP::remove_ref_cv<InVector_>::type;
+		using _value_type = typename _in_vector_uq::value_type_uq;
+
+		static constexpr bool _is_32bit_int = std::is_integral_v<_value_type> && !std::is_same_v<_value_type, bool> && sizeof(_value_type) == 4;
+
+	public:
+		using register_type = std::conditional_t
+		<
+			std::is_same_v<_value_type, float>,
+			__m128,
+			std::conditional_t
+			<
+				std::is_same_v<_value_type, double>,
+				__m128d,
+				std::conditional_t<_is_32bit_int, __m128i, void>
+			>
+		>;
+		static constexpr std::size_t in_size = _in_vector_uq::size;
+		static constexpr std::size_t out_size = sizeof...(Indices_);
+		static constexpr std::size_t elements_per_register = 16 / sizeof(_value_type);
+		static constexpr std::size_t element_width = sizeof(_value_type) * 8;
+
+		static constexpr bool value =
+		(
+			!std::is_void_v<register_type> &&
+			!_in_vector_uq::contains_ref &&
+			std::is_same_v<OutT_, _value_type> &&
+			in_size != 0 &&
+			in_size <= elements_per_register &&
+			out_size <= elements_per_register
+		);
+	};
+
+	/// <summary> Index to use for the provided RegisterIndex_ of a SIMD shuffle mask, where indices beyond the provided Indices_ are unused and set to 0. </summary>
+	template<std::size_t RegisterIndex_, std::size_t...Indices_>
+	[[nodiscard]] constexpr inline std::size_t _vector_shuffle_simd_mask_index()
+	{
+		if constexpr (RegisterIndex_ < sizeof...(Indices_))
+		{
+			constexpr std::size_t indices_[sizeof...(Indices_)] = { Indices_... };
+			return indices_[RegisterIndex_];
+		}
+		else
+		{
+			return 0;
+		}
+	}
+
+	template<typename OutT_, std::size_t...Indices_, class InVector_, std::size_t...RegisterIndices_>
+	[[nodiscard]] inline EmuMath::Vector<sizeof...(Indices_), OutT_> _vector_shuffle_simd(InVector_& in_vector_, std::index_sequence<RegisterIndices_...>)
+	{
+		using simd_info = _vector_shuffle_simd_info<InVector_, OutT_, Indices_...>;
+		using register_type = typename simd_info::register_type;
+
+		register_type shuffled_ = EmuSIMD::load_partial<register_type, simd_info::in_size, simd_info::element_width>(in_vector_.data());
+		shuffled_ = EmuSIMD::shuffle<_vector_shuffle_simd_mask_index<RegisterIndices_, Indices_...>()...>(shuffled_);
+
+		EmuMath::Vector<sizeof...(Indices_), OutT_> out_vector_;
+		EmuSIMD::store_partial<simd_info::out_size, simd_info::element_width>(shuffled_, out_vector_.data());
+		return out_vector_;
+	}
+
+	/// <summary>
+	/// <para> Shuffles the passed in_vector_ into a new Vector made up of the provided Indices_. </para>
+	/// <para> If AllowSimd_ is true, shuffles which meet the requirements of _vector_shuffle_simd_info are performed as a SIMD shuffle, and are not constexpr-evaluable. </para>
+	/// </summary>
+	template<typename OutT_, bool UseTheoreticalIndices_, bool AllowSimd_, std::size_t...Indices_, class InVector_>
 	[[nodiscard]] constexpr inline EmuMath::Vector<sizeof...(Indices_), OutT_> _vector_shuffle(InVector_& in_vector_)
 	{
 		if constexpr (EmuMath::TMP::is_emu_vector_v<InVector_>)
@@ -457,7 +533,15 @@ namespace EmuMath::Helpers::_vector_underlying
 			{
 				if constexpr (std::is_constructible_v<out_stored_type, get_return_type>)
 				{
-					return out_vector(_vector_get<Indices_>(in_vector_)...);
+					using simd_info = _vector_shuffle_simd_info<InVector_, OutT_, Indices_...>;
+					if constexpr (AllowSimd_ && simd_info::value)
+					{
+						return _vector_shuffle_simd<OutT_, Indices_...>(in_vector_, std::make_index_sequence<simd_info::elements_per_register>());
+					}
+					else
+					{
+						return out_vector(_vector_get<Indices_>(in_vector_)...);
+					}
 				}
 				else
 				{
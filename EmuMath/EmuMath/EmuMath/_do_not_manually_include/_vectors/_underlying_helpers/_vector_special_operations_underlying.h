@@ -6,6 +6,7 @@
 #include "_vector_mutation_underlying.h"
 #include "../../../../EmuCore/Functors/Arithmetic.h"
 #include "../../../../EmuCore/TMPHelpers/Values.h"
+#include "../../../../EmuSIMD/SIMDHelpers.h"
 
 namespace EmuMath::Helpers::_vector_underlying
 {
@@ -100,6 +101,42 @@ namespace EmuMath::Helpers::_vector_underlying
 		const Mag_ _mag;
 	};
 
+	/// <summary>
+	/// <para> Calculates an approximate reciprocal square root of the passed value, used for fast magnitudes and normalisation. </para>
+	/// <para> Floats use a refined hardware approximation via EmuSIMD::rsqrt; other types fall back to an exact `1 / sqrt(x)`. </para>
+	/// </summary>
+	template<typename T_>
+	[[nodiscard]] inline T_ _vector_fast_rsqrt(const T_& val_)
+	{
+		if constexpr (std::is_same_v<T_, float>)
+		{
+			return _mm_cvtss_f32(EmuSIMD::rsqrt(_mm_set1_ps(val_)));
+		}
+		else
+		{
+			return EmuCore::do_divide<T_, T_>()(T_(1), static_cast<T_>(EmuCore::do_sqrt<T_>()(val_)));
+		}
+	}
+
+	/// <summary> Functor multiplying elements by an already-calculated reciprocal magnitude, used for fast normalisation. </summary>
+	template<typename ReciprocalMag_>
+	struct _vector_fast_norm_element
+	{
+		_vector_fast_norm_element() = delete;
+		constexpr _vector_fast_norm_element(const ReciprocalMag_& reciprocal_mag_) : _reciprocal_mag(reciprocal_mag_)
+		{
+		}
+
+		template<typename In_>
+		[[nodiscard]] constexpr inline auto operator()(const In_& in_value_) const
+		{
+			return EmuCore::do_multiply<In_, ReciprocalMag_>()(in_value_, _reciprocal_mag);
+		}
+
+	private:
+		const ReciprocalMag_ _reciprocal_mag;
+	};
+
 	template<bool OutputRads_>
 	struct _conditional_rad_converter
 	{
@@ -504,6 +541,85 @@ namespace EmuMath::Helpers::_vector_underlying
 		);
 	}
 
+	// FAST MAGNITUDE
+	template<std::size_t BeginIndex_, std::size_t EndIndex_, typename Out_, std::size_t Size_, typename T_>
+	[[nodiscard]] inline Out_ _vector_mag_fast(const EmuMath::Vector<Size_, T_>& vector_)
+	{
+		using out_processing = typename _types_vector_dot<Size_, T_, Size_, T_, Out_>::out_processing;
+		const out_processing square_mag_ = _vector_square_mag<BeginIndex_, EndIndex_, out_processing>(vector_);
+
+		// Guard against 0 * inf, which would otherwise produce NaN for zero-length Vectors
+		if (square_mag_ == out_processing(0))
+		{
+			return static_cast<Out_>(square_mag_);
+		}
+		else
+		{
+			return static_cast<Out_>(EmuCore::do_multiply<out_processing, out_processing>()(square_mag_, _vector_fast_rsqrt(square_mag_)));
+		}
+	}
+
+	template<typename Out_, std::size_t Size_, typename T_>
+	[[nodiscard]] inline Out_ _vector_mag_fast(const EmuMath::Vector<Size_, T_>& vector_)
+	{
+		return _vector_mag_fast<0, EmuMath::Vector<Size_, T_>::size, Out_>(vector_);
+	}
+
+	// FAST NORMALISE
+	template<std::size_t OutSize_, typename OutT_, std::size_t BeginIndex_, std::size_t EndIndex_, typename InT_, std::size_t InSize_>
+	[[nodiscard]] inline EmuMath::Vector<OutSize_, OutT_> _vector_normalise_fast(const EmuMath::Vector<InSize_, InT_>& in_vector_)
+	{
+		using out_processing = typename _types_vector_dot<InSize_, InT_, InSize_, InT_, OutT_>::out_processing;
+		using norm_func = _vector_fast_norm_element<out_processing>;
+		return _vector_partial_mutation_copy_return_result<OutSize_, OutT_, norm_func, const EmuMath::Vector<InSize_, InT_>&, BeginIndex_, EndIndex_, BeginIndex_>
+		(
+			norm_func(_vector_fast_rsqrt(_vector_square_mag<BeginIndex_, EndIndex_, out_processing>(in_vector_))),
+			in_vector_,
+			in_vector_
+		);
+	}
+
+	template<std::size_t OutSize_, typename OutT_, typename InT_, std::size_t InSize_>
+	[[nodiscard]] inline EmuMath::Vector<OutSize_, OutT_> _vector_normalise_fast(const EmuMath::Vector<InSize_, InT_>& in_vector_)
+	{
+		using out_processing = typename _types_vector_dot<InSize_, InT_, InSize_, InT_, OutT_>::out_processing;
+		using norm_func = _vector_fast_norm_element<out_processing>;
+		return _vector_partial_mutation_copy_return_result<OutSize_, OutT_, norm_func, const EmuMath::Vector<InSize_, InT_>&, 0, OutSize_, 0>
+		(
+			norm_func(_vector_fast_rsqrt(_vector_square_mag<0, EmuMath::Vector<InSize_, InT_>::size, out_processing>(in_vector_))),
+			in_vector_,
+			in_vector_
+		);
+	}
+
+	template<std::size_t BeginIndex_, std::size_t EndIndex_, std::size_t OutSize_, typename OutT_, typename InT_, std::size_t InSize_>
+	inline void _vector_normalise_fast(EmuMath::Vector<OutSize_, OutT_>& out_vector_, const EmuMath::Vector<InSize_, InT_>& in_vector_)
+	{
+		using out_processing = typename _types_vector_dot<InSize_, InT_, InSize_, InT_, OutT_>::out_processing;
+		using norm_func = _vector_fast_norm_element<out_processing>;
+		_vector_partial_mutation_copy<norm_func, EmuMath::Vector<OutSize_, OutT_>, const EmuMath::Vector<InSize_, InT_>&, BeginIndex_, EndIndex_, BeginIndex_>
+		(
+			norm_func(_vector_fast_rsqrt(_vector_square_mag<BeginIndex_, EndIndex_, out_processing>(in_vector_))),
+			out_vector_,
+			in_vector_,
+			in_vector_
+		);
+	}
+
+	template<std::size_t OutSize_, typename OutT_, typename InT_, std::size_t InSize_>
+	inline void _vector_normalise_fast(EmuMath::Vector<OutSize_, OutT_>& out_vector_, const EmuMath::Vector<InSize_, InT_>& in_vector_)
+	{
+		using out_processing = typename _types_vector_dot<InSize_, InT_, InSize_, InT_, OutT_>::out_processing;
+		using norm_func = _vector_fast_norm_element<out_processing>;
+		_vector_partial_mutation_copy<norm_func, EmuMath::Vector<OutSize_, OutT_>, const EmuMath::Vector<InSize_, InT_>&, 0, OutSize_, 0>
+		(
+			norm_func(_vector_fast_rsqrt(_vector_square_mag<0, EmuMath::Vector<InSize_, InT_>::size, out_processing>(in_vector_))),
+			out_vector_,
+			in_vector_,
+			in_vector_
+		);
+	}
+
 	// ANGLES
 	template<template<class> class SqrtTemplate_, class Out_, bool Radians_, std::size_t SizeA_, typename TA_, std::size_t SizeB_, typename TB_>
 	[[nodiscard]] constexpr inline Out_ _vector_angle_cos(const EmuMath::Vector<SizeA_, TA_>& a_, const EmuMath::Vector<SizeB_, TB_>& b_)
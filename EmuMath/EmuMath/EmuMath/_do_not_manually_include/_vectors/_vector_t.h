@@ -4112,6 +4112,8 @@ namespace EmuMath
 		/// <para> At least one Indices_ arg must be provided. </para>
 		/// <para> This can be used to output a shuffled reference Vector, but it is recommended to use RefShuffle instead. </para>
 		/// <para> This may not be used to shuffle theoretical indices. For such behaviour, use ShuffleTheoretical. </para>
+		/// <para> Shuffles of float, double, and 32-bit integer Vectors which fit within a 128-bit register are performed as a single SIMD shuffle. </para>
+		/// <para> Does not provide a guarantee to be constexpr-evaluable if possible; for such behaviour, use `ShuffleConstexpr` instead. </para>
 		/// </summary>
 		/// <typeparam name="OutT_">Type to be contained in the output Vector. Defaults to this Vector's value_type_uq if not provided.</typeparam>
 		/// <returns>
@@ -4140,6 +4142,45 @@ namespace EmuMath
 			return EmuMath::Helpers::vector_shuffle<value_type_uq, Indices_...>(*this);
 		}
 
+		/// <summary>
+		/// <para> Creates an EmuMath Vector containing the specified OutT_ (defaults to value_type_uq) from elements within this Vector. </para>
+		/// <para> The size of the output Vector will be equal to the number of provided Indices_ args. </para>
+		/// <para>
+		///		Indices_: Variadic sequence of 1 or more indices within this Vector to use to form the element for the output Vector's index at that arg's position. 
+		///		(e.g. with the args 2, 4, 0, the result will be out[0] = this[2], out[1] = this[4], out[2] = this[0]).
+		/// </para>
+		/// <para> At least one Indices_ arg must be provided. </para>
+		/// <para> This can be used to output a shuffled reference Vector, but it is recommended to use RefShuffle instead. </para>
+		/// <para> This may not be used to shuffle theoretical indices. For such behaviour, use ShuffleTheoretical. </para>
+		/// <para> Provides a guarantee to be constexpr-evaluable if possible, but may make sacrifices. One may prefer to use `Shuffle` if calling at runtime. </para>
+		/// </summary>
+		/// <typeparam name="OutT_">Type to be contained in the output Vector. Defaults to this Vector's value_type_uq if not provided.</typeparam>
+		/// <returns>
+		///		EmuMath Vector containing the provided OutT_ (defaults to value_type_uq), containing a number of indices equal to the number of provided Indices_ args, 
+		///		with respective elements constructed from the provided Indices_ within this Vector.
+		/// </returns>
+		template<typename OutT_, std::size_t...Indices_, typename = std::enable_if_t<sizeof...(Indices_) != 0>>
+		[[nodiscard]] constexpr inline EmuMath::Vector<sizeof...(Indices_), OutT_> ShuffleConstexpr()
+		{
+			return EmuMath::Helpers::vector_shuffle_constexpr<OutT_, Indices_...>(*this);
+		}
+		template<typename OutT_, std::size_t...Indices_, typename = std::enable_if_t<sizeof...(Indices_) != 0>>
+		[[nodiscard]] constexpr inline EmuMath::Vector<sizeof...(Indices_), OutT_> ShuffleConstexpr() const
+		{
+			return EmuMath::Helpers::vector_shuffle_constexpr<OutT_, Indices_...>(*this);
+		}
+
+		template<std::size_t...Indices_, typename = std::enable_if_t<sizeof...(Indices_) != 0>>
+		[[nodiscard]] constexpr inline EmuMath::Vector<sizeof...(Indices_), value_type_uq> ShuffleConstexpr()
+		{
+			return EmuMath::Helpers::vector_shuffle_constexpr<value_type_uq, Indices_...>(*this);
+		}
+		template<std::size_t...Indices_, typename = std::enable_if_t<sizeof...(Indices_) != 0>>
+		[[nodiscard]] constexpr inline EmuMath::Vector<sizeof...(Indices_), value_type_uq> ShuffleConstexpr() const
+		{
+			return EmuMath::Helpers::vector_shuffle_constexpr<value_type_uq, Indices_...>(*this);
+		}
+
 		/// <summary>
 		/// <para> Creates an EmuMath Vector containing the specified OutT_ (defaults to value_type_uq) from elements within this Vector. </para>
 		/// <para> The size of the output Vector will be equal to the number of provided Indices_ args. </para>
@@ -4716,6 +4757,29 @@ namespace EmuMath
 			return EmuMath::Helpers::vector_magnitude<BeginIndex_, EndIndex_, Out_>(*this);
 		}
 
+		/// <summary>
+		/// <para> Calculates an approximate magnitude of this Vector via a reciprocal square root, output as the provided Out_ type (defaults to this Vector's preferred_floating_point). </para>
+		/// <para> For float calculations this has a relative error of roughly 1e-4 or better, in exchange for being significantly cheaper than `Magnitude`. </para>
+		/// </summary>
+		/// <typeparam name="Out_">Type to output the calculated magnitude as. Defaults to preferred_floating_point.</typeparam>
+		/// <returns>Approximate magnitude of this Vector.</returns>
+		template<typename Out_ = preferred_floating_point>
+		[[nodiscard]] inline Out_ MagnitudeFast() const
+		{
+			return EmuMath::Helpers::vector_magnitude_fast<Out_>(*this);
+		}
+		/// <summary>
+		/// <para> Calculates an approximate magnitude of this Vector via a reciprocal square root, using only indices in the provided range. </para>
+		/// <para> For float calculations this has a relative error of roughly 1e-4 or better, in exchange for being significantly cheaper than `Magnitude`. </para>
+		/// </summary>
+		/// <typeparam name="Out_">Type to output the calculated magnitude as. Defaults to preferred_floating_point.</typeparam>
+		/// <returns>Approximate magnitude of this Vector, using the provided index range.</returns>
+		template<std::size_t BeginIndex_, std::size_t EndIndex_, typename Out_ = preferred_floating_point>
+		[[nodiscard]] inline Out_ MagnitudeFast() const
+		{
+			return EmuMath::Helpers::vector_magnitude_fast<BeginIndex_, EndIndex_, Out_>(*this);
+		}
+
 		/// <summary>
 		/// <para> Calculates and outputs a copy of this Vector with normalised elements. </para>
 		/// <para>
@@ -4848,6 +4912,64 @@ namespace EmuMath
 			EmuMath::Helpers::vector_normalise_range<BeginIndex_, EndIndex_>(out_vector_, *this);
 		}
 
+		/// <summary>
+		/// <para> Calculates and outputs a copy of this Vector with approximately normalised elements, multiplying by a reciprocal square root of the square magnitude. </para>
+		/// <para> For float calculations this has a relative error of roughly 1e-4 or better, in exchange for being significantly cheaper than `Normalise`. </para>
+		/// </summary>
+		/// <returns>EmuMath Vector copy of this Vector approximately normalised.</returns>
+		template<std::size_t OutSize_, typename OutT_ = preferred_floating_point>
+		[[nodiscard]] inline EmuMath::Vector<OutSize_, OutT_> NormaliseFast() const
+		{
+			return EmuMath::Helpers::vector_normalise_fast<OutSize_, OutT_>(*this);
+		}
+		template<typename OutT_ = preferred_floating_point>
+		[[nodiscard]] inline EmuMath::Vector<size, OutT_> NormaliseFast() const
+		{
+			return EmuMath::Helpers::vector_normalise_fast<size, OutT_>(*this);
+		}
+
+		/// <summary>
+		/// <para> Calculates and outputs a copy of this Vector with approximately normalised elements, via the provided out_vector_. </para>
+		/// <para> For float calculations this has a relative error of roughly 1e-4 or better, in exchange for being significantly cheaper than `Normalise`. </para>
+		/// </summary>
+		/// <param name="out_vector_">: EmuMath Vector to output to.</param>
+		template<std::size_t OutSize_, typename OutT_>
+		inline void NormaliseFast(EmuMath::Vector<OutSize_, OutT_>& out_vector_) const
+		{
+			EmuMath::Helpers::vector_normalise_fast(out_vector_, *this);
+		}
+
+		/// <summary>
+		/// <para> Calculates and outputs a copy of this Vector with approximately normalised elements. </para>
+		/// <para> Only indices in the provided range will be normalised; indices outside of said range will be copied without modification. </para>
+		/// <para> BeginIndex_: Inclusive index at which to start normalising elements. </para>
+		/// <para> EndIndex_: Exclusive index at which to stop normalising elements. </para>
+		/// </summary>
+		/// <returns>EmuMath Vector copy of this Vector approximately normalised.</returns>
+		template<std::size_t BeginIndex_, std::size_t EndIndex_, std::size_t OutSize_, typename OutT_ = preferred_floating_point>
+		[[nodiscard]] inline EmuMath::Vector<OutSize_, OutT_> NormaliseFast() const
+		{
+			return EmuMath::Helpers::vector_normalise_range_fast<BeginIndex_, EndIndex_, OutSize_, OutT_>(*this);
+		}
+		template<std::size_t BeginIndex_, std::size_t EndIndex_, typename OutT_ = preferred_floating_point>
+		[[nodiscard]] inline EmuMath::Vector<size, OutT_> NormaliseFast() const
+		{
+			return EmuMath::Helpers::vector_normalise_range_fast<BeginIndex_, EndIndex_, size, OutT_>(*this);
+		}
+
+		/// <summary>
+		/// <para> Calculates and outputs a copy of this Vector with approximately normalised elements, via the provided out_vector_. </para>
+		/// <para> Only indices in the provided range will be normalised; indices outside of said range will be copied without modification. </para>
+		/// <para> BeginIndex_: Inclusive index at which to start normalising elements. </para>
+		/// <para> EndIndex_: Exclusive index at which to stop normalising elements. </para>
+		/// </summary>
+		/// <param name="out_vector_">: EmuMath Vector to output to.</param>
+		template<std::size_t BeginIndex_, std::size_t EndIndex_, std::size_t OutSize_, typename OutT_>
+		inline void NormaliseFast(EmuMath::Vector<OutSize_, OutT_>& out_vector_) const
+		{
+			EmuMath::Helpers::vector_normalise_range_fast<BeginIndex_, EndIndex_>(out_vector_, *this);
+		}
+
 		/// <summary>
 		/// <para> Calculates the cosine of the angle between this Vector and the passed vector_b_. </para>
 		/// <para> Radians_: If true, output will be in radians; otherwise, it will be in degrees. Defaults to true. </para>
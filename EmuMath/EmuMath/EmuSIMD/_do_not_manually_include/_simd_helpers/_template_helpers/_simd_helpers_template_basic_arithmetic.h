@@ -270,7 +270,7 @@ namespace EmuSIMD
 		using register_type_uq = typename EmuCore::TMP::remove_ref_cv<Register_>::type;
 		if constexpr (EmuSIMD::TMP::is_simd_register_v<register_type_uq>)
 		{
-			return _underlying_simd_helpers::_negate(register_);
+			return _underlying_simd_helpers::_negate<PerElementWidthIfIntegral_>(register_);
 		}
 		else
 		{
@@ -573,6 +573,54 @@ namespace EmuSIMD
 		}
 	}
 
+	/// <summary>
+	/// <para> Calculates the square root of each element within the passed floating-point SIMD register. </para>
+	/// </summary>
+	/// <param name="register_">Register to calculate the per-element square roots of.</param>
+	/// <returns>Register containing the square root of each respective element in the passed register_.</returns>
+	template<class Register_>
+	[[nodiscard]] inline Register_ sqrt(Register_ register_)
+	{
+		using register_type_uq = typename EmuCore::TMP::remove_ref_cv<Register_>::type;
+		if constexpr (EmuSIMD::TMP::is_floating_point_simd_register_v<register_type_uq>)
+		{
+			return _underlying_simd_helpers::_sqrt(register_);
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to perform EmuSIMD::sqrt with an unsupported type as the passed Register_. Only floating-point SIMD registers are supported.");
+		}
+	}
+
+	/// <summary>
+	/// <para> Calculates the reciprocal square root (`1 / sqrt(x)`) of each element within the passed floating-point SIMD register. </para>
+	/// <para>
+	///		For single-precision registers, this is a hardware approximation refined with a single Newton-Raphson step, 
+	///		which has a maximum relative error of roughly 1e-4 or better and is significantly cheaper than a sqrt followed by a division. 
+	///		Double-precision registers have no such approximation available, and instead perform an exact sqrt followed by a division.
+	/// </para>
+	/// <para>
+	///		Elements of 0 will produce infinity of the same sign, and positive infinity will produce 0. 
+	///		Lanes whose hardware estimate is 0 or infinity (zeros, infinities and denormals that the estimate flushes to zero) cannot be refined, 
+	///		and instead take an exact sqrt and division; this slower path is only taken when at least one such lane is present.
+	/// </para>
+	/// </summary>
+	/// <param name="register_">Register to calculate the per-element reciprocal square roots of.</param>
+	/// <returns>Register containing the reciprocal square root of each respective element in the passed register_.</returns>
+	template<class Register_>
+	[[nodiscard]] inline Register_ rsqrt(Register_ register_)
+	{
+		using register_type_uq = typename EmuCore::TMP::remove_ref_cv<Register_>::type;
+		if constexpr (EmuSIMD::TMP::is_floating_point_simd_register_v<register_type_uq>)
+		{
+			return _underlying_simd_helpers::_rsqrt(register_);
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to perform EmuSIMD::rsqrt with an unsupported type as the passed Register_. Only floating-point SIMD registers are supported.");
+		}
+	}
+
 	template<std::size_t PerElementWidthIfInt_ = 32, bool SignedIfInt_ = true, class Register_>
 	[[nodiscard]] inline Register_ vector_min(Register_ a_, Register_ b_)
 	{
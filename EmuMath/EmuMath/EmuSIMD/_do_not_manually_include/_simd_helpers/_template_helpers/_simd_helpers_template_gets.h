@@ -52,6 +52,78 @@ namespace EmuSIMD
 			static_assert(EmuCore::TMP::get_false<Out_>(), "Attempted to extract a SIMD register index via EmuSIMD::get_index, but the provided register_ is not recognised as a SIMD register.");
 		}
 	}
+
+	/// <summary>
+	/// <para> Outputs the entirety of the passed SIMD register to the contiguous memory location pointed to by p_out_, which has no alignment requirements. </para>
+	/// <para> 
+	///		It is the caller's responsibility to ensure that the output location contains enough contiguously safe memory 
+	///		(e.g. 256 bits for __m256 registers) to store the passed register. 
+	/// </para>
+	/// <para> If the output location is known to be aligned to the register's width, `store` should be preferred. </para>
+	/// </summary>
+	/// <typeparam name="Out_">Type pointed to by the passed output pointer. May not be constant.</typeparam>
+	/// <param name="register_">Register to store the contained data of.</param>
+	/// <param name="p_out_">Non-const pointer to a memory location to output to.</param>
+	template<typename Out_, class Register_, typename NoConstReq_ = std::enable_if_t<!std::is_const_v<Out_>>>
+	inline void store_unaligned(Register_ register_, Out_* p_out_)
+	{
+		if constexpr (EmuSIMD::TMP::is_simd_register_v<Register_>)
+		{
+			_underlying_simd_helpers::_store_register_unaligned(register_, p_out_);
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<Out_>(), "Attempted to store a SIMD register via EmuSIMD::store_unaligned, but the provided register_ is not recognised as a SIMD register.");
+		}
+	}
+
+	/// <summary>
+	/// <para> Outputs the entirety of the passed SIMD register to the contiguous memory location pointed to by p_out_, using a non-temporal hint. </para>
+	/// <para> Non-temporal stores bypass the cache where possible, which benefits large outputs that will not be read again soon. </para>
+	/// <para> The output location must be aligned to the register's width (e.g. 32 bytes for __m256 registers), as with `store`. </para>
+	/// <para> 
+	///		Non-temporal stores are weakly ordered; callers that hand the written memory to other threads should issue a store fence 
+	///		(such as _mm_sfence) after their final non-temporal store.
+	/// </para>
+	/// </summary>
+	/// <typeparam name="Out_">Type pointed to by the passed output pointer. May not be constant.</typeparam>
+	/// <param name="register_">Register to store the contained data of.</param>
+	/// <param name="p_out_">Non-const pointer to an aligned memory location to output to.</param>
+	template<typename Out_, class Register_, typename NoConstReq_ = std::enable_if_t<!std::is_const_v<Out_>>>
+	inline void store_non_temporal(Register_ register_, Out_* p_out_)
+	{
+		if constexpr (EmuSIMD::TMP::is_simd_register_v<Register_>)
+		{
+			_underlying_simd_helpers::_store_register_non_temporal(register_, p_out_);
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<Out_>(), "Attempted to store a SIMD register via EmuSIMD::store_non_temporal, but the provided register_ is not recognised as a SIMD register.");
+		}
+	}
+
+	/// <summary>
+	/// <para> Outputs the first NumElements_ elements of the passed 128-bit SIMD register to the memory location pointed to by p_out_, without writing beyond them. </para>
+	/// <para> This is safe for writing the tails of tightly-packed data such as 3-element Vectors. </para>
+	/// <para> PerElementWidthIfInt_ is used to determine the width of elements within integral registers, and is ignored for floating-point registers. </para>
+	/// <para> The total number of stored bytes must be 4, 8, 12, or 16. The output location has no alignment requirements. </para>
+	/// </summary>
+	/// <typeparam name="Out_">Type pointed to by the passed output pointer. May not be constant.</typeparam>
+	/// <param name="register_">Register to store the leading elements of.</param>
+	/// <param name="p_out_">Non-const pointer to a memory location to output to.</param>
+	template<std::size_t NumElements_, std::size_t PerElementWidthIfInt_ = 32, typename Out_, class Register_, typename NoConstReq_ = std::enable_if_t<!std::is_const_v<Out_>>>
+	inline void store_partial(Register_ register_, Out_* p_out_)
+	{
+		if constexpr (EmuSIMD::TMP::is_simd_register_v<Register_>)
+		{
+			constexpr std::size_t element_width_ = EmuSIMD::TMP::is_integral_simd_register_v<Register_> ? PerElementWidthIfInt_ : (std::is_same_v<Register_, __m128d> ? 64 : 32);
+			_underlying_simd_helpers::_store_partial<(NumElements_ * element_width_) / 8>(register_, p_out_);
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<Out_>(), "Attempted to store a SIMD register via EmuSIMD::store_partial, but the provided register_ is not recognised as a SIMD register.");
+		}
+	}
 }
 
 #endif
\ No newline at end of file
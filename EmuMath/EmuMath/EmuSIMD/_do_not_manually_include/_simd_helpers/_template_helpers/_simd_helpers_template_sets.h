@@ -237,6 +237,57 @@ namespace EmuSIMD
 			static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to perform EmuSIMD::load with an unsupported type as the passed Register_.");
 		}
 	}
+
+	/// <summary>
+	/// <para> Loads a SIMD register of the specified type from the provided data pointed to by p_to_load_, which has no alignment requirements. </para>
+	/// <para> Bits of pointed-to data are loaded directly; conversions between different representations (such as IEEE-754 -> 2's complement) are NOT performed. </para>
+	/// <para> 
+	///		It is the caller's responsibility to ensure that the pointed-to location contains enough contiguously safe memory 
+	///		(e.g. 256 bits for __m256 registers) for the register to read from. 
+	/// </para>
+	/// <para> If the pointed-to data is known to be aligned to the register's width, `load` should be preferred. </para>
+	/// </summary>
+	/// <typeparam name="Register_">Type of SIMD register to create from loaded data.</typeparam>
+	/// <typeparam name="In_">Type pointed to by the input pointer.</typeparam>
+	/// <param name="p_to_load_">Constant pointer to data to be loaded into the output register.</param>
+	/// <returns>SIMD register of the specified type, with data initialised from loading the data pointed to by the provided p_to_load_ pointer.</returns>
+	template<class Register_, typename In_>
+	[[nodiscard]] inline Register_ load_unaligned(const In_* p_to_load_)
+	{
+		using register_type_uq = typename EmuCore::TMP::remove_ref_cv<Register_>::type;
+		if constexpr (EmuSIMD::TMP::is_simd_register_v<register_type_uq>)
+		{
+			return _underlying_simd_helpers::_load_unaligned<Register_>(p_to_load_);
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to perform EmuSIMD::load_unaligned with an unsupported type as the passed Register_.");
+		}
+	}
+
+	/// <summary>
+	/// <para> Loads the first NumElements_ elements of a 128-bit SIMD register of the specified type from the data pointed to by p_to_load_, zeroing all remaining elements. </para>
+	/// <para> Unlike `load_unaligned`, no memory beyond the loaded elements is read, making this safe for reading the tails of tightly-packed data such as 3-element Vectors. </para>
+	/// <para> PerElementWidthIfInt_ is used to determine the width of elements within integral registers, and is ignored for floating-point registers. </para>
+	/// <para> The total number of loaded bytes must be 4, 8, 12, or 16. The pointed-to data has no alignment requirements. </para>
+	/// </summary>
+	/// <typeparam name="Register_">Type of 128-bit SIMD register to create from loaded data.</typeparam>
+	/// <param name="p_to_load_">Constant pointer to data to be loaded into the output register.</param>
+	/// <returns>SIMD register with its first NumElements_ elements loaded from p_to_load_, and remaining elements set to 0.</returns>
+	template<class Register_, std::size_t NumElements_, std::size_t PerElementWidthIfInt_ = 32, typename In_>
+	[[nodiscard]] inline Register_ load_partial(const In_* p_to_load_)
+	{
+		using register_type_uq = typename EmuCore::TMP::remove_ref_cv<Register_>::type;
+		if constexpr (EmuSIMD::TMP::is_simd_register_v<register_type_uq>)
+		{
+			constexpr std::size_t element_width_ = EmuSIMD::TMP::is_integral_simd_register_v<register_type_uq> ? PerElementWidthIfInt_ : (std::is_same_v<register_type_uq, __m128d> ? 64 : 32);
+			return _underlying_simd_helpers::_load_partial<Register_, (NumElements_ * element_width_) / 8>(p_to_load_);
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to perform EmuSIMD::load_partial with an unsupported type as the passed Register_.");
+		}
+	}
 }
 
 #endif
@@ -6,6 +6,7 @@
 #include "_simd_helpers_underlying_cmp.h"
 #include "_simd_helpers_underlying_set.h"
 #include "../../../../../EmuCore/TMPHelpers/Values.h"
+#include <limits>
 
 namespace EmuSIMD::_underlying_simd_helpers
 {
@@ -1520,6 +1521,143 @@ namespace EmuSIMD::_underlying_simd_helpers
 	}
 #pragma endregion
 
+#pragma region SQRT_OPS
+	template<class Register_>
+	[[nodiscard]] inline Register_ _sqrt(Register_ register_)
+	{
+		using register_type_uq = typename EmuCore::TMP::remove_ref_cv<Register_>::type;
+		if constexpr (EmuSIMD::TMP::is_simd_register_v<register_type_uq>)
+		{
+			if constexpr (std::is_same_v<register_type_uq, __m128>)
+			{
+				return _mm_sqrt_ps(register_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m256>)
+			{
+				return _mm256_sqrt_ps(register_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m512>)
+			{
+				return _mm512_sqrt_ps(register_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m128d>)
+			{
+				return _mm_sqrt_pd(register_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m256d>)
+			{
+				return _mm256_sqrt_pd(register_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m512d>)
+			{
+				return _mm512_sqrt_pd(register_);
+			}
+			else
+			{
+				static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to calculate the square root of a SIMD register via EmuSIMD helpers, but the provided SIMD register is not supported for this operation.");
+			}
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to calculate the square root of a SIMD register via EmuSIMD helpers, but the provided Register_ type is not recognised as a supported SIMD register.");
+		}
+	}
+
+	/// <summary>
+	/// <para> Applies a single Newton-Raphson step to the approximate reciprocal square root estimate_ of in_, calculating `estimate_ * (1.5 - (0.5 * in_ * estimate_ * estimate_))`. </para>
+	/// <para> Estimates of 0 or infinity produce NaN through this step (`0 * inf`), so _rsqrt replaces such lanes with an exact result. </para>
+	/// </summary>
+	template<class Register_>
+	[[nodiscard]] inline Register_ _rsqrt_newton_raphson(Register_ in_, Register_ estimate_)
+	{
+		using register_type_uq = typename EmuCore::TMP::remove_ref_cv<Register_>::type;
+		if constexpr (std::is_same_v<register_type_uq, __m128>)
+		{
+			__m128 half_in_estimate_ = _mm_mul_ps(_mm_mul_ps(in_, _mm_set1_ps(0.5f)), estimate_);
+			return _mm_mul_ps(estimate_, _mm_fnmadd_ps(half_in_estimate_, estimate_, _mm_set1_ps(1.5f)));
+		}
+		else if constexpr (std::is_same_v<register_type_uq, __m256>)
+		{
+			__m256 half_in_estimate_ = _mm256_mul_ps(_mm256_mul_ps(in_, _mm256_set1_ps(0.5f)), estimate_);
+			return _mm256_mul_ps(estimate_, _mm256_fnmadd_ps(half_in_estimate_, estimate_, _mm256_set1_ps(1.5f)));
+		}
+		else if constexpr (std::is_same_v<register_type_uq, __m512>)
+		{
+			__m512 half_in_estimate_ = _mm512_mul_ps(_mm512_mul_ps(in_, _mm512_set1_ps(0.5f)), estimate_);
+			return _mm512_mul_ps(estimate_, _mm512_fnmadd_ps(half_in_estimate_, estimate_, _mm512_set1_ps(1.5f)));
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to refine a reciprocal square root estimate via EmuSIMD helpers, but the provided SIMD register is not supported for this operation.");
+		}
+	}
+
+	template<class Register_>
+	[[nodiscard]] inline Register_ _rsqrt(Register_ register_)
+	{
+		using register_type_uq = typename EmuCore::TMP::remove_ref_cv<Register_>::type;
+		if constexpr (EmuSIMD::TMP::is_simd_register_v<register_type_uq>)
+		{
+			if constexpr (std::is_same_v<register_type_uq, __m128>)
+			{
+				__m128 estimate_ = _mm_rsqrt_ps(register_);
+				__m128 refined_ = _rsqrt_newton_raphson(register_, estimate_);
+				__m128 abs_estimate_ = _mm_andnot_ps(_mm_set1_ps(-0.0f), estimate_);
+				__m128 unrefinable_ = _mm_or_ps(_mm_cmpeq_ps(abs_estimate_, _mm_setzero_ps()), _mm_cmpeq_ps(abs_estimate_, _mm_set1_ps(std::numeric_limits<float>::infinity())));
+				if (_mm_movemask_ps(unrefinable_) != 0)
+				{
+					refined_ = _mm_blendv_ps(refined_, _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(register_)), unrefinable_);
+				}
+				return refined_;
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m256>)
+			{
+				__m256 estimate_ = _mm256_rsqrt_ps(register_);
+				__m256 refined_ = _rsqrt_newton_raphson(register_, estimate_);
+				__m256 abs_estimate_ = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), estimate_);
+				__m256 unrefinable_ = _mm256_or_ps(_mm256_cmp_ps(abs_estimate_, _mm256_setzero_ps(), _CMP_EQ_OQ), _mm256_cmp_ps(abs_estimate_, _mm256_set1_ps(std::numeric_limits<float>::infinity()), _CMP_EQ_OQ));
+				if (_mm256_movemask_ps(unrefinable_) != 0)
+				{
+					refined_ = _mm256_blendv_ps(refined_, _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(register_)), unrefinable_);
+				}
+				return refined_;
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m512>)
+			{
+				__m512 estimate_ = _mm512_rsqrt14_ps(register_);
+				__m512 refined_ = _rsqrt_newton_raphson(register_, estimate_);
+				__m512 abs_estimate_ = _mm512_abs_ps(estimate_);
+				__mmask16 unrefinable_ = _mm512_cmp_ps_mask(abs_estimate_, _mm512_setzero_ps(), _CMP_EQ_OQ) | _mm512_cmp_ps_mask(abs_estimate_, _mm512_set1_ps(std::numeric_limits<float>::infinity()), _CMP_EQ_OQ);
+				if (unrefinable_ != 0)
+				{
+					refined_ = _mm512_mask_blend_ps(unrefinable_, refined_, _mm512_div_ps(_mm512_set1_ps(1.0f), _mm512_sqrt_ps(register_)));
+				}
+				return refined_;
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m128d>)
+			{
+				return _mm_div_pd(_mm_set1_pd(1.0), _mm_sqrt_pd(register_));
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m256d>)
+			{
+				return _mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(register_));
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m512d>)
+			{
+				return _mm512_div_pd(_mm512_set1_pd(1.0), _mm512_sqrt_pd(register_));
+			}
+			else
+			{
+				static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to calculate the reciprocal square root of a SIMD register via EmuSIMD helpers, but the provided SIMD register is not supported for this operation.");
+			}
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to calculate the reciprocal square root of a SIMD register via EmuSIMD helpers, but the provided Register_ type is not recognised as a supported SIMD register.");
+		}
+	}
+#pragma endregion
+
 #pragma region MIN_MAX_OPS
 	template<std::size_t PerElementWidthIfInt_, bool SignedIfInt_, class Register_>
 	[[nodiscard]] inline Register_ _min(Register_ a_, Register_ b_)
@@ -253,6 +253,162 @@ namespace EmuSIMD::_underlying_simd_helpers
 			static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to store a SIMD register to a pointer via an EmuSIMD helper, but the provided register_ was not a supported SIMD register.");
 		}
 	}
+
+	template<typename Out_, class Register_, typename NoConstReq_ = std::enable_if_t<!std::is_const_v<Out_>>>
+	[[nodiscard]] inline void _store_register_unaligned(Register_ register_, Out_* p_out_)
+	{
+		if constexpr (EmuSIMD::TMP::is_simd_register_v<Register_>)
+		{
+			using register_type_uq = typename EmuCore::TMP::remove_ref_cv<Register_>::type;
+			if constexpr (std::is_same_v<register_type_uq, __m128>)
+			{
+				_mm_storeu_ps(reinterpret_cast<float*>(p_out_), register_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m128d>)
+			{
+				_mm_storeu_pd(reinterpret_cast<double*>(p_out_), register_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m256>)
+			{
+				_mm256_storeu_ps(reinterpret_cast<float*>(p_out_), register_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m256d>)
+			{
+				_mm256_storeu_pd(reinterpret_cast<double*>(p_out_), register_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m512>)
+			{
+				_mm512_storeu_ps(reinterpret_cast<void*>(p_out_), register_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m512d>)
+			{
+				_mm512_storeu_pd(reinterpret_cast<void*>(p_out_), register_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m128i>)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(p_out_), register_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m256i>)
+			{
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(p_out_), register_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m512i>)
+			{
+				_mm512_storeu_si512(reinterpret_cast<void*>(p_out_), register_);
+			}
+			else
+			{
+				static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to store a SIMD register to an unaligned pointer via an EmuSIMD helper, but the provided register_ could not be recognised.");
+			}
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to store a SIMD register to an unaligned pointer via an EmuSIMD helper, but the provided register_ was not a supported SIMD register.");
+		}
+	}
+
+	template<typename Out_, class Register_, typename NoConstReq_ = std::enable_if_t<!std::is_const_v<Out_>>>
+	inline void _store_register_non_temporal(Register_ register_, Out_* p_out_)
+	{
+		if constexpr (EmuSIMD::TMP::is_simd_register_v<Register_>)
+		{
+			using register_type_uq = typename EmuCore::TMP::remove_ref_cv<Register_>::type;
+			if constexpr (std::is_same_v<register_type_uq, __m128>)
+			{
+				_mm_stream_ps(reinterpret_cast<float*>(p_out_), register_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m128d>)
+			{
+				_mm_stream_pd(reinterpret_cast<double*>(p_out_), register_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m256>)
+			{
+				_mm256_stream_ps(reinterpret_cast<float*>(p_out_), register_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m256d>)
+			{
+				_mm256_stream_pd(reinterpret_cast<double*>(p_out_), register_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m512>)
+			{
+				_mm512_stream_ps(reinterpret_cast<void*>(p_out_), register_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m512d>)
+			{
+				_mm512_stream_pd(reinterpret_cast<void*>(p_out_), register_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m128i>)
+			{
+				_mm_stream_si128(reinterpret_cast<__m128i*>(p_out_), register_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m256i>)
+			{
+				_mm256_stream_si256(reinterpret_cast<__m256i*>(p_out_), register_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m512i>)
+			{
+				_mm512_stream_si512(reinterpret_cast<void*>(p_out_), register_);
+			}
+			else
+			{
+				static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to perform a non-temporal store of a SIMD register to a pointer via an EmuSIMD helper, but the provided register_ could not be recognised.");
+			}
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to perform a non-temporal store of a SIMD register to a pointer via an EmuSIMD helper, but the provided register_ was not a supported SIMD register.");
+		}
+	}
+
+	/// <summary> Stores the first NumBytes_ bytes of the passed 128-bit register to the passed pointer without writing beyond them. </summary>
+	template<std::size_t NumBytes_, typename Out_>
+	inline void _store_partial_128(__m128i register_, Out_* p_out_)
+	{
+		char* p_bytes_ = reinterpret_cast<char*>(p_out_);
+		if constexpr (NumBytes_ == 16)
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p_bytes_), register_);
+		}
+		else if constexpr (NumBytes_ == 12)
+		{
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(p_bytes_), register_);
+			_mm_store_ss(reinterpret_cast<float*>(p_bytes_ + 8), _mm_castsi128_ps(_mm_unpackhi_epi64(register_, register_)));
+		}
+		else if constexpr (NumBytes_ == 8)
+		{
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(p_bytes_), register_);
+		}
+		else if constexpr (NumBytes_ == 4)
+		{
+			_mm_store_ss(reinterpret_cast<float*>(p_bytes_), _mm_castsi128_ps(register_));
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<Out_>(), "Attempted to partially store a 128-bit SIMD register via EmuSIMD helpers, but the number of bytes to store is not supported. Only 4, 8, 12, or 16 bytes may be stored.");
+		}
+	}
+
+	template<std::size_t NumBytes_, class Register_, typename Out_>
+	inline void _store_partial(Register_ register_, Out_* p_out_)
+	{
+		using register_type_uq = EmuCore::TMP::remove_ref_cv_t<Register_>;
+		if constexpr (std::is_same_v<register_type_uq, __m128>)
+		{
+			_store_partial_128<NumBytes_>(_mm_castps_si128(register_), p_out_);
+		}
+		else if constexpr (std::is_same_v<register_type_uq, __m128d>)
+		{
+			_store_partial_128<NumBytes_>(_mm_castpd_si128(register_), p_out_);
+		}
+		else if constexpr (std::is_same_v<register_type_uq, __m128i>)
+		{
+			_store_partial_128<NumBytes_>(register_, p_out_);
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to partially store a SIMD register via EmuSIMD helpers, but the provided SIMD register type is not supported for this operation. Only 128-bit registers are supported.");
+		}
+	}
 }
 
 #endif
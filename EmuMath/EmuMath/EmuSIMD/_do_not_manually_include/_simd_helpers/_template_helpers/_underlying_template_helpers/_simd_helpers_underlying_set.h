@@ -1066,6 +1066,112 @@ namespace EmuSIMD::_underlying_simd_helpers
 			static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to load a SIMD register from memory via EmuSIMD helpers, but the provided Register_ type was not recognised as a supported SIMD register.");
 		}
 	}
+
+	template<class Register_, typename In_>
+	[[nodiscard]] inline Register_ _load_unaligned(const In_* p_to_load_)
+	{
+		using register_type_uq = EmuCore::TMP::remove_ref_cv_t<Register_>;
+		if constexpr (EmuSIMD::TMP::is_simd_register_v<register_type_uq>)
+		{
+			if constexpr (std::is_same_v<register_type_uq, __m128>)
+			{
+				return _mm_loadu_ps(reinterpret_cast<const float*>(p_to_load_));
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m256>)
+			{
+				return _mm256_loadu_ps(reinterpret_cast<const float*>(p_to_load_));
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m512>)
+			{
+				return _mm512_loadu_ps(p_to_load_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m128d>)
+			{
+				return _mm_loadu_pd(reinterpret_cast<const double*>(p_to_load_));
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m256d>)
+			{
+				return _mm256_loadu_pd(reinterpret_cast<const double*>(p_to_load_));
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m512d>)
+			{
+				return _mm512_loadu_pd(p_to_load_);
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m128i>)
+			{
+				return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_to_load_));
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m256i>)
+			{
+				return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_to_load_));
+			}
+			else if constexpr (std::is_same_v<register_type_uq, __m512i>)
+			{
+				return _mm512_loadu_si512(p_to_load_);
+			}
+			else
+			{
+				static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to load a SIMD register from unaligned memory via EmuSIMD helpers, but the provided SIMD register type is not supported for this operation.");
+			}
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to load a SIMD register from unaligned memory via EmuSIMD helpers, but the provided Register_ type was not recognised as a supported SIMD register.");
+		}
+	}
+
+	/// <summary> Loads the first NumBytes_ bytes of a 128-bit register from the passed pointer without reading beyond them, zeroing all remaining bytes. </summary>
+	template<std::size_t NumBytes_, typename In_>
+	[[nodiscard]] inline __m128i _load_partial_128(const In_* p_to_load_)
+	{
+		const char* p_bytes_ = reinterpret_cast<const char*>(p_to_load_);
+		if constexpr (NumBytes_ == 16)
+		{
+			return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_bytes_));
+		}
+		else if constexpr (NumBytes_ == 12)
+		{
+			return _mm_unpacklo_epi64
+			(
+				_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p_bytes_)),
+				_mm_castps_si128(_mm_load_ss(reinterpret_cast<const float*>(p_bytes_ + 8)))
+			);
+		}
+		else if constexpr (NumBytes_ == 8)
+		{
+			return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p_bytes_));
+		}
+		else if constexpr (NumBytes_ == 4)
+		{
+			return _mm_castps_si128(_mm_load_ss(reinterpret_cast<const float*>(p_bytes_)));
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<In_>(), "Attempted to partially load a 128-bit SIMD register via EmuSIMD helpers, but the number of bytes to load is not supported. Only 4, 8, 12, or 16 bytes may be loaded.");
+		}
+	}
+
+	template<class Register_, std::size_t NumBytes_, typename In_>
+	[[nodiscard]] inline Register_ _load_partial(const In_* p_to_load_)
+	{
+		using register_type_uq = EmuCore::TMP::remove_ref_cv_t<Register_>;
+		if constexpr (std::is_same_v<register_type_uq, __m128>)
+		{
+			return _mm_castsi128_ps(_load_partial_128<NumBytes_>(p_to_load_));
+		}
+		else if constexpr (std::is_same_v<register_type_uq, __m128d>)
+		{
+			return _mm_castsi128_pd(_load_partial_128<NumBytes_>(p_to_load_));
+		}
+		else if constexpr (std::is_same_v<register_type_uq, __m128i>)
+		{
+			return _load_partial_128<NumBytes_>(p_to_load_);
+		}
+		else
+		{
+			static_assert(EmuCore::TMP::get_false<Register_>(), "Attempted to partially load a SIMD register via EmuSIMD helpers, but the provided SIMD register type is not supported for this operation. Only 128-bit registers are supported.");
+		}
+	}
 }
 
 #endif
@@ -0,0 +1,404 @@
+#ifndef EMU_THREADS_FUNCTORS_BOUNDED_WORK_ALLOCATOR_H_INC_
+#define EMU_THREADS_FUNCTORS_BOUNDED_WORK_ALLOCATOR_H_INC_ 1
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <thread>
+#include <type_traits>
+#include "default_work_allocator.h"
+#include "task_storage.h"
+#include "../TMP/CommonThreadingAliases.h"
+#include "../../EmuCore/TMPHelpers/Values.h"
+
+namespace EmuThreads
+{
+	/// <summary> Behaviours of an EmuThreads::Functors::bounded_work_allocator when a task is allocated while its queue is full. </summary>
+	enum class QueueFullPolicy : std::uint8_t
+	{
+		// The allocating thread executes queued tasks until there is space for its own, so tasks allocating further tasks cannot deadlock the pool
+		BLOCK = 0x01,
+		// The task is rejected; AllocateTask outputs an invalid future and SubmitTask outputs false
+		FAIL = 0x02,
+		// The task is executed immediately on the allocating thread instead of being queued
+		RUN_INLINE = 0x04
+	};
+}
+
+namespace EmuThreads::Functors
+{
+	/// <summary>
+	/// <para> Work allocator which queues tasks in a bounded lock-free multi-producer/multi-consumer ring, instead of a locked queue. </para>
+	/// <para> Neither allocating threads nor linked threads ever lock, so producers feeding the pool at high rates see predictable latency. </para>
+	/// <para> When the queue is full, allocation follows the provided FullPolicy_ instead of growing the queue. </para>
+	/// <para> Small tasks are stored inline in the ring's slots, and futures use pooled shared states, so steady workloads do not allocate per task. </para>
+	/// <para>
+	///		Idle linked threads cannot park without a lock, so they yield for idle_spin_count checks and then sleep for the waiting time between checks.
+	///		A task allocated to a pool which has been idle for longer than the spin may therefore wait up to the waiting time (rounded up to the OS sleep granularity,
+	///		which may be several milliseconds) before starting. Where wake latency after idle periods matters more than allocation latency, prefer parking_work_allocator.
+	/// </para>
+	/// </summary>
+	/// <typeparam name="FullPolicy_">Behaviour when a task is allocated while the queue is full.</typeparam>
+	/// <typeparam name="Capacity_">Maximum number of tasks that may be queued at once. Must be a power of 2, and at least 2.</typeparam>
+	template<EmuThreads::QueueFullPolicy FullPolicy_ = EmuThreads::QueueFullPolicy::BLOCK, std::size_t Capacity_ = 4096>
+	class bounded_work_allocator
+	{
+	public:
+		using this_type = bounded_work_allocator<FullPolicy_, Capacity_>;
+		static constexpr EmuThreads::QueueFullPolicy full_policy = FullPolicy_;
+		static constexpr std::size_t capacity = Capacity_;
+
+		static_assert
+		(
+			full_policy == EmuThreads::QueueFullPolicy::BLOCK || full_policy == EmuThreads::QueueFullPolicy::FAIL || full_policy == EmuThreads::QueueFullPolicy::RUN_INLINE,
+			"Invalid EmuThreads::Functors::bounded_work_allocator instantiation: FullPolicy_ must be exactly one EmuThreads::QueueFullPolicy value."
+		);
+
+		/// <summary> The waiting time (in milliseconds) used when no other time is provided. </summary>
+		static constexpr double default_waiting_time_ms = default_work_allocator::default_waiting_time_ms;
+		/// <summary> Minimum waiting time (in milliseconds) that may be used in this allocator's downtime. </summary>
+		static constexpr double min_waiting_time_ms = default_work_allocator::min_waiting_time_ms;
+		/// <summary> Maximum waiting time (in milliseconds) that may be used in this allocator's downtime. </summary>
+		static constexpr double max_waiting_time_ms = default_work_allocator::max_waiting_time_ms;
+		/// <summary> The number of times an idle linked thread will check for work, yielding between each, before it begins sleeping for the waiting time between checks. </summary>
+		static constexpr std::size_t idle_spin_count = 1024;
+
+		/// <summary> Helper to reduce verbosity when creating a duration in milliseconds. The passed time value is not validated. </summary>
+		/// <param name="time_in_ms_">Number of milliseconds to use for creating the resulting duration.</param>
+		/// <returns>Chrono duration in milliseconds, with `double` representation, using the provided time_in_ms_. </returns>
+		template<typename InNum_>
+		[[nodiscard]] static constexpr inline std::chrono::duration<double, std::milli> time_in_ms(const InNum_& time_in_ms_)
+		{
+			return default_work_allocator::time_in_ms(time_in_ms_);
+		}
+
+		/// <summary> Creates a version of the passed waiting_time_ms_ which is valid for use with this allocator. </summary>
+		/// <param name="waiting_time_ms_">Waiting time to validate.</param>
+		/// <returns>The passed waiting_time_ms_ value clamped into the inclusive range min_waiting_time_ms:max_waiting_time_ms.</returns>
+		[[nodiscard]] static constexpr inline double validate_waiting_time_ms(double waiting_time_ms_)
+		{
+			return default_work_allocator::validate_waiting_time_ms(waiting_time_ms_);
+		}
+
+		bounded_work_allocator() : bounded_work_allocator(default_waiting_time_ms)
+		{
+		}
+
+		bounded_work_allocator(double waiting_time_ms_) :
+			is_active(true),
+			working_thread_count(0),
+			num_queued_tasks(0),
+			work_queue(),
+			waiting_time_ms(validate_waiting_time_ms(waiting_time_ms_))
+		{
+		}
+
+		/// <summary>
+		/// <para> Creates a work allocator from the passed allocator, taking tasks from the passed to_move_ allocator. </para>
+		/// <para> This construction will not retain the linked threads of the moved allocator, only its queued tasks. </para>
+		/// </summary>
+		/// <param name="to_move_">Work allocator to move into the newly constructed allocator.</param>
+		/// <param name="waiting_time_ms_">Custom time for threads linked to this allocator to wait for during downtime (in milliseconds).</param>
+		inline bounded_work_allocator(this_type&& to_move_, double waiting_time_ms_) : bounded_work_allocator(waiting_time_ms_)
+		{
+			// Both queues have the same capacity, so everything taken from to_move_ will fit
+			work_type task_;
+			while (to_move_.work_queue.TryPop(task_))
+			{
+				--to_move_.num_queued_tasks;
+				++num_queued_tasks;
+				static_cast<void>(work_queue.TryPush(std::move(task_)));
+			}
+		}
+		/// <summary>
+		/// <para> Creates a work allocator from the passed allocator, taking tasks from the passed to_move_ allocator. </para>
+		/// <para> This construction will not retain the linked threads of the moved allocator, only its queued tasks and waiting time. </para>
+		/// </summary>
+		/// <param name="to_move_">Work allocator to move into the newly constructed allocator.</param>
+		inline bounded_work_allocator(this_type&& to_move_) : bounded_work_allocator(std::forward<this_type>(to_move_), to_move_.waiting_time_ms)
+		{
+		}
+
+		bounded_work_allocator(const this_type&) = delete;
+
+		inline ~bounded_work_allocator()
+		{
+			Deactivate();
+			ClearWorkQueue();
+			WaitForAllTasksToComplete();
+		}
+
+		/// <summary>
+		/// <para> Constructs a thread which is launched into this allocator's task execution loop. </para>
+		/// <para> The thread will remain looping for as long as this allocator is in the active state, even when no tasks are queued. </para>
+		/// <para> It is the caller's responsibility to ensure that this thread is safely stored and, when needed, closed. </para>
+		/// <para>
+		///		Note: this object will gracefully finish active tasks upon destruction.
+		///		However, if threads are deallocated before this object's destruction,
+		///		it is the caller's responsibility to ensure it is not using threads before they are deallocated
+		///		(this can be achieved through Deactivate, followed by joining the threads in question (or equivalent)).
+		/// </para>
+		/// </summary>
+		/// <typeparam name="Thread_">Type of thread to construct.</typeparam>
+		/// <returns>Thread of the provided Thread_ type, constructed to be executing within this allocator's work loop for as long as it is active.</returns>
+		template<class Thread_>
+		[[nodiscard]] inline Thread_ LaunchThread()
+		{
+			return Thread_(&this_type::_worker_execution, this);
+		}
+
+		/// <summary>
+		/// <para> Removes any work that has not yet been allocated to a thread. </para>
+		/// <para> This will not stop work that is currently being executed. </para>
+		/// </summary>
+		inline void ClearWorkQueue()
+		{
+			work_type task_;
+			while (work_queue.TryPop(task_))
+			{
+				task_.Reset();
+				--num_queued_tasks;
+			}
+		}
+
+		/// <summary> Returns a boolean indicating if this allocator has any tasks queued and waiting for a thread. </summary>
+		[[nodiscard]] inline bool HasWork() const
+		{
+			return num_queued_tasks != 0;
+		}
+
+		/// <summary> The number of threads currently performing work from this allocator. </summary>
+		[[nodiscard]] inline std::size_t NumWorkingThreads() const
+		{
+			return working_thread_count;
+		}
+
+		/// <summary> Returns true if this allocator is active. While active, all threads created by it will be performing its execution loop until inactive. </summary>
+		[[nodiscard]] inline bool IsActive() const
+		{
+			return is_active;
+		}
+
+		/// <summary> The number of tasks that this allocator is waiting to provide to a thread for execution. </summary>
+		[[nodiscard]] inline std::size_t NumQueuedTasks() const
+		{
+			return num_queued_tasks;
+		}
+
+		/// <summary>
+		/// <para> Waits for all of this allocator's tasks to be completed, using only its linked threads to do so. </para>
+		/// <para> WARNING: if no threads are linked with this allocator, this will cause a program crash if any work is queued. </para>
+		/// </summary>
+		inline void WaitForAllTasksToCompleteNoJoin() const
+		{
+			while (HasWork() || working_thread_count != 0)
+			{
+				std::this_thread::sleep_for(time_in_ms(waiting_time_ms));
+			}
+		}
+
+		/// <summary>
+		/// <para> Waits for all of this allocator's tasks to be completed, and the calling thread may contribute to completing said tasks. </para>
+		/// <para> If the calling thread's contribution is undesired, call WaitForAllTasksToCompleteNoJoin instead. </para>
+		/// </summary>
+		inline void WaitForAllTasksToComplete()
+		{
+			while (HasWork() || working_thread_count != 0)
+			{
+				if (!_try_execute_next_task())
+				{
+					std::this_thread::sleep_for(time_in_ms(waiting_time_ms));
+				}
+			}
+		}
+		inline void WaitForAllTasksToComplete() const
+		{
+			// Work will only be poppable (and well-formed) if this is non-const, so this is conceptually safe to allow the calling thread to join in with work.
+			const_cast<this_type*>(this)->WaitForAllTasksToComplete();
+		}
+
+		/// <summary> Returns the amount of time that this allocator's linked threads will wait before checking for a new task, in milliseconds. </summary>
+		[[nodiscard]] inline double WaitingTimeMs() const
+		{
+			return waiting_time_ms;
+		}
+
+		/// <summary>
+		/// <para> Sets the amount of time (in milliseconds) that this allocator's linked threads will wait before checking for a new task. </para>
+		/// </summary>
+		/// <param name="waiting_time_ms_">
+		///		Amount of time to wait in milliseconds.
+		///		This will be clamped into the inclusive range min_waiting_time_ms:max_waiting_time_ms.
+		/// </param>
+		/// <returns>Validated value that the waiting time for this allocator is set to via the passed argument.</returns>
+		inline double WaitingTimeMs(double waiting_time_ms_)
+		{
+			waiting_time_ms = validate_waiting_time_ms(waiting_time_ms_);
+			return waiting_time_ms;
+		}
+
+		/// <summary> Marks this allocator as active, allowing threads linked to it to participate in its execution loop. </summary>
+		inline void Activate()
+		{
+			is_active = true;
+		}
+
+		/// <summary>
+		/// <para> Marks this allocator as inactive, preventing new threads from participating in its execution loop. </para>
+		/// <para> Additionally, currently linked threads will unlink once they have finished executing their current task if this allocator remains inactive. </para>
+		/// </summary>
+		inline void Deactivate()
+		{
+			is_active = false;
+		}
+
+		/// <summary>
+		/// <para> Allocates a task to be queued and executed by threads linked to this allocator. If the queue is full, this follows this allocator's full_policy. </para>
+		/// <para> The provided args_ must be compatible with the provided func_. </para>
+		/// <para> This does not enforce reference protection, or perform binds where they may be preferred. Such tasks are the responsibility of the caller, if needed. </para>
+		/// </summary>
+		/// <param name="func_">Invocable item to call.</param>
+		/// <param name="args_">Arguments to provide when invoking the passed func_, with the syntax `func_(args_...)`.</param>
+		/// <returns>
+		///		Future to the task, allowing its result to be retrieved. A complete future does not guarantee that previously allocated tasks are complete.
+		///		If the task was rejected under QueueFullPolicy::FAIL, the future will not be valid.
+		/// </returns>
+		template<class Func_, class...Args_>
+		inline auto AllocateTask(Func_ func_, Args_...args_)->std::future<decltype(func_(args_...))>
+		{
+			if constexpr (std::is_invocable_v<Func_, Args_...>)
+			{
+				std::future<decltype(func_(args_...))> future_;
+				work_type task_ = EmuThreads::Functors::make_promised_inline_task(future_, std::move(func_), std::move(args_)...);
+				if (!_push_task(std::move(task_)))
+				{
+					// Rejected, so invalidate the future; the promise is discarded with the task without ever being satisfied
+					return std::future<decltype(func_(args_...))>();
+				}
+				return future_;
+			}
+			else
+			{
+				static_assert(EmuCore::TMP::get_false<Func_>(), "Attempted to allocate a task via EmuThreading::Functors::bounded_work_allocator, but the provided Func_ type cannot be invoked with the provided Args_.");
+			}
+		}
+
+		/// <summary>
+		/// <para> Submits a task to be queued and executed by threads linked to this allocator, without providing a future to its completion. If the queue is full, this follows this allocator's full_policy. </para>
+		/// <para> The provided args_ must be compatible with the provided func_. Any result of the task is discarded, and any exception thrown by it will terminate the program. </para>
+		/// </summary>
+		/// <param name="func_">Invocable item to call.</param>
+		/// <param name="args_">Arguments to provide when invoking the passed func_, with the syntax `func_(args_...)`.</param>
+		/// <returns>True if the task was queued or executed; false if it was rejected under QueueFullPolicy::FAIL.</returns>
+		template<class Func_, class...Args_>
+		inline bool SubmitTask(Func_ func_, Args_...args_)
+		{
+			if constexpr (std::is_invocable_v<Func_, Args_...>)
+			{
+				return _push_task(EmuThreads::Functors::make_inline_task(std::move(func_), std::move(args_)...));
+			}
+			else
+			{
+				static_assert(EmuCore::TMP::get_false<Func_>(), "Attempted to submit a task via EmuThreading::Functors::bounded_work_allocator, but the provided Func_ type cannot be invoked with the provided Args_.");
+			}
+		}
+
+	private:
+		using work_type = EmuThreads::Functors::inline_task;
+		using work_queue_type = EmuThreads::Functors::mpmc_task_queue<capacity>;
+
+		/// <summary> This is designed to run on a separate worker thread, and not the main thread. Constantly looks for work, spinning before it sleeps when idle. </summary>
+		inline void _worker_execution()
+		{
+			std::size_t idle_checks_ = 0;
+			while (is_active)
+			{
+				if (_try_execute_next_task())
+				{
+					idle_checks_ = 0;
+				}
+				else if (idle_checks_ < idle_spin_count)
+				{
+					++idle_checks_;
+					std::this_thread::yield();
+				}
+				else
+				{
+					std::this_thread::sleep_for(time_in_ms(waiting_time_ms));
+				}
+			}
+		}
+
+		/// <summary> Pops and executes the next task if there is one. Returns true if a task was executed. </summary>
+		inline bool _try_execute_next_task()
+		{
+			work_type task_;
+			if (work_queue.TryPop(task_))
+			{
+				// Mark as working before the task leaves the queued count, so waiters never see a task which is neither queued nor running
+				++working_thread_count;
+				--num_queued_tasks;
+				_execute_task(task_);
+				--working_thread_count;
+				return true;
+			}
+			return false;
+		}
+
+		static inline void _execute_task(work_type& task_)
+		{
+			task_();
+			task_.Reset();
+		}
+
+		/// <summary> Queues the passed task, applying full_policy if the queue is full. Outputs false only if the task was rejected. </summary>
+		inline bool _push_task(work_type&& task_)
+		{
+			// Count before pushing so that the task is never taken before it is counted
+			++num_queued_tasks;
+			if (work_queue.TryPush(std::move(task_)))
+			{
+				return true;
+			}
+			--num_queued_tasks;
+
+			if constexpr (full_policy == EmuThreads::QueueFullPolicy::BLOCK)
+			{
+				do
+				{
+					// Help drain the queue instead of idling, which also prevents deadlock when every linked thread is allocating into a full queue
+					if (!_try_execute_next_task())
+					{
+						std::this_thread::yield();
+					}
+					++num_queued_tasks;
+					if (work_queue.TryPush(std::move(task_)))
+					{
+						return true;
+					}
+					--num_queued_tasks;
+				} while (true);
+			}
+			else if constexpr (full_policy == EmuThreads::QueueFullPolicy::FAIL)
+			{
+				return false;
+			}
+			else
+			{
+				++working_thread_count;
+				_execute_task(task_);
+				--working_thread_count;
+				return true;
+			}
+		}
+
+		alignas(EmuThreads::TMP::assumed_cache_line_size) std::atomic_bool is_active;
+		alignas(EmuThreads::TMP::assumed_cache_line_size) std::atomic_size_t working_thread_count;
+		alignas(EmuThreads::TMP::assumed_cache_line_size) std::atomic_size_t num_queued_tasks;
+		work_queue_type work_queue;
+		double waiting_time_ms;
+	};
+}
+
+#endif
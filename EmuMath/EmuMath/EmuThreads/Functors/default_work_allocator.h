@@ -1,6 +1,8 @@
 #ifndef EMU_THREADS_FUNCTORS_DEFAULT_WORK_ALLOCATOR_H_INC_
 #define EMU_THREADS_FUNCTORS_DEFAULT_WORK_ALLOCATOR_H_INC_ 1
 
+#include "task_storage.h"
+#include "../TMP/CommonThreadingAliases.h"
 #include "../../EmuCore/TMPHelpers/Values.h"
 #include <atomic>
 #include <chrono>
@@ -8,7 +10,6 @@
 #include <future>
 #include <limits>
 #include <mutex>
-#include <queue>
 #include <type_traits>
 
 namespace EmuThreads::Functors
@@ -47,6 +48,7 @@ namespace EmuThreads::Functors
 			work_queue(),
 			queue_mutex(),
 			working_thread_count(0),
+			num_queued_tasks(0),
 			waiting_time_ms(default_waiting_time_ms)
 		{
 		}
@@ -56,6 +58,7 @@ namespace EmuThreads::Functors
 			work_queue(),
 			queue_mutex(),
 			working_thread_count(0),
+			num_queued_tasks(0),
 			waiting_time_ms(validate_waiting_time_ms(waiting_time_ms_))
 		{
 		}
@@ -71,10 +74,12 @@ namespace EmuThreads::Functors
 			work_queue(),
 			queue_mutex(),
 			working_thread_count(0),
+			num_queued_tasks(0),
 			waiting_time_ms(validate_waiting_time_ms(waiting_time_ms_))
 		{
 			std::lock_guard<mutex_type> lock_(to_move_.queue_mutex);
-			work_queue.swap(to_move_.work_queue);
+			work_queue.Swap(to_move_.work_queue);
+			num_queued_tasks = work_queue.Size();
 			to_move_.num_queued_tasks = 0;
 		}
 		/// <summary>
@@ -121,7 +126,9 @@ namespace EmuThreads::Functors
 		inline void ClearWorkQueue()
 		{
 			std::lock_guard<mutex_type> lock_(queue_mutex);
-			decltype(work_queue)().swap(work_queue);
+			work_queue.Clear();
+			work_queue.ShrinkToRetainedCapacity();
+			num_queued_tasks = 0;
 		}
 
 		/// <summary> Returns a boolean indicating if this allocator has any tasks queued and waiting for a thread. </summary>
@@ -217,6 +224,7 @@ namespace EmuThreads::Functors
 		/// <para> Allocates a task to be queued and executed by threads linked to this allocator. </para>
 		/// <para> The provided args_ must be compatible with the provided func_. </para>
 		/// <para> This does not enforce reference protection, or perform binds where they may be preferred. Such tasks are the responsibility of the caller, if needed. </para>
+		/// <para> Small tasks are stored inline in a reused queue slot, and the future's shared state is pooled, so steady workloads do not allocate per task. </para>
 		/// </summary>
 		/// <param name="func_">Invocable item to call.</param>
 		/// <param name="args_">Arguments to provide when invoking the passed func_, with the syntax `func_(args_...)`.</param>
@@ -226,11 +234,10 @@ namespace EmuThreads::Functors
 		{
 			if constexpr (std::is_invocable_v<Func_, Args_...>)
 			{
-				auto wrapped_func_ = std::make_shared<std::packaged_task<decltype(func_(args_...))(Args_...)>>(func_);
-				std::lock_guard<mutex_type> lock_(queue_mutex);
-				work_queue.emplace([=]() { (*wrapped_func_)(args_...); });
-				++num_queued_tasks;
-				return wrapped_func_->get_future();
+				std::future<decltype(func_(args_...))> future_;
+				work_type task_ = EmuThreads::Functors::make_promised_inline_task(future_, std::move(func_), std::move(args_)...);
+				_push_task(std::move(task_));
+				return future_;
 			}
 			else
 			{
@@ -238,11 +245,38 @@ namespace EmuThreads::Functors
 			}
 		}
 
+		/// <summary>
+		/// <para> Submits a task to be queued and executed by threads linked to this allocator, without providing a future to its completion. </para>
+		/// <para> Small tasks are stored inline in a reused queue slot, so steady workloads do not allocate per task. </para>
+		/// <para> The provided args_ must be compatible with the provided func_. Any result of the task is discarded, and any exception thrown by it will terminate the program. </para>
+		/// </summary>
+		/// <param name="func_">Invocable item to call.</param>
+		/// <param name="args_">Arguments to provide when invoking the passed func_, with the syntax `func_(args_...)`.</param>
+		template<class Func_, class...Args_>
+		inline void SubmitTask(Func_ func_, Args_...args_)
+		{
+			if constexpr (std::is_invocable_v<Func_, Args_...>)
+			{
+				_push_task(EmuThreads::Functors::make_inline_task(std::move(func_), std::move(args_)...));
+			}
+			else
+			{
+				static_assert(EmuCore::TMP::get_false<Func_>(), "Attempted to submit a task via EmuThreading::Functors::default_work_allocator, but the provided Func_ type cannot be invoked with the provided Args_.");
+			}
+		}
+
 	private:
-		using work_type = std::function<void()>;
-		using work_queue_type = std::queue<work_type>;
+		using work_type = EmuThreads::Functors::inline_task;
+		using work_queue_type = EmuThreads::Functors::task_ring_buffer;
 		using mutex_type = std::mutex;
 
+		inline void _push_task(work_type&& task_)
+		{
+			std::lock_guard<mutex_type> lock_(queue_mutex);
+			work_queue.Push(std::move(task_));
+			++num_queued_tasks;
+		}
+
 		/// <summary> This is designed to run on a separate worker thread, and not the main thread. Constantly looks for work. </summary>
 		inline void _worker_execution()
 		{
@@ -274,23 +308,22 @@ namespace EmuThreads::Functors
 
 		inline work_type _pop_next_task()
 		{
-			work_type out_task_ = std::move(work_queue.front());
-			work_queue.pop();
+			work_type out_task_ = work_queue.Pop();
 			--num_queued_tasks;
 
 			if (num_queued_tasks == 0)
 			{
 				// Queue clearance if we've hit 0 to free memory in cases where many tasks have been provided
 				// --- Safe to do this way as this function should only be called when in a locked state
-				// --- Large allocations (such as a parallel loop) can waste a lot of space even with built-in clearance, so do this to play safe
-				decltype(work_queue)().swap(work_queue);
+				// --- Slots up to the retained capacity are kept so that typical workloads reuse them instead of reallocating
+				work_queue.ShrinkToRetainedCapacity();
 			}
 			return out_task_;
 		}
 
 		std::atomic_bool is_active;
-		std::atomic_size_t working_thread_count;
-		std::atomic_size_t num_queued_tasks;
+		alignas(EmuThreads::TMP::assumed_cache_line_size) std::atomic_size_t working_thread_count;
+		alignas(EmuThreads::TMP::assumed_cache_line_size) std::atomic_size_t num_queued_tasks;
 		mutex_type queue_mutex;
 		work_queue_type work_queue;
 		double waiting_time_ms;
@@ -0,0 +1,423 @@
+#ifndef EMU_THREADS_FUNCTORS_PARKING_WORK_ALLOCATOR_H_INC_
+#define EMU_THREADS_FUNCTORS_PARKING_WORK_ALLOCATOR_H_INC_ 1
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include "default_work_allocator.h"
+#include "task_storage.h"
+#include "../TMP/CommonThreadingAliases.h"
+#include "../../EmuCore/TMPHelpers/Values.h"
+
+namespace EmuThreads::Functors
+{
+	/// <summary>
+	/// <para> Work allocator with the same task storage as default_work_allocator, but which parks idle threads instead of having them repeatedly sleep and poll. </para>
+	/// <para> A thread which finds no work will first spin for up to SpinCount() checks, yielding between each, and then park on a condition variable. </para>
+	/// <para> Parked threads are woken as soon as a task is allocated, so the time from allocation to execution does not depend on the waiting time. </para>
+	/// <para> The waiting time instead acts as the maximum time a thread will stay parked before checking for work by itself, and defaults to a much larger value. </para>
+	/// </summary>
+	class parking_work_allocator
+	{
+	public:
+		using this_type = parking_work_allocator;
+
+		/// <summary> The waiting time (in milliseconds) used when no other time is provided. Equivalent to 100 milliseconds, as parked threads are woken upon allocation. </summary>
+		static constexpr double default_waiting_time_ms = 100.0;
+		/// <summary> Minimum waiting time (in milliseconds) that may be used in this allocator's downtime. </summary>
+		static constexpr double min_waiting_time_ms = default_work_allocator::min_waiting_time_ms;
+		/// <summary> Maximum waiting time (in milliseconds) that may be used in this allocator's downtime. </summary>
+		static constexpr double max_waiting_time_ms = default_work_allocator::max_waiting_time_ms;
+		/// <summary> The number of times an idle thread will check for work before parking, when no other count is provided. </summary>
+		static constexpr std::size_t default_spin_count = 1024;
+
+		/// <summary> Helper to reduce verbosity when creating a duration in milliseconds. The passed time value is not validated. </summary>
+		/// <param name="time_in_ms_">Number of milliseconds to use for creating the resulting duration.</param>
+		/// <returns>Chrono duration in milliseconds, with `double` representation, using the provided time_in_ms_. </returns>
+		template<typename InNum_>
+		[[nodiscard]] static constexpr inline std::chrono::duration<double, std::milli> time_in_ms(const InNum_& time_in_ms_)
+		{
+			return default_work_allocator::time_in_ms(time_in_ms_);
+		}
+
+		/// <summary> Creates a version of the passed waiting_time_ms_ which is valid for use with this allocator. </summary>
+		/// <param name="waiting_time_ms_">Waiting time to validate.</param>
+		/// <returns>The passed waiting_time_ms_ value clamped into the inclusive range min_waiting_time_ms:max_waiting_time_ms.</returns>
+		[[nodiscard]] static constexpr inline double validate_waiting_time_ms(double waiting_time_ms_)
+		{
+			return default_work_allocator::validate_waiting_time_ms(waiting_time_ms_);
+		}
+
+		parking_work_allocator() : parking_work_allocator(default_waiting_time_ms, default_spin_count)
+		{
+		}
+
+		parking_work_allocator(double waiting_time_ms_) : parking_work_allocator(waiting_time_ms_, default_spin_count)
+		{
+		}
+
+		parking_work_allocator(double waiting_time_ms_, std::size_t spin_count_) :
+			is_active(true),
+			working_thread_count(0),
+			num_queued_tasks(0),
+			num_parked_threads(0),
+			num_completion_waiters(0),
+			queue_mutex(),
+			work_available(),
+			work_completed(),
+			work_queue(),
+			waiting_time_ms(validate_waiting_time_ms(waiting_time_ms_)),
+			spin_count(spin_count_)
+		{
+		}
+
+		/// <summary>
+		/// <para> Creates a work allocator from the passed allocator, taking tasks from the passed to_move_ allocator. </para>
+		/// <para> This construction will not retain the linked threads of the moved allocator, only its queued tasks and spin count. </para>
+		/// </summary>
+		/// <param name="to_move_">Work allocator to move into the newly constructed allocator.</param>
+		/// <param name="waiting_time_ms_">Custom time for threads linked to this allocator to stay parked for during downtime (in milliseconds).</param>
+		inline parking_work_allocator(this_type&& to_move_, double waiting_time_ms_) noexcept :
+			parking_work_allocator(waiting_time_ms_, to_move_.spin_count)
+		{
+			std::lock_guard<mutex_type> lock_(to_move_.queue_mutex);
+			work_queue.Swap(to_move_.work_queue);
+			num_queued_tasks = work_queue.Size();
+			to_move_.num_queued_tasks = 0;
+		}
+		/// <summary>
+		/// <para> Creates a work allocator from the passed allocator, taking tasks from the passed to_move_ allocator. </para>
+		/// <para> This construction will not retain the linked threads of the moved allocator, only its queued tasks, waiting time, and spin count. </para>
+		/// </summary>
+		/// <param name="to_move_">Work allocator to move into the newly constructed allocator.</param>
+		inline parking_work_allocator(this_type&& to_move_) noexcept : parking_work_allocator(std::forward<this_type>(to_move_), to_move_.waiting_time_ms)
+		{
+		}
+
+		parking_work_allocator(const this_type&) = delete;
+
+		inline ~parking_work_allocator()
+		{
+			Deactivate();
+			ClearWorkQueue();
+			WaitForAllTasksToComplete();
+		}
+
+		/// <summary>
+		/// <para> Constructs a thread which is launched into this allocator's task execution loop. </para>
+		/// <para> The thread will remain looping for as long as this allocator is in the active state, even when no tasks are queued. </para>
+		/// <para> It is the caller's responsibility to ensure that this thread is safely stored and, when needed, closed. </para>
+		/// <para>
+		///		Note: this object will gracefully finish active tasks upon destruction.
+		///		However, if threads are deallocated before this object's destruction,
+		///		it is the caller's responsibility to ensure it is not using threads before they are deallocated
+		///		(this can be achieved through Deactivate, followed by joining the threads in question (or equivalent)).
+		/// </para>
+		/// </summary>
+		/// <typeparam name="Thread_">Type of thread to construct.</typeparam>
+		/// <returns>Thread of the provided Thread_ type, constructed to be executing within this allocator's work loop for as long as it is active.</returns>
+		template<class Thread_>
+		[[nodiscard]] inline Thread_ LaunchThread()
+		{
+			return Thread_(&this_type::_worker_execution, this);
+		}
+
+		/// <summary>
+		/// <para> Removes any work that has not yet been allocated to a thread. </para>
+		/// <para> This will not stop work that is currently being executed. </para>
+		/// </summary>
+		inline void ClearWorkQueue()
+		{
+			{
+				std::lock_guard<mutex_type> lock_(queue_mutex);
+				work_queue.Clear();
+				work_queue.ShrinkToRetainedCapacity();
+				num_queued_tasks = 0;
+			}
+			_notify_if_complete();
+		}
+
+		/// <summary> Returns a boolean indicating if this allocator has any tasks queued and waiting for a thread. </summary>
+		[[nodiscard]] inline bool HasWork() const
+		{
+			return num_queued_tasks != 0;
+		}
+
+		/// <summary> The number of threads currently performing work from this allocator. </summary>
+		[[nodiscard]] inline std::size_t NumWorkingThreads() const
+		{
+			return working_thread_count;
+		}
+
+		/// <summary> The number of threads currently parked while waiting for this allocator to receive work. </summary>
+		[[nodiscard]] inline std::size_t NumParkedThreads() const
+		{
+			return num_parked_threads;
+		}
+
+		/// <summary> Returns true if this allocator is active. While active, all threads created by it will be performing its execution loop until inactive. </summary>
+		[[nodiscard]] inline bool IsActive() const
+		{
+			return is_active;
+		}
+
+		/// <summary> The number of tasks that this allocator is waiting to provide to a thread for execution. </summary>
+		[[nodiscard]] inline std::size_t NumQueuedTasks() const
+		{
+			return num_queued_tasks;
+		}
+
+		/// <summary>
+		/// <para> Waits for all of this allocator's tasks to be completed, using only its linked threads to do so. </para>
+		/// <para> The calling thread is blocked until woken by the completion of the final task, rather than polling. </para>
+		/// <para> WARNING: if no threads are linked with this allocator, this will block forever if any work is queued. </para>
+		/// </summary>
+		inline void WaitForAllTasksToCompleteNoJoin() const
+		{
+			const_cast<this_type*>(this)->_wait_for_completion();
+		}
+
+		/// <summary>
+		/// <para> Waits for all of this allocator's tasks to be completed, and the calling thread may contribute to completing said tasks. </para>
+		/// <para> Once no tasks remain queued, the calling thread is blocked until woken by the completion of the final task. </para>
+		/// <para> If the calling thread's contribution is undesired, call WaitForAllTasksToCompleteNoJoin instead. </para>
+		/// </summary>
+		inline void WaitForAllTasksToComplete()
+		{
+			while (_try_execute_next_task())
+			{
+			}
+			_wait_for_completion();
+		}
+		inline void WaitForAllTasksToComplete() const
+		{
+			// Work will only be poppable (and well-formed) if this is non-const, so this is conceptually safe to allow the calling thread to join in with work.
+			const_cast<this_type*>(this)->WaitForAllTasksToComplete();
+		}
+
+		/// <summary> Returns the maximum amount of time that this allocator's linked threads will stay parked before checking for a new task, in milliseconds. </summary>
+		[[nodiscard]] inline double WaitingTimeMs() const
+		{
+			return waiting_time_ms;
+		}
+
+		/// <summary>
+		/// <para> Sets the maximum amount of time (in milliseconds) that this allocator's linked threads will stay parked before checking for a new task. </para>
+		/// <para> Parked threads are woken when a task is allocated regardless of this time. </para>
+		/// </summary>
+		/// <param name="waiting_time_ms_">
+		///		Amount of time to wait in milliseconds.
+		///		This will be clamped into the inclusive range min_waiting_time_ms:max_waiting_time_ms.
+		/// </param>
+		/// <returns>Validated value that the waiting time for this allocator is set to via the passed argument.</returns>
+		inline double WaitingTimeMs(double waiting_time_ms_)
+		{
+			waiting_time_ms = validate_waiting_time_ms(waiting_time_ms_);
+			return waiting_time_ms;
+		}
+
+		/// <summary> Returns the number of times that an idle thread linked to this allocator will check for work before parking. </summary>
+		[[nodiscard]] inline std::size_t SpinCount() const
+		{
+			return spin_count;
+		}
+
+		/// <summary> Sets the number of times that an idle thread linked to this allocator will check for work before parking. 0 will park idle threads immediately. </summary>
+		inline std::size_t SpinCount(std::size_t spin_count_)
+		{
+			spin_count = spin_count_;
+			return spin_count;
+		}
+
+		/// <summary> Marks this allocator as active, allowing threads linked to it to participate in its execution loop. </summary>
+		inline void Activate()
+		{
+			is_active = true;
+		}
+
+		/// <summary>
+		/// <para> Marks this allocator as inactive, preventing new threads from participating in its execution loop. </para>
+		/// <para> Parked threads are woken so that they may unlink immediately. </para>
+		/// <para> Additionally, currently linked threads will unlink once they have finished executing their current task if this allocator remains inactive. </para>
+		/// </summary>
+		inline void Deactivate()
+		{
+			{
+				// Lock so that no thread can miss the change between checking for it and parking
+				std::lock_guard<mutex_type> lock_(queue_mutex);
+				is_active = false;
+			}
+			work_available.notify_all();
+		}
+
+		/// <summary>
+		/// <para> Allocates a task to be queued and executed by threads linked to this allocator, waking a parked thread if there are any. </para>
+		/// <para> The provided args_ must be compatible with the provided func_. </para>
+		/// <para> This does not enforce reference protection, or perform binds where they may be preferred. Such tasks are the responsibility of the caller, if needed. </para>
+		/// <para> Small tasks are stored inline in a reused queue slot, and the future's shared state is pooled, so steady workloads do not allocate per task. </para>
+		/// </summary>
+		/// <param name="func_">Invocable item to call.</param>
+		/// <param name="args_">Arguments to provide when invoking the passed func_, with the syntax `func_(args_...)`.</param>
+		/// <returns>Future to the task, allowing its result to be retrieved. A complete future does not guarantee that previously allocated tasks are complete.</returns>
+		template<class Func_, class...Args_>
+		inline auto AllocateTask(Func_ func_, Args_...args_)->std::future<decltype(func_(args_...))>
+		{
+			if constexpr (std::is_invocable_v<Func_, Args_...>)
+			{
+				std::future<decltype(func_(args_...))> future_;
+				work_type task_ = EmuThreads::Functors::make_promised_inline_task(future_, std::move(func_), std::move(args_)...);
+				_push_task(std::move(task_));
+				return future_;
+			}
+			else
+			{
+				static_assert(EmuCore::TMP::get_false<Func_>(), "Attempted to allocate a task via EmuThreading::Functors::parking_work_allocator, but the provided Func_ type cannot be invoked with the provided Args_.");
+			}
+		}
+
+		/// <summary>
+		/// <para> Submits a task to be queued and executed by threads linked to this allocator without providing a future to its completion, waking a parked thread if there are any. </para>
+		/// <para> Small tasks are stored inline in a reused queue slot, so steady workloads do not allocate per task. </para>
+		/// <para> The provided args_ must be compatible with the provided func_. Any result of the task is discarded, and any exception thrown by it will terminate the program. </para>
+		/// </summary>
+		/// <param name="func_">Invocable item to call.</param>
+		/// <param name="args_">Arguments to provide when invoking the passed func_, with the syntax `func_(args_...)`.</param>
+		template<class Func_, class...Args_>
+		inline void SubmitTask(Func_ func_, Args_...args_)
+		{
+			if constexpr (std::is_invocable_v<Func_, Args_...>)
+			{
+				_push_task(EmuThreads::Functors::make_inline_task(std::move(func_), std::move(args_)...));
+			}
+			else
+			{
+				static_assert(EmuCore::TMP::get_false<Func_>(), "Attempted to submit a task via EmuThreading::Functors::parking_work_allocator, but the provided Func_ type cannot be invoked with the provided Args_.");
+			}
+		}
+
+	private:
+		using work_type = EmuThreads::Functors::inline_task;
+		using work_queue_type = EmuThreads::Functors::task_ring_buffer;
+		using mutex_type = std::mutex;
+
+		inline void _push_task(work_type&& task_)
+		{
+			{
+				std::lock_guard<mutex_type> lock_(queue_mutex);
+				work_queue.Push(std::move(task_));
+				++num_queued_tasks;
+			}
+
+			// Parked threads only register while holding the lock, so any thread parking after our push will see the task before it parks
+			if (num_parked_threads != 0)
+			{
+				work_available.notify_one();
+			}
+		}
+
+		/// <summary> This is designed to run on a separate worker thread, and not the main thread. Executes work when available, and otherwise spins then parks. </summary>
+		inline void _worker_execution()
+		{
+			while (is_active)
+			{
+				if (!_try_execute_next_task())
+				{
+					_idle();
+				}
+			}
+		}
+
+		/// <summary> Pops and executes the next task if there is one. Returns true if a task was executed. </summary>
+		inline bool _try_execute_next_task()
+		{
+			std::unique_lock<mutex_type> lock_(queue_mutex);
+			if (num_queued_tasks != 0)
+			{
+				// Get task and unlock as soon as reasonable
+				++working_thread_count;
+				work_type next_task_ = std::move(_pop_next_task());
+				lock_.unlock();
+
+				next_task_();
+				--working_thread_count;
+				_notify_if_complete();
+				return true;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		inline void _idle()
+		{
+			for (std::size_t i = 0; i < spin_count; ++i)
+			{
+				if (num_queued_tasks != 0 || !is_active)
+				{
+					return;
+				}
+				std::this_thread::yield();
+			}
+
+			std::unique_lock<mutex_type> lock_(queue_mutex);
+			++num_parked_threads;
+			work_available.wait_for(lock_, time_in_ms(waiting_time_ms), [this]() { return num_queued_tasks != 0 || !is_active; });
+			--num_parked_threads;
+		}
+
+		/// <summary> Blocks the calling thread until no tasks are queued or being executed. </summary>
+		inline void _wait_for_completion()
+		{
+			std::unique_lock<mutex_type> lock_(queue_mutex);
+			++num_completion_waiters;
+			work_completed.wait(lock_, [this]() { return num_queued_tasks == 0 && working_thread_count == 0; });
+			--num_completion_waiters;
+		}
+
+		/// <summary> Wakes any threads waiting for completion if there are no tasks queued or being executed. </summary>
+		inline void _notify_if_complete()
+		{
+			// Completion waiters register while holding the lock before checking for completion, so locking here guarantees they are either notified or see completion
+			if (num_completion_waiters != 0 && num_queued_tasks == 0 && working_thread_count == 0)
+			{
+				std::lock_guard<mutex_type> lock_(queue_mutex);
+				work_completed.notify_all();
+			}
+		}
+
+		inline work_type _pop_next_task()
+		{
+			work_type out_task_ = work_queue.Pop();
+			--num_queued_tasks;
+
+			if (num_queued_tasks == 0)
+			{
+				// Queue clearance if we've hit 0 to free memory in cases where many tasks have been provided
+				// --- Safe to do this way as this function should only be called when in a locked state
+				work_queue.ShrinkToRetainedCapacity();
+			}
+			return out_task_;
+		}
+
+		std::atomic_bool is_active;
+		alignas(EmuThreads::TMP::assumed_cache_line_size) std::atomic_size_t working_thread_count;
+		alignas(EmuThreads::TMP::assumed_cache_line_size) std::atomic_size_t num_queued_tasks;
+		std::atomic_size_t num_parked_threads;
+		std::atomic_size_t num_completion_waiters;
+		mutex_type queue_mutex;
+		std::condition_variable work_available;
+		std::condition_variable work_completed;
+		work_queue_type work_queue;
+		double waiting_time_ms;
+		std::size_t spin_count;
+	};
+}
+
+#endif
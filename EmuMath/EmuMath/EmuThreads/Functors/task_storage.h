@@ -0,0 +1,729 @@
+#ifndef EMU_THREADS_FUNCTORS_TASK_STORAGE_H_INC_
+#define EMU_THREADS_FUNCTORS_TASK_STORAGE_H_INC_ 1
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../TMP/CommonThreadingAliases.h"
+
+namespace EmuThreads::Functors
+{
+	/// <summary>
+	/// <para> Move-only type-erased task invoked with the syntax `task_()`, which stores small callables inline instead of allocating them on the heap. </para>
+	/// <para> Callables are stored inline if they fit within storage_size bytes, require no more than storage_alignment alignment, and are nothrow-move-constructible. </para>
+	/// <para> Any other callables are still accepted, but are allocated on the heap. </para>
+	/// <para> The size of an inline_task is intended to match a typical cache line, so that consecutive tasks in a task_ring_buffer do not share lines. </para>
+	/// </summary>
+	class inline_task
+	{
+	public:
+		using this_type = inline_task;
+
+		/// <summary> Number of bytes available for storing a callable inline. </summary>
+		static constexpr std::size_t storage_size = 48;
+		/// <summary> Maximum alignment of a callable which may be stored inline. </summary>
+		static constexpr std::size_t storage_alignment = alignof(std::max_align_t);
+
+		/// <summary> Returns true if a callable of the passed Func_ type will be stored inline, without allocating. </summary>
+		template<class Func_>
+		[[nodiscard]] static constexpr inline bool is_stored_inline()
+		{
+			using func_type = std::decay_t<Func_>;
+			return sizeof(func_type) <= storage_size && alignof(func_type) <= storage_alignment && std::is_nothrow_move_constructible_v<func_type>;
+		}
+
+		/// <summary> Constructs an empty task, which may not be invoked. </summary>
+		inline_task() noexcept : ops(nullptr)
+		{
+		}
+
+		/// <summary> Constructs a task which will invoke a decayed copy of the passed func_. </summary>
+		/// <param name="func_">Invocable item taking no arguments. This will be stored inline if is_stored_inline&lt;Func_&gt;() is true.</param>
+		template<class Func_, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Func_>, this_type> && std::is_invocable_v<std::decay_t<Func_>&>>>
+		inline_task(Func_&& func_) : ops(_ops_for<std::decay_t<Func_>>())
+		{
+			using func_type = std::decay_t<Func_>;
+			if constexpr (is_stored_inline<func_type>())
+			{
+				new(static_cast<void*>(storage)) func_type(std::forward<Func_>(func_));
+			}
+			else
+			{
+				*reinterpret_cast<func_type**>(storage) = new func_type(std::forward<Func_>(func_));
+			}
+		}
+
+		inline_task(this_type&& to_move_) noexcept : ops(to_move_.ops)
+		{
+			if (ops != nullptr)
+			{
+				ops->move(storage, to_move_.storage);
+				to_move_.ops = nullptr;
+			}
+		}
+
+		inline_task(const this_type&) = delete;
+
+		~inline_task()
+		{
+			Reset();
+		}
+
+		inline this_type& operator=(this_type&& to_move_) noexcept
+		{
+			if (this != &to_move_)
+			{
+				Reset();
+				if (to_move_.ops != nullptr)
+				{
+					ops = to_move_.ops;
+					ops->move(storage, to_move_.storage);
+					to_move_.ops = nullptr;
+				}
+			}
+			return *this;
+		}
+
+		this_type& operator=(const this_type&) = delete;
+
+		/// <summary> Invokes the stored callable. This task must not be empty. </summary>
+		inline void operator()()
+		{
+			ops->invoke(storage);
+		}
+
+		/// <summary> Returns true if this task contains a callable. </summary>
+		[[nodiscard]] explicit inline operator bool() const noexcept
+		{
+			return ops != nullptr;
+		}
+
+		/// <summary> Destroys the stored callable, if there is one, leaving this task empty. </summary>
+		inline void Reset() noexcept
+		{
+			if (ops != nullptr)
+			{
+				ops->destroy(storage);
+				ops = nullptr;
+			}
+		}
+
+	private:
+		struct _ops_table
+		{
+			void(*invoke)(void*);
+			void(*move)(void*, void*);
+			void(*destroy)(void*);
+		};
+
+		template<class Func_>
+		[[nodiscard]] static inline Func_& _get(void* storage_)
+		{
+			if constexpr (is_stored_inline<Func_>())
+			{
+				return *std::launder(reinterpret_cast<Func_*>(storage_));
+			}
+			else
+			{
+				return **reinterpret_cast<Func_**>(storage_);
+			}
+		}
+
+		template<class Func_>
+		static inline void _invoke(void* storage_)
+		{
+			_get<Func_>(storage_)();
+		}
+
+		template<class Func_>
+		static inline void _move(void* out_storage_, void* in_storage_)
+		{
+			if constexpr (is_stored_inline<Func_>())
+			{
+				Func_& in_func_ = _get<Func_>(in_storage_);
+				new(out_storage_) Func_(std::move(in_func_));
+				in_func_.~Func_();
+			}
+			else
+			{
+				// Heap-allocated callables only need their pointer transferring
+				*reinterpret_cast<Func_**>(out_storage_) = *reinterpret_cast<Func_**>(in_storage_);
+			}
+		}
+
+		template<class Func_>
+		static inline void _destroy(void* storage_)
+		{
+			if constexpr (is_stored_inline<Func_>())
+			{
+				_get<Func_>(storage_).~Func_();
+			}
+			else
+			{
+				delete *reinterpret_cast<Func_**>(storage_);
+			}
+		}
+
+		/// <summary> Outputs a pointer to the single operations table shared by all tasks storing a Func_. </summary>
+		template<class Func_>
+		[[nodiscard]] static inline const _ops_table* _ops_for()
+		{
+			static constexpr _ops_table ops_ = { &_invoke<Func_>, &_move<Func_>, &_destroy<Func_> };
+			return &ops_;
+		}
+
+		const _ops_table* ops;
+		alignas(storage_alignment) unsigned char storage[storage_size];
+	};
+
+	/// <summary>
+	/// <para> First-in-first-out ring buffer of inline_task slots. </para>
+	/// <para>
+	///		Slots are reused once their tasks are popped, so after the buffer has grown to fit its typical workload, pushing and popping tasks does not allocate
+	///		(provided the tasks themselves are stored inline).
+	/// </para>
+	/// <para> This is not thread-safe; it is expected to be guarded by its owner. </para>
+	/// </summary>
+	class task_ring_buffer
+	{
+	public:
+		using this_type = task_ring_buffer;
+
+		/// <summary> The capacity of a buffer upon its first growth. Must be a power of 2. </summary>
+		static constexpr std::size_t initial_capacity = 64;
+		/// <summary> The largest capacity that will be kept when calling ShrinkToRetainedCapacity. </summary>
+		static constexpr std::size_t max_retained_capacity = 4096;
+
+		static_assert
+		(
+			initial_capacity != 0 && (initial_capacity & (initial_capacity - 1)) == 0,
+			"EmuThreads::Functors::task_ring_buffer::initial_capacity must be a power of 2."
+		);
+
+		task_ring_buffer() noexcept : slots(), capacity(0), head(0), count(0)
+		{
+		}
+
+		task_ring_buffer(this_type&& to_move_) noexcept : task_ring_buffer()
+		{
+			Swap(to_move_);
+		}
+
+		task_ring_buffer(const this_type&) = delete;
+
+		inline this_type& operator=(this_type&& to_move_) noexcept
+		{
+			this_type(std::move(to_move_)).Swap(*this);
+			return *this;
+		}
+
+		this_type& operator=(const this_type&) = delete;
+
+		inline void Swap(this_type& other_) noexcept
+		{
+			slots.swap(other_.slots);
+			std::swap(capacity, other_.capacity);
+			std::swap(head, other_.head);
+			std::swap(count, other_.count);
+		}
+
+		/// <summary> Adds the passed task to the back of this buffer, growing it if it is full. </summary>
+		inline void Push(inline_task&& task_)
+		{
+			if (count == capacity)
+			{
+				_grow();
+			}
+			slots[(head + count) & (capacity - 1)] = std::move(task_);
+			++count;
+		}
+
+		/// <summary> Removes and outputs the task at the front of this buffer. This buffer must not be empty. </summary>
+		[[nodiscard]] inline inline_task Pop()
+		{
+			inline_task out_task_ = std::move(slots[head]);
+			head = (head + 1) & (capacity - 1);
+			--count;
+			return out_task_;
+		}
+
+		[[nodiscard]] inline bool Empty() const noexcept
+		{
+			return count == 0;
+		}
+
+		[[nodiscard]] inline std::size_t Size() const noexcept
+		{
+			return count;
+		}
+
+		[[nodiscard]] inline std::size_t Capacity() const noexcept
+		{
+			return capacity;
+		}
+
+		/// <summary> Destroys all contained tasks. Capacity is retained so that the slots may be reused. </summary>
+		inline void Clear() noexcept
+		{
+			while (count != 0)
+			{
+				slots[head].Reset();
+				head = (head + 1) & (capacity - 1);
+				--count;
+			}
+			head = 0;
+		}
+
+		/// <summary>
+		/// <para> Frees this buffer's slots if it is empty and its capacity exceeds max_retained_capacity. </para>
+		/// <para> This allows occasional very large allocations (such as a parallel loop) to release their memory, while typical workloads keep their slots. </para>
+		/// </summary>
+		inline void ShrinkToRetainedCapacity() noexcept
+		{
+			if (count == 0 && capacity > max_retained_capacity)
+			{
+				slots.reset();
+				capacity = 0;
+				head = 0;
+			}
+		}
+
+	private:
+		inline void _grow()
+		{
+			const std::size_t new_capacity_ = (capacity == 0) ? initial_capacity : capacity * 2;
+			std::unique_ptr<inline_task[]> new_slots_(new inline_task[new_capacity_]);
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				new_slots_[i] = std::move(slots[(head + i) & (capacity - 1)]);
+			}
+			slots.swap(new_slots_);
+			capacity = new_capacity_;
+			head = 0;
+		}
+
+		std::unique_ptr<inline_task[]> slots;
+		std::size_t capacity;
+		std::size_t head;
+		std::size_t count;
+	};
+
+	/// <summary>
+	/// <para> Bounded lock-free multi-producer/multi-consumer FIFO queue of inline_tasks, as described by Dmitry Vyukov. </para>
+	/// <para> Each slot carries a sequence number which tells producers and consumers whether it is ready for them, so that a push or pop only contends on one atomic index. </para>
+	/// <para> Pushing fails instead of blocking when the queue is full, and popping fails when it is empty. </para>
+	/// <para>
+	///		Each cell, and each of the enqueue and dequeue positions, starts on its own cache line, so that producers and consumers working on neighbouring cells
+	///		(or only on one end of the queue) do not invalidate one another's lines.
+	/// </para>
+	/// </summary>
+	/// <typeparam name="Capacity_">Maximum number of tasks that may be queued at once. Must be a power of 2, and at least 2.</typeparam>
+	template<std::size_t Capacity_>
+	class alignas(EmuThreads::TMP::assumed_cache_line_size) mpmc_task_queue
+	{
+	public:
+		using this_type = mpmc_task_queue<Capacity_>;
+		static constexpr std::size_t capacity = Capacity_;
+
+		static_assert
+		(
+			capacity >= 2 && (capacity & (capacity - 1)) == 0,
+			"EmuThreads::Functors::mpmc_task_queue must have a Capacity_ which is a power of 2, and at least 2."
+		);
+
+		mpmc_task_queue() : cells(new _cell[capacity]), enqueue_pos(0), dequeue_pos(0)
+		{
+			for (std::size_t i = 0; i < capacity; ++i)
+			{
+				cells[i].sequence.store(i, std::memory_order_relaxed);
+			}
+		}
+
+		mpmc_task_queue(const this_type&) = delete;
+		this_type& operator=(const this_type&) = delete;
+
+		/// <summary> Attempts to add the passed task to the back of this queue. If this queue is full, false is output and task_ is left unmodified. </summary>
+		[[nodiscard]] inline bool TryPush(inline_task&& task_)
+		{
+			std::size_t pos_ = enqueue_pos.load(std::memory_order_relaxed);
+			while (true)
+			{
+				_cell& cell_ = cells[pos_ & _mask];
+				const std::size_t sequence_ = cell_.sequence.load(std::memory_order_acquire);
+				const std::intptr_t difference_ = static_cast<std::intptr_t>(sequence_) - static_cast<std::intptr_t>(pos_);
+
+				if (difference_ == 0)
+				{
+					if (enqueue_pos.compare_exchange_weak(pos_, pos_ + 1, std::memory_order_relaxed))
+					{
+						cell_.task = std::move(task_);
+						cell_.sequence.store(pos_ + 1, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (difference_ < 0)
+				{
+					// Slot still holds a task from the previous lap, so the queue is full
+					return false;
+				}
+				else
+				{
+					pos_ = enqueue_pos.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		/// <summary> Attempts to remove the task at the front of this queue, moving it into out_task_. If this queue is empty, false is output. </summary>
+		[[nodiscard]] inline bool TryPop(inline_task& out_task_)
+		{
+			std::size_t pos_ = dequeue_pos.load(std::memory_order_relaxed);
+			while (true)
+			{
+				_cell& cell_ = cells[pos_ & _mask];
+				const std::size_t sequence_ = cell_.sequence.load(std::memory_order_acquire);
+				const std::intptr_t difference_ = static_cast<std::intptr_t>(sequence_) - static_cast<std::intptr_t>(pos_ + 1);
+
+				if (difference_ == 0)
+				{
+					if (dequeue_pos.compare_exchange_weak(pos_, pos_ + 1, std::memory_order_relaxed))
+					{
+						out_task_ = std::move(cell_.task);
+						cell_.sequence.store(pos_ + capacity, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (difference_ < 0)
+				{
+					// Slot has not been filled for this lap, so the queue is empty
+					return false;
+				}
+				else
+				{
+					pos_ = dequeue_pos.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+	private:
+		static constexpr std::size_t _mask = capacity - 1;
+
+		struct alignas(EmuThreads::TMP::assumed_cache_line_size) _cell
+		{
+			std::atomic_size_t sequence;
+			inline_task task;
+		};
+
+		std::unique_ptr<_cell[]> cells;
+		alignas(EmuThreads::TMP::assumed_cache_line_size) std::atomic_size_t enqueue_pos;
+		alignas(EmuThreads::TMP::assumed_cache_line_size) std::atomic_size_t dequeue_pos;
+	};
+
+	/// <summary>
+	/// <para> Stateless allocator which recycles single-object allocations through a free list local to the calling thread. </para>
+	/// <para> Intended for shared states allocated per task (such as via `std::promise(std::allocator_arg, pooled_state_allocator&lt;T_&gt;())`), so that steady workloads do not allocate. </para>
+	/// <para>
+	///		Blocks are typically allocated by the thread submitting a task and freed by the thread executing it.
+	///		To stop blocks from collecting in executing threads, each thread's list exchanges blocks with a shared locked list in batches of pool_transfer_batch_size.
+	/// </para>
+	/// <para> Any blocks beyond the limits of both lists are returned to the global heap. </para>
+	/// </summary>
+	/// <typeparam name="T_">Type of object allocated.</typeparam>
+	template<typename T_>
+	class pooled_state_allocator
+	{
+	public:
+		using value_type = T_;
+
+		/// <summary> Maximum number of free blocks of each type that each thread will keep for reuse. </summary>
+		static constexpr std::size_t max_pooled_blocks_per_thread = 256;
+		/// <summary> Maximum number of free blocks of each type kept in the shared list. </summary>
+		static constexpr std::size_t max_shared_pooled_blocks = 4096;
+		/// <summary> Number of blocks moved between a thread's list and the shared list at a time. </summary>
+		static constexpr std::size_t pool_transfer_batch_size = 64;
+
+		static_assert
+		(
+			pool_transfer_batch_size != 0 && pool_transfer_batch_size <= max_pooled_blocks_per_thread,
+			"EmuThreads::Functors::pooled_state_allocator::pool_transfer_batch_size must be in the inclusive range 1:max_pooled_blocks_per_thread."
+		);
+
+		pooled_state_allocator() noexcept = default;
+
+		template<typename U_>
+		pooled_state_allocator(const pooled_state_allocator<U_>&) noexcept
+		{
+		}
+
+		[[nodiscard]] inline T_* allocate(std::size_t n_)
+		{
+			if (n_ == 1 && !_local_pool::is_destroyed)
+			{
+				void* block_ = _local().Take();
+				if (block_ != nullptr)
+				{
+					return static_cast<T_*>(block_);
+				}
+			}
+			return static_cast<T_*>(_allocate_block(n_));
+		}
+
+		inline void deallocate(T_* p_, std::size_t n_) noexcept
+		{
+			if (n_ == 1 && !_local_pool::is_destroyed)
+			{
+				_local().Give(p_);
+			}
+			else
+			{
+				_free_block(p_);
+			}
+		}
+
+		template<typename U_>
+		[[nodiscard]] constexpr inline bool operator==(const pooled_state_allocator<U_>&) const noexcept
+		{
+			return true;
+		}
+
+		template<typename U_>
+		[[nodiscard]] constexpr inline bool operator!=(const pooled_state_allocator<U_>&) const noexcept
+		{
+			return false;
+		}
+
+	private:
+		static constexpr bool _is_over_aligned = alignof(T_) > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+		[[nodiscard]] static inline void* _allocate_block(std::size_t n_)
+		{
+			if constexpr (_is_over_aligned)
+			{
+				return ::operator new(n_ * sizeof(T_), std::align_val_t(alignof(T_)));
+			}
+			else
+			{
+				return ::operator new(n_ * sizeof(T_));
+			}
+		}
+
+		static inline void _free_block(void* p_) noexcept
+		{
+			if constexpr (_is_over_aligned)
+			{
+				::operator delete(p_, std::align_val_t(alignof(T_)));
+			}
+			else
+			{
+				::operator delete(p_);
+			}
+		}
+
+		class _shared_pool
+		{
+		public:
+			_shared_pool() : blocks_mutex(), free_blocks()
+			{
+			}
+
+			~_shared_pool()
+			{
+				for (void* block_ : free_blocks)
+				{
+					_free_block(block_);
+				}
+				// Trivially destructible, so remains safe to read for any deallocations later in static destruction
+				is_destroyed = true;
+			}
+
+			/// <summary> Moves up to pool_transfer_batch_size blocks into out_blocks_. </summary>
+			inline void TakeBatch(std::vector<void*>& out_blocks_)
+			{
+				std::lock_guard<std::mutex> lock_(blocks_mutex);
+				const std::size_t num_taken_ = std::min(free_blocks.size(), pool_transfer_batch_size);
+				out_blocks_.insert(out_blocks_.end(), free_blocks.end() - num_taken_, free_blocks.end());
+				free_blocks.resize(free_blocks.size() - num_taken_);
+			}
+
+			/// <summary> Moves the last pool_transfer_batch_size blocks of in_blocks_ into this pool, freeing any that do not fit. </summary>
+			inline void GiveBatch(std::vector<void*>& in_blocks_) noexcept
+			{
+				const std::size_t first_given_ = in_blocks_.size() - pool_transfer_batch_size;
+				{
+					std::lock_guard<std::mutex> lock_(blocks_mutex);
+					std::size_t i = first_given_;
+					for (; i < in_blocks_.size() && free_blocks.size() < max_shared_pooled_blocks; ++i)
+					{
+						free_blocks.push_back(in_blocks_[i]);
+					}
+					for (; i < in_blocks_.size(); ++i)
+					{
+						_free_block(in_blocks_[i]);
+					}
+				}
+				in_blocks_.resize(first_given_);
+			}
+
+			static bool is_destroyed;
+
+		private:
+			std::mutex blocks_mutex;
+			std::vector<void*> free_blocks;
+		};
+
+		class _local_pool
+		{
+		public:
+			_local_pool() : free_blocks()
+			{
+				free_blocks.reserve(max_pooled_blocks_per_thread);
+			}
+
+			~_local_pool()
+			{
+				for (void* block_ : free_blocks)
+				{
+					_free_block(block_);
+				}
+				// Trivially destructible, so remains safe to read for any deallocations later in this thread's destruction
+				is_destroyed = true;
+			}
+
+			[[nodiscard]] inline void* Take()
+			{
+				if (free_blocks.empty() && !_shared_pool::is_destroyed)
+				{
+					_shared().TakeBatch(free_blocks);
+				}
+
+				if (free_blocks.empty())
+				{
+					return nullptr;
+				}
+				void* out_ = free_blocks.back();
+				free_blocks.pop_back();
+				return out_;
+			}
+
+			inline void Give(void* block_) noexcept
+			{
+				if (free_blocks.size() == max_pooled_blocks_per_thread)
+				{
+					if (_shared_pool::is_destroyed)
+					{
+						_free_block(block_);
+						return;
+					}
+					_shared().GiveBatch(free_blocks);
+				}
+				free_blocks.push_back(block_);
+			}
+
+			static thread_local bool is_destroyed;
+
+		private:
+			std::vector<void*> free_blocks;
+		};
+
+		[[nodiscard]] static inline _shared_pool& _shared()
+		{
+			static _shared_pool pool_;
+			return pool_;
+		}
+
+		[[nodiscard]] static inline _local_pool& _local()
+		{
+			static thread_local _local_pool pool_;
+			return pool_;
+		}
+	};
+
+	template<typename T_>
+	bool pooled_state_allocator<T_>::_shared_pool::is_destroyed = false;
+
+	template<typename T_>
+	thread_local bool pooled_state_allocator<T_>::_local_pool::is_destroyed = false;
+
+	/// <summary> Nullary task which invokes a stored Func_ with a stored tuple of Args_, in the form `func(args...)`. </summary>
+	template<class Func_, class...Args_>
+	struct applied_task
+	{
+		inline void operator()()
+		{
+			std::apply(func, args);
+		}
+
+		Func_ func;
+		std::tuple<Args_...> args;
+	};
+
+	/// <summary>
+	/// <para> Nullary task which invokes a stored Func_ with a stored tuple of Args_, and provides the result (or any thrown exception) to a stored std::promise. </para>
+	/// <para> When the promise is constructed with a pooled_state_allocator, this provides future-returning tasks without a per-task allocation in steady workloads. </para>
+	/// </summary>
+	template<typename Result_, class Func_, class...Args_>
+	struct promised_task
+	{
+		inline void operator()()
+		{
+			try
+			{
+				if constexpr (std::is_void_v<Result_>)
+				{
+					std::apply(func, args);
+					promise.set_value();
+				}
+				else
+				{
+					promise.set_value(std::apply(func, args));
+				}
+			}
+			catch (...)
+			{
+				promise.set_exception(std::current_exception());
+			}
+		}
+
+		std::promise<Result_> promise;
+		Func_ func;
+		std::tuple<Args_...> args;
+	};
+
+	/// <summary>
+	/// <para> Creates an inline_task which invokes func_ with args_, outputting the future to its result via out_future_. </para>
+	/// <para> The future's shared state is allocated via a pooled_state_allocator. </para>
+	/// </summary>
+	template<class Func_, class...Args_>
+	[[nodiscard]] inline inline_task make_promised_inline_task(std::future<std::invoke_result_t<Func_&, Args_&...>>& out_future_, Func_ func_, Args_...args_)
+	{
+		using result_type = std::invoke_result_t<Func_&, Args_&...>;
+		std::promise<result_type> promise_(std::allocator_arg, pooled_state_allocator<result_type>());
+		out_future_ = promise_.get_future();
+		return inline_task(promised_task<result_type, Func_, Args_...>{ std::move(promise_), std::move(func_), std::tuple<Args_...>(std::move(args_)...) });
+	}
+
+	/// <summary> Creates an inline_task which invokes func_ with args_, discarding any result. </summary>
+	template<class Func_, class...Args_>
+	[[nodiscard]] inline inline_task make_inline_task(Func_ func_, Args_...args_)
+	{
+		if constexpr (sizeof...(Args_) == 0)
+		{
+			return inline_task(std::move(func_));
+		}
+		else
+		{
+			return inline_task(applied_task<Func_, Args_...>{ std::move(func_), std::tuple<Args_...>(std::move(args_)...) });
+		}
+	}
+}
+
+#endif
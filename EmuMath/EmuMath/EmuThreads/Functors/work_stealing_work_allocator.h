@@ -0,0 +1,672 @@
+#ifndef EMU_THREADS_FUNCTORS_WORK_STEALING_WORK_ALLOCATOR_H_INC_
+#define EMU_THREADS_FUNCTORS_WORK_STEALING_WORK_ALLOCATOR_H_INC_ 1
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "default_work_allocator.h"
+#include "../TMP/CommonThreadingAliases.h"
+#include "../../EmuCore/TMPHelpers/Values.h"
+
+namespace EmuThreads::Functors
+{
+	/// <summary>
+	/// <para> Work allocator which gives each linked thread its own lock-free Chase-Lev deque of tasks, instead of funnelling all threads through one locked queue. </para>
+	/// <para> Tasks allocated from within a task running on a linked thread are pushed to that thread's deque, and are popped by it in LIFO order without locking. </para>
+	/// <para>
+	///		Tasks allocated from any other thread are placed in a shared locked queue.
+	///		Linked threads move batches from this queue into their own deque, so the lock is taken once per batch rather than once per task.
+	/// </para>
+	/// <para> Threads which run out of work steal the oldest task from the deque of a randomly selected thread. </para>
+	/// <para> Only the first max_num_worker_deques linked threads receive a deque; any threads beyond this will only take from the shared queue or steal. </para>
+	/// </summary>
+	class work_stealing_work_allocator
+	{
+	public:
+		using this_type = work_stealing_work_allocator;
+
+		/// <summary> The waiting time (in milliseconds) used when no other time is provided. </summary>
+		static constexpr double default_waiting_time_ms = default_work_allocator::default_waiting_time_ms;
+		/// <summary> Minimum waiting time (in milliseconds) that may be used in this allocator's downtime. </summary>
+		static constexpr double min_waiting_time_ms = default_work_allocator::min_waiting_time_ms;
+		/// <summary> Maximum waiting time (in milliseconds) that may be used in this allocator's downtime. </summary>
+		static constexpr double max_waiting_time_ms = default_work_allocator::max_waiting_time_ms;
+
+		/// <summary> Maximum number of simultaneously linked threads which will receive their own deque. </summary>
+		static constexpr std::size_t max_num_worker_deques = 256;
+		/// <summary> Number of tasks each worker deque may hold before it grows. Must be a power of 2. </summary>
+		static constexpr std::size_t initial_deque_capacity = 256;
+		/// <summary> Maximum number of tasks that a linked thread will move from the shared queue into its own deque in one go, excluding the task it executes. </summary>
+		static constexpr std::size_t max_shared_queue_batch_size = 32;
+
+		static_assert
+		(
+			initial_deque_capacity != 0 && (initial_deque_capacity & (initial_deque_capacity - 1)) == 0,
+			"EmuThreads::Functors::work_stealing_work_allocator::initial_deque_capacity must be a power of 2."
+		);
+
+		/// <summary> Helper to reduce verbosity when creating a duration in milliseconds. The passed time value is not validated. </summary>
+		/// <param name="time_in_ms_">Number of milliseconds to use for creating the resulting duration.</param>
+		/// <returns>Chrono duration in milliseconds, with `double` representation, using the provided time_in_ms_. </returns>
+		template<typename InNum_>
+		[[nodiscard]] static constexpr inline std::chrono::duration<double, std::milli> time_in_ms(const InNum_& time_in_ms_)
+		{
+			return default_work_allocator::time_in_ms(time_in_ms_);
+		}
+
+		/// <summary> Creates a version of the passed waiting_time_ms_ which is valid for use with this allocator. </summary>
+		/// <param name="waiting_time_ms_">Waiting time to validate.</param>
+		/// <returns>The passed waiting_time_ms_ value clamped into the inclusive range min_waiting_time_ms:max_waiting_time_ms.</returns>
+		[[nodiscard]] static constexpr inline double validate_waiting_time_ms(double waiting_time_ms_)
+		{
+			return default_work_allocator::validate_waiting_time_ms(waiting_time_ms_);
+		}
+
+		work_stealing_work_allocator() : work_stealing_work_allocator(default_waiting_time_ms)
+		{
+		}
+
+		work_stealing_work_allocator(double waiting_time_ms_) :
+			is_active(true),
+			working_thread_count(0),
+			num_queued_tasks(0),
+			num_shared_tasks(0),
+			num_used_worker_slots(0),
+			worker_slots(new _worker_slot[max_num_worker_deques]),
+			shared_queue_mutex(),
+			shared_queue(),
+			waiting_time_ms(validate_waiting_time_ms(waiting_time_ms_))
+		{
+		}
+
+		/// <summary>
+		/// <para> Creates a work allocator from the passed allocator, taking tasks from the passed to_move_ allocator. </para>
+		/// <para> This construction will not retain the linked threads of the moved allocator, only its queued tasks. </para>
+		/// <para> Tasks taken from the moved allocator's worker deques are placed in this allocator's shared queue. </para>
+		/// </summary>
+		/// <param name="to_move_">Work allocator to move into the newly constructed allocator.</param>
+		/// <param name="waiting_time_ms_">Custom time for threads linked to this allocator to wait for during downtime (in milliseconds).</param>
+		inline work_stealing_work_allocator(this_type&& to_move_, double waiting_time_ms_) : work_stealing_work_allocator(waiting_time_ms_)
+		{
+			std::size_t num_moved_ = 0;
+			{
+				std::lock_guard<mutex_type> lock_(to_move_.shared_queue_mutex);
+				shared_queue.swap(to_move_.shared_queue);
+				to_move_.num_shared_tasks = 0;
+				num_moved_ += shared_queue.size();
+			}
+
+			const std::size_t num_slots_ = to_move_.num_used_worker_slots.load(std::memory_order_acquire);
+			for (std::size_t i = 0; i < num_slots_; ++i)
+			{
+				_chase_lev_deque* deque_ = to_move_.worker_slots[i].deque.load(std::memory_order_acquire);
+				if (deque_ != nullptr)
+				{
+					while (!deque_->Empty())
+					{
+						work_type* task_ = deque_->Steal();
+						if (task_ != nullptr)
+						{
+							shared_queue.push_back(task_);
+							++num_moved_;
+						}
+					}
+				}
+			}
+
+			to_move_.num_queued_tasks -= num_moved_;
+			num_queued_tasks = num_moved_;
+			num_shared_tasks = shared_queue.size();
+		}
+		/// <summary>
+		/// <para> Creates a work allocator from the passed allocator, taking tasks from the passed to_move_ allocator. </para>
+		/// <para> This construction will not retain the linked threads of the moved allocator, only its queued tasks and waiting time. </para>
+		/// </summary>
+		/// <param name="to_move_">Work allocator to move into the newly constructed allocator.</param>
+		inline work_stealing_work_allocator(this_type&& to_move_) : work_stealing_work_allocator(std::forward<this_type>(to_move_), to_move_.waiting_time_ms)
+		{
+		}
+
+		work_stealing_work_allocator(const this_type&) = delete;
+
+		/// <summary>
+		/// <para> Deactivates this allocator and waits for tasks that are already executing to finish. </para>
+		/// <para> 
+		///		Queued tasks which have not begun - in the shared queue or in any worker deque - are discarded without being executed. 
+		///		Futures to discarded tasks report std::future_errc::broken_promise.
+		/// </para>
+		/// </summary>
+		inline ~work_stealing_work_allocator()
+		{
+			Deactivate();
+			ClearWorkQueue();
+			WaitForAllTasksToComplete();
+
+			for (std::size_t i = 0; i < max_num_worker_deques; ++i)
+			{
+				delete worker_slots[i].deque.load(std::memory_order_acquire);
+			}
+		}
+
+		/// <summary>
+		/// <para> Constructs a thread which is launched into this allocator's task execution loop. </para>
+		/// <para> The thread will remain looping for as long as this allocator is in the active state, even when no tasks are queued. </para>
+		/// <para> It is the caller's responsibility to ensure that this thread is safely stored and, when needed, closed. </para>
+		/// <para>
+		///		Note: this object will gracefully finish active tasks upon destruction.
+		///		However, if threads are deallocated before this object's destruction,
+		///		it is the caller's responsibility to ensure it is not using threads before they are deallocated
+		///		(this can be achieved through Deactivate, followed by joining the threads in question (or equivalent)).
+		/// </para>
+		/// </summary>
+		/// <typeparam name="Thread_">Type of thread to construct.</typeparam>
+		/// <returns>Thread of the provided Thread_ type, constructed to be executing within this allocator's work loop for as long as it is active.</returns>
+		template<class Thread_>
+		[[nodiscard]] inline Thread_ LaunchThread()
+		{
+			return Thread_(&this_type::_worker_execution, this);
+		}
+
+		/// <summary>
+		/// <para> Removes any work that has not yet been allocated to a thread, including work waiting in the deques of linked threads. </para>
+		/// <para> This will not stop work that is currently being executed. </para>
+		/// </summary>
+		inline void ClearWorkQueue()
+		{
+			{
+				std::lock_guard<mutex_type> lock_(shared_queue_mutex);
+				for (work_type* task_ : shared_queue)
+				{
+					delete task_;
+				}
+				num_queued_tasks -= shared_queue.size();
+				decltype(shared_queue)().swap(shared_queue);
+				num_shared_tasks = 0;
+			}
+
+			const std::size_t num_slots_ = num_used_worker_slots.load(std::memory_order_acquire);
+			for (std::size_t i = 0; i < num_slots_; ++i)
+			{
+				_chase_lev_deque* deque_ = worker_slots[i].deque.load(std::memory_order_acquire);
+				if (deque_ != nullptr)
+				{
+					while (!deque_->Empty())
+					{
+						work_type* task_ = deque_->Steal();
+						if (task_ != nullptr)
+						{
+							delete task_;
+							--num_queued_tasks;
+						}
+					}
+				}
+			}
+		}
+
+		/// <summary> Returns a boolean indicating if this allocator has any tasks queued and waiting for a thread. </summary>
+		[[nodiscard]] inline bool HasWork() const
+		{
+			return num_queued_tasks != 0;
+		}
+
+		/// <summary> The number of threads currently performing work from this allocator. </summary>
+		[[nodiscard]] inline std::size_t NumWorkingThreads() const
+		{
+			return working_thread_count;
+		}
+
+		/// <summary> Returns true if this allocator is active. While active, all threads created by it will be performing its execution loop until inactive. </summary>
+		[[nodiscard]] inline bool IsActive() const
+		{
+			return is_active;
+		}
+
+		/// <summary> The number of tasks that this allocator is waiting to provide to a thread for execution, including those waiting in the deques of linked threads. </summary>
+		[[nodiscard]] inline std::size_t NumQueuedTasks() const
+		{
+			return num_queued_tasks;
+		}
+
+		/// <summary>
+		/// <para> Waits for all of this allocator's tasks to be completed, using only its linked threads to do so. </para>
+		/// <para> WARNING: if no threads are linked with this allocator, this will cause a program crash if any work is queued. </para>
+		/// </summary>
+		inline void WaitForAllTasksToCompleteNoJoin() const
+		{
+			while (HasWork() || working_thread_count != 0)
+			{
+				std::this_thread::sleep_for(time_in_ms(waiting_time_ms));
+			}
+		}
+
+		/// <summary>
+		/// <para> Waits for all of this allocator's tasks to be completed, and the calling thread may contribute to completing said tasks. </para>
+		/// <para> The calling thread contributes by taking from the shared queue and stealing from linked threads. </para>
+		/// <para> If the calling thread's contribution is undesired, call WaitForAllTasksToCompleteNoJoin instead. </para>
+		/// </summary>
+		inline void WaitForAllTasksToComplete()
+		{
+			_worker_context& context_ = _this_thread_context();
+			_chase_lev_deque* local_deque_ = (context_.allocator == this) ? context_.deque : nullptr;
+			while (HasWork() || working_thread_count != 0)
+			{
+				_look_for_work(local_deque_, context_);
+			}
+		}
+		inline void WaitForAllTasksToComplete() const
+		{
+			// Work will only be poppable (and well-formed) if this is non-const, so this is conceptually safe to allow the calling thread to join in with work.
+			const_cast<this_type*>(this)->WaitForAllTasksToComplete();
+		}
+
+		/// <summary> Returns the amount of time that this allocator's linked threads will wait before checking for a new task, in milliseconds. </summary>
+		[[nodiscard]] inline double WaitingTimeMs() const
+		{
+			return waiting_time_ms;
+		}
+
+		/// <summary>
+		/// <para> Sets the amount of time (in milliseconds) that this allocator's linked threads will wait before checking for a new task. </para>
+		/// </summary>
+		/// <param name="waiting_time_ms_">
+		///		Amount of time to wait in milliseconds.
+		///		This will be clamped into the inclusive range min_waiting_time_ms:max_waiting_time_ms.
+		/// </param>
+		/// <returns>Validated value that the waiting time for this allocator is set to via the passed argument.</returns>
+		inline double WaitingTimeMs(double waiting_time_ms_)
+		{
+			waiting_time_ms = validate_waiting_time_ms(waiting_time_ms_);
+			return waiting_time_ms;
+		}
+
+		/// <summary> Marks this allocator as active, allowing threads linked to it to participate in its execution loop. </summary>
+		inline void Activate()
+		{
+			is_active = true;
+		}
+
+		/// <summary>
+		/// <para> Marks this allocator as inactive, preventing new threads from participating in its execution loop. </para>
+		/// <para> Additionally, currently linked threads will unlink once they have finished executing their current task if this allocator remains inactive. </para>
+		/// <para> Tasks left in the deque of an unlinked thread remain queued, and may be stolen by other threads or taken over by the next thread to be launched. </para>
+		/// </summary>
+		inline void Deactivate()
+		{
+			is_active = false;
+		}
+
+		/// <summary>
+		/// <para> Allocates a task to be queued and executed by threads linked to this allocator. </para>
+		/// <para> If called from a task running on a thread linked to this allocator, the task is pushed to that thread's own deque without locking. </para>
+		/// <para> The provided args_ must be compatible with the provided func_. </para>
+		/// <para> This does not enforce reference protection, or perform binds where they may be preferred. Such tasks are the responsibility of the caller, if needed. </para>
+		/// </summary>
+		/// <param name="func_">Invocable item to call.</param>
+		/// <param name="args_">Arguments to provide when invoking the passed func_, with the syntax `func_(args_...)`.</param>
+		/// <returns>Future to the task, allowing its result to be retrieved. A complete future does not guarantee that previously allocated tasks are complete.</returns>
+		template<class Func_, class...Args_>
+		inline auto AllocateTask(Func_ func_, Args_...args_)->std::future<decltype(func_(args_...))>
+		{
+			if constexpr (std::is_invocable_v<Func_, Args_...>)
+			{
+				auto wrapped_func_ = std::make_shared<std::packaged_task<decltype(func_(args_...))(Args_...)>>(func_);
+				auto future_ = wrapped_func_->get_future();
+				_push_task(new work_type([=]() { (*wrapped_func_)(args_...); }));
+				return future_;
+			}
+			else
+			{
+				static_assert(EmuCore::TMP::get_false<Func_>(), "Attempted to allocate a task via EmuThreading::Functors::work_stealing_work_allocator, but the provided Func_ type cannot be invoked with the provided Args_.");
+			}
+		}
+
+	private:
+		using work_type = std::function<void()>;
+		using mutex_type = std::mutex;
+		using index_type = std::int64_t;
+
+		static constexpr std::size_t _cache_line_size = EmuThreads::TMP::assumed_cache_line_size;
+
+		/// <summary> Circular buffer of task pointers used by a _chase_lev_deque. Indices wrap, so only the range [top, bottom) is meaningful. </summary>
+		class _task_buffer
+		{
+		public:
+			explicit _task_buffer(std::size_t capacity_) : capacity(capacity_), mask(capacity_ - 1), tasks(new std::atomic<work_type*>[capacity_])
+			{
+			}
+
+			[[nodiscard]] inline std::atomic<work_type*>& at(index_type index_)
+			{
+				return tasks[static_cast<std::size_t>(index_) & mask];
+			}
+
+			/// <summary> Creates a new buffer of double this buffer's capacity, containing copies of the tasks in the range [top_, bottom_). </summary>
+			[[nodiscard]] inline _task_buffer* Grow(index_type top_, index_type bottom_)
+			{
+				_task_buffer* out_ = new _task_buffer(capacity * 2);
+				for (index_type i = top_; i < bottom_; ++i)
+				{
+					out_->at(i).store(at(i).load(std::memory_order_relaxed), std::memory_order_relaxed);
+				}
+				return out_;
+			}
+
+			const std::size_t capacity;
+			const std::size_t mask;
+
+		private:
+			std::unique_ptr<std::atomic<work_type*>[]> tasks;
+		};
+
+		/// <summary>
+		/// <para> Lock-free work-stealing deque as described by Chase and Lev, using the C11 memory orderings given by Le et al. </para>
+		/// <para> Only the owning thread may Push and Pop (at the bottom). Any thread may Steal (at the top). </para>
+		/// <para> Buffers replaced by growth are retained until destruction, as thieves may still be reading from them. </para>
+		/// </summary>
+		class _chase_lev_deque
+		{
+		public:
+			_chase_lev_deque() : top(0), bottom(0), buffer(new _task_buffer(initial_deque_capacity)), retired_buffers()
+			{
+			}
+
+			~_chase_lev_deque()
+			{
+				delete buffer.load(std::memory_order_relaxed);
+			}
+
+			_chase_lev_deque(const _chase_lev_deque&) = delete;
+			_chase_lev_deque& operator=(const _chase_lev_deque&) = delete;
+
+			inline void Push(work_type* task_)
+			{
+				const index_type bottom_ = bottom.load(std::memory_order_relaxed);
+				const index_type top_ = top.load(std::memory_order_acquire);
+				_task_buffer* buffer_ = buffer.load(std::memory_order_relaxed);
+				if (bottom_ - top_ > static_cast<index_type>(buffer_->capacity) - 1)
+				{
+					_task_buffer* grown_buffer_ = buffer_->Grow(top_, bottom_);
+					retired_buffers.emplace_back(buffer_);
+					buffer.store(grown_buffer_, std::memory_order_release);
+					buffer_ = grown_buffer_;
+				}
+				buffer_->at(bottom_).store(task_, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_release);
+				bottom.store(bottom_ + 1, std::memory_order_relaxed);
+			}
+
+			[[nodiscard]] inline work_type* Pop()
+			{
+				const index_type bottom_ = bottom.load(std::memory_order_relaxed) - 1;
+				_task_buffer* buffer_ = buffer.load(std::memory_order_relaxed);
+				bottom.store(bottom_, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				index_type top_ = top.load(std::memory_order_relaxed);
+
+				if (top_ <= bottom_)
+				{
+					work_type* task_ = buffer_->at(bottom_).load(std::memory_order_relaxed);
+					if (top_ == bottom_)
+					{
+						// Last task, so we need to beat any thieves to it
+						if (!top.compare_exchange_strong(top_, top_ + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+						{
+							task_ = nullptr;
+						}
+						bottom.store(bottom_ + 1, std::memory_order_relaxed);
+					}
+					return task_;
+				}
+				else
+				{
+					bottom.store(bottom_ + 1, std::memory_order_relaxed);
+					return nullptr;
+				}
+			}
+
+			/// <summary> Takes the oldest task in this deque. Outputs nullptr if the deque is empty or another thread took the task first. </summary>
+			[[nodiscard]] inline work_type* Steal()
+			{
+				index_type top_ = top.load(std::memory_order_acquire);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				const index_type bottom_ = bottom.load(std::memory_order_acquire);
+
+				if (top_ < bottom_)
+				{
+					_task_buffer* buffer_ = buffer.load(std::memory_order_acquire);
+					work_type* task_ = buffer_->at(top_).load(std::memory_order_relaxed);
+					if (top.compare_exchange_strong(top_, top_ + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					{
+						return task_;
+					}
+				}
+				return nullptr;
+			}
+
+			[[nodiscard]] inline bool Empty() const
+			{
+				return top.load(std::memory_order_acquire) >= bottom.load(std::memory_order_acquire);
+			}
+
+		private:
+			alignas(_cache_line_size) std::atomic<index_type> top;
+			alignas(_cache_line_size) std::atomic<index_type> bottom;
+			alignas(_cache_line_size) std::atomic<_task_buffer*> buffer;
+			std::vector<std::unique_ptr<_task_buffer>> retired_buffers;
+		};
+
+		/// <summary> Storage for one worker's deque. Once created, a deque is kept until this allocator is destroyed, so that tasks left in it can still be stolen. </summary>
+		struct alignas(_cache_line_size) _worker_slot
+		{
+			_worker_slot() : is_claimed(false), deque(nullptr)
+			{
+			}
+
+			std::atomic_bool is_claimed;
+			std::atomic<_chase_lev_deque*> deque;
+		};
+
+		/// <summary> Per-thread state identifying which allocator (if any) the calling thread is linked to, and its random state for selecting steal victims. </summary>
+		struct _worker_context
+		{
+			this_type* allocator;
+			_chase_lev_deque* deque;
+			std::uint32_t rng_state;
+		};
+
+		[[nodiscard]] static inline _worker_context& _this_thread_context()
+		{
+			static thread_local _worker_context context_ = { nullptr, nullptr, 0 };
+			return context_;
+		}
+
+		/// <summary> Advances the passed xorshift state, outputting the new random value. The state is lazily seeded from the calling thread's ID. </summary>
+		[[nodiscard]] static inline std::uint32_t _next_random(std::uint32_t& rng_state_)
+		{
+			if (rng_state_ == 0)
+			{
+				rng_state_ = static_cast<std::uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id())) | 1;
+			}
+			rng_state_ ^= rng_state_ << 13;
+			rng_state_ ^= rng_state_ >> 17;
+			rng_state_ ^= rng_state_ << 5;
+			return rng_state_;
+		}
+
+		/// <summary> This is designed to run on a separate worker thread, and not the main thread. Constantly looks for work. </summary>
+		inline void _worker_execution()
+		{
+			_worker_context& context_ = _this_thread_context();
+			const std::size_t slot_index_ = _claim_worker_slot();
+			context_.allocator = this;
+			context_.deque = (slot_index_ < max_num_worker_deques) ? worker_slots[slot_index_].deque.load(std::memory_order_relaxed) : nullptr;
+
+			while (is_active)
+			{
+				_look_for_work(context_.deque, context_);
+			}
+
+			context_.allocator = nullptr;
+			context_.deque = nullptr;
+			if (slot_index_ < max_num_worker_deques)
+			{
+				worker_slots[slot_index_].is_claimed.store(false, std::memory_order_release);
+			}
+		}
+
+		/// <summary> Claims the first unclaimed worker slot, creating its deque if it has never been used. Outputs max_num_worker_deques if all slots are claimed. </summary>
+		[[nodiscard]] inline std::size_t _claim_worker_slot()
+		{
+			for (std::size_t i = 0; i < max_num_worker_deques; ++i)
+			{
+				bool expected_ = false;
+				if (worker_slots[i].is_claimed.compare_exchange_strong(expected_, true, std::memory_order_acq_rel))
+				{
+					if (worker_slots[i].deque.load(std::memory_order_relaxed) == nullptr)
+					{
+						worker_slots[i].deque.store(new _chase_lev_deque(), std::memory_order_release);
+					}
+
+					std::size_t num_used_ = num_used_worker_slots.load(std::memory_order_relaxed);
+					while (num_used_ <= i && !num_used_worker_slots.compare_exchange_weak(num_used_, i + 1, std::memory_order_release, std::memory_order_relaxed))
+					{
+					}
+					return i;
+				}
+			}
+			return max_num_worker_deques;
+		}
+
+		inline void _look_for_work(_chase_lev_deque* local_deque_, _worker_context& context_)
+		{
+			work_type* task_ = (local_deque_ != nullptr) ? local_deque_->Pop() : nullptr;
+			if (task_ == nullptr)
+			{
+				task_ = _take_from_shared_queue(local_deque_);
+				if (task_ == nullptr)
+				{
+					task_ = _steal_task(local_deque_, context_.rng_state);
+				}
+			}
+
+			if (task_ != nullptr)
+			{
+				// Mark as working before the task leaves the queued count, so waiters never see a task which is neither queued nor running
+				++working_thread_count;
+				--num_queued_tasks;
+				std::unique_ptr<work_type> owned_task_(task_);
+				(*owned_task_)();
+				owned_task_.reset();
+				--working_thread_count;
+			}
+			else
+			{
+				std::this_thread::sleep_for(time_in_ms(waiting_time_ms));
+			}
+		}
+
+		/// <summary>
+		/// <para> Takes the next task from the shared queue, if there is one. </para>
+		/// <para> If a local deque is provided, up to half of the remaining shared tasks (limited to max_shared_queue_batch_size) are moved into it. </para>
+		/// </summary>
+		[[nodiscard]] inline work_type* _take_from_shared_queue(_chase_lev_deque* local_deque_)
+		{
+			// Avoid touching the lock at all when there is nothing to take
+			if (num_shared_tasks.load(std::memory_order_relaxed) == 0)
+			{
+				return nullptr;
+			}
+
+			std::lock_guard<mutex_type> lock_(shared_queue_mutex);
+			if (shared_queue.empty())
+			{
+				return nullptr;
+			}
+
+			work_type* out_task_ = shared_queue.front();
+			shared_queue.pop_front();
+
+			if (local_deque_ != nullptr)
+			{
+				std::size_t batch_size_ = std::min(shared_queue.size() / 2, max_shared_queue_batch_size);
+				while (batch_size_ != 0)
+				{
+					local_deque_->Push(shared_queue.front());
+					shared_queue.pop_front();
+					--batch_size_;
+				}
+			}
+
+			if (shared_queue.empty())
+			{
+				// Free memory in cases where many tasks have been provided, as with the default allocator
+				decltype(shared_queue)().swap(shared_queue);
+			}
+			num_shared_tasks.store(shared_queue.size(), std::memory_order_relaxed);
+			return out_task_;
+		}
+
+		/// <summary> Attempts to steal a task from each worker deque other than local_deque_ once, starting from a random victim. </summary>
+		[[nodiscard]] inline work_type* _steal_task(_chase_lev_deque* local_deque_, std::uint32_t& rng_state_)
+		{
+			const std::size_t num_slots_ = num_used_worker_slots.load(std::memory_order_acquire);
+			if (num_slots_ != 0)
+			{
+				std::size_t victim_ = static_cast<std::size_t>(_next_random(rng_state_)) % num_slots_;
+				for (std::size_t i = 0; i < num_slots_; ++i)
+				{
+					_chase_lev_deque* deque_ = worker_slots[victim_].deque.load(std::memory_order_acquire);
+					if (deque_ != nullptr && deque_ != local_deque_)
+					{
+						work_type* task_ = deque_->Steal();
+						if (task_ != nullptr)
+						{
+							return task_;
+						}
+					}
+					victim_ = (victim_ + 1 == num_slots_) ? 0 : victim_ + 1;
+				}
+			}
+			return nullptr;
+		}
+
+		inline void _push_task(work_type* task_)
+		{
+			// Count before pushing so that the task is never taken before it is counted
+			++num_queued_tasks;
+
+			_worker_context& context_ = _this_thread_context();
+			if (context_.allocator == this && context_.deque != nullptr)
+			{
+				context_.deque->Push(task_);
+			}
+			else
+			{
+				std::lock_guard<mutex_type> lock_(shared_queue_mutex);
+				shared_queue.push_back(task_);
+				num_shared_tasks.store(shared_queue.size(), std::memory_order_relaxed);
+			}
+		}
+
+		std::atomic_bool is_active;
+		alignas(_cache_line_size) std::atomic_size_t working_thread_count;
+		alignas(_cache_line_size) std::atomic_size_t num_queued_tasks;
+		alignas(_cache_line_size) std::atomic_size_t num_shared_tasks;
+		std::atomic_size_t num_used_worker_slots;
+		std::unique_ptr<_worker_slot[]> worker_slots;
+		mutex_type shared_queue_mutex;
+		std::deque<work_type*> shared_queue;
+		double waiting_time_ms;
+	};
+}
+
+#endif
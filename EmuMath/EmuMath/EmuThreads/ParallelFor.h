@@ -1,8 +1,14 @@
 #ifndef EMU_THREADS_PARALLEL_FOR_H_INC_
 #define EMU_THREADS_PARALLEL_FOR_H_INC_ 1
 
+#include <chrono>
+#include <cstdint>
+#include <exception>
 #include <functional>
+#include <future>
+#include <stdexcept>
 #include <type_traits>
+#include <vector>
 #include "../EmuCore/TMPHelpers/TypeComparators.h"
 #include "../EmuCore/TMPHelpers/TypeConvertors.h"
 #include "../EmuCore/TMPHelpers/Values.h"
@@ -15,10 +21,22 @@
 
 namespace EmuThreads
 {
+	/// <summary> Methods of splitting an index range into chunks for EmuThreads::ParallelFor::ExecuteRange and ExecuteAndWait. </summary>
+	enum class ParallelForSchedule : std::uint8_t
+	{
+		// Chunks of equal size; one per worker unless a grain size is provided, in which case every chunk is the grain size
+		STATIC = 0x01,
+		// Chunks of decreasing size, each a share of the remaining iterations (no smaller than the grain size), so that the final chunks balance out uneven work
+		GUIDED = 0x02,
+		// Chunks of equal size, chosen by timing iterations executed on the calling thread so that each chunk takes roughly target_chunk_time_us
+		AUTO = 0x04
+	};
+
 	/// <summary>
 	/// <para> Functor for performing a for-loop of arbitrary depth which invokes the provided Func_ with provided iterators, executed via a thread pool. </para>
 	/// <para> This is not intended to make an individual loop faster, but to allow it to be executed in parallel to the main thread's execution. </para>
 	/// <para> Task allocation may still take a significant sum of time, although this may be alleviated with built-in async execution. </para>
+	/// <para> For integral ranges, `ExecuteRange` and `ExecuteAndWait` allocate a single task per chunk of iterations rather than per iteration, greatly reducing this cost. </para>
 	/// </summary>
 	template
 	<
@@ -384,6 +402,41 @@ namespace EmuThreads
 				EmuThreads::TMP::get_suitable_bind_arg<incrementer_type>(incrementer_)
 			);
 		}
+
+		/// <summary>
+		/// <para> Executes func_unsynced(i) for every integral index i in the range [begin_, end_), with consecutive indices grouped into chunks according to schedule_. </para>
+		/// <para> A single task is allocated per chunk, which executes its indices in a tight serial loop. This avoids the per-iteration allocation cost of `Execute`. </para>
+		/// <para> grain_size_ is the minimum number of indices per chunk, where 0 allows the schedule to decide. STATIC schedules use it as the exact chunk size. </para>
+		/// <para> AUTO schedules execute a short probe of iterations on the calling thread before allocating the remainder. </para>
+		/// <para> This function only allocates chunks to the thread pool; the return of control to the calling thread does not indicate completion of the loop. </para>
+		/// </summary>
+		/// <param name="begin_">First index of the loop.</param>
+		/// <param name="end_">Index one past the final index of the loop.</param>
+		/// <param name="schedule_">Method of splitting the range into chunks.</param>
+		/// <param name="grain_size_">Minimum number of indices per chunk, or 0 to allow the schedule to decide.</param>
+		template<typename Index_>
+		inline void ExecuteRange(Index_ begin_, Index_ end_, ParallelForSchedule schedule_ = ParallelForSchedule::AUTO, std::size_t grain_size_ = 0)
+		{
+			_do_range_execution<false>(begin_, end_, schedule_, grain_size_);
+		}
+
+		/// <summary>
+		/// <para> Performs `ExecuteRange` with the same arguments, but does not return until every index has been executed. </para>
+		/// <para> The calling thread executes the final chunk itself rather than idling, so this is also valid for thread pools with no threads. </para>
+		/// <para> 
+		///		If any chunk throws - including chunks executed by the calling thread - or allocating a chunk throws, the first exception encountered is rethrown once every allocated chunk has completed. 
+		///		Chunks which had not yet been allocated when the calling thread threw are not executed.
+		/// </para>
+		/// </summary>
+		/// <param name="begin_">First index of the loop.</param>
+		/// <param name="end_">Index one past the final index of the loop.</param>
+		/// <param name="schedule_">Method of splitting the range into chunks.</param>
+		/// <param name="grain_size_">Minimum number of indices per chunk, or 0 to allow the schedule to decide.</param>
+		template<typename Index_>
+		inline void ExecuteAndWait(Index_ begin_, Index_ end_, ParallelForSchedule schedule_ = ParallelForSchedule::AUTO, std::size_t grain_size_ = 0)
+		{
+			_do_range_execution<true>(begin_, end_, schedule_, grain_size_);
+		}
 #pragma endregion
 
 		/// <summary>
@@ -450,6 +503,181 @@ namespace EmuThreads
 			}
 		}
 		
+		/// <summary> Approximate execution time targeted for each chunk allocated by an AUTO schedule, in microseconds. </summary>
+		static constexpr double target_chunk_time_us = 100.0;
+		/// <summary> Minimum time spent probing iterations on the calling thread for an AUTO schedule, in microseconds. </summary>
+		static constexpr double min_probe_time_us = 10.0;
+		/// <summary> Number of chunks per worker that AUTO schedules aim to produce at minimum, so that a slow chunk does not leave other workers idle. </summary>
+		static constexpr std::size_t min_auto_chunks_per_worker = 4;
+
+		template<typename Index_>
+		inline void _execute_chunk(Index_ begin_, Index_ end_)
+		{
+			for (Index_ i = begin_; i < end_; ++i)
+			{
+				func_unsynced(i);
+			}
+		}
+
+		/// <summary>
+		/// <para> Executes a growing number of iterations from begin_ on the calling thread until at least min_probe_time_us has passed or max_count_ iterations have been executed. </para>
+		/// <para> Outputs the number of iterations executed via out_count_, and returns the chunk size expected to take roughly target_chunk_time_us. </para>
+		/// </summary>
+		template<typename Index_>
+		[[nodiscard]] inline std::size_t _probe_auto_chunk_size(Index_ begin_, std::size_t max_count_, std::size_t& out_count_)
+		{
+			using clock_type = std::chrono::steady_clock;
+			const clock_type::time_point start_ = clock_type::now();
+			double elapsed_us_ = 0.0;
+			std::size_t batch_ = 1;
+			out_count_ = 0;
+			while (out_count_ < max_count_ && elapsed_us_ < min_probe_time_us)
+			{
+				batch_ = batch_ < (max_count_ - out_count_) ? batch_ : (max_count_ - out_count_);
+				const Index_ batch_begin_ = static_cast<Index_>(begin_ + static_cast<Index_>(out_count_));
+				_execute_chunk(batch_begin_, static_cast<Index_>(batch_begin_ + static_cast<Index_>(batch_)));
+				out_count_ += batch_;
+				batch_ *= 2;
+				elapsed_us_ = std::chrono::duration<double, std::micro>(clock_type::now() - start_).count();
+			}
+
+			if (elapsed_us_ <= 0.0)
+			{
+				return max_count_ != 0 ? max_count_ : 1;
+			}
+			const double chunk_size_ = target_chunk_time_us / (elapsed_us_ / static_cast<double>(out_count_));
+			return chunk_size_ < 1.0 ? 1 : static_cast<std::size_t>(chunk_size_);
+		}
+
+		/// <summary> Number of indices in the next chunk of a GUIDED or STATIC schedule, where fixed_size_ is the precalculated size for fixed-size schedules. </summary>
+		[[nodiscard]] static inline std::size_t _next_chunk_size
+		(
+			ParallelForSchedule schedule_,
+			std::size_t remaining_,
+			std::size_t num_workers_,
+			std::size_t grain_size_,
+			std::size_t fixed_size_
+		)
+		{
+			std::size_t chunk_size_ = fixed_size_;
+			if (schedule_ == ParallelForSchedule::GUIDED)
+			{
+				chunk_size_ = (remaining_ + (2 * num_workers_) - 1) / (2 * num_workers_);
+				chunk_size_ = chunk_size_ < grain_size_ ? grain_size_ : chunk_size_;
+			}
+			return chunk_size_ < remaining_ ? chunk_size_ : remaining_;
+		}
+
+		template<bool Wait_, typename Index_>
+		inline void _do_range_execution(Index_ begin_, Index_ end_, ParallelForSchedule schedule_, std::size_t grain_size_)
+		{
+			static_assert(std::is_integral_v<Index_>, "Attempted to execute a range via EmuThreads::ParallelFor with a non-integral Index_ type. Only integral indices may be split into chunks.");
+			if (!(begin_ < end_))
+			{
+				return;
+			}
+
+			// When waiting, the calling thread is an additional worker
+			const std::size_t num_threads_ = static_cast<std::size_t>(_get_thread_pool().NumThreads());
+			const std::size_t num_workers_ = (num_threads_ != 0 ? num_threads_ : 1) + (Wait_ && num_threads_ != 0 ? 1 : 0);
+			std::size_t remaining_ = static_cast<std::size_t>(end_ - begin_);
+			Index_ chunk_begin_ = begin_;
+
+			std::size_t fixed_size_ = 0;
+			if (schedule_ == ParallelForSchedule::STATIC)
+			{
+				fixed_size_ = grain_size_ != 0 ? grain_size_ : (remaining_ + num_workers_ - 1) / num_workers_;
+			}
+			else if (schedule_ == ParallelForSchedule::AUTO)
+			{
+				// Probe no more than a single worker's share, so that the probe alone cannot serialise the loop
+				std::size_t probed_ = 0;
+				fixed_size_ = _probe_auto_chunk_size(chunk_begin_, remaining_ / (num_workers_ * min_auto_chunks_per_worker), probed_);
+				chunk_begin_ = static_cast<Index_>(chunk_begin_ + static_cast<Index_>(probed_));
+				remaining_ -= probed_;
+
+				const std::size_t max_size_ = (remaining_ + (num_workers_ * min_auto_chunks_per_worker) - 1) / (num_workers_ * min_auto_chunks_per_worker);
+				fixed_size_ = fixed_size_ < max_size_ ? fixed_size_ : max_size_;
+				fixed_size_ = fixed_size_ < grain_size_ ? grain_size_ : fixed_size_;
+				fixed_size_ = fixed_size_ != 0 ? fixed_size_ : 1;
+			}
+			else if (schedule_ != ParallelForSchedule::GUIDED)
+			{
+				throw std::invalid_argument("Provided an invalid ParallelForSchedule to EmuThreads::ParallelFor range execution.");
+			}
+
+			// When waiting, chunks reference this object, so every allocated chunk must be waited on before leaving this function - even if the calling thread throws
+			std::vector<std::future<void>> pending_chunks_;
+			std::exception_ptr first_exception_ = nullptr;
+			try
+			{
+				while (remaining_ != 0)
+				{
+					const std::size_t chunk_size_ = _next_chunk_size(schedule_, remaining_, num_workers_, grain_size_, fixed_size_);
+					const Index_ chunk_end_ = static_cast<Index_>(chunk_begin_ + static_cast<Index_>(chunk_size_));
+					remaining_ -= chunk_size_;
+
+					if constexpr (Wait_)
+					{
+						if (remaining_ == 0 || num_threads_ == 0)
+						{
+							_execute_chunk(chunk_begin_, chunk_end_);
+						}
+						else
+						{
+							pending_chunks_.emplace_back(_get_thread_pool().AllocateTask([this, chunk_begin_, chunk_end_]() { _execute_chunk(chunk_begin_, chunk_end_); }));
+							if (!pending_chunks_.back().valid())
+							{
+								// The pool rejected this chunk, so it is executed here instead
+								_execute_chunk(chunk_begin_, chunk_end_);
+							}
+						}
+					}
+					else
+					{
+						_get_thread_pool().AllocateTask([this, chunk_begin_, chunk_end_]() { _execute_chunk(chunk_begin_, chunk_end_); });
+					}
+					chunk_begin_ = chunk_end_;
+				}
+			}
+			catch (...)
+			{
+				if constexpr (Wait_)
+				{
+					first_exception_ = std::current_exception();
+				}
+				else
+				{
+					throw;
+				}
+			}
+
+			if constexpr (Wait_)
+			{
+				for (auto& pending_chunk_ : pending_chunks_)
+				{
+					if (pending_chunk_.valid())
+					{
+						try
+						{
+							pending_chunk_.get();
+						}
+						catch (...)
+						{
+							if (first_exception_ == nullptr)
+							{
+								first_exception_ = std::current_exception();
+							}
+						}
+					}
+				}
+				if (first_exception_ != nullptr)
+				{
+					std::rethrow_exception(first_exception_);
+				}
+			}
+		}
+
 		template<class T_>
 		[[nodiscard]] static constexpr inline bool _is_tuple()
 		{
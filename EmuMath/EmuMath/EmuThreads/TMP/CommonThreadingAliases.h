@@ -1,11 +1,15 @@
 #ifndef EMU_THREADS_COMMON_THREADING_ALIASES_H_INC_
 #define EMU_THREADS_COMMON_THREADING_ALIASES_H_INC_ 1
 
+#include <cstddef>
 #include <cstdint>
 
 namespace EmuThreads::TMP
 {
 	using default_priority_type = std::int16_t;
+
+	/// <summary> Assumed size of a cache line in bytes, used to pad frequently modified atomics so that they do not share a line with other data. </summary>
+	inline constexpr std::size_t assumed_cache_line_size = 64;
 }
 
 #endif
@@ -71,6 +71,17 @@ namespace EmuThreads::TMP
 		static constexpr bool value = true;
 	};
 
+	template<class WorkAllocator_, class Func_, typename = void>
+	struct has_submit_task_member_func
+	{
+		static constexpr bool value = false;
+	};
+	template<class WorkAllocator_, class Func_>
+	struct has_submit_task_member_func<WorkAllocator_, Func_, std::void_t<decltype(std::declval<WorkAllocator_>().SubmitTask(std::declval<Func_>()))>>
+	{
+		static constexpr bool value = true;
+	};
+
 	template<class ThreadAllocator_, typename = void>
 	struct has_join_all_member_func
 	{
@@ -4,9 +4,12 @@
 #include <functional>
 #include <queue>
 #include <thread>
+#include "Functors/bounded_work_allocator.h"
 #include "Functors/default_thread_allocator.h"
 #include "Functors/default_work_allocator.h"
+#include "Functors/parking_work_allocator.h"
 #include "Functors/prioritised_work_allocator.h"
+#include "Functors/work_stealing_work_allocator.h"
 #include "TMP/CommonThreadingAliases.h"
 #include "TMP/ThreadPoolTMP.h"
 #include "../EmuCore/TMPHelpers/Values.h"
@@ -327,6 +330,43 @@ namespace EmuThreads
 			}
 		}
 
+		/// <summary>
+		/// <para> Submits any valid generic task to be performed by one of this pool's worker threads, without providing a future to its results. </para>
+		/// <para> The provided args_ must be valid arguments to invoke the provided func_ via the syntax `func_(args_...)`. </para>
+		/// <para> If non-value arguments are being provided, it is highly recommended to explicitly type provided Args_ template types, or use std wrappers. </para>
+		/// <para>
+		///		If this thread pool's work allocator provides a `SubmitTask` function, it will be used to avoid the cost of creating a future.
+		///		For the default EmuThreads allocators, small tasks are then stored inline in a reused queue slot and do not allocate.
+		///		Otherwise, this is equivalent to AllocateTask with the resulting future discarded.
+		/// </para>
+		/// <para> If the work allocator's `SubmitTask` function outputs a value (such as bounded_work_allocator reporting if a task was rejected), it is output by this function. </para>
+		/// <para> If this thread pool's work allocator supports priorities, this will apply the default priority to the provided task. </para>
+		/// </summary>
+		/// <typeparam name="Args_">All argument types to pass in the provided order when invoking the provided func_.</typeparam>
+		/// <typeparam name="Func_">Type of invocable to be called.</typeparam>
+		/// <param name="func_">Invocable item (such as a functor or function pointer) to be invoked.</param>
+		/// <param name="args_">Arguments to pass when invoking the provided func_.</param>
+		template<class...Args_, class Func_, typename RequiresValidArgs_ = std::enable_if_t<std::is_invocable_v<Func_, Args_...>>>
+		inline auto SubmitTask(Func_ func_, Args_...args_)
+		{
+			if constexpr (has_task_priorities)
+			{
+				work_allocator.AllocateTask(make_priority(), std::bind(func_, EmuThreads::TMP::get_suitable_bind_arg<Args_>(args_)...));
+			}
+			else
+			{
+				using bound_type = decltype(std::bind(func_, EmuThreads::TMP::get_suitable_bind_arg<Args_>(args_)...));
+				if constexpr (EmuThreads::TMP::has_submit_task_member_func<work_allocator_type, bound_type>::value)
+				{
+					return work_allocator.SubmitTask(std::bind(func_, EmuThreads::TMP::get_suitable_bind_arg<Args_>(args_)...));
+				}
+				else
+				{
+					work_allocator.AllocateTask(std::bind(func_, EmuThreads::TMP::get_suitable_bind_arg<Args_>(args_)...));
+				}
+			}
+		}
+
 		/// <summary>
 		/// <para> Performs allocation of any valid generic task to be performed by one of this pool's worker threads. </para>
 		/// <para> The provided args_ must be valid arguments to invoke the provided func_ via the syntax `func_(args_...)`. </para>
@@ -372,6 +412,33 @@ namespace EmuThreads
 		EmuThreads::Functors::default_thread_allocator<std::thread>
 	>;
 
+	/// <summary>
+	/// <para> Alias for EmuThreads::ThreadPool with default arguments except for the work allocator, which is EmuThreads::Functors::bounded_work_allocator. </para>
+	/// <para> Recommended where producer threads feed the pool at high rates and need predictable allocation latency. </para>
+	/// </summary>
+	template<EmuThreads::QueueFullPolicy FullPolicy_ = EmuThreads::QueueFullPolicy::BLOCK, std::size_t Capacity_ = 4096>
+	using BoundedThreadPool = ThreadPool
+	<
+		std::thread,
+		EmuThreads::Functors::bounded_work_allocator<FullPolicy_, Capacity_>,
+		EmuThreads::Functors::default_thread_allocator<std::thread>
+	>;
+	/// <summary>
+	/// <para> Alias for EmuThreads::BoundedThreadPool with all default arguments. </para>
+	/// </summary>
+	using DefaultBoundedThreadPool = BoundedThreadPool<>;
+
+	/// <summary>
+	/// <para> Alias for EmuThreads::ThreadPool with default arguments except for the work allocator, which is EmuThreads::Functors::parking_work_allocator. </para>
+	/// <para> Recommended where tasks arrive intermittently and should begin promptly, without idle threads repeatedly waking to poll for work. </para>
+	/// </summary>
+	using ParkingThreadPool = ThreadPool
+	<
+		std::thread,
+		EmuThreads::Functors::parking_work_allocator,
+		EmuThreads::Functors::default_thread_allocator<std::thread>
+	>;
+
 	/// <summary>
 	/// <para>
 	///		Alias for EmuThreads::ThreadPool with default arguments except for the work allocator, which is the default EmuThreads::Functors::prioritised_work_allocator.
@@ -388,6 +455,17 @@ namespace EmuThreads
 	/// <para> Alias for EmuThreads::PrioritisedThreadPool with EmuThreads::TMP::default_priority_type as the priority type. </para>
 	/// </summary>
 	using DefaultPrioritisedThreadPool = PrioritisedThreadPool<EmuThreads::TMP::default_priority_type>;
+
+	/// <summary>
+	/// <para> Alias for EmuThreads::ThreadPool with default arguments except for the work allocator, which is EmuThreads::Functors::work_stealing_work_allocator. </para>
+	/// <para> Recommended for heavily contended pools with many threads, or where tasks commonly allocate further tasks to the same pool. </para>
+	/// </summary>
+	using WorkStealingThreadPool = ThreadPool
+	<
+		std::thread,
+		EmuThreads::Functors::work_stealing_work_allocator,
+		EmuThreads::Functors::default_thread_allocator<std::thread>
+	>;
 }
 
 #endif
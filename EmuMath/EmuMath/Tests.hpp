@@ -10,11 +10,34 @@
 #include <tuple>
 
 // ADDITIONAL INCLUDES
+#include "EmuMath/FastNoise.h"
+#include "EmuMath/FastVector.h"
+#include "EmuMath/Matrix.h"
+#include "EmuMath/Noise.h"
+#include "EmuMath/Quaternion.h"
 #include "EmuMath/Vector.h"
+#include "EmuMath/VectorExpression.h"
+#include "EmuMath/VectorSoA.h"
+#include "EmuSIMD/SIMDHelpers.h"
 #include "EmuMath/Random.h"
+#include "EmuThreads/ParallelFor.h"
+#include "EmuThreads/ThreadPool.h"
+#include <algorithm>
+#include <atomic>
 #include <bitset>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
 #include <DirectXMath.h>
 #include <string_view>
+#include <thread>
+#include <vector>
 
 namespace EmuCore::TestingHelpers
 {
@@ -236,20 +259,2865 @@ namespace EmuCore::TestingHelpers
 		std::vector<DirectX::XMFLOAT3> out_reflection;
 	};
 
+	/// <summary>
+	/// <para> Tallies the checks made by a behaviour test, outputting a line for each check that fails. </para>
+	/// <para> Behaviour tests run a single harness loop which performs all of their checks; their timings are incidental. </para>
+	/// </summary>
+	struct behaviour_check_results
+	{
+		behaviour_check_results() : num_checks(0), num_failures(0)
+		{
+		}
+
+		inline bool Check(bool passed_, std::string_view description_)
+		{
+			++num_checks;
+			if (!passed_)
+			{
+				++num_failures;
+				std::cout << "\tFAILED: " << description_ << "\n";
+			}
+			return passed_;
+		}
+
+		/// <summary> Checks that result_ is within tolerance_ of expected_, where tolerance_ is scaled by the magnitude of expected_ when it exceeds 1. </summary>
+		template<typename T_>
+		inline bool CheckNear(T_ result_, T_ expected_, T_ tolerance_, std::string_view description_)
+		{
+			const T_ abs_expected_ = std::abs(expected_);
+			const T_ scaled_tolerance_ = abs_expected_ > T_(1) ? tolerance_ * abs_expected_ : tolerance_;
+			return Check(std::abs(result_ - expected_) <= scaled_tolerance_, description_);
+		}
+
+		/// <summary> Performs CheckNear on every respective element of two EmuMath Vectors of the same size. </summary>
+		template<std::size_t Size_, typename T_>
+		inline bool CheckNearVector(const EmuMath::Vector<Size_, T_>& result_, const EmuMath::Vector<Size_, T_>& expected_, T_ tolerance_, std::string_view description_)
+		{
+			bool all_near_ = true;
+			for (std::size_t i = 0; i < Size_; ++i)
+			{
+				const T_ abs_expected_ = std::abs(expected_.at(i));
+				const T_ scaled_tolerance_ = abs_expected_ > T_(1) ? tolerance_ * abs_expected_ : tolerance_;
+				all_near_ = all_near_ && std::abs(result_.at(i) - expected_.at(i)) <= scaled_tolerance_;
+			}
+			return Check(all_near_, description_);
+		}
+
+		inline void OutputSummary(std::string_view test_name_) const
+		{
+			std::cout << test_name_ << ": " << (num_checks - num_failures) << "/" << num_checks << " checks passed";
+			std::cout << (num_failures == 0 ? "\n" : " (FAILURES PRESENT)\n");
+		}
+
+		std::size_t num_checks;
+		std::size_t num_failures;
+	};
+
+	/// <summary>
+	/// <para> Common base for behaviour tests, providing the harness settings they share. Derived_ must provide NAME and a PerformChecks function. </para>
+	/// <para> All checks are performed in the single harness loop, after which the summary of their results is output once. </para>
+	/// </summary>
+	template<class Derived_>
+	struct behaviour_test_base
+	{
+		static constexpr bool DO_TEST = true;
+		static constexpr bool PASS_LOOP_NUM = true;
+		static constexpr std::size_t NUM_LOOPS = 1;
+		static constexpr bool WRITE_ALL_TIMES_TO_STREAM = false;
+
+		behaviour_test_base() : results()
+		{
+		}
+		void Prepare()
+		{
+		}
+		void operator()(std::size_t i)
+		{
+			static_cast<Derived_*>(this)->PerformChecks();
+			results.OutputSummary(Derived_::NAME);
+		}
+		void OnTestsOver()
+		{
+		}
+
+		behaviour_check_results results;
+	};
+
+	/// <summary> Checks FastVector arithmetic and vector operations against the equivalent scalar EmuMath::Vector results. </summary>
+	struct fast_vector_behaviour_test : public behaviour_test_base<fast_vector_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "FastVector Behaviour";
+
+		static constexpr std::size_t num_samples = 256;
+
+		void PerformChecks()
+		{
+			RngFunctor rng_ = RngFunctor(shared_fill_seed_);
+			rng_._rng.SetMinMax(-10, 10);
+			for (std::size_t sample_ = 0; sample_ < num_samples; ++sample_)
+			{
+				_check_sample<4, float>(rng_, 1.0e-4f);
+				_check_sample<2, double>(rng_, 1.0e-12);
+#if defined(__AVX__)
+				_check_sample<8, float>(rng_, 1.0e-4f);
+#endif
+			}
+
+			EmuMath::FastVector<4, float> rounded_(-1.5f, -0.25f, 0.25f, 2.75f);
+			results.Check(rounded_.Floor().AsVector() == EmuMath::Vector<4, float>(-2.0f, -1.0f, 0.0f, 2.0f), "FastVector<4, float>::Floor");
+			results.Check(rounded_.Ceil().AsVector() == EmuMath::Vector<4, float>(-1.0f, -0.0f, 1.0f, 3.0f), "FastVector<4, float>::Ceil");
+			results.Check(rounded_.Trunc().AsVector() == EmuMath::Vector<4, float>(-1.0f, -0.0f, 0.0f, 2.0f), "FastVector<4, float>::Trunc");
+
+			alignas(EmuMath::FastVector<4, float>::required_alignment) float stored_[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+			rounded_.Store(stored_);
+			results.Check(EmuMath::FastVector<4, float>::Load(stored_) == rounded_, "FastVector<4, float> Store/Load round trip");
+			results.Check(rounded_.at<3>() == 2.75f, "FastVector<4, float>::at");
+		}
+
+		template<std::size_t Size_, typename T_>
+		void _check_sample(RngFunctor& rng_, T_ tolerance_)
+		{
+			using vector_type = EmuMath::Vector<Size_, T_>;
+			using fast_type = EmuMath::FastVector<Size_, T_>;
+
+			vector_type a_ = vector_type();
+			vector_type b_ = vector_type();
+			for (std::size_t i = 0; i < Size_; ++i)
+			{
+				a_.at(i) = rng_(T_());
+				b_.at(i) = rng_(T_());
+				b_.at(i) = b_.at(i) == T_(0) ? T_(1) : b_.at(i);
+			}
+			const fast_type fast_a_(a_);
+			const fast_type fast_b_(b_);
+			const T_ t_ = T_(0.25);
+
+			results.Check(fast_a_.AsVector() == a_, "FastVector construction from Vector");
+			results.CheckNearVector(fast_a_.Add(fast_b_).AsVector(), a_.Add(b_), tolerance_, "FastVector::Add");
+			results.CheckNearVector(fast_a_.Subtract(fast_b_).AsVector(), a_.Subtract(b_), tolerance_, "FastVector::Subtract");
+			results.CheckNearVector(fast_a_.Multiply(fast_b_).AsVector(), a_.Multiply(b_), tolerance_, "FastVector::Multiply");
+			results.CheckNearVector(fast_a_.Divide(fast_b_).AsVector(), a_.Divide(b_), tolerance_, "FastVector::Divide");
+			results.CheckNearVector((fast_a_ * t_).AsVector(), a_.Multiply(t_), tolerance_, "FastVector scalar operator*");
+			results.CheckNearVector(fast_a_.Min(fast_b_).AsVector(), a_.Min(b_), tolerance_, "FastVector::Min");
+			results.CheckNearVector(fast_a_.Max(fast_b_).AsVector(), a_.Max(b_), tolerance_, "FastVector::Max");
+			results.CheckNearVector(fast_a_.Abs().AsVector(), a_.Abs(), tolerance_, "FastVector::Abs");
+			results.CheckNearVector(fast_a_.Clamp(T_(-100), T_(100)).AsVector(), a_.Clamp(T_(-100), T_(100)), tolerance_, "FastVector::Clamp");
+			results.CheckNearVector(fast_a_.Lerp(fast_b_, t_).AsVector(), a_.Lerp(b_, t_), tolerance_, "FastVector::Lerp");
+			results.CheckNearVector(fast_a_.Normalise().AsVector(), a_.Normalise(), tolerance_, "FastVector::Normalise");
+			results.CheckNear(fast_a_.Dot(fast_b_), a_.template Dot<T_>(b_), tolerance_, "FastVector::Dot");
+			results.CheckNear(fast_a_.SquareMagnitude(), a_.template SquareMagnitude<T_>(), tolerance_, "FastVector::SquareMagnitude");
+			results.CheckNear(fast_a_.Magnitude(), a_.template Magnitude<T_>(), tolerance_, "FastVector::Magnitude");
+			results.CheckNear(fast_a_.Distance(fast_b_), a_.template Distance<T_>(b_), tolerance_, "FastVector::Distance");
+			results.Check(fast_a_.CmpAllEqual(fast_a_) && !fast_a_.CmpAllEqual(fast_a_ + T_(1)), "FastVector::CmpAllEqual");
+		}
+	};
+
+	/// <summary> Fills every element of the passed EmuMath Matrix with values from the passed rng_. </summary>
+	template<class Matrix_>
+	inline void fill_matrix(Matrix_& matrix_, RngFunctor& rng_)
+	{
+		for (std::size_t column_ = 0; column_ < Matrix_::num_columns; ++column_)
+		{
+			for (std::size_t row_ = 0; row_ < Matrix_::num_rows; ++row_)
+			{
+				matrix_.at(column_, row_) = rng_(typename Matrix_::value_type_uq());
+			}
+		}
+	}
+
+	/// <summary> Calculates `lhs_ * rhs_` as a double-precision reference for checking EmuMath Matrix multiplication. </summary>
+	template<class OutMatrix_, class LhsMatrix_, class RhsMatrix_>
+	[[nodiscard]] inline OutMatrix_ reference_matrix_multiply(const LhsMatrix_& lhs_, const RhsMatrix_& rhs_)
+	{
+		OutMatrix_ out_ = OutMatrix_();
+		for (std::size_t column_ = 0; column_ < OutMatrix_::num_columns; ++column_)
+		{
+			for (std::size_t row_ = 0; row_ < OutMatrix_::num_rows; ++row_)
+			{
+				double sum_ = 0.0;
+				for (std::size_t k_ = 0; k_ < LhsMatrix_::num_columns; ++k_)
+				{
+					sum_ += static_cast<double>(lhs_.at(k_, row_)) * static_cast<double>(rhs_.at(column_, k_));
+				}
+				out_.at(column_, row_) = static_cast<typename OutMatrix_::value_type_uq>(sum_);
+			}
+		}
+		return out_;
+	}
+
+	/// <summary> Checks that every respective element of two EmuMath Matrices of the same dimensions is within tolerance_. </summary>
+	template<class Matrix_>
+	inline bool check_near_matrix(behaviour_check_results& results_, const Matrix_& result_, const Matrix_& expected_, float tolerance_, std::string_view description_)
+	{
+		bool all_near_ = true;
+		for (std::size_t column_ = 0; column_ < Matrix_::num_columns; ++column_)
+		{
+			for (std::size_t row_ = 0; row_ < Matrix_::num_rows; ++row_)
+			{
+				const double expected_value_ = static_cast<double>(expected_.at(column_, row_));
+				const double abs_expected_ = std::abs(expected_value_);
+				const double scaled_tolerance_ = abs_expected_ > 1.0 ? tolerance_ * abs_expected_ : tolerance_;
+				all_near_ = all_near_ && std::abs(static_cast<double>(result_.at(column_, row_)) - expected_value_) <= scaled_tolerance_;
+			}
+		}
+		return results_.Check(all_near_, description_);
+	}
+
+	/// <summary> Checks the SIMD and generic paths of EmuMath Matrix multiplication against a double-precision reference. </summary>
+	struct matrix_multiply_behaviour_test : public behaviour_test_base<matrix_multiply_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "Matrix Multiply Behaviour";
+
+		static constexpr std::size_t num_samples = 64;
+		static constexpr float tolerance = 1.0e-4f;
+
+		void PerformChecks()
+		{
+			RngFunctor rng_ = RngFunctor(shared_fill_seed_);
+			rng_._rng.SetMinMax(-2, 2);
+			for (std::size_t sample_ = 0; sample_ < num_samples; ++sample_)
+			{
+				using cm_4x4 = EmuMath::Matrix<4, 4, float, true>;
+				using rm_4x4 = EmuMath::Matrix<4, 4, float, false>;
+				cm_4x4 cm_a_, cm_b_;
+				rm_4x4 rm_a_, rm_b_;
+				fill_matrix(cm_a_, rng_);
+				fill_matrix(cm_b_, rng_);
+				fill_matrix(rm_a_, rng_);
+				fill_matrix(rm_b_, rng_);
+				check_near_matrix(results, cm_a_ * cm_b_, reference_matrix_multiply<cm_4x4>(cm_a_, cm_b_), tolerance, "Column-major 4x4 float SIMD multiply");
+				check_near_matrix(results, rm_a_ * rm_b_, reference_matrix_multiply<rm_4x4>(rm_a_, rm_b_), tolerance, "Row-major 4x4 float SIMD multiply");
+				check_near_matrix(results, cm_a_.Multiply<float, false>(rm_b_), reference_matrix_multiply<rm_4x4>(cm_a_, rm_b_), tolerance, "Mixed-major 4x4 float multiply");
+
+				EmuMath::Matrix<2, 3, float> lhs_2x3_;
+				EmuMath::Matrix<3, 2, float> rhs_3x2_;
+				fill_matrix(lhs_2x3_, rng_);
+				fill_matrix(rhs_3x2_, rng_);
+				check_near_matrix(results, lhs_2x3_ * rhs_3x2_, reference_matrix_multiply<EmuMath::Matrix<3, 3, float>>(lhs_2x3_, rhs_3x2_), tolerance, "Non-square float multiply");
+
+				EmuMath::Vector<4, float> vector_(rng_(0.0f), rng_(0.0f), rng_(0.0f), rng_(0.0f));
+				EmuMath::Matrix<1, 4, float> column_vector_;
+				for (std::size_t row_ = 0; row_ < 4; ++row_)
+				{
+					column_vector_.at(0, row_) = vector_.at(row_);
+				}
+				const EmuMath::Matrix<1, 4, float> expected_column_ = reference_matrix_multiply<EmuMath::Matrix<1, 4, float>>(cm_a_, column_vector_);
+				const EmuMath::Vector<4, float> transformed_ = cm_a_ * vector_;
+				bool vector_near_ = true;
+				for (std::size_t row_ = 0; row_ < 4; ++row_)
+				{
+					const float expected_ = expected_column_.at(0, row_);
+					vector_near_ = vector_near_ && std::abs(transformed_.at(row_) - expected_) <= (std::abs(expected_) > 1.0f ? tolerance * std::abs(expected_) : tolerance);
+				}
+				results.Check(vector_near_, "Column-major 4x4 float SIMD Matrix * Vector");
+			}
+
+			// A single-column lhs must not make explicit <OutT_, OutColumnMajor_> arguments ambiguous with the dimension-deducing overloads
+			EmuMath::Matrix<1, 3, float, true> single_column_;
+			EmuMath::Matrix<2, 1, float, true> single_row_;
+			fill_matrix(single_column_, rng_);
+			fill_matrix(single_row_, rng_);
+			const EmuMath::Matrix<2, 3, double, false> outer_ = EmuMath::Helpers::matrix_multiply<double, false>(single_column_, single_row_);
+			check_near_matrix
+			(
+				results,
+				outer_,
+				reference_matrix_multiply<EmuMath::Matrix<2, 3, double, false>>(single_column_, single_row_),
+				tolerance,
+				"Single-column lhs multiply with explicit output major order"
+			);
+			EmuMath::Vector<1, float> single_scale_ = EmuMath::Vector<1, float>();
+			single_scale_.at<0>() = 2.0f;
+			const EmuMath::Vector<3, double> single_column_transformed_ = EmuMath::Helpers::matrix_multiply<double>(single_column_, single_scale_);
+			results.CheckNear(single_column_transformed_.at<2>(), 2.0 * single_column_.at(0, 2), 1.0e-6, "Single-column lhs Matrix * Vector");
+		}
+	};
+
+	/// <summary> Checks batched AoS and SoA point transformation against individually transformed points, including SIMD remainders and in-place output. </summary>
+	struct transform_points_behaviour_test : public behaviour_test_base<transform_points_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "Matrix TransformPoints Behaviour";
+
+		static constexpr float tolerance = 1.0e-4f;
+
+		void PerformChecks()
+		{
+			// Counts cover empty input, remainder-only input, SIMD remainders, and (with a remainder) output large enough for non-temporal stores
+			constexpr std::size_t non_temporal_count_ = (EmuMath::Helpers::_matrix_underlying::_transform_points_non_temporal_threshold_bytes / (3 * sizeof(float))) + 5;
+			constexpr std::size_t counts_[] = { 0, 3, 37, 8195, non_temporal_count_ };
+			RngFunctor rng_ = RngFunctor(shared_fill_seed_);
+			rng_._rng.SetMinMax(-2, 2);
+			for (const std::size_t count_ : counts_)
+			{
+				_check_count<true>(rng_, count_);
+				_check_count<false>(rng_, count_);
+			}
+		}
+
+		template<bool ColumnMajor_>
+		void _check_count(RngFunctor& rng_, std::size_t count_)
+		{
+			EmuMath::Matrix<4, 4, float, ColumnMajor_> matrix_;
+			fill_matrix(matrix_, rng_);
+
+			std::vector<EmuMath::Vector<3, float>> points_(count_);
+			std::vector<EmuMath::Vector<3, float>> expected_(count_);
+			for (std::size_t i = 0; i < count_; ++i)
+			{
+				points_[i] = EmuMath::Vector<3, float>(rng_(0.0f), rng_(0.0f), rng_(0.0f));
+				for (std::size_t row_ = 0; row_ < 3; ++row_)
+				{
+					double sum_ = static_cast<double>(matrix_.at(3, row_));
+					for (std::size_t column_ = 0; column_ < 3; ++column_)
+					{
+						sum_ += static_cast<double>(matrix_.at(column_, row_)) * static_cast<double>(points_[i].at(column_));
+					}
+					expected_[i].at(row_) = static_cast<float>(sum_);
+				}
+			}
+
+			// Outputs are aligned so that large counts take the non-temporal path, which requires 16-byte (AoS) or 32-byte (SoA) aligned output
+			std::vector<EmuMath::Vector<3, float>> aos_out_buffer_(count_ + 4);
+			EmuMath::Vector<3, float>* p_aos_out_ = _first_aligned<16>(aos_out_buffer_);
+			EmuMath::Helpers::matrix_transform_points(matrix_, points_.data(), p_aos_out_, count_);
+			results.Check(_all_near(p_aos_out_, expected_), "AoS matrix_transform_points");
+
+			std::vector<float> in_x_(count_), in_y_(count_), in_z_(count_), out_x_(count_ + 8), out_y_(count_ + 8), out_z_(count_ + 8);
+			float* p_out_x_ = _first_aligned<32>(out_x_);
+			float* p_out_y_ = _first_aligned<32>(out_y_);
+			float* p_out_z_ = _first_aligned<32>(out_z_);
+			for (std::size_t i = 0; i < count_; ++i)
+			{
+				in_x_[i] = points_[i].at<0>();
+				in_y_[i] = points_[i].at<1>();
+				in_z_[i] = points_[i].at<2>();
+			}
+			EmuMath::Helpers::matrix_transform_points(matrix_, in_x_.data(), in_y_.data(), in_z_.data(), p_out_x_, p_out_y_, p_out_z_, count_);
+			std::vector<EmuMath::Vector<3, float>> soa_out_(count_);
+			for (std::size_t i = 0; i < count_; ++i)
+			{
+				soa_out_[i] = EmuMath::Vector<3, float>(p_out_x_[i], p_out_y_[i], p_out_z_[i]);
+			}
+			results.Check(_all_near(soa_out_.data(), expected_), "SoA matrix_transform_points");
+
+			EmuMath::Helpers::matrix_transform_points(matrix_, points_.data(), points_.data(), count_);
+			results.Check(_all_near(points_.data(), expected_), "In-place AoS matrix_transform_points");
+		}
+
+		/// <summary> Outputs a pointer to the first of the first Alignment_ elements of buffer_ whose address is aligned to Alignment_ bytes. </summary>
+		template<std::size_t Alignment_, typename T_>
+		[[nodiscard]] static T_* _first_aligned(std::vector<T_>& buffer_)
+		{
+			T_* p_element_ = buffer_.data();
+			for (std::size_t i = 1; i < Alignment_ && (reinterpret_cast<std::uintptr_t>(p_element_) % Alignment_) != 0; ++i)
+			{
+				p_element_ = buffer_.data() + i;
+			}
+			return p_element_;
+		}
+
+		[[nodiscard]] static bool _all_near(const EmuMath::Vector<3, float>* p_result_, const std::vector<EmuMath::Vector<3, float>>& expected_)
+		{
+			for (std::size_t i = 0; i < expected_.size(); ++i)
+			{
+				for (std::size_t element_ = 0; element_ < 3; ++element_)
+				{
+					const float expected_value_ = expected_[i].at(element_);
+					const float scaled_tolerance_ = std::abs(expected_value_) > 1.0f ? tolerance * std::abs(expected_value_) : tolerance;
+					if (!(std::abs(p_result_[i].at(element_) - expected_value_) <= scaled_tolerance_))
+					{
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+	};
+
+	/// <summary> Calculates the determinant of a row-major square matrix of the passed size_ via Laplace expansion, as a reference for checking EmuMath Matrix determinants. </summary>
+	[[nodiscard]] inline double reference_determinant(const std::vector<double>& elements_, std::size_t size_)
+	{
+		if (size_ == 1)
+		{
+			return elements_[0];
+		}
+
+		double determinant_ = 0.0;
+		std::vector<double> minor_((size_ - 1) * (size_ - 1));
+		for (std::size_t excluded_column_ = 0; excluded_column_ < size_; ++excluded_column_)
+		{
+			std::size_t minor_index_ = 0;
+			for (std::size_t row_ = 1; row_ < size_; ++row_)
+			{
+				for (std::size_t column_ = 0; column_ < size_; ++column_)
+				{
+					if (column_ != excluded_column_)
+					{
+						minor_[minor_index_++] = elements_[(row_ * size_) + column_];
+					}
+				}
+			}
+			const double sign_ = (excluded_column_ % 2) == 0 ? 1.0 : -1.0;
+			determinant_ += sign_ * elements_[excluded_column_] * reference_determinant(minor_, size_ - 1);
+		}
+		return determinant_;
+	}
+
+	/// <summary> Checks Matrix Transpose, Determinant and Inverse against reference results for each specialised size and the generic LU path. </summary>
+	struct matrix_inverse_behaviour_test : public behaviour_test_base<matrix_inverse_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "Matrix Transpose/Determinant/Inverse Behaviour";
+
+		static constexpr std::size_t num_samples = 32;
+		static constexpr float tolerance = 1.0e-4f;
+
+		void PerformChecks()
+		{
+			RngFunctor rng_ = RngFunctor(shared_fill_seed_);
+			rng_._rng.SetMinMax(-1, 1);
+			for (std::size_t sample_ = 0; sample_ < num_samples; ++sample_)
+			{
+				_check_square<EmuMath::Matrix<2, 2, float, true>>(rng_, "2x2 float");
+				_check_square<EmuMath::Matrix<3, 3, float, true>>(rng_, "3x3 float");
+				_check_square<EmuMath::Matrix<4, 4, float, true>>(rng_, "Column-major 4x4 float (SIMD)");
+				_check_square<EmuMath::Matrix<4, 4, float, false>>(rng_, "Row-major 4x4 float (SIMD)");
+				_check_square<EmuMath::Matrix<4, 4, double, true>>(rng_, "4x4 double");
+				_check_square<EmuMath::Matrix<5, 5, double, false>>(rng_, "5x5 double (LU)");
+			}
+
+			// Single-column and 1x1 matrices must not make explicit <OutT_, OutColumnMajor_> arguments ambiguous
+			EmuMath::Matrix<1, 3, float> single_column_;
+			fill_matrix(single_column_, rng_);
+			const EmuMath::Matrix<3, 1, float> single_row_ = single_column_.Transpose();
+			results.Check
+			(
+				single_row_.at(0, 0) == single_column_.at(0, 0) && single_row_.at(1, 0) == single_column_.at(0, 1) && single_row_.at(2, 0) == single_column_.at(0, 2),
+				"Single-column Matrix Transpose"
+			);
+			EmuMath::Matrix<1, 1, float> scalar_matrix_;
+			scalar_matrix_.at(0, 0) = 4.0f;
+			results.CheckNear(scalar_matrix_.Inverse<float>().at(0, 0), 0.25f, 1.0e-6f, "1x1 Matrix Inverse");
+		}
+
+		template<class Matrix_>
+		void _check_square(RngFunctor& rng_, std::string_view size_name_)
+		{
+			using value_type = typename Matrix_::value_type_uq;
+			constexpr std::size_t size_ = Matrix_::num_columns;
+
+			// Diagonal dominance keeps random matrices well-conditioned, so that float tolerances remain meaningful
+			Matrix_ matrix_;
+			fill_matrix(matrix_, rng_);
+			for (std::size_t d_ = 0; d_ < size_; ++d_)
+			{
+				matrix_.at(d_, d_) += static_cast<value_type>(size_);
+			}
+
+			const Matrix_ transpose_ = matrix_.Transpose();
+			bool transpose_matches_ = true;
+			std::vector<double> row_major_elements_(size_ * size_);
+			for (std::size_t column_ = 0; column_ < size_; ++column_)
+			{
+				for (std::size_t row_ = 0; row_ < size_; ++row_)
+				{
+					transpose_matches_ = transpose_matches_ && transpose_.at(row_, column_) == matrix_.at(column_, row_);
+					row_major_elements_[(row_ * size_) + column_] = static_cast<double>(matrix_.at(column_, row_));
+				}
+			}
+			results.Check(transpose_matches_, std::string(size_name_) + " Transpose");
+
+			const double expected_determinant_ = reference_determinant(row_major_elements_, size_);
+			results.CheckNear(static_cast<double>(matrix_.Determinant()), expected_determinant_, static_cast<double>(tolerance), std::string(size_name_) + " Determinant");
+
+			value_type inverse_determinant_ = value_type();
+			const Matrix_ inverse_ = matrix_.Inverse(inverse_determinant_);
+			results.CheckNear(static_cast<double>(inverse_determinant_), expected_determinant_, static_cast<double>(tolerance), std::string(size_name_) + " Inverse output determinant");
+
+			Matrix_ identity_;
+			for (std::size_t d_ = 0; d_ < size_; ++d_)
+			{
+				identity_.at(d_, d_) = value_type(1);
+			}
+			check_near_matrix(results, reference_matrix_multiply<Matrix_>(matrix_, inverse_), identity_, tolerance, std::string(size_name_) + " Matrix * Inverse == Identity");
+		}
+	};
+
+	/// <summary> Checks affine builders against their defining properties, and the affine inverse against the general Matrix inverse. </summary>
+	struct matrix_affine_behaviour_test : public behaviour_test_base<matrix_affine_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "Matrix Affine Behaviour";
+
+		static constexpr std::size_t num_samples = 64;
+		static constexpr float tolerance = 1.0e-4f;
+
+		void PerformChecks()
+		{
+			RngFunctor rng_ = RngFunctor(shared_fill_seed_);
+			rng_._rng.SetMinMax(-1, 1);
+			for (std::size_t sample_ = 0; sample_ < num_samples; ++sample_)
+			{
+				const EmuMath::Vector<3, float> axis_(rng_(0.0f), rng_(0.0f), rng_(0.0f) + 2.0f);
+				const float angle_ = rng_(0.0f) * 3.0f;
+
+				// A w element must not contribute to the axis length
+				const EmuMath::Vector<4, float> axis_with_w_(axis_.at<0>(), axis_.at<1>(), axis_.at<2>(), 5.0f);
+				const EmuMath::Matrix<4, 4, float, true> rotation_ = EmuMath::Helpers::matrix_make_rotation_axis_angle(axis_, angle_);
+				check_near_matrix
+				(
+					results,
+					EmuMath::Helpers::matrix_make_rotation_axis_angle(axis_with_w_, angle_),
+					rotation_,
+					tolerance,
+					"Axis-angle rotation ignores axis w"
+				);
+
+				// Rotations preserve length, and leave their axis unchanged
+				const EmuMath::Vector<4, float> axis_point_(axis_.at<0>(), axis_.at<1>(), axis_.at<2>(), 1.0f);
+				results.CheckNearVector(rotation_ * axis_point_, axis_point_, tolerance, "Axis-angle rotation leaves its axis unchanged");
+				const EmuMath::Vector<4, float> point_(rng_(0.0f), rng_(0.0f), rng_(0.0f), 1.0f);
+				const EmuMath::Vector<4, float> rotated_ = rotation_ * point_;
+				results.CheckNear(rotated_.Magnitude<float>(), point_.Magnitude<float>(), tolerance, "Axis-angle rotation preserves length");
+				results.CheckNear(rotated_.at<3>(), 1.0f, tolerance, "Axis-angle rotation preserves w");
+
+				const EmuMath::Matrix<4, 4, float, true> transform_ = EmuMath::Helpers::matrix_make_translation(rng_(0.0f) * 10.0f, rng_(0.0f) * 10.0f, rng_(0.0f) * 10.0f)
+					* rotation_
+					* EmuMath::Helpers::matrix_make_scale(rng_(0.0f) + 2.0f, rng_(0.0f) + 2.0f, rng_(0.0f) + 2.0f);
+				const EmuMath::Matrix<4, 4, float, true> affine_inverse_ = transform_.AffineInverse();
+				check_near_matrix(results, affine_inverse_, transform_.Inverse(), tolerance, "Column-major float AffineInverse (SIMD) matches Inverse");
+				results.Check(affine_inverse_.at(0, 3) == 0.0f && affine_inverse_.at(1, 3) == 0.0f && affine_inverse_.at(2, 3) == 0.0f, "AffineInverse final row is exactly zero");
+				results.Check(affine_inverse_.at(3, 3) == 1.0f, "AffineInverse final w is exactly one");
+
+				const EmuMath::Matrix<4, 4, double, false> transform_rm_ = transform_.Multiply<double, false>(EmuMath::Helpers::matrix_make_translation<double, false>(1.0, 2.0, 3.0));
+				check_near_matrix(results, transform_rm_.AffineInverse(), transform_rm_.Inverse(), tolerance, "Row-major double AffineInverse matches Inverse");
+			}
+		}
+	};
+
+	/// <summary> Checks bulk VectorSoA helpers against the equivalent per-Vector EmuMath::Vector results, using counts which are not a multiple of a SIMD block. </summary>
+	struct vector_soa_behaviour_test : public behaviour_test_base<vector_soa_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "VectorSoA Behaviour";
+
+		static constexpr std::size_t num_vectors = 37;
+
+		void PerformChecks()
+		{
+			RngFunctor rng_ = RngFunctor(shared_fill_seed_);
+			rng_._rng.SetMinMax(-10, 10);
+			_check_type<3, float>(rng_, 1.0e-4f);
+			_check_type<4, double>(rng_, 1.0e-10);
+		}
+
+		template<std::size_t Size_, typename T_>
+		void _check_type(RngFunctor& rng_, T_ tolerance_)
+		{
+			using vector_type = EmuMath::Vector<Size_, T_>;
+			using soa_type = EmuMath::VectorSoA<Size_, T_>;
+
+			std::vector<vector_type> a_(num_vectors);
+			std::vector<vector_type> b_(num_vectors);
+			for (std::size_t i = 0; i < num_vectors; ++i)
+			{
+				for (std::size_t component_ = 0; component_ < Size_; ++component_)
+				{
+					a_[i].at(component_) = rng_(T_());
+					b_[i].at(component_) = rng_(T_());
+				}
+			}
+
+			const soa_type soa_a_(a_.data(), num_vectors);
+			soa_type soa_b_ = soa_type();
+			for (const vector_type& vector_ : b_)
+			{
+				soa_b_.PushBack(vector_);
+			}
+			results.Check(soa_a_.Count() == num_vectors && soa_b_.Count() == num_vectors, "VectorSoA gather and PushBack counts");
+			results.Check(soa_a_.ToVectors() == a_, "VectorSoA gather/ToVectors round trip");
+
+			const vector_type broadcast_ = a_[0];
+			const T_ t_ = T_(0.25);
+			const soa_type added_ = EmuMath::Helpers::vector_add(soa_a_, soa_b_);
+			const soa_type scaled_ = EmuMath::Helpers::vector_multiply(soa_a_, t_);
+			const soa_type subtracted_ = EmuMath::Helpers::vector_subtract(soa_a_, broadcast_);
+			const soa_type min_ = EmuMath::Helpers::vector_min(soa_a_, soa_b_);
+			const soa_type lerped_ = EmuMath::Helpers::vector_lerp(soa_a_, soa_b_, t_);
+			const soa_type normalised_ = EmuMath::Helpers::vector_normalise(soa_a_);
+			const EmuMath::VectorSoA<1, T_> dots_ = EmuMath::Helpers::vector_dot(soa_a_, soa_b_);
+			const EmuMath::VectorSoA<1, T_> magnitudes_ = EmuMath::Helpers::vector_magnitude(soa_a_);
+
+			bool add_matches_ = true, scale_matches_ = true, subtract_matches_ = true, min_matches_ = true, lerp_matches_ = true, normalise_matches_ = true;
+			bool dot_matches_ = true, magnitude_matches_ = true;
+			for (std::size_t i = 0; i < num_vectors; ++i)
+			{
+				add_matches_ = add_matches_ && _near(added_.At(i), a_[i].Add(b_[i]), tolerance_);
+				scale_matches_ = scale_matches_ && _near(scaled_.At(i), a_[i].Multiply(t_), tolerance_);
+				subtract_matches_ = subtract_matches_ && _near(subtracted_.At(i), a_[i].Subtract(broadcast_), tolerance_);
+				min_matches_ = min_matches_ && _near(min_.At(i), a_[i].Min(b_[i]), tolerance_);
+				lerp_matches_ = lerp_matches_ && _near(lerped_.At(i), a_[i].Lerp(b_[i], t_), tolerance_);
+				normalise_matches_ = normalise_matches_ && _near(normalised_.At(i), a_[i].Normalise(), tolerance_);
+				dot_matches_ = dot_matches_ && _near(dots_.At(i).template at<0>(), a_[i].template Dot<T_>(b_[i]), tolerance_);
+				magnitude_matches_ = magnitude_matches_ && _near(magnitudes_.At(i).template at<0>(), a_[i].template Magnitude<T_>(), tolerance_);
+			}
+			results.Check(add_matches_, "VectorSoA vector_add (VectorSoA rhs)");
+			results.Check(scale_matches_, "VectorSoA vector_multiply (scalar rhs)");
+			results.Check(subtract_matches_, "VectorSoA vector_subtract (Vector rhs)");
+			results.Check(min_matches_, "VectorSoA vector_min");
+			results.Check(lerp_matches_, "VectorSoA vector_lerp");
+			results.Check(normalise_matches_, "VectorSoA vector_normalise");
+			results.Check(dot_matches_, "VectorSoA vector_dot");
+			results.Check(magnitude_matches_, "VectorSoA vector_magnitude");
+
+			if constexpr (Size_ == 3)
+			{
+				const soa_type crossed_ = EmuMath::Helpers::vector_cross_3d(soa_a_, soa_b_);
+				bool cross_matches_ = true;
+				for (std::size_t i = 0; i < num_vectors; ++i)
+				{
+					cross_matches_ = cross_matches_ && _near(crossed_.At(i), EmuMath::Helpers::vector_cross_3d<3, T_>(a_[i], b_[i]), tolerance_);
+				}
+				results.Check(cross_matches_, "VectorSoA vector_cross_3d");
+			}
+
+			soa_type in_place_ = soa_a_;
+			EmuMath::Helpers::vector_add(in_place_, in_place_, soa_b_);
+			results.Check(EmuMath::Helpers::vector_cmp_all_near(in_place_, added_), "VectorSoA in-place vector_add");
+		}
+
+		template<typename T_>
+		[[nodiscard]] static bool _near(T_ result_, T_ expected_, T_ tolerance_)
+		{
+			const T_ scaled_tolerance_ = std::abs(expected_) > T_(1) ? tolerance_ * std::abs(expected_) : tolerance_;
+			return std::abs(result_ - expected_) <= scaled_tolerance_;
+		}
+
+		template<std::size_t Size_, typename T_>
+		[[nodiscard]] static bool _near(const EmuMath::Vector<Size_, T_>& result_, const EmuMath::Vector<Size_, T_>& expected_, T_ tolerance_)
+		{
+			for (std::size_t i = 0; i < Size_; ++i)
+			{
+				if (!_near(result_.at(i), expected_.at(i), tolerance_))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+	};
+
+	/// <summary> Checks lazily-evaluated VectorExpressions against the same arithmetic performed eagerly with EmuMath::Vector, for both SIMD and scalar evaluation. </summary>
+	struct vector_expression_behaviour_test : public behaviour_test_base<vector_expression_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "VectorExpression Behaviour";
+
+		static constexpr std::size_t num_samples = 64;
+
+		void PerformChecks()
+		{
+			RngFunctor rng_ = RngFunctor(shared_fill_seed_);
+			rng_._rng.SetMinMax(-10, 10);
+			for (std::size_t sample_ = 0; sample_ < num_samples; ++sample_)
+			{
+				_check_type<8, float>(rng_, 1.0e-4f);
+				_check_type<11, float>(rng_, 1.0e-4f);
+				_check_type<3, float>(rng_, 1.0e-4f);
+				_check_type<4, double>(rng_, 1.0e-10);
+				_check_type<16, float>(rng_, 1.0e-4f);
+				_check_type<37, float>(rng_, 1.0e-4f);
+				_check_type<64, float>(rng_, 1.0e-4f);
+				_check_type<16, double>(rng_, 1.0e-10);
+				_check_mixed_types<16>(rng_);
+				_check_mixed_types<37>(rng_);
+				_check_mixed_types<64>(rng_);
+			}
+		}
+
+		template<std::size_t Size_, typename T_>
+		void _check_type(RngFunctor& rng_, T_ tolerance_)
+		{
+			using vector_type = EmuMath::Vector<Size_, T_>;
+			vector_type a_, b_, c_, d_;
+			for (std::size_t i = 0; i < Size_; ++i)
+			{
+				a_.at(i) = rng_(T_());
+				b_.at(i) = rng_(T_());
+				c_.at(i) = rng_(T_());
+				d_.at(i) = rng_(T_());
+				d_.at(i) = d_.at(i) == T_(0) ? T_(1) : d_.at(i);
+			}
+
+			const vector_type fused_ = EmuMath::lazy(a_) + EmuMath::lazy(b_) * c_ - d_;
+			results.CheckNearVector(fused_, a_.Add(b_.Multiply(c_)).Subtract(d_), tolerance_, "VectorExpression fused multiply-add");
+
+			const vector_type scaled_ = (T_(2) * EmuMath::lazy(a_) - b_) / d_;
+			results.CheckNearVector(scaled_, a_.Multiply(T_(2)).Subtract(b_).Divide(d_), tolerance_, "VectorExpression scalar lhs and division");
+
+			const auto expression_ = EmuMath::lazy(a_) * T_(3) + c_;
+			results.CheckNear(expression_.template at<Size_ - 1>(), (a_.at(Size_ - 1) * T_(3)) + c_.at(Size_ - 1), tolerance_, "VectorExpression single-element access");
+
+			EmuMath::Vector<2, double> narrowed_ = EmuMath::Vector<2, double>();
+			expression_.EvaluateTo(narrowed_);
+			results.Check
+			(
+				std::abs(narrowed_.at<0>() - static_cast<double>(expression_.template at<0>())) <= 1.0e-12 &&
+				std::abs(narrowed_.at<1>() - static_cast<double>(expression_.template at<1>())) <= 1.0e-12,
+				"VectorExpression EvaluateTo a differently-sized Vector"
+			);
+
+			if constexpr (Size_ >= (256 / (sizeof(T_) * CHAR_BIT)))
+			{
+				results.Check(expression_.is_simd_evaluated, "VectorExpression of one full register or more is SIMD-evaluated");
+			}
+		}
+
+		/// <summary> Checks expressions combining Vectors of different value types, which must convert each element rather than reinterpret SIMD loads. </summary>
+		template<std::size_t Size_>
+		void _check_mixed_types(RngFunctor& rng_)
+		{
+			EmuMath::Vector<Size_, float> a_;
+			EmuMath::Vector<Size_, double> b_;
+			EmuMath::Vector<Size_, int> c_;
+			for (std::size_t i = 0; i < Size_; ++i)
+			{
+				a_.at(i) = rng_(float());
+				b_.at(i) = rng_(double());
+				c_.at(i) = rng_(int());
+			}
+
+			const auto float_double_ = EmuMath::lazy(a_) + b_;
+			const auto float_int_double_ = EmuMath::lazy(a_) * c_ - b_;
+			const auto double_float_ = EmuMath::lazy(b_) * a_ + a_;
+			results.Check
+			(
+				!float_double_.is_simd_evaluated && !float_int_double_.is_simd_evaluated && !double_float_.is_simd_evaluated,
+				"VectorExpressions with operands of a different value type are not SIMD-evaluated"
+			);
+
+			// Each operand is converted to the lhs value type before its operation, as in the scalar evaluation path
+			EmuMath::Vector<Size_, float> expected_float_double_;
+			EmuMath::Vector<Size_, float> expected_float_int_double_;
+			EmuMath::Vector<Size_, double> expected_double_float_;
+			for (std::size_t i = 0; i < Size_; ++i)
+			{
+				expected_float_double_.at(i) = a_.at(i) + static_cast<float>(b_.at(i));
+				expected_float_int_double_.at(i) = (a_.at(i) * static_cast<float>(c_.at(i))) - static_cast<float>(b_.at(i));
+				expected_double_float_.at(i) = (b_.at(i) * static_cast<double>(a_.at(i))) + static_cast<double>(a_.at(i));
+			}
+			results.CheckNearVector(float_double_.Evaluate(), expected_float_double_, 1.0e-5f, "VectorExpression float + double operands");
+			results.CheckNearVector(float_int_double_.Evaluate(), expected_float_int_double_, 1.0e-5f, "VectorExpression fused float * int - double operands");
+			results.CheckNearVector(double_float_.Evaluate(), expected_double_float_, 1.0e-12, "VectorExpression fused double * float + float operands");
+		}
+	};
+
+	/// <summary> Checks EmuSIMD::rsqrt against 1 / sqrt for zeros, denormals, infinity and normal inputs. </summary>
+	struct rsqrt_behaviour_test : public behaviour_test_base<rsqrt_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "EmuSIMD::rsqrt Behaviour";
+
+		void PerformChecks()
+		{
+			const float inputs_[16] =
+			{
+				0.0f, -0.0f, std::numeric_limits<float>::denorm_min(), 1.0e-40f,
+				std::numeric_limits<float>::min(), std::numeric_limits<float>::infinity(), 1.0f, 2.0f,
+				0.25f, 3.5f, 1.0e-30f, 1.0e30f,
+				123.456f, 0.001f, 7.0e-20f, 65536.0f
+			};
+			for (std::size_t offset_ = 0; offset_ < 16; offset_ += 4)
+			{
+				float out_[4];
+				_mm_storeu_ps(out_, EmuSIMD::rsqrt(_mm_loadu_ps(inputs_ + offset_)));
+				_check_floats(inputs_ + offset_, out_, 4, "__m128");
+			}
+#if defined(__AVX__)
+			for (std::size_t offset_ = 0; offset_ < 16; offset_ += 8)
+			{
+				float out_[8];
+				_mm256_storeu_ps(out_, EmuSIMD::rsqrt(_mm256_loadu_ps(inputs_ + offset_)));
+				_check_floats(inputs_ + offset_, out_, 8, "__m256");
+			}
+#endif
+
+			const double double_inputs_[4] = { 0.0, std::numeric_limits<double>::denorm_min(), 2.0, 1.0e200 };
+			for (std::size_t offset_ = 0; offset_ < 4; offset_ += 2)
+			{
+				double out_[2];
+				_mm_storeu_pd(out_, EmuSIMD::rsqrt(_mm_loadu_pd(double_inputs_ + offset_)));
+				for (std::size_t j = 0; j < 2; ++j)
+				{
+					const double in_ = double_inputs_[offset_ + j];
+					const double expected_ = 1.0 / std::sqrt(in_);
+					results.Check(out_[j] == expected_, "__m128d rsqrt(" + std::to_string(in_) + ")");
+				}
+			}
+		}
+
+		void _check_floats(const float* in_, const float* out_, std::size_t count_, std::string_view register_name_)
+		{
+			for (std::size_t j = 0; j < count_; ++j)
+			{
+				const double expected_ = 1.0 / std::sqrt(static_cast<double>(in_[j]));
+				const std::string desc_ = std::string(register_name_) + " rsqrt(" + std::to_string(in_[j]) + ")";
+				if (std::isinf(expected_) || expected_ == 0.0)
+				{
+					results.Check(static_cast<double>(out_[j]) == expected_, desc_);
+				}
+				else
+				{
+					results.Check(std::isfinite(out_[j]) && std::abs((static_cast<double>(out_[j]) - expected_) / expected_) <= 1.0e-4, desc_);
+				}
+			}
+		}
+	};
+
+	/// <summary> Checks Vector shuffles, including those lowered to a single SIMD shuffle, against the element each output index should read. </summary>
+	struct vector_shuffle_behaviour_test : public behaviour_test_base<vector_shuffle_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "Vector Shuffle Behaviour";
+
+		void PerformChecks()
+		{
+			RngFunctor rng_ = RngFunctor(shared_fill_seed_);
+			rng_._rng.SetMinMax(-100, 100);
+
+			const EmuMath::Vector<4, float> vec4f_ = _make_vector<4, float>(rng_);
+			_check_shuffle<3, 2, 1, 0>(vec4f_, "Vector<4, float>");
+			_check_shuffle<0, 0, 0, 0>(vec4f_, "Vector<4, float>");
+			_check_shuffle<2, 1>(vec4f_, "Vector<4, float>");
+			_check_shuffle<1, 3, 0>(vec4f_, "Vector<4, float>");
+			_check_shuffle<3>(vec4f_, "Vector<4, float>");
+
+			const EmuMath::Vector<3, float> vec3f_ = _make_vector<3, float>(rng_);
+			_check_shuffle<2, 0, 1>(vec3f_, "Vector<3, float>");
+			_check_shuffle<1, 1, 2, 0>(vec3f_, "Vector<3, float>");
+
+			const EmuMath::Vector<2, double> vec2d_ = _make_vector<2, double>(rng_);
+			_check_shuffle<1, 0>(vec2d_, "Vector<2, double>");
+			_check_shuffle<1, 1>(vec2d_, "Vector<2, double>");
+
+			const EmuMath::Vector<4, std::int32_t> vec4i_ = _make_vector<4, std::int32_t>(rng_);
+			_check_shuffle<0, 3, 3, 1>(vec4i_, "Vector<4, std::int32_t>");
+			_check_shuffle<2, 0, 1>(vec4i_, "Vector<4, std::int32_t>");
+
+			// Larger and converting shuffles stay on the element-wise path, but should agree all the same
+			const EmuMath::Vector<8, float> vec8f_ = _make_vector<8, float>(rng_);
+			_check_shuffle<7, 0, 5, 2>(vec8f_, "Vector<8, float>");
+			const EmuMath::Vector<4, double> converted_ = vec4f_.Shuffle<double, 3, 1, 2, 0>();
+			results.Check
+			(
+				converted_.at<0>() == static_cast<double>(vec4f_.at<3>()) && converted_.at<1>() == static_cast<double>(vec4f_.at<1>()) &&
+				converted_.at<2>() == static_cast<double>(vec4f_.at<2>()) && converted_.at<3>() == static_cast<double>(vec4f_.at<0>()),
+				"Vector<4, float> converting Shuffle<double, 3, 1, 2, 0>"
+			);
+
+			constexpr EmuMath::Vector<4, float> constexpr_shuffled_ = EmuMath::Vector<4, float>(1.0f, 2.0f, 3.0f, 4.0f).ShuffleConstexpr<3, 1, 0>().ShuffleConstexpr<2, 1, 0, 0>();
+			results.Check(constexpr_shuffled_ == EmuMath::Vector<4, float>(1.0f, 2.0f, 4.0f, 4.0f), "constexpr-evaluated Vector ShuffleConstexpr");
+		}
+
+		template<std::size_t Size_, typename T_>
+		static EmuMath::Vector<Size_, T_> _make_vector(RngFunctor& rng_)
+		{
+			EmuMath::Vector<Size_, T_> out_;
+			for (std::size_t i = 0; i < Size_; ++i)
+			{
+				out_.at(i) = rng_(T_());
+			}
+			return out_;
+		}
+
+		template<std::size_t...Indices_, std::size_t Size_, typename T_>
+		void _check_shuffle(const EmuMath::Vector<Size_, T_>& in_, std::string_view vector_name_)
+		{
+			constexpr std::size_t indices_[sizeof...(Indices_)] = { Indices_... };
+			const EmuMath::Vector<sizeof...(Indices_), T_> out_ = in_.template Shuffle<Indices_...>();
+
+			bool all_match_ = true;
+			std::string indices_str_;
+			for (std::size_t i = 0; i < sizeof...(Indices_); ++i)
+			{
+				all_match_ = all_match_ && out_.at(i) == in_.at(indices_[i]);
+				indices_str_ += (i == 0 ? "" : ", ") + std::to_string(indices_[i]);
+			}
+			results.Check(all_match_, std::string(vector_name_) + " Shuffle<" + indices_str_ + ">");
+		}
+	};
+
+	/// <summary> Checks Quaternion multiplication, rotation, conversions and interpolation against double-precision reference results. </summary>
+	struct quaternion_behaviour_test : public behaviour_test_base<quaternion_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "Quaternion Behaviour";
+
+		static constexpr std::size_t num_samples = 64;
+
+		void PerformChecks()
+		{
+			RngFunctor rng_ = RngFunctor(shared_fill_seed_);
+			for (std::size_t sample_ = 0; sample_ < num_samples; ++sample_)
+			{
+				_check_type<float>(rng_, 1.0e-4f);
+				_check_type<double>(rng_, 1.0e-10);
+			}
+
+			const EmuMath::Quaternion<float> quarter_turn_z_ = EmuMath::Quaternion<float>::FromAxisAngle(EmuMath::Vector<3, float>(0.0f, 0.0f, 1.0f), 1.57079632679f);
+			results.CheckNearVector(quarter_turn_z_.RotateVector(EmuMath::Vector<3, float>(1.0f, 0.0f, 0.0f)), EmuMath::Vector<3, float>(0.0f, 1.0f, 0.0f), 1.0e-5f, "FromAxisAngle quarter turn about Z");
+		}
+
+		template<typename T_>
+		void _check_type(RngFunctor& rng_, T_ tolerance_)
+		{
+			using quaternion_type = EmuMath::Quaternion<T_>;
+			const quaternion_type a_ = _make_unit_quaternion<T_>(rng_);
+			const quaternion_type b_ = _make_unit_quaternion<T_>(rng_);
+
+			// Hamilton product in (x, y, z, w) order
+			const double ax_ = a_.X(), ay_ = a_.Y(), az_ = a_.Z(), aw_ = a_.W();
+			const double bx_ = b_.X(), by_ = b_.Y(), bz_ = b_.Z(), bw_ = b_.W();
+			const EmuMath::Vector<4, T_> expected_product_
+			(
+				static_cast<T_>((aw_ * bx_) + (ax_ * bw_) + (ay_ * bz_) - (az_ * by_)),
+				static_cast<T_>((aw_ * by_) - (ax_ * bz_) + (ay_ * bw_) + (az_ * bx_)),
+				static_cast<T_>((aw_ * bz_) + (ax_ * by_) - (ay_ * bx_) + (az_ * bw_)),
+				static_cast<T_>((aw_ * bw_) - (ax_ * bx_) - (ay_ * by_) - (az_ * bz_))
+			);
+			results.CheckNearVector((a_ * b_).AsVector(), expected_product_, tolerance_, "Quaternion Multiply");
+			results.CheckNearVector((a_ * a_.Inverse()).AsVector(), quaternion_type::Identity().AsVector(), tolerance_, "Quaternion * Inverse == Identity");
+
+			// Rotation must agree with q * v * conjugate(q), and with the equivalent rotation Matrix
+			EmuMath::Vector<3, T_> v_;
+			rng_._rng.SetMinMax(-10, 10);
+			v_.template at<0>() = rng_(T_());
+			v_.template at<1>() = rng_(T_());
+			v_.template at<2>() = rng_(T_());
+			const quaternion_type v_quaternion_(v_.template at<0>(), v_.template at<1>(), v_.template at<2>(), T_(0));
+			const quaternion_type sandwiched_ = a_ * v_quaternion_ * a_.Conjugate();
+			const EmuMath::Vector<3, T_> rotated_ = a_.RotateVector(v_);
+			results.CheckNearVector(rotated_, EmuMath::Vector<3, T_>(sandwiched_.X(), sandwiched_.Y(), sandwiched_.Z()), tolerance_ * T_(10), "Quaternion RotateVector vs q * v * q^-1");
+
+			const EmuMath::Vector<4, T_> matrix_rotated_ = a_.ToMatrix() * EmuMath::Vector<4, T_>(v_.template at<0>(), v_.template at<1>(), v_.template at<2>(), T_(0));
+			results.CheckNearVector(rotated_, EmuMath::Vector<3, T_>(matrix_rotated_.template at<0>(), matrix_rotated_.template at<1>(), matrix_rotated_.template at<2>()), tolerance_ * T_(10), "Quaternion RotateVector vs ToMatrix");
+
+			// FromMatrix may return either sign of the same rotation
+			const quaternion_type round_trip_ = quaternion_type::FromMatrix(a_.ToMatrix());
+			const T_ sign_ = round_trip_.Dot(a_) < T_(0) ? T_(-1) : T_(1);
+			results.CheckNearVector(round_trip_.AsVector().Multiply(sign_), a_.AsVector(), tolerance_, "Quaternion ToMatrix/FromMatrix round trip");
+
+			rng_._rng.SetMinMax(-3, 3);
+			const T_ euler_x_ = rng_(T_()), euler_y_ = rng_(T_()), euler_z_ = rng_(T_());
+			check_near_matrix
+			(
+				results,
+				quaternion_type::FromEuler(euler_x_, euler_y_, euler_z_).template ToMatrix<T_, true>(),
+				EmuMath::Helpers::matrix_make_rotation_euler<T_, true>(euler_x_, euler_y_, euler_z_),
+				static_cast<float>(tolerance_ * T_(10)),
+				"Quaternion FromEuler vs matrix_make_rotation_euler"
+			);
+
+			// Slerp hits both endpoints along the shortest path, and halves the angle at t = 0.5
+			const quaternion_type b_near_ = a_.Dot(b_) < T_(0) ? quaternion_type(b_.AsVector().Multiply(T_(-1))) : b_;
+			results.CheckNearVector(a_.Slerp(b_, T_(0)).AsVector(), a_.AsVector(), tolerance_, "Quaternion Slerp t = 0");
+			results.CheckNearVector(a_.Slerp(b_, T_(1)).AsVector(), b_near_.AsVector(), tolerance_, "Quaternion Slerp t = 1");
+			const quaternion_type halfway_ = a_.Slerp(b_, T_(0.5));
+			results.CheckNear(halfway_.Magnitude(), T_(1), tolerance_, "Quaternion Slerp output is normalised");
+			results.CheckNear(halfway_.Dot(a_), halfway_.Dot(b_near_), tolerance_, "Quaternion Slerp t = 0.5 is equidistant");
+			results.CheckNear(a_.Nlerp(b_, T_(0.5)).Magnitude(), T_(1), tolerance_, "Quaternion Nlerp output is normalised");
+		}
+
+		template<typename T_>
+		static EmuMath::Quaternion<T_> _make_unit_quaternion(RngFunctor& rng_)
+		{
+			rng_._rng.SetMinMax(-1, 1);
+			EmuMath::Quaternion<T_> out_;
+			do
+			{
+				out_ = EmuMath::Quaternion<T_>(rng_(T_()), rng_(T_()), rng_(T_()), rng_(T_()));
+			} while (out_.SquareMagnitude() < T_(0.01));
+			return out_.Normalise();
+		}
+	};
+
+	/// <summary> Checks bulk QuaternionSoA helpers against the equivalent per-Quaternion results, using a count which is not a multiple of a SIMD register. </summary>
+	struct quaternion_soa_behaviour_test : public behaviour_test_base<quaternion_soa_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "QuaternionSoA Behaviour";
+
+		static constexpr std::size_t num_quaternions = 37;
+
+		void PerformChecks()
+		{
+			RngFunctor rng_ = RngFunctor(shared_fill_seed_);
+			_check_type<float>(rng_, 1.0e-4f);
+			_check_type<double>(rng_, 1.0e-10);
+		}
+
+		template<typename T_>
+		void _check_type(RngFunctor& rng_, T_ tolerance_)
+		{
+			using quaternion_type = EmuMath::Quaternion<T_>;
+			using soa_type = EmuMath::QuaternionSoA<T_>;
+			using vector_3_type = EmuMath::Vector<3, T_>;
+
+			std::vector<quaternion_type> a_(num_quaternions);
+			std::vector<quaternion_type> b_(num_quaternions);
+			std::vector<EmuMath::Vector<4, T_>> a_vectors_(num_quaternions);
+			std::vector<EmuMath::Vector<4, T_>> b_vectors_(num_quaternions);
+			std::vector<vector_3_type> points_(num_quaternions);
+			EmuMath::VectorSoA<1, T_> weights_(num_quaternions);
+			for (std::size_t i = 0; i < num_quaternions; ++i)
+			{
+				a_[i] = quaternion_behaviour_test::_make_unit_quaternion<T_>(rng_);
+				b_[i] = quaternion_behaviour_test::_make_unit_quaternion<T_>(rng_);
+				a_vectors_[i] = a_[i].AsVector();
+				b_vectors_[i] = b_[i].AsVector();
+
+				rng_._rng.SetMinMax(-10, 10);
+				points_[i] = vector_3_type(rng_(T_()), rng_(T_()), rng_(T_()));
+				rng_._rng.SetMinMax(0, 1);
+				weights_.Set(i, EmuMath::Vector<1, T_>(rng_(T_())));
+			}
+
+			const soa_type soa_a_(a_vectors_.data(), num_quaternions);
+			const soa_type soa_b_(b_vectors_.data(), num_quaternions);
+			const EmuMath::VectorSoA<3, T_> soa_points_(points_.data(), num_quaternions);
+			const T_ t_ = T_(0.3);
+
+			const soa_type multiplied_ = EmuMath::Helpers::quaternion_multiply(soa_a_, soa_b_);
+			const soa_type conjugated_ = EmuMath::Helpers::quaternion_conjugate(soa_a_);
+			const soa_type nlerped_ = EmuMath::Helpers::quaternion_nlerp(soa_a_, soa_b_, t_);
+			const soa_type slerped_ = EmuMath::Helpers::quaternion_slerp(soa_a_, soa_b_, t_);
+			const soa_type weighted_slerped_ = EmuMath::Helpers::quaternion_slerp(soa_a_, soa_b_, weights_);
+			const EmuMath::VectorSoA<3, T_> rotated_ = EmuMath::Helpers::quaternion_rotate_vector(soa_a_, soa_points_);
+
+			results.Check
+			(
+				multiplied_.Count() == num_quaternions && conjugated_.Count() == num_quaternions && nlerped_.Count() == num_quaternions &&
+				slerped_.Count() == num_quaternions && weighted_slerped_.Count() == num_quaternions && rotated_.Count() == num_quaternions,
+				"QuaternionSoA output counts"
+			);
+
+			bool multiply_matches_ = true, conjugate_matches_ = true, nlerp_matches_ = true, slerp_matches_ = true, weighted_slerp_matches_ = true;
+			bool rotate_matches_ = true;
+			for (std::size_t i = 0; i < num_quaternions; ++i)
+			{
+				const T_ weight_ = weights_.At(i).template at<0>();
+				multiply_matches_ = multiply_matches_ && _near(multiplied_.At(i), (a_[i] * b_[i]).AsVector(), tolerance_);
+				conjugate_matches_ = conjugate_matches_ && _near(conjugated_.At(i), a_[i].Conjugate().AsVector(), tolerance_);
+				nlerp_matches_ = nlerp_matches_ && _near(nlerped_.At(i), a_[i].Nlerp(b_[i], t_).AsVector(), tolerance_);
+				slerp_matches_ = slerp_matches_ && _near(slerped_.At(i), a_[i].Slerp(b_[i], t_).AsVector(), tolerance_);
+				weighted_slerp_matches_ = weighted_slerp_matches_ && _near(weighted_slerped_.At(i), a_[i].Slerp(b_[i], weight_).AsVector(), tolerance_);
+				rotate_matches_ = rotate_matches_ && _near(rotated_.At(i), a_[i].RotateVector(points_[i]), tolerance_ * T_(10));
+			}
+			results.Check(multiply_matches_, "QuaternionSoA quaternion_multiply");
+			results.Check(conjugate_matches_, "QuaternionSoA quaternion_conjugate");
+			results.Check(nlerp_matches_, "QuaternionSoA quaternion_nlerp (scalar weighting)");
+			results.Check(slerp_matches_, "QuaternionSoA quaternion_slerp (scalar weighting)");
+			results.Check(weighted_slerp_matches_, "QuaternionSoA quaternion_slerp (VectorSoA weighting)");
+			results.Check(rotate_matches_, "QuaternionSoA quaternion_rotate_vector");
+
+			soa_type in_place_ = soa_a_;
+			EmuMath::Helpers::quaternion_multiply(in_place_, in_place_, soa_b_);
+			results.Check(EmuMath::Helpers::vector_cmp_all_near(in_place_, multiplied_), "QuaternionSoA in-place quaternion_multiply");
+		}
+
+		template<std::size_t Size_, typename T_>
+		[[nodiscard]] static bool _near(const EmuMath::Vector<Size_, T_>& result_, const EmuMath::Vector<Size_, T_>& expected_, T_ tolerance_)
+		{
+			return vector_soa_behaviour_test::_near(result_, expected_, tolerance_);
+		}
+	};
+
+	/// <summary> Summary of comparing the samples of a scalar NoiseTable against those of a FastNoiseTable generated with the same options. </summary>
+	struct noise_comparison_summary
+	{
+		float max_difference = 0.0f;
+		float min_scalar_sample = std::numeric_limits<float>::infinity();
+		float max_scalar_sample = -std::numeric_limits<float>::infinity();
+		float min_fast_sample = std::numeric_limits<float>::infinity();
+		float max_fast_sample = -std::numeric_limits<float>::infinity();
+	};
+
+	/// <summary>
+	/// <para> Shared options for comparing noise generated through different paths with the same settings. </para>
+	/// <para> The start point and step are chosen so that no sample (in any of the first few octaves) lies close to an integer lattice coordinate, where unsmoothed noise is discontinuous. </para>
+	/// </summary>
+	template<std::size_t Dimensions_>
+	[[nodiscard]] inline EmuMath::NoiseTableOptions<Dimensions_, float> make_noise_comparison_options(const EmuMath::Vector<Dimensions_, std::size_t>& resolution_, bool use_fractal_)
+	{
+		using options_type = EmuMath::NoiseTableOptions<Dimensions_, float>;
+		return options_type
+		(
+			resolution_,
+			options_type::template make_correctly_sized_vector<float>(0.13f, 0.13f, 0.13f),
+			options_type::template make_correctly_sized_vector<float>(1.0f / 37.0f, 1.0f / 37.0f, 1.0f / 37.0f),
+			3.0f,
+			true,
+			use_fractal_,
+			EmuMath::Info::NoisePermutationInfo(1024, EmuMath::Info::NoisePermutationShuffleMode::SEED_32, true, 1337, 1337),
+			EmuMath::Info::FractalNoiseInfo<float>(3, 2.0f, 0.5f)
+		);
+	}
+
+	/// <summary> Generates NoiseType_ noise with a scalar NoiseTable and a FastNoiseTable using the same options, and summarises how their unprocessed samples compare. </summary>
+	template<EmuMath::NoiseType NoiseType_, std::size_t Dimensions_>
+	[[nodiscard]] inline noise_comparison_summary compare_scalar_and_fast_noise(const EmuMath::Vector<Dimensions_, std::size_t>& resolution_, bool use_fractal_)
+	{
+		const auto options_ = make_noise_comparison_options<Dimensions_>(resolution_, use_fractal_);
+		EmuMath::NoiseTable<Dimensions_, float> scalar_table_;
+		EmuMath::FastNoiseTable<Dimensions_, 0> fast_table_;
+		scalar_table_.template GenerateNoise<NoiseType_, EmuMath::Functors::noise_sample_processor_default>(options_);
+		fast_table_.template GenerateNoise<NoiseType_, EmuMath::Functors::fast_noise_sample_processor_default>(options_);
+
+		noise_comparison_summary summary_;
+		std::size_t total_samples_ = 1;
+		for (std::size_t i = 0; i < Dimensions_; ++i)
+		{
+			total_samples_ *= resolution_.at(i);
+		}
+
+		EmuMath::Vector<Dimensions_, std::size_t> coords_;
+		for (std::size_t flat_index_ = 0; flat_index_ < total_samples_; ++flat_index_)
+		{
+			std::size_t remaining_index_ = flat_index_;
+			for (std::size_t i = 0; i < Dimensions_; ++i)
+			{
+				coords_.at(i) = remaining_index_ % resolution_.at(i);
+				remaining_index_ /= resolution_.at(i);
+			}
+
+			const float scalar_sample_ = scalar_table_.at(coords_);
+			const float fast_sample_ = fast_table_.at(coords_);
+			const float difference_ = std::abs(scalar_sample_ - fast_sample_);
+			summary_.max_difference = difference_ > summary_.max_difference ? difference_ : summary_.max_difference;
+			summary_.min_scalar_sample = scalar_sample_ < summary_.min_scalar_sample ? scalar_sample_ : summary_.min_scalar_sample;
+			summary_.max_scalar_sample = scalar_sample_ > summary_.max_scalar_sample ? scalar_sample_ : summary_.max_scalar_sample;
+			summary_.min_fast_sample = fast_sample_ < summary_.min_fast_sample ? fast_sample_ : summary_.min_fast_sample;
+			summary_.max_fast_sample = fast_sample_ > summary_.max_fast_sample ? fast_sample_ : summary_.max_fast_sample;
+		}
+		return summary_;
+	}
+
+	/// <summary> Checks that fast (SIMD) noise matches scalar noise for VALUE, VALUE_SMOOTH and PERLIN noise in 1, 2 and 3 dimensions. </summary>
+	struct fast_noise_behaviour_test : public behaviour_test_base<fast_noise_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "Fast Noise Behaviour";
+
+		static constexpr float tolerance = 1.0e-4f;
+
+		void PerformChecks()
+		{
+			_check_noise_type<EmuMath::NoiseType::VALUE>("VALUE");
+			_check_noise_type<EmuMath::NoiseType::VALUE_SMOOTH>("VALUE_SMOOTH");
+			_check_noise_type<EmuMath::NoiseType::PERLIN>("PERLIN");
+		}
+
+		template<EmuMath::NoiseType NoiseType_>
+		void _check_noise_type(std::string_view type_name_)
+		{
+			// Resolutions are not multiples of any register width, so partial batches are also compared
+			for (bool use_fractal_ : { false, true })
+			{
+				const std::string suffix_ = std::string(type_name_) + (use_fractal_ ? " (fractal)" : "");
+				const noise_comparison_summary summary_1d_ = compare_scalar_and_fast_noise<NoiseType_, 1>(EmuMath::NoiseTableOptions<1, float>::make_correctly_sized_vector<std::size_t>(301, 1, 1), use_fractal_);
+				const noise_comparison_summary summary_2d_ = compare_scalar_and_fast_noise<NoiseType_, 2>(EmuMath::Vector<2, std::size_t>(37, 29), use_fractal_);
+				const noise_comparison_summary summary_3d_ = compare_scalar_and_fast_noise<NoiseType_, 3>(EmuMath::Vector<3, std::size_t>(37, 13, 11), use_fractal_);
+				results.Check(summary_1d_.max_difference <= tolerance, "1D scalar vs SIMD " + suffix_ + ", max difference " + std::to_string(summary_1d_.max_difference));
+				results.Check(summary_2d_.max_difference <= tolerance, "2D scalar vs SIMD " + suffix_ + ", max difference " + std::to_string(summary_2d_.max_difference));
+				results.Check(summary_3d_.max_difference <= tolerance, "3D scalar vs SIMD " + suffix_ + ", max difference " + std::to_string(summary_3d_.max_difference));
+			}
+		}
+	};
+
+	/// <summary>
+	/// <para> Checks that SIMPLEX noise matches between scalar and SIMD generation in 1, 2 and 3 dimensions, and that its output stays within -1:1. </para>
+	/// <para> 
+	///		The output scale constants are also checked directly: the largest possible unscaled sum is found by choosing, at every sampled position, 
+	///		the gradient that maximises each corner's contribution, and the scaled maximum must reach - but not exceed - 1.
+	/// </para>
+	/// </summary>
+	struct simplex_noise_behaviour_test : public behaviour_test_base<simplex_noise_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "Simplex Noise Behaviour";
+
+		static constexpr float tolerance = 1.0e-4f;
+		/// <summary> Lowest acceptable worst-case output for a scale constant, so that scales cannot pass by being overly conservative. </summary>
+		static constexpr double min_worst_case = 0.95;
+
+		void PerformChecks()
+		{
+			for (bool use_fractal_ : { false, true })
+			{
+				const std::string suffix_ = use_fractal_ ? " (fractal)" : "";
+				_check_summary(compare_scalar_and_fast_noise<EmuMath::NoiseType::SIMPLEX, 1>(EmuMath::NoiseTableOptions<1, float>::make_correctly_sized_vector<std::size_t>(301, 1, 1), use_fractal_), "1D" + suffix_, !use_fractal_);
+				_check_summary(compare_scalar_and_fast_noise<EmuMath::NoiseType::SIMPLEX, 2>(EmuMath::Vector<2, std::size_t>(37, 29), use_fractal_), "2D" + suffix_, !use_fractal_);
+				_check_summary(compare_scalar_and_fast_noise<EmuMath::NoiseType::SIMPLEX, 3>(EmuMath::Vector<3, std::size_t>(37, 13, 11), use_fractal_), "3D" + suffix_, !use_fractal_);
+			}
+
+			_check_worst_case(_worst_case_1d(), "1D");
+			_check_worst_case(_worst_case_2d(), "2D");
+			_check_worst_case(_worst_case_3d(), "3D");
+		}
+
+		void _check_summary(const noise_comparison_summary& summary_, const std::string& name_, bool check_range_)
+		{
+			results.Check(summary_.max_difference <= tolerance, name_ + " SIMPLEX scalar vs SIMD, max difference " + std::to_string(summary_.max_difference));
+			if (check_range_)
+			{
+				results.Check(summary_.min_scalar_sample >= -1.0f && summary_.max_scalar_sample <= 1.0f, name_ + " scalar SIMPLEX output within -1:1");
+				results.Check(summary_.min_fast_sample >= -1.0f && summary_.max_fast_sample <= 1.0f, name_ + " SIMD SIMPLEX output within -1:1");
+			}
+		}
+
+		void _check_worst_case(double worst_case_, const std::string& name_)
+		{
+			const std::string desc_ = name_ + " SIMPLEX scale keeps output within -1:1 (worst case " + std::to_string(worst_case_) + ")";
+			results.Check(worst_case_ <= 1.0 + 1.0e-4 && worst_case_ >= min_worst_case, desc_);
+		}
+
+		/// <summary> Largest contribution of a corner at the passed offset from the sample, given a free choice of gradient. </summary>
+		template<std::size_t Dimensions_, std::size_t...Indices_>
+		[[nodiscard]] static double _best_contribution(const double(&offset_)[Dimensions_], std::index_sequence<Indices_...>)
+		{
+			using gradients = EmuMath::Functors::_underlying_noise_gen::perlin_gradients<Dimensions_, double>;
+			using simplex_info = EmuMath::Functors::_underlying_noise_gen::simplex_info<Dimensions_, double>;
+			const double distance_squared_ = ((offset_[Indices_] * offset_[Indices_]) + ...);
+			const double falloff_ = EmuMath::Functors::_underlying_noise_gen::simplex_falloff(simplex_info::radius_squared, distance_squared_);
+			double best_dot_ = -std::numeric_limits<double>::infinity();
+			for (std::size_t i = 0; i < gradients::num_gradients; ++i)
+			{
+				const double dot_ = ((gradients::values[i].template at<Indices_>() * offset_[Indices_]) + ...);
+				best_dot_ = dot_ > best_dot_ ? dot_ : best_dot_;
+			}
+			return falloff_ * best_dot_;
+		}
+
+		template<std::size_t Dimensions_>
+		[[nodiscard]] static double _best_contribution(const double(&offset_)[Dimensions_])
+		{
+			return _best_contribution<Dimensions_>(offset_, std::make_index_sequence<Dimensions_>());
+		}
+
+		[[nodiscard]] static double _worst_case_1d()
+		{
+			constexpr std::size_t resolution = 100000;
+			double worst_ = 0.0;
+			for (std::size_t i = 0; i <= resolution; ++i)
+			{
+				const double t_ = static_cast<double>(i) / resolution;
+				const double offset_0_[1] = { t_ };
+				const double offset_1_[1] = { t_ - 1.0 };
+				const double sum_ = _best_contribution(offset_0_) + _best_contribution(offset_1_);
+				worst_ = sum_ > worst_ ? sum_ : worst_;
+			}
+			return worst_ * EmuMath::Functors::_underlying_noise_gen::simplex_info<1, double>::scale;
+		}
+
+		[[nodiscard]] static double _worst_case_2d()
+		{
+			using simplex_info = EmuMath::Functors::_underlying_noise_gen::simplex_info<2, double>;
+			constexpr std::size_t resolution = 600;
+			double worst_ = 0.0;
+			for (std::size_t ix = 0; ix <= resolution; ++ix)
+			{
+				for (std::size_t iy = 0; iy <= resolution; ++iy)
+				{
+					// Cover several cells so that both triangles of a cell are sampled
+					const double x_ = 2.0 * ix / resolution;
+					const double y_ = 2.0 * iy / resolution;
+					const double skew_ = (x_ + y_) * simplex_info::skew;
+					const double cell_x_ = std::floor(x_ + skew_);
+					const double cell_y_ = std::floor(y_ + skew_);
+					const double unskew_ = (cell_x_ + cell_y_) * simplex_info::unskew;
+					const double x_0_ = x_ - (cell_x_ - unskew_);
+					const double y_0_ = y_ - (cell_y_ - unskew_);
+					const double x_1_offset_ = x_0_ > y_0_ ? 1.0 : 0.0;
+					const double y_1_offset_ = 1.0 - x_1_offset_;
+
+					const double offset_0_[2] = { x_0_, y_0_ };
+					const double offset_1_[2] = { x_0_ - x_1_offset_ + simplex_info::unskew, y_0_ - y_1_offset_ + simplex_info::unskew };
+					const double offset_2_[2] = { x_0_ - 1.0 + (2.0 * simplex_info::unskew), y_0_ - 1.0 + (2.0 * simplex_info::unskew) };
+					const double sum_ = _best_contribution(offset_0_) + _best_contribution(offset_1_) + _best_contribution(offset_2_);
+					worst_ = sum_ > worst_ ? sum_ : worst_;
+				}
+			}
+			return worst_ * simplex_info::scale;
+		}
+
+		[[nodiscard]] static double _worst_case_3d()
+		{
+			using simplex_info = EmuMath::Functors::_underlying_noise_gen::simplex_info<3, double>;
+			constexpr std::size_t resolution = 90;
+			double worst_ = 0.0;
+			for (std::size_t ix = 0; ix <= resolution; ++ix)
+			{
+				for (std::size_t iy = 0; iy <= resolution; ++iy)
+				{
+					for (std::size_t iz = 0; iz <= resolution; ++iz)
+					{
+						const double x_ = 1.5 * ix / resolution;
+						const double y_ = 1.5 * iy / resolution;
+						const double z_ = 1.5 * iz / resolution;
+						const double skew_ = (x_ + y_ + z_) * simplex_info::skew;
+						const double cell_x_ = std::floor(x_ + skew_);
+						const double cell_y_ = std::floor(y_ + skew_);
+						const double cell_z_ = std::floor(z_ + skew_);
+						const double unskew_ = (cell_x_ + cell_y_ + cell_z_) * simplex_info::unskew;
+						const double x_0_ = x_ - (cell_x_ - unskew_);
+						const double y_0_ = y_ - (cell_y_ - unskew_);
+						const double z_0_ = z_ - (cell_z_ - unskew_);
+
+						// Second and third corners of the containing tetrahedron, found by ranking the offsets within the cell
+						double offset_1_[3] = { 0.0, 0.0, 0.0 };
+						double offset_2_[3] = { 1.0, 1.0, 1.0 };
+						const double in_cell_[3] = { x_0_, y_0_, z_0_ };
+						const std::size_t largest_ = (x_0_ >= y_0_) ? (x_0_ >= z_0_ ? 0 : 2) : (y_0_ >= z_0_ ? 1 : 2);
+						const std::size_t smallest_ = (x_0_ < y_0_) ? (x_0_ < z_0_ ? 0 : 2) : (y_0_ < z_0_ ? 1 : 2);
+						offset_1_[largest_] = 1.0;
+						offset_2_[smallest_ == largest_ ? (largest_ + 1) % 3 : smallest_] = 0.0;
+						for (std::size_t i = 0; i < 3; ++i)
+						{
+							offset_1_[i] = in_cell_[i] - offset_1_[i] + simplex_info::unskew;
+							offset_2_[i] = in_cell_[i] - offset_2_[i] + (2.0 * simplex_info::unskew);
+						}
+
+						const double offset_0_[3] = { x_0_, y_0_, z_0_ };
+						const double offset_3_[3] = { x_0_ - 1.0 + (3.0 * simplex_info::unskew), y_0_ - 1.0 + (3.0 * simplex_info::unskew), z_0_ - 1.0 + (3.0 * simplex_info::unskew) };
+						const double sum_ = _best_contribution(offset_0_) + _best_contribution(offset_1_) + _best_contribution(offset_2_) + _best_contribution(offset_3_);
+						worst_ = sum_ > worst_ ? sum_ : worst_;
+					}
+				}
+			}
+			return worst_ * simplex_info::scale;
+		}
+	};
+
+	/// <summary>
+	/// <para> Checks that FastNoiseTable tiles are bit-identical to the respective samples of a full generation, for sizes that are not multiples of the tile size. </para>
+	/// <para> Overlapping tiles beyond 2^24 along the major dimension are also compared, as float lane offsets are no longer exact at that range. </para>
+	/// </summary>
+	struct fast_noise_tile_behaviour_test : public behaviour_test_base<fast_noise_tile_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "Fast Noise Tile Behaviour";
+
+		void PerformChecks()
+		{
+			_check_tiles_match_full<2>(EmuMath::Vector<2, std::size_t>(53, 41), EmuMath::Vector<2, std::size_t>(16, 12), "2D");
+			_check_tiles_match_full<3>(EmuMath::Vector<3, std::size_t>(45, 19, 7), EmuMath::Vector<3, std::size_t>(16, 8, 3), "3D");
+
+			// Tiles far along the major dimension, offset from one another by an amount that is not a multiple of any register width
+			using table_2d = EmuMath::FastNoiseTable<2, 0>;
+			const std::size_t far_begin_ = (std::size_t(1) << 24) + 1000;
+			const auto far_options_ = make_noise_comparison_options<2>(EmuMath::Vector<2, std::size_t>(std::size_t(1) << 25, std::size_t(4)), false);
+			table_2d wide_tile_, offset_tile_;
+			const bool wide_generated_ = wide_tile_.GenerateNoiseTile<EmuMath::NoiseType::PERLIN>(far_options_, table_2d::coordinate_type(far_begin_, std::size_t(0)), table_2d::coordinate_type(64, 4));
+			const bool offset_generated_ = offset_tile_.GenerateNoiseTile<EmuMath::NoiseType::PERLIN>(far_options_, table_2d::coordinate_type(far_begin_ + 3, std::size_t(0)), table_2d::coordinate_type(37, 4));
+			bool far_match_ = wide_generated_ && offset_generated_;
+			for (std::size_t y = 0; far_match_ && y < 4; ++y)
+			{
+				for (std::size_t x = 0; far_match_ && x < 37; ++x)
+				{
+					far_match_ = offset_tile_.at(x, y) == wide_tile_.at(x + 3, y);
+				}
+			}
+			results.Check(far_match_, "Overlapping 2D tiles beyond 2^24 are bit-identical");
+		}
+
+		template<std::size_t Dimensions_>
+		void _check_tiles_match_full(const EmuMath::Vector<Dimensions_, std::size_t>& resolution_, const EmuMath::Vector<Dimensions_, std::size_t>& tile_size_, std::string_view name_)
+		{
+			using table_type = EmuMath::FastNoiseTable<Dimensions_, 0>;
+			const auto options_ = make_noise_comparison_options<Dimensions_>(resolution_, true);
+			table_type full_table_;
+			full_table_.template GenerateNoise<EmuMath::NoiseType::PERLIN>(options_);
+
+			bool all_match_ = true;
+			std::size_t num_tiles_ = 0;
+			table_type tile_table_;
+			const bool streamed_ = tile_table_.template StreamNoiseTiles<EmuMath::NoiseType::PERLIN>
+			(
+				options_,
+				tile_size_,
+				[&](const typename table_type::coordinate_type& tile_begin_, const table_type& tile_)
+				{
+					++num_tiles_;
+					const typename table_type::coordinate_type local_size_ = tile_.size();
+					std::size_t total_ = 1;
+					for (std::size_t i = 0; i < Dimensions_; ++i)
+					{
+						total_ *= local_size_.at(i);
+					}
+
+					typename table_type::coordinate_type local_;
+					for (std::size_t flat_ = 0; flat_ < total_; ++flat_)
+					{
+						std::size_t remaining_ = flat_;
+						for (std::size_t i = 0; i < Dimensions_; ++i)
+						{
+							local_.at(i) = remaining_ % local_size_.at(i);
+							remaining_ /= local_size_.at(i);
+						}
+						all_match_ = all_match_ && tile_.at(local_) == full_table_.at(local_.Add(tile_begin_));
+					}
+				}
+			);
+
+			std::size_t expected_tiles_ = 1;
+			for (std::size_t i = 0; i < Dimensions_; ++i)
+			{
+				expected_tiles_ *= (resolution_.at(i) + tile_size_.at(i) - 1) / tile_size_.at(i);
+			}
+			results.Check(streamed_ && num_tiles_ == expected_tiles_, std::string(name_) + " StreamNoiseTiles visits every partial tile");
+			results.Check(all_match_, std::string(name_) + " tiles are bit-identical to full generation");
+		}
+	};
+
+	/// <summary>
+	/// <para> Checks that FastNoiseTable::GenerateNoiseParallel is bit-identical to GenerateNoise in 1, 2 and 3 dimensions, with and without fractal noise. </para>
+	/// <para> Sizes are not multiples of any register width or chunk size, and pools with and without worker threads are both used. </para>
+	/// </summary>
+	struct fast_noise_parallel_behaviour_test : public behaviour_test_base<fast_noise_parallel_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "Fast Noise Parallel Behaviour";
+
+		void PerformChecks()
+		{
+			EmuThreads::DefaultThreadPool no_workers_;
+			EmuThreads::DefaultThreadPool workers_(std::size_t(3));
+			for (bool use_fractal_ : { false, true })
+			{
+				const std::string suffix_ = use_fractal_ ? " (fractal)" : "";
+				_check_noise_type<EmuMath::NoiseType::PERLIN>(no_workers_, use_fractal_, "PERLIN without workers" + suffix_);
+				_check_noise_type<EmuMath::NoiseType::PERLIN>(workers_, use_fractal_, "PERLIN with 3 workers" + suffix_);
+				_check_noise_type<EmuMath::NoiseType::VALUE_SMOOTH>(workers_, use_fractal_, "VALUE_SMOOTH with 3 workers" + suffix_);
+			}
+
+			// 1D chunks are aligned to batches, so a narrower register changes where they may begin
+			results.Check
+			(
+				_parallel_matches_serial<EmuMath::NoiseType::PERLIN, 1, 128>(workers_, EmuMath::Vector<1, std::size_t>(301), false),
+				"1D 128-bit PERLIN with 3 workers"
+			);
+		}
+
+		template<EmuMath::NoiseType NoiseType_>
+		void _check_noise_type(EmuThreads::DefaultThreadPool& pool_, bool use_fractal_, const std::string& name_)
+		{
+			results.Check(_parallel_matches_serial<NoiseType_, 1>(pool_, EmuMath::Vector<1, std::size_t>(301), use_fractal_), "1D " + name_);
+			results.Check(_parallel_matches_serial<NoiseType_, 1>(pool_, EmuMath::Vector<1, std::size_t>(5), use_fractal_), "1D single partial batch " + name_);
+			results.Check(_parallel_matches_serial<NoiseType_, 2>(pool_, EmuMath::Vector<2, std::size_t>(37, 29), use_fractal_), "2D " + name_);
+			results.Check(_parallel_matches_serial<NoiseType_, 3>(pool_, EmuMath::Vector<3, std::size_t>(37, 13, 11), use_fractal_), "3D " + name_);
+		}
+
+		template
+		<
+			EmuMath::NoiseType NoiseType_,
+			std::size_t Dimensions_,
+			std::size_t RegisterWidth_ = EmuMath::FastNoiseTable<Dimensions_, 0>::default_register_width
+		>
+		[[nodiscard]] static bool _parallel_matches_serial
+		(
+			EmuThreads::DefaultThreadPool& pool_,
+			const EmuMath::Vector<Dimensions_, std::size_t>& resolution_,
+			bool use_fractal_
+		)
+		{
+			using table_type = EmuMath::FastNoiseTable<Dimensions_, 0>;
+			using processor_type = EmuMath::Functors::fast_noise_sample_processor_default;
+			const auto options_ = make_noise_comparison_options<Dimensions_>(resolution_, use_fractal_);
+			table_type serial_table_;
+			table_type parallel_table_;
+			const bool serial_generated_ = serial_table_.template GenerateNoise<NoiseType_, processor_type, RegisterWidth_>(options_);
+			const bool parallel_generated_ = parallel_table_.template GenerateNoiseParallel<NoiseType_, processor_type, RegisterWidth_>(options_, pool_);
+			if (!serial_generated_ || !parallel_generated_ || serial_table_.size() != parallel_table_.size())
+			{
+				return false;
+			}
+
+			std::size_t total_samples_ = 1;
+			for (std::size_t i = 0; i < Dimensions_; ++i)
+			{
+				total_samples_ *= resolution_.at(i);
+			}
+
+			typename table_type::coordinate_type coords_;
+			for (std::size_t flat_index_ = 0; flat_index_ < total_samples_; ++flat_index_)
+			{
+				std::size_t remaining_index_ = flat_index_;
+				for (std::size_t i = 0; i < Dimensions_; ++i)
+				{
+					coords_.at(i) = remaining_index_ % resolution_.at(i);
+					remaining_index_ /= resolution_.at(i);
+				}
+
+				if (serial_table_.at(coords_) != parallel_table_.at(coords_))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+	};
+
+	/// <summary>
+	/// <para> Checks that FastNoiseTable::SampleNoise at the coordinates of table cells is bit-identical to the respective samples generated by GenerateNoise. </para>
+	/// <para> Point counts are not a multiple of any register width, so the final partial batch through SampleNoise's scratch storage is also compared. </para>
+	/// </summary>
+	struct fast_noise_sample_behaviour_test : public behaviour_test_base<fast_noise_sample_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "Fast Noise Sample Behaviour";
+
+		/// <summary> Value written after the final output of SampleNoise, which must be left untouched. </summary>
+		static constexpr float sentinel = 12345.0f;
+
+		void PerformChecks()
+		{
+			for (bool use_fractal_ : { false, true })
+			{
+				const std::string suffix_ = use_fractal_ ? " (fractal)" : "";
+				_check_sampled_grid<EmuMath::NoiseType::PERLIN, 1>(EmuMath::Vector<1, std::size_t>(301), use_fractal_, "1D PERLIN" + suffix_);
+				_check_sampled_grid<EmuMath::NoiseType::PERLIN, 2>(EmuMath::Vector<2, std::size_t>(13, 7), use_fractal_, "2D PERLIN" + suffix_);
+				_check_sampled_grid<EmuMath::NoiseType::PERLIN, 3>(EmuMath::Vector<3, std::size_t>(13, 5, 3), use_fractal_, "3D PERLIN" + suffix_);
+				_check_sampled_grid<EmuMath::NoiseType::VALUE_SMOOTH, 3>(EmuMath::Vector<3, std::size_t>(13, 5, 3), use_fractal_, "3D VALUE_SMOOTH" + suffix_);
+			}
+		}
+
+		template<EmuMath::NoiseType NoiseType_, std::size_t Dimensions_>
+		void _check_sampled_grid(const EmuMath::Vector<Dimensions_, std::size_t>& resolution_, bool use_fractal_, const std::string& name_)
+		{
+			using table_type = EmuMath::FastNoiseTable<Dimensions_, 0>;
+			const auto options_ = make_noise_comparison_options<Dimensions_>(resolution_, use_fractal_);
+			table_type table_;
+			table_.template GenerateNoise<NoiseType_>(options_);
+
+			std::size_t total_samples_ = 1;
+			for (std::size_t i = 0; i < Dimensions_; ++i)
+			{
+				total_samples_ *= resolution_.at(i);
+			}
+
+			// Coordinates are formed as GenerateNoise forms them: the major dimension (0) with a fused multiply-add, and other dimensions from their layer index
+			const EmuMath::Vector<Dimensions_, float> start_ = options_.start_point;
+			const EmuMath::Vector<Dimensions_, float> step_ = options_.MakeStep();
+			std::vector<float> coords_[Dimensions_];
+			std::vector<typename table_type::coordinate_type> indices_(total_samples_);
+			for (std::size_t flat_index_ = 0; flat_index_ < total_samples_; ++flat_index_)
+			{
+				std::size_t remaining_index_ = flat_index_;
+				for (std::size_t i = 0; i < Dimensions_; ++i)
+				{
+					const std::size_t index_ = remaining_index_ % resolution_.at(i);
+					remaining_index_ /= resolution_.at(i);
+					indices_[flat_index_].at(i) = index_;
+
+					const float index_float_ = static_cast<float>(index_);
+					coords_[i].push_back(i == 0 ? std::fma(step_.at(i), index_float_, start_.at(i)) : start_.at(i) + (step_.at(i) * index_float_));
+				}
+			}
+
+			std::vector<float> sampled_(total_samples_ + 1, sentinel);
+			if constexpr (Dimensions_ == 1)
+			{
+				table_type::template SampleNoise<NoiseType_>(coords_[0].data(), sampled_.data(), total_samples_, options_);
+			}
+			else if constexpr (Dimensions_ == 2)
+			{
+				table_type::template SampleNoise<NoiseType_>(coords_[0].data(), coords_[1].data(), sampled_.data(), total_samples_, options_);
+			}
+			else
+			{
+				table_type::template SampleNoise<NoiseType_>(coords_[0].data(), coords_[1].data(), coords_[2].data(), sampled_.data(), total_samples_, options_);
+			}
+
+			bool all_match_ = true;
+			for (std::size_t flat_index_ = 0; flat_index_ < total_samples_; ++flat_index_)
+			{
+				all_match_ = all_match_ && sampled_[flat_index_] == table_.at(indices_[flat_index_]);
+			}
+			results.Check(all_match_, name_ + " SampleNoise at table cells is bit-identical to GenerateNoise");
+			results.Check(sampled_[total_samples_] == sentinel, name_ + " SampleNoise does not write beyond the final point");
+		}
+	};
+
+	/// <summary>
+	/// <para> Checks that NoiseChunkCache samples are bit-identical to a single table generated over the same world region, including negative coordinates and chunk seams. </para>
+	/// <para> Also checks hit and miss counts, least-recently used eviction under the memory budget, and that parallel Prefetch generates the same chunks as serial Prefetch. </para>
+	/// </summary>
+	struct noise_chunk_cache_behaviour_test : public behaviour_test_base<noise_chunk_cache_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "Noise Chunk Cache Behaviour";
+
+		using cache_type = EmuMath::NoiseChunkCache<2, EmuMath::NoiseType::PERLIN>;
+		using table_type = cache_type::chunk_table_type;
+		using world_coords = cache_type::world_coordinate_type;
+		using chunk_coords = cache_type::chunk_coordinate_type;
+
+		/// <summary> Chunk size in each dimension, neither of which is a multiple of any register width. </summary>
+		static inline const cache_type::local_coordinate_type chunk_size = cache_type::local_coordinate_type(13, 11);
+		/// <summary> Inclusive world region spanning several chunks either side of the world origin. </summary>
+		static inline const world_coords region_min = world_coords(-40, -25);
+		static inline const world_coords region_max = world_coords(39, 24);
+
+		void PerformChecks()
+		{
+			const auto world_options_ = make_noise_comparison_options<2>(EmuMath::Vector<2, std::size_t>(1, 1), true);
+			_check_regions(world_options_);
+			_check_samples(world_options_);
+			_check_hits_and_misses(world_options_);
+			_check_eviction(world_options_);
+			_check_parallel_prefetch(world_options_);
+		}
+
+		void _check_regions(const cache_type::options_type& world_options_)
+		{
+			// A region at the world origin matches a full generation, and overlapping regions at negative indices agree wherever they meet
+			auto full_options_ = world_options_;
+			full_options_.table_resolution = table_type::coordinate_type(37, 29);
+			table_type full_, origin_region_, wide_region_, offset_region_;
+			full_.GenerateNoise<EmuMath::NoiseType::PERLIN>(full_options_);
+			const bool origin_generated_ = origin_region_.GenerateNoiseRegion<EmuMath::NoiseType::PERLIN>(world_options_, world_coords(0, 0), table_type::coordinate_type(37, 29));
+			const bool wide_generated_ = wide_region_.GenerateNoiseRegion<EmuMath::NoiseType::PERLIN>(world_options_, world_coords(-30, -20), table_type::coordinate_type(40, 30));
+			const bool offset_generated_ = offset_region_.GenerateNoiseRegion<EmuMath::NoiseType::PERLIN>(world_options_, world_coords(-27, -13), table_type::coordinate_type(19, 7));
+
+			bool origin_matches_ = origin_generated_;
+			for (std::size_t y = 0; origin_matches_ && y < 29; ++y)
+			{
+				for (std::size_t x = 0; origin_matches_ && x < 37; ++x)
+				{
+					origin_matches_ = origin_region_.at(x, y) == full_.at(x, y);
+				}
+			}
+			results.Check(origin_matches_, "GenerateNoiseRegion at the origin is bit-identical to GenerateNoise");
+
+			bool offset_matches_ = wide_generated_ && offset_generated_;
+			for (std::size_t y = 0; offset_matches_ && y < 7; ++y)
+			{
+				for (std::size_t x = 0; offset_matches_ && x < 19; ++x)
+				{
+					offset_matches_ = offset_region_.at(x, y) == wide_region_.at(x + 3, y + 7);
+				}
+			}
+			results.Check(offset_matches_, "Overlapping GenerateNoiseRegion regions at negative indices are bit-identical");
+
+			table_type out_of_range_;
+			results.Check
+			(
+				!out_of_range_.GenerateNoiseRegion<EmuMath::NoiseType::PERLIN>(world_options_, world_coords(std::int64_t(0), std::int64_t(std::numeric_limits<std::int32_t>::max())), table_type::coordinate_type(4, 4)),
+				"GenerateNoiseRegion rejects major-dimension indices beyond 32 bits"
+			);
+		}
+
+		void _check_samples(const cache_type::options_type& world_options_)
+		{
+			table_type reference_;
+			const table_type::coordinate_type region_size_(std::size_t(region_max[0] - region_min[0] + 1), std::size_t(region_max[1] - region_min[1] + 1));
+			reference_.GenerateNoiseRegion<EmuMath::NoiseType::PERLIN>(world_options_, region_min, region_size_);
+
+			cache_type cache_(world_options_, chunk_size, std::numeric_limits<std::size_t>::max());
+			bool all_match_ = true;
+			for (std::int64_t y = region_min[1]; y <= region_max[1]; ++y)
+			{
+				for (std::int64_t x = region_min[0]; x <= region_max[0]; ++x)
+				{
+					all_match_ = all_match_ && cache_.at(x, y) == reference_.at(std::size_t(x - region_min[0]), std::size_t(y - region_min[1]));
+				}
+			}
+			results.Check(all_match_, "NoiseChunkCache at() across negative coordinates and chunk seams is bit-identical to a single table");
+		}
+
+		void _check_hits_and_misses(const cache_type::options_type& world_options_)
+		{
+			cache_type cache_(world_options_, chunk_size, std::numeric_limits<std::size_t>::max());
+			(void)cache_.at(0, 0);
+			const bool first_miss_ = cache_.hits() == 0 && cache_.misses() == 1;
+			(void)cache_.at(12, 10);
+			const bool same_chunk_hit_ = cache_.hits() == 1 && cache_.misses() == 1;
+			(void)cache_.at(-1, 0);
+			const bool neighbour_miss_ = cache_.hits() == 1 && cache_.misses() == 2 && cache_.Contains(chunk_coords(-1, 0));
+			(void)cache_.at(5, 5);
+			const bool revisit_hit_ = cache_.hits() == 2 && cache_.misses() == 2;
+			results.Check(first_miss_, "NoiseChunkCache counts a miss for a new chunk");
+			results.Check(same_chunk_hit_, "NoiseChunkCache counts a hit for the most recent chunk");
+			results.Check(neighbour_miss_, "NoiseChunkCache counts a miss for a neighbouring chunk at negative coordinates");
+			results.Check(revisit_hit_, "NoiseChunkCache counts a hit for a previously generated chunk");
+
+			// Prefetched chunks count as misses, and later samples within them as hits
+			cache_.Prefetch(world_coords(0, 0), world_coords(25, 15));
+			const std::size_t misses_after_prefetch_ = cache_.misses();
+			(void)cache_.at(14, 3);
+			(void)cache_.at(25, 15);
+			results.Check(misses_after_prefetch_ == 5 && cache_.misses() == 5 && cache_.hits() == 4, "NoiseChunkCache counts prefetched chunks as misses and later samples as hits");
+		}
+
+		void _check_eviction(const cache_type::options_type& world_options_)
+		{
+			cache_type sizing_cache_(world_options_, chunk_size, 0);
+			const std::size_t chunk_bytes_ = sizing_cache_.chunk_size_bytes();
+			results.Check(sizing_cache_.max_size() == 1, "NoiseChunkCache always keeps at least 1 chunk");
+
+			cache_type cache_(world_options_, chunk_size, (chunk_bytes_ * 3) + (chunk_bytes_ - 1));
+			results.Check(cache_.max_size() == 3, "NoiseChunkCache max_size is the number of whole chunks within its budget");
+
+			const chunk_coords a_(0, 0), b_(1, 0), c_(-1, -1), d_(2, 0);
+			(void)cache_.GetChunk(a_);
+			(void)cache_.GetChunk(b_);
+			(void)cache_.GetChunk(c_);
+			(void)cache_.GetChunk(a_);
+			(void)cache_.GetChunk(d_);
+			results.Check
+			(
+				cache_.size() == 3 && !cache_.Contains(b_) && cache_.Contains(a_) && cache_.Contains(c_) && cache_.Contains(d_),
+				"NoiseChunkCache evicts the least-recently used chunk when over budget"
+			);
+
+			// Chunks generated from reused storage must still be correct
+			table_type reference_;
+			reference_.GenerateNoiseRegion<EmuMath::NoiseType::PERLIN>(world_options_, world_coords(26, 0), chunk_size);
+			const table_type& d_table_ = cache_.GetChunk(d_);
+			bool reused_matches_ = true;
+			for (std::size_t y = 0; reused_matches_ && y < chunk_size[1]; ++y)
+			{
+				for (std::size_t x = 0; reused_matches_ && x < chunk_size[0]; ++x)
+				{
+					reused_matches_ = d_table_.at(x, y) == reference_.at(x, y);
+				}
+			}
+			results.Check(reused_matches_, "NoiseChunkCache chunks generated into evicted storage are correct");
+
+			cache_.SetMemoryBudget(chunk_bytes_);
+			results.Check(cache_.size() == 1 && cache_.Contains(d_), "NoiseChunkCache SetMemoryBudget keeps only the most recently used chunks");
+		}
+
+		void _check_parallel_prefetch(const cache_type::options_type& world_options_)
+		{
+			EmuThreads::DefaultThreadPool pool_(std::size_t(3));
+			cache_type serial_(world_options_, chunk_size, std::numeric_limits<std::size_t>::max());
+			cache_type parallel_(world_options_, chunk_size, std::numeric_limits<std::size_t>::max());
+			serial_.Prefetch(region_min, region_max);
+			parallel_.Prefetch(region_min, region_max, pool_);
+			// The region spans chunks -4 to 3 in X and -3 to 2 in Y
+			constexpr std::size_t num_region_chunks_ = 8 * 6;
+			results.Check
+			(
+				serial_.size() == num_region_chunks_ && parallel_.size() == num_region_chunks_ && parallel_.misses() == num_region_chunks_,
+				"NoiseChunkCache parallel Prefetch generates every chunk of the region"
+			);
+
+			bool all_match_ = true;
+			for (std::int64_t y = region_min[1]; y <= region_max[1]; ++y)
+			{
+				for (std::int64_t x = region_min[0]; x <= region_max[0]; ++x)
+				{
+					all_match_ = all_match_ && parallel_.at(x, y) == serial_.at(x, y);
+				}
+			}
+			results.Check(all_match_, "NoiseChunkCache parallel Prefetch is bit-identical to serial Prefetch");
+			results.Check(serial_.misses() == num_region_chunks_ && parallel_.misses() == num_region_chunks_, "NoiseChunkCache samples after Prefetch do not generate further chunks");
+
+			// A budget smaller than the region only keeps the last chunks of it, in both cases
+			cache_type small_serial_(world_options_, chunk_size, serial_.chunk_size_bytes() * 4);
+			cache_type small_parallel_(world_options_, chunk_size, serial_.chunk_size_bytes() * 4);
+			small_serial_.Prefetch(region_min, region_max);
+			small_parallel_.Prefetch(region_min, region_max, pool_);
+			const chunk_coords last_chunk_(3, 2);
+			results.Check
+			(
+				small_serial_.size() == 4 && small_parallel_.size() == 4 && small_serial_.Contains(last_chunk_) && small_parallel_.Contains(last_chunk_),
+				"NoiseChunkCache Prefetch beyond the budget keeps the last chunks of the region"
+			);
+		}
+	};
+
+	/// <summary>
+	/// <para> Checks the analytic derivatives of PERLIN and SIMPLEX noise against central finite differences of sampled noise. </para>
+	/// <para> 
+	///		Derivatives are only provided for 3D noise, which is checked through scalar generators (with and without fractal wrapping), 
+	///		and through FastNoiseTable::GenerateNoiseWithGradients by differencing neighbouring samples of a finely stepped table.
+	/// </para>
+	/// </summary>
+	struct noise_derivative_behaviour_test : public behaviour_test_base<noise_derivative_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "Noise Derivative Behaviour";
+
+		static constexpr std::size_t num_scalar_points = 256;
+		static constexpr double scalar_step = 1.0e-6;
+		static constexpr double scalar_tolerance = 1.0e-5;
+		static constexpr float table_step = 1.0f / 1024.0f;
+		static constexpr float table_tolerance = 5.0e-3f;
+
+		void PerformChecks()
+		{
+			_check_noise_type<EmuMath::NoiseType::PERLIN>("PERLIN");
+			_check_noise_type<EmuMath::NoiseType::SIMPLEX>("SIMPLEX");
+		}
+
+		template<EmuMath::NoiseType NoiseType_>
+		void _check_noise_type(std::string_view type_name_)
+		{
+			using generator_type = EmuMath::Functors::make_noise_3d<NoiseType_, double>;
+			const EmuMath::NoisePermutations permutations_ = _make_permutation_info().MakePermutations();
+			EmuMath::Functors::no_fractal_noise_wrapper<generator_type, double> single_(3.0, permutations_);
+			EmuMath::Functors::fractal_noise_wrapper<generator_type, double> fractal_(3.0f, permutations_, EmuMath::Info::FractalNoiseInfo<double>(3, 2.0, 0.5));
+			_check_scalar(single_, std::string(type_name_) + " scalar");
+			_check_scalar(fractal_, std::string(type_name_) + " scalar (fractal)");
+
+			for (bool use_fractal_ : { false, true })
+			{
+				const std::string suffix_ = std::string(type_name_) + (use_fractal_ ? " (fractal)" : "");
+				_check_table<NoiseType_>(0.13f, use_fractal_, suffix_ + " FastNoiseTable near origin");
+				_check_table<NoiseType_>(0.61f, use_fractal_, suffix_ + " FastNoiseTable offset");
+			}
+		}
+
+		template<class Wrapper_>
+		void _check_scalar(Wrapper_& wrapper_, const std::string& name_)
+		{
+			RngFunctor rng_ = RngFunctor(shared_fill_seed_);
+			rng_._rng.SetMinMax(-10.0, 10.0);
+
+			double max_error_ = 0.0;
+			double max_sample_difference_ = 0.0;
+			for (std::size_t p = 0; p < num_scalar_points; ++p)
+			{
+				EmuMath::Vector<3, double> point_;
+				point_.at(0) = rng_(double());
+				point_.at(1) = rng_(double());
+				point_.at(2) = rng_(double());
+
+				const EmuMath::Vector<4, double> analytic_ = wrapper_.SampleWithDerivatives(point_);
+				max_sample_difference_ = std::max(max_sample_difference_, std::abs(analytic_.at(0) - wrapper_(point_)));
+				for (std::size_t axis_ = 0; axis_ < 3; ++axis_)
+				{
+					EmuMath::Vector<3, double> forward_ = point_;
+					EmuMath::Vector<3, double> backward_ = point_;
+					forward_.at(axis_) += scalar_step;
+					backward_.at(axis_) -= scalar_step;
+					const double numeric_ = (wrapper_(forward_) - wrapper_(backward_)) / (2.0 * scalar_step);
+					const double error_ = std::abs(analytic_.at(axis_ + 1) - numeric_) / std::max(1.0, std::abs(numeric_));
+					max_error_ = std::max(max_error_, error_);
+				}
+			}
+			results.Check(max_sample_difference_ <= 1.0e-12, name_ + " SampleWithDerivatives sample matches operator()");
+			results.Check(max_error_ <= scalar_tolerance, name_ + " derivatives match finite differences, max error " + std::to_string(max_error_));
+		}
+
+		template<EmuMath::NoiseType NoiseType_>
+		void _check_table(float start_, bool use_fractal_, const std::string& name_)
+		{
+			using table_type = EmuMath::FastNoiseTable<3, 0>;
+			using options_type = EmuMath::NoiseTableOptions<3, float>;
+			const options_type options_
+			(
+				EmuMath::Vector<3, std::size_t>(37, 13, 11),
+				EmuMath::Vector<3, float>(start_, start_ + 0.07f, start_ + 0.19f),
+				EmuMath::Vector<3, float>(table_step, table_step, table_step),
+				3.0f,
+				true,
+				use_fractal_,
+				_make_permutation_info(),
+				EmuMath::Info::FractalNoiseInfo<float>(3, 2.0f, 0.5f)
+			);
+			table_type table_;
+			const bool generated_ = table_.template GenerateNoiseWithGradients<NoiseType_>(options_);
+			results.Check(generated_ && table_.has_gradients(), name_ + " generated with gradients");
+			if (!generated_)
+			{
+				return;
+			}
+
+			// Only interior samples have a neighbour on both sides along every axis
+			float max_error_ = 0.0f;
+			const table_type::coordinate_type size_ = table_.size();
+			for (std::size_t z = 1; z < (size_.at<2>() - 1); ++z)
+			{
+				for (std::size_t y = 1; y < (size_.at<1>() - 1); ++y)
+				{
+					for (std::size_t x = 1; x < (size_.at<0>() - 1); ++x)
+					{
+						const EmuMath::Vector<3, float> analytic_ = table_.gradient_at(x, y, z);
+						const float numeric_[3] =
+						{
+							(table_.at(x + 1, y, z) - table_.at(x - 1, y, z)) / (2.0f * table_step),
+							(table_.at(x, y + 1, z) - table_.at(x, y - 1, z)) / (2.0f * table_step),
+							(table_.at(x, y, z + 1) - table_.at(x, y, z - 1)) / (2.0f * table_step)
+						};
+						for (std::size_t axis_ = 0; axis_ < 3; ++axis_)
+						{
+							const float error_ = std::abs(analytic_.at(axis_) - numeric_[axis_]) / std::max(1.0f, std::abs(numeric_[axis_]));
+							max_error_ = std::max(max_error_, error_);
+						}
+					}
+				}
+			}
+			results.Check(max_error_ <= table_tolerance, name_ + " gradients match finite differences, max error " + std::to_string(max_error_));
+		}
+
+		[[nodiscard]] static EmuMath::Info::NoisePermutationInfo _make_permutation_info()
+		{
+			return EmuMath::Info::NoisePermutationInfo(1024, EmuMath::Info::NoisePermutationShuffleMode::SEED_32, true, 1337, 1337);
+		}
+	};
+
+	/// <summary>
+	/// <para> Checks that ParallelFor::ExecuteAndWait executes every index exactly once for each schedule, and that exceptions are only rethrown once every queued chunk has completed. </para>
+	/// <para> Throwing from the final chunk is checked separately, as that chunk is executed by the calling thread while the rest are still queued. </para>
+	/// </summary>
+	struct parallel_for_range_behaviour_test : public behaviour_test_base<parallel_for_range_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "ParallelFor Range Behaviour";
+
+		static constexpr std::size_t num_indices = 10007;
+		static constexpr std::size_t grain_size = 100;
+		using func_type = std::function<void(std::size_t)>;
+		using parallel_for_type = EmuThreads::ParallelFor<func_type, EmuThreads::DefaultThreadPool>;
+
+		parallel_for_range_behaviour_test() : counts(num_indices)
+		{
+		}
+		void PerformChecks()
+		{
+			parallel_for_type parallel_for_(func_type(), std::size_t(4));
+			_check_schedule(parallel_for_, EmuThreads::ParallelForSchedule::STATIC, 0, "STATIC");
+			_check_schedule(parallel_for_, EmuThreads::ParallelForSchedule::STATIC, grain_size, "STATIC (grain)");
+			_check_schedule(parallel_for_, EmuThreads::ParallelForSchedule::GUIDED, grain_size, "GUIDED");
+			_check_schedule(parallel_for_, EmuThreads::ParallelForSchedule::AUTO, 0, "AUTO");
+
+			// STATIC chunks with a grain size are allocated in order, so the final index is in the final chunk, which the calling thread executes
+			_check_throwing_index(parallel_for_, num_indices - 1, "final (inline) chunk");
+			_check_throwing_index(parallel_for_, 0, "first (queued) chunk");
+
+			parallel_for_type no_threads_(func_type(), std::size_t(0));
+			_check_schedule(no_threads_, EmuThreads::ParallelForSchedule::STATIC, grain_size, "STATIC with no threads");
+			_check_throwing_index(no_threads_, num_indices / 2, "chunk with no threads");
+		}
+
+		void _reset_counts()
+		{
+			for (auto& count_ : counts)
+			{
+				count_.store(0, std::memory_order_relaxed);
+			}
+		}
+
+		void _check_schedule(parallel_for_type& parallel_for_, EmuThreads::ParallelForSchedule schedule_, std::size_t grain_size_, std::string_view name_)
+		{
+			_reset_counts();
+			parallel_for_.func_unsynced = [this](std::size_t index_) { counts[index_].fetch_add(1, std::memory_order_relaxed); };
+			parallel_for_.ExecuteAndWait(std::size_t(0), num_indices, schedule_, grain_size_);
+
+			bool all_once_ = true;
+			for (const auto& count_ : counts)
+			{
+				all_once_ = all_once_ && count_.load(std::memory_order_relaxed) == 1;
+			}
+			results.Check(all_once_, std::string(name_) + " executes every index exactly once");
+		}
+
+		void _check_throwing_index(parallel_for_type& parallel_for_, std::size_t throwing_index_, std::string_view name_)
+		{
+			_reset_counts();
+			parallel_for_.func_unsynced = [this, throwing_index_](std::size_t index_)
+			{
+				if (index_ == throwing_index_)
+				{
+					throw std::runtime_error("parallel_for_range_behaviour_test");
+				}
+				counts[index_].fetch_add(1, std::memory_order_relaxed);
+			};
+
+			bool thrown_ = false;
+			try
+			{
+				parallel_for_.ExecuteAndWait(std::size_t(0), num_indices, EmuThreads::ParallelForSchedule::STATIC, grain_size);
+			}
+			catch (const std::runtime_error&)
+			{
+				thrown_ = true;
+			}
+			results.Check(thrown_, std::string(name_) + " exception is rethrown");
+
+			// Every other chunk must already have finished, as ExecuteAndWait may not rethrow while chunks are still queued
+			const bool serial_ = parallel_for_.ViewThreadPool().NumThreads() == 0;
+			const std::size_t throwing_chunk_ = throwing_index_ / grain_size;
+			bool others_complete_ = true;
+			for (std::size_t index_ = 0; index_ < num_indices; ++index_)
+			{
+				const std::size_t chunk_ = index_ / grain_size;
+				const bool expected_ = serial_ ? chunk_ < throwing_chunk_ : chunk_ != throwing_chunk_;
+				if (expected_)
+				{
+					others_complete_ = others_complete_ && counts[index_].load(std::memory_order_relaxed) == 1;
+				}
+			}
+			results.Check(others_complete_, std::string(name_) + " every other allocated chunk completes before rethrowing");
+		}
+
+		std::vector<std::atomic<int>> counts;
+	};
+
+	/// <summary>
+	/// <para> Stress tests the work_stealing_work_allocator, with tasks on worker threads pushing to and popping from their own deques while other workers steal from them. </para>
+	/// <para> Checks that no task is lost or executed twice, and that destroying a pool with queued tasks discards them as documented: never executed, with broken promises. </para>
+	/// </summary>
+	struct work_stealing_behaviour_test : public behaviour_test_base<work_stealing_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "Work Stealing Behaviour";
+
+		using pool_type = EmuThreads::WorkStealingThreadPool;
+		static constexpr std::size_t num_threads = 4;
+		static constexpr std::size_t num_rounds = 20;
+		static constexpr std::size_t num_roots = 64;
+		// More than a deque's initial capacity, so that owners grow their deques while thieves are stealing from them
+		static constexpr std::size_t num_children_per_root = 600;
+		static constexpr std::size_t num_tasks = num_roots + (num_roots * num_children_per_root);
+
+		static_assert
+		(
+			num_children_per_root > EmuThreads::Functors::work_stealing_work_allocator::initial_deque_capacity,
+			"work_stealing_behaviour_test must push more tasks to a single deque than its initial capacity."
+		);
+
+		work_stealing_behaviour_test() : counts(num_tasks)
+		{
+		}
+		void PerformChecks()
+		{
+			_check_no_task_lost_or_repeated();
+			_check_shutdown_discards_queued_tasks();
+		}
+
+		void _check_no_task_lost_or_repeated()
+		{
+			pool_type pool_(num_threads);
+			bool all_once_ = true;
+			for (std::size_t round_ = 0; round_ < num_rounds; ++round_)
+			{
+				_reset_counts();
+				for (std::size_t root_ = 0; root_ < num_roots; ++root_)
+				{
+					pool_.SubmitTask([this, &pool_, root_]() { _run_root(pool_, root_, 0.0); });
+				}
+				pool_.ViewWorkAllocator().WaitForAllTasksToCompleteNoJoin();
+
+				for (const auto& count_ : counts)
+				{
+					all_once_ = all_once_ && count_.load(std::memory_order_relaxed) == 1;
+				}
+			}
+			results.Check(all_once_, "Every task executes exactly once while owners push and pop against thieves");
+		}
+
+		void _check_shutdown_discards_queued_tasks()
+		{
+			_reset_counts();
+			std::vector<std::future<void>> root_futures_;
+			root_futures_.reserve(num_roots);
+			{
+				pool_type pool_(num_threads);
+				for (std::size_t root_ = 0; root_ < num_roots; ++root_)
+				{
+					root_futures_.emplace_back(pool_.AllocateTask([this, &pool_, root_]() { _run_root(pool_, root_, 5.0); }));
+				}
+
+				// Give some roots time to fill their workers' deques, so that both the shared queue and the deques hold tasks on destruction
+				std::this_thread::sleep_for(std::chrono::milliseconds(5));
+			}
+
+			std::vector<int> counts_after_destruction_(num_tasks);
+			for (std::size_t i = 0; i < num_tasks; ++i)
+			{
+				counts_after_destruction_[i] = counts[i].load(std::memory_order_relaxed);
+			}
+
+			bool roots_consistent_ = true;
+			std::size_t num_discarded_roots_ = 0;
+			for (std::size_t root_ = 0; root_ < num_roots; ++root_)
+			{
+				bool executed_ = false;
+				try
+				{
+					root_futures_[root_].get();
+					executed_ = true;
+				}
+				catch (const std::future_error& error_)
+				{
+					roots_consistent_ = roots_consistent_ && error_.code() == std::future_errc::broken_promise;
+					++num_discarded_roots_;
+				}
+
+				roots_consistent_ = roots_consistent_ && counts_after_destruction_[root_] == (executed_ ? 1 : 0);
+				if (!executed_)
+				{
+					const std::size_t first_child_ = num_roots + (root_ * num_children_per_root);
+					for (std::size_t child_ = first_child_; child_ < (first_child_ + num_children_per_root); ++child_)
+					{
+						roots_consistent_ = roots_consistent_ && counts_after_destruction_[child_] == 0;
+					}
+				}
+			}
+
+			bool none_repeated_ = true;
+			std::size_t num_executed_ = 0;
+			for (const int count_ : counts_after_destruction_)
+			{
+				none_repeated_ = none_repeated_ && (count_ == 0 || count_ == 1);
+				num_executed_ += static_cast<std::size_t>(count_);
+			}
+
+			// Nothing may execute once the pool is destroyed
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			bool none_after_destruction_ = true;
+			for (std::size_t i = 0; i < num_tasks; ++i)
+			{
+				none_after_destruction_ = none_after_destruction_ && counts[i].load(std::memory_order_relaxed) == counts_after_destruction_[i];
+			}
+
+			results.Check(roots_consistent_, "Destroyed pool executes each queued task fully or discards it with a broken promise");
+			results.Check(none_repeated_, "Destroyed pool executes no task more than once");
+			results.Check(num_discarded_roots_ != 0 && num_executed_ < num_tasks, "Destroyed pool discards tasks still queued on destruction");
+			results.Check(none_after_destruction_, "No task executes after the pool is destroyed");
+		}
+
+		/// <summary> Counts the passed root, then allocates its children from within the pool so that they are pushed to the executing worker's deque. </summary>
+		void _run_root(pool_type& pool_, std::size_t root_, double child_work_us_)
+		{
+			counts[root_].fetch_add(1, std::memory_order_relaxed);
+			const std::size_t first_child_ = num_roots + (root_ * num_children_per_root);
+			for (std::size_t i = 0; i < num_children_per_root; ++i)
+			{
+				const std::size_t child_ = first_child_ + i;
+				pool_.SubmitTask
+				(
+					[this, child_, child_work_us_]()
+					{
+						_spin_for_us(child_work_us_);
+						counts[child_].fetch_add(1, std::memory_order_relaxed);
+					}
+				);
+			}
+		}
+
+		static void _spin_for_us(double duration_us_)
+		{
+			const auto begin_ = std::chrono::steady_clock::now();
+			while (std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin_).count() < duration_us_)
+			{
+			}
+		}
+
+		void _reset_counts()
+		{
+			for (auto& count_ : counts)
+			{
+				count_.store(0, std::memory_order_relaxed);
+			}
+		}
+
+		std::vector<std::atomic<int>> counts;
+	};
+
+	/// <summary>
+	/// <para> Checks that a parking_work_allocator executes every task when its workers are parked between bursts of allocations. </para>
+	/// <para> Also checks that parked workers are woken by Deactivate, and that a ParkingThreadPool with parked workers is destroyed without waiting for their timeout. </para>
+	/// </summary>
+	struct parking_behaviour_test : public behaviour_test_base<parking_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "Parking Behaviour";
+
+		using pool_type = EmuThreads::ParkingThreadPool;
+		using allocator_type = EmuThreads::Functors::parking_work_allocator;
+		static constexpr std::size_t num_threads = 4;
+		static constexpr std::size_t num_bursts = 50;
+		static constexpr std::size_t tasks_per_burst = 200;
+		// Long enough that a parked thread which is never woken is clearly distinguishable from one which is
+		static constexpr double parked_waiting_time_ms = 60000.0;
+		static constexpr std::chrono::milliseconds wake_timeout = std::chrono::milliseconds(5000);
+
+		parking_behaviour_test() : counts(num_bursts * tasks_per_burst)
+		{
+		}
+		void PerformChecks()
+		{
+			_check_every_task_executes();
+			_check_deactivate_wakes_parked_workers();
+			_check_destruction_with_parked_workers();
+		}
+
+		void _check_every_task_executes()
+		{
+			for (auto& count_ : counts)
+			{
+				count_.store(0, std::memory_order_relaxed);
+			}
+
+			pool_type pool_(num_threads, parked_waiting_time_ms);
+			bool parked_between_bursts_ = true;
+			bool woken_for_every_burst_ = true;
+			std::vector<std::future<void>> futures_;
+			futures_.reserve(tasks_per_burst);
+			for (std::size_t burst_ = 0; burst_ < num_bursts; ++burst_)
+			{
+				// Every worker is parked before each burst, so each burst must wake them rather than relying on their timeout
+				parked_between_bursts_ = parked_between_bursts_ && _wait_until_parked(pool_.ViewWorkAllocator(), num_threads);
+
+				futures_.clear();
+				for (std::size_t task_ = 0; task_ < tasks_per_burst; ++task_)
+				{
+					const std::size_t index_ = (burst_ * tasks_per_burst) + task_;
+					futures_.emplace_back(pool_.AllocateTask([this, index_]() { counts[index_].fetch_add(1, std::memory_order_relaxed); }));
+				}
+				for (auto& future_ : futures_)
+				{
+					woken_for_every_burst_ = woken_for_every_burst_ && future_.wait_for(wake_timeout) == std::future_status::ready;
+					future_.get();
+				}
+			}
+
+			bool all_once_ = true;
+			for (const auto& count_ : counts)
+			{
+				all_once_ = all_once_ && count_.load(std::memory_order_relaxed) == 1;
+			}
+			results.Check(parked_between_bursts_, "Idle workers park between bursts");
+			results.Check(woken_for_every_burst_, "Parked workers are woken by allocation");
+			results.Check(all_once_, "Every task executes exactly once");
+		}
+
+		void _check_deactivate_wakes_parked_workers()
+		{
+			allocator_type allocator_(parked_waiting_time_ms);
+			std::vector<std::thread> threads_;
+			for (std::size_t i = 0; i < num_threads; ++i)
+			{
+				threads_.emplace_back(allocator_.LaunchThread<std::thread>());
+			}
+			const bool parked_ = _wait_until_parked(allocator_, num_threads);
+
+			allocator_.Deactivate();
+			auto joined_ = std::async
+			(
+				std::launch::async,
+				[&threads_]()
+				{
+					for (auto& thread_ : threads_)
+					{
+						thread_.join();
+					}
+				}
+			);
+			const bool woken_ = joined_.wait_for(wake_timeout) == std::future_status::ready;
+			joined_.get();
+
+			results.Check(parked_, "Idle workers of a lone allocator park");
+			results.Check(woken_, "Deactivate wakes parked workers so that they unlink before their timeout");
+		}
+
+		void _check_destruction_with_parked_workers()
+		{
+			std::unique_ptr<pool_type> pool_ = std::make_unique<pool_type>(num_threads, parked_waiting_time_ms);
+			const bool parked_ = _wait_until_parked(pool_->ViewWorkAllocator(), num_threads);
+
+			auto destroyed_ = std::async(std::launch::async, [&pool_]() { pool_.reset(); });
+			const bool finished_ = destroyed_.wait_for(wake_timeout) == std::future_status::ready;
+			destroyed_.get();
+
+			results.Check(parked_, "Idle workers of a pool park");
+			results.Check(finished_, "Destroying a pool with parked workers does not wait for their timeout");
+		}
+
+		/// <summary> Polls until at least num_threads_ threads are parked in the passed allocator, outputting false if this takes longer than wake_timeout. </summary>
+		[[nodiscard]] static bool _wait_until_parked(const allocator_type& allocator_, std::size_t num_threads_)
+		{
+			const auto end_ = std::chrono::steady_clock::now() + wake_timeout;
+			while (allocator_.NumParkedThreads() < num_threads_)
+			{
+				if (std::chrono::steady_clock::now() >= end_)
+				{
+					return false;
+				}
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+			return true;
+		}
+
+		std::vector<std::atomic<int>> counts;
+	};
+
+	/// <summary>
+	/// <para> Checks inline_task storage: move-only callables, inline storage of small callables and heap storage of large or throwing-move callables, and callable lifetimes. </para>
+	/// <para> Also checks that exceptions thrown by tasks propagate through the futures of make_promised_inline_task and of thread pools using inline tasks. </para>
+	/// </summary>
+	struct task_storage_behaviour_test : public behaviour_test_base<task_storage_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "Task Storage Behaviour";
+
+		using inline_task = EmuThreads::Functors::inline_task;
+
+		/// <summary> Callable which counts how many instances are alive and how many times instances have been move-constructed, so that inline and heap storage may be told apart. </summary>
+		template<std::size_t PaddingSize_>
+		struct _tracked_callable
+		{
+			explicit _tracked_callable(int* p_result_) noexcept : p_result(p_result_), padding()
+			{
+				++num_live;
+			}
+			_tracked_callable(_tracked_callable&& to_move_) noexcept : p_result(to_move_.p_result), padding()
+			{
+				++num_live;
+				++num_moves;
+			}
+			~_tracked_callable()
+			{
+				--num_live;
+			}
+			void operator()()
+			{
+				++(*p_result);
+			}
+
+			static inline int num_live = 0;
+			static inline int num_moves = 0;
+			int* p_result;
+			unsigned char padding[PaddingSize_];
+		};
+
+		struct _throwing_move_callable
+		{
+			_throwing_move_callable() = default;
+			_throwing_move_callable(_throwing_move_callable&&) noexcept(false)
+			{
+			}
+			void operator()()
+			{
+			}
+		};
+
+		void PerformChecks()
+		{
+			_check_storage_by_size();
+			_check_move_only_callables();
+			_check_exception_propagation();
+			_check_pool_exception_propagation<EmuThreads::DefaultThreadPool>("DefaultThreadPool");
+			_check_pool_exception_propagation<EmuThreads::ParkingThreadPool>("ParkingThreadPool");
+		}
+
+		void _check_storage_by_size()
+		{
+			using small_type = _tracked_callable<8>;
+			using large_type = _tracked_callable<inline_task::storage_size * 2>;
+			results.Check(inline_task::is_stored_inline<small_type>(), "Small nothrow-movable callables are stored inline");
+			results.Check(!inline_task::is_stored_inline<large_type>(), "Callables larger than storage_size are stored on the heap");
+			results.Check(!inline_task::is_stored_inline<_throwing_move_callable>(), "Callables which may throw when moved are stored on the heap");
+
+			_check_tracked_callable<small_type>(true, "Small");
+			_check_tracked_callable<large_type>(false, "Large");
+
+			inline_task throwing_move_task_ = inline_task(_throwing_move_callable());
+			inline_task moved_throwing_move_task_ = std::move(throwing_move_task_);
+			moved_throwing_move_task_();
+			results.Check(static_cast<bool>(moved_throwing_move_task_) && !static_cast<bool>(throwing_move_task_), "Heap-stored throwing-move callables transfer between tasks");
+		}
+
+		template<class Callable_>
+		void _check_tracked_callable(bool expect_inline_, const std::string& name_)
+		{
+			Callable_::num_live = 0;
+			Callable_::num_moves = 0;
+			int result_ = 0;
+			{
+				inline_task task_ = inline_task(Callable_(&result_));
+				const int moves_after_construction_ = Callable_::num_moves;
+				inline_task moved_ = std::move(task_);
+				inline_task assigned_;
+				assigned_ = std::move(moved_);
+
+				// Inline callables are moved along with their task, whereas heap callables only have their pointer transferred
+				const int transfer_moves_ = Callable_::num_moves - moves_after_construction_;
+				results.Check(transfer_moves_ == (expect_inline_ ? 2 : 0), name_ + (expect_inline_ ? " callable moves with its task (inline)" : " callable stays in place when its task moves (heap)"));
+				results.Check(!static_cast<bool>(task_) && !static_cast<bool>(moved_) && static_cast<bool>(assigned_), name_ + " moved-from tasks are empty");
+				results.Check(Callable_::num_live == 1, name_ + " callable has exactly one live instance");
+
+				assigned_();
+				results.Check(result_ == 1, name_ + " callable is invoked after being moved");
+			}
+			results.Check(Callable_::num_live == 0, name_ + " callable is destroyed with its task");
+		}
+
+		void _check_move_only_callables()
+		{
+			int result_ = 0;
+			inline_task small_ = EmuThreads::Functors::make_inline_task([value_ = std::make_unique<int>(7), &result_]() { result_ = *value_; });
+			inline_task moved_small_ = std::move(small_);
+			moved_small_();
+			results.Check(result_ == 7, "Small move-only callable is stored and invoked");
+
+			std::array<int, 32> large_values_ = std::array<int, 32>();
+			large_values_.back() = 9;
+			auto large_func_ = [value_ = std::make_unique<int>(2), large_values_, &result_]() { result_ = *value_ * large_values_.back(); };
+			results.Check(!inline_task::is_stored_inline<decltype(large_func_)>(), "Large move-only callable is stored on the heap");
+			inline_task large_ = EmuThreads::Functors::make_inline_task(std::move(large_func_));
+			inline_task moved_large_ = std::move(large_);
+			moved_large_();
+			results.Check(result_ == 18, "Large move-only callable is stored and invoked");
+
+			std::future<int> future_;
+			inline_task promised_ = EmuThreads::Functors::make_promised_inline_task(future_, [value_ = std::make_unique<int>(11)]() { return *value_; });
+			promised_();
+			results.Check(future_.get() == 11, "Move-only callable provides its result through a promised task's future");
+		}
+
+		void _check_exception_propagation()
+		{
+			std::future<void> void_future_;
+			inline_task void_task_ = EmuThreads::Functors::make_promised_inline_task(void_future_, []() -> void { throw std::runtime_error("task_storage_behaviour_test"); });
+			bool task_threw_ = false;
+			try
+			{
+				void_task_();
+			}
+			catch (...)
+			{
+				task_threw_ = true;
+			}
+			results.Check(!task_threw_, "Invoking a promised task does not throw when its callable throws");
+			results.Check(_throws<std::runtime_error>(void_future_), "Exception from a void task propagates through its future");
+
+			std::future<int> int_future_;
+			inline_task int_task_ = EmuThreads::Functors::make_promised_inline_task
+			(
+				int_future_,
+				[](int value_) -> int
+				{
+					if (value_ > 0)
+					{
+						throw std::invalid_argument("task_storage_behaviour_test");
+					}
+					return value_;
+				},
+				5
+			);
+			int_task_();
+			results.Check(_throws<std::invalid_argument>(int_future_), "Exception from a task with arguments and a result propagates through its future");
+		}
+
+		template<class ThreadPool_>
+		void _check_pool_exception_propagation(const std::string& name_)
+		{
+			ThreadPool_ pool_(std::size_t(2));
+			std::future<int> throwing_ = pool_.AllocateTask([]() -> int { throw std::logic_error("task_storage_behaviour_test"); });
+			std::future<int> succeeding_ = pool_.AllocateTask([]() { return 3; });
+			results.Check(_throws<std::logic_error>(throwing_), name_ + " propagates task exceptions through futures");
+			results.Check(succeeding_.get() == 3, name_ + " continues executing tasks after one throws");
+		}
+
+		template<class Exception_, class Future_>
+		[[nodiscard]] static bool _throws(Future_& future_)
+		{
+			try
+			{
+				future_.get();
+			}
+			catch (const Exception_&)
+			{
+				return true;
+			}
+			catch (...)
+			{
+			}
+			return false;
+		}
+	};
+
+	/// <summary>
+	/// <para> Checks the bounded lock-free task queue with many producers and consumers, confirming that every task is executed exactly once. </para>
+	/// <para> Also checks that full queues reject pushes without consuming the task, and the FAIL and BLOCK policies of bounded pools when their queue is full. </para>
+	/// </summary>
+	struct bounded_queue_behaviour_test : public behaviour_test_base<bounded_queue_behaviour_test>
+	{
+		static constexpr std::string_view NAME = "Bounded Queue Behaviour";
+
+		static constexpr std::size_t num_producers = 4;
+		static constexpr std::size_t num_consumers = 4;
+		static constexpr std::size_t tasks_per_producer = 20000;
+		static constexpr std::size_t num_tasks = num_producers * tasks_per_producer;
+		// Small enough that producers regularly find the queue full
+		static constexpr std::size_t queue_capacity = 16;
+		static constexpr std::size_t num_pool_threads = 4;
+		static constexpr std::chrono::milliseconds start_timeout = std::chrono::milliseconds(5000);
+
+		template<EmuThreads::QueueFullPolicy FullPolicy_>
+		using pool_type = EmuThreads::BoundedThreadPool<FullPolicy_, queue_capacity>;
+
+		bounded_queue_behaviour_test() : counts(num_tasks)
+		{
+		}
+		void PerformChecks()
+		{
+			_check_mpmc_every_task_once();
+			_check_push_to_full_queue();
+			_check_fail_policy_when_full();
+			_check_block_policy_when_full();
+			_check_pool_every_task_once<EmuThreads::QueueFullPolicy::FAIL>("FAIL");
+			_check_pool_every_task_once<EmuThreads::QueueFullPolicy::BLOCK>("BLOCK");
+		}
+
+		void _check_mpmc_every_task_once()
+		{
+			_reset_counts();
+			EmuThreads::Functors::mpmc_task_queue<queue_capacity> queue_;
+			std::atomic_size_t num_popped_ = 0;
+			std::vector<std::thread> threads_;
+			for (std::size_t producer_ = 0; producer_ < num_producers; ++producer_)
+			{
+				threads_.emplace_back
+				(
+					[this, &queue_, producer_]()
+					{
+						for (std::size_t task_ = 0; task_ < tasks_per_producer; ++task_)
+						{
+							const std::size_t index_ = (producer_ * tasks_per_producer) + task_;
+							EmuThreads::Functors::inline_task to_push_ = EmuThreads::Functors::make_inline_task([this, index_]() { counts[index_].fetch_add(1, std::memory_order_relaxed); });
+							while (!queue_.TryPush(std::move(to_push_)))
+							{
+								std::this_thread::yield();
+							}
+						}
+					}
+				);
+			}
+			for (std::size_t consumer_ = 0; consumer_ < num_consumers; ++consumer_)
+			{
+				threads_.emplace_back
+				(
+					[&queue_, &num_popped_]()
+					{
+						EmuThreads::Functors::inline_task popped_;
+						while (num_popped_.load(std::memory_order_relaxed) < num_tasks)
+						{
+							if (queue_.TryPop(popped_))
+							{
+								popped_();
+								popped_.Reset();
+								num_popped_.fetch_add(1, std::memory_order_relaxed);
+							}
+							else
+							{
+								std::this_thread::yield();
+							}
+						}
+					}
+				);
+			}
+			for (auto& thread_ : threads_)
+			{
+				thread_.join();
+			}
+
+			EmuThreads::Functors::inline_task leftover_;
+			results.Check(num_popped_ == num_tasks && !queue_.TryPop(leftover_), "Raw queue pops every pushed task, and nothing more");
+			results.Check(_all_counts_equal(1), "Raw queue executes every task exactly once with concurrent producers and consumers");
+		}
+
+		void _check_push_to_full_queue()
+		{
+			EmuThreads::Functors::mpmc_task_queue<queue_capacity> queue_;
+			int num_executed_ = 0;
+			bool all_pushed_ = true;
+			for (std::size_t i = 0; i < queue_capacity; ++i)
+			{
+				all_pushed_ = all_pushed_ && queue_.TryPush(EmuThreads::Functors::make_inline_task([&num_executed_]() { ++num_executed_; }));
+			}
+
+			int rejected_result_ = 0;
+			EmuThreads::Functors::inline_task rejected_ = EmuThreads::Functors::make_inline_task([&rejected_result_]() { rejected_result_ = 5; });
+			const bool rejected_push_ = queue_.TryPush(std::move(rejected_));
+			results.Check(all_pushed_, "Raw queue accepts tasks up to its capacity");
+			results.Check(!rejected_push_ && static_cast<bool>(rejected_), "Pushing to a full raw queue fails and leaves the task unmodified");
+
+			EmuThreads::Functors::inline_task popped_;
+			const bool popped_one_ = queue_.TryPop(popped_);
+			if (popped_one_)
+			{
+				popped_();
+			}
+			results.Check(popped_one_ && queue_.TryPush(std::move(rejected_)), "A rejected task may be pushed again once space is freed");
+
+			while (queue_.TryPop(popped_))
+			{
+				popped_();
+			}
+			results.Check(num_executed_ == static_cast<int>(queue_capacity) && rejected_result_ == 5, "Every task pushed to the raw queue is popped in full");
+		}
+
+		void _check_fail_policy_when_full()
+		{
+			pool_type<EmuThreads::QueueFullPolicy::FAIL> pool_(1);
+			std::promise<void> gate_;
+			std::shared_future<void> gate_future_ = gate_.get_future().share();
+			static_cast<void>(pool_.SubmitTask([gate_future_]() { gate_future_.wait(); }));
+			const bool worker_blocked_ = _wait_until_working(pool_.ViewWorkAllocator());
+
+			std::atomic_int num_executed_ = 0;
+			std::atomic_int num_rejected_executed_ = 0;
+			bool all_accepted_ = true;
+			for (std::size_t i = 0; i < queue_capacity; ++i)
+			{
+				all_accepted_ = pool_.SubmitTask([&num_executed_]() { ++num_executed_; }) && all_accepted_;
+			}
+			const bool submit_rejected_ = !pool_.SubmitTask([&num_rejected_executed_]() { ++num_rejected_executed_; });
+			std::future<int> rejected_future_ = pool_.AllocateTask([&num_rejected_executed_]() { ++num_rejected_executed_; return 1; });
+			const std::size_t num_queued_ = pool_.ViewWorkAllocator().NumQueuedTasks();
+
+			gate_.set_value();
+			pool_.ViewWorkAllocator().WaitForAllTasksToCompleteNoJoin();
+
+			results.Check(worker_blocked_, "FAIL: Worker picks up the blocking task");
+			results.Check(all_accepted_, "FAIL: Tasks are accepted up to the queue's capacity");
+			results.Check(submit_rejected_, "FAIL: SubmitTask outputs false when the queue is full");
+			results.Check(!rejected_future_.valid(), "FAIL: AllocateTask outputs an invalid future when the queue is full");
+			results.Check(num_queued_ == queue_capacity, "FAIL: Rejected tasks are not counted as queued");
+			results.Check(num_executed_ == static_cast<int>(queue_capacity), "FAIL: Every accepted task executes once space is no longer needed");
+			results.Check(num_rejected_executed_ == 0, "FAIL: Rejected tasks never execute");
+		}
+
+		void _check_block_policy_when_full()
+		{
+			static constexpr std::size_t num_overflow_tasks = 4;
+			pool_type<EmuThreads::QueueFullPolicy::BLOCK> pool_(1);
+			std::promise<void> gate_;
+			std::shared_future<void> gate_future_ = gate_.get_future().share();
+			static_cast<void>(pool_.SubmitTask([gate_future_]() { gate_future_.wait(); }));
+			const bool worker_blocked_ = _wait_until_working(pool_.ViewWorkAllocator());
+
+			// The only worker is blocked, so allocating past capacity can only return if the allocating thread executes queued tasks itself
+			const std::thread::id this_id_ = std::this_thread::get_id();
+			std::atomic_int num_executed_ = 0;
+			std::atomic_int num_executed_by_allocator_ = 0;
+			bool all_accepted_ = true;
+			for (std::size_t i = 0; i < queue_capacity + num_overflow_tasks; ++i)
+			{
+				all_accepted_ = pool_.SubmitTask
+				(
+					[&num_executed_, &num_executed_by_allocator_, this_id_]()
+					{
+						++num_executed_;
+						if (std::this_thread::get_id() == this_id_)
+						{
+							++num_executed_by_allocator_;
+						}
+					}
+				) && all_accepted_;
+			}
+			const int executed_before_release_ = num_executed_;
+
+			gate_.set_value();
+			pool_.ViewWorkAllocator().WaitForAllTasksToCompleteNoJoin();
+
+			results.Check(worker_blocked_, "BLOCK: Worker picks up the blocking task");
+			results.Check(all_accepted_, "BLOCK: Every task is accepted when the queue is full");
+			results.Check(executed_before_release_ == static_cast<int>(num_overflow_tasks), "BLOCK: Allocating thread executes one queued task for each task that did not fit");
+			results.Check(num_executed_by_allocator_ == static_cast<int>(num_overflow_tasks), "BLOCK: Tasks that made space were executed by the allocating thread");
+			results.Check(num_executed_ == static_cast<int>(queue_capacity + num_overflow_tasks), "BLOCK: Every task executes exactly once");
+		}
+
+		template<EmuThreads::QueueFullPolicy FullPolicy_>
+		void _check_pool_every_task_once(const std::string& name_)
+		{
+			_reset_counts();
+			std::vector<char> accepted_(num_tasks, 0);
+			{
+				pool_type<FullPolicy_> pool_(num_pool_threads);
+				std::vector<std::thread> producers_;
+				for (std::size_t producer_ = 0; producer_ < num_producers; ++producer_)
+				{
+					producers_.emplace_back
+					(
+						[this, &pool_, &accepted_, producer_]()
+						{
+							// Each producer only writes the accepted flags of its own tasks
+							for (std::size_t task_ = 0; task_ < tasks_per_producer; ++task_)
+							{
+								const std::size_t index_ = (producer_ * tasks_per_producer) + task_;
+								accepted_[index_] = pool_.SubmitTask([this, index_]() { counts[index_].fetch_add(1, std::memory_order_relaxed); }) ? 1 : 0;
+							}
+						}
+					);
+				}
+				for (auto& producer_ : producers_)
+				{
+					producer_.join();
+				}
+				pool_.ViewWorkAllocator().WaitForAllTasksToCompleteNoJoin();
+			}
+
+			bool accepted_once_ = true;
+			bool rejected_never_ = true;
+			std::size_t num_accepted_ = 0;
+			for (std::size_t i = 0; i < num_tasks; ++i)
+			{
+				const int count_ = counts[i].load(std::memory_order_relaxed);
+				if (accepted_[i] != 0)
+				{
+					++num_accepted_;
+					accepted_once_ = accepted_once_ && count_ == 1;
+				}
+				else
+				{
+					rejected_never_ = rejected_never_ && count_ == 0;
+				}
+			}
+			results.Check(accepted_once_, name_ + ": Every accepted task executes exactly once with concurrent producers");
+			results.Check(rejected_never_, name_ + ": Rejected tasks never execute");
+			if constexpr (FullPolicy_ == EmuThreads::QueueFullPolicy::BLOCK)
+			{
+				results.Check(num_accepted_ == num_tasks, name_ + ": Every task is accepted");
+			}
+		}
+
+		void _reset_counts()
+		{
+			for (auto& count_ : counts)
+			{
+				count_.store(0, std::memory_order_relaxed);
+			}
+		}
+
+		[[nodiscard]] bool _all_counts_equal(int expected_) const
+		{
+			for (const auto& count_ : counts)
+			{
+				if (count_.load(std::memory_order_relaxed) != expected_)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/// <summary> Polls until at least one thread is working in the passed allocator, outputting false if this takes longer than start_timeout. </summary>
+		template<class Allocator_>
+		[[nodiscard]] static bool _wait_until_working(const Allocator_& allocator_)
+		{
+			const auto end_ = std::chrono::steady_clock::now() + start_timeout;
+			while (allocator_.NumWorkingThreads() == 0 || allocator_.HasWork())
+			{
+				if (std::chrono::steady_clock::now() >= end_)
+				{
+					return false;
+				}
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+			return true;
+		}
+
+		std::vector<std::atomic<int>> counts;
+	};
+
+	/// <summary>
+	/// <para> Measures the time from allocating a task to an idle ThreadPool_ until that task begins executing. </para>
+	/// <para> Each loop idles before allocating so that workers have gone quiet, so harness timings include this idle time; latencies are output in OnTestsOver. </para>
+	/// </summary>
+	template<class ThreadPool_>
+	struct thread_wake_latency_test_base
+	{
+		static constexpr bool DO_TEST = true;
+		static constexpr bool PASS_LOOP_NUM = true;
+		static constexpr std::size_t NUM_LOOPS = 1000;
+		static constexpr bool WRITE_ALL_TIMES_TO_STREAM = false;
+
+		static constexpr std::size_t num_threads = 4;
+		static constexpr double idle_time_ms = 2.0;
+		using clock_type = std::chrono::steady_clock;
+
+		thread_wake_latency_test_base() : pool(), latencies_us()
+		{
+		}
+		void Prepare()
+		{
+			latencies_us.resize(NUM_LOOPS);
+			pool.AllocateWorkers(num_threads);
+		}
+		void operator()(std::size_t i)
+		{
+			std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(idle_time_ms));
+			const auto allocation_time_ = clock_type::now();
+			latencies_us[i] = pool.AllocateTask
+			(
+				[allocation_time_]() { return std::chrono::duration<double, std::micro>(clock_type::now() - allocation_time_).count(); }
+			).get();
+		}
+		void OnTestsOver()
+		{
+			std::vector<double> sorted_ = latencies_us;
+			std::sort(sorted_.begin(), sorted_.end());
+			double total_ = 0.0;
+			for (const double latency_ : sorted_)
+			{
+				total_ += latency_;
+			}
+
+			std::cout << "WAKE-TO-RUN LATENCY (" << num_threads << " threads, " << idle_time_ms << "ms idle before each task, " << pool.WaitingTimeMs() << "ms waiting time)\n";
+			std::cout << "\tMean: " << (total_ / sorted_.size()) << "us\n";
+			std::cout << "\tMedian: " << sorted_[sorted_.size() / 2] << "us\n";
+			std::cout << "\t99th Percentile: " << sorted_[(sorted_.size() * 99) / 100] << "us\n";
+			std::cout << "\tMax: " << sorted_.back() << "us\n\n";
+		}
+
+		ThreadPool_ pool;
+		std::vector<double> latencies_us;
+	};
+
+	struct thread_wake_latency_test_sleep : public thread_wake_latency_test_base<EmuThreads::DefaultThreadPool>
+	{
+		static constexpr std::string_view NAME = "Thread Wake Latency (Sleep Polling)";
+	};
+
+	struct thread_wake_latency_test_parking : public thread_wake_latency_test_base<EmuThreads::ParkingThreadPool>
+	{
+		static constexpr std::string_view NAME = "Thread Wake Latency (Parking)";
+	};
+
 
 	// ----------- TESTS SELECTION -----------
 	using AllTests = std::tuple
 	<
 		reflect_test_emu,
-		reflect_test_dxm
+		reflect_test_dxm,
+		fast_vector_behaviour_test,
+		matrix_multiply_behaviour_test,
+		transform_points_behaviour_test,
+		matrix_inverse_behaviour_test,
+		matrix_affine_behaviour_test,
+		vector_soa_behaviour_test,
+		vector_expression_behaviour_test,
+		rsqrt_behaviour_test,
+		vector_shuffle_behaviour_test,
+		quaternion_behaviour_test,
+		quaternion_soa_behaviour_test,
+		fast_noise_behaviour_test,
+		simplex_noise_behaviour_test,
+		fast_noise_tile_behaviour_test,
+		fast_noise_parallel_behaviour_test,
+		fast_noise_sample_behaviour_test,
+		noise_chunk_cache_behaviour_test,
+		noise_derivative_behaviour_test,
+		parallel_for_range_behaviour_test,
+		work_stealing_behaviour_test,
+		parking_behaviour_test,
+		task_storage_behaviour_test,
+		bounded_queue_behaviour_test
+	>;
+
+	// ----------- BENCHMARKS SELECTION -----------
+	/// <summary> Tests which only measure and output timings rather than checking behaviour. These are opt-in through PerformBenchmarks, and are not run by PerformTests. </summary>
+	using AllBenchmarks = std::tuple
+	<
+		thread_wake_latency_test_sleep,
+		thread_wake_latency_test_parking
 	>;
 
 	// ----------- TESTS BEGIN -----------
 
-	template<std::size_t Index_>
-	void PrepareAllTests(AllTests& tests)
+	template<std::size_t Index_, class Tests_>
+	void PrepareAllTests(Tests_& tests)
 	{
-		if constexpr (Index_ < std::tuple_size_v<AllTests>)
+		if constexpr (Index_ < std::tuple_size_v<Tests_>)
 		{
 			auto& test_ = std::get<Index_>(tests);
 			if (test_.DO_TEST)
@@ -265,12 +3133,12 @@ namespace EmuCore::TestingHelpers
 		PrepareAllTests<0>(outTests);
 	}
 
-	template<std::size_t Index_>
-	void OnAllTestsOver(AllTests& tests)
+	template<std::size_t Index_, class Tests_>
+	void OnAllTestsOver(Tests_& tests)
 	{
-		if constexpr (Index_ < std::tuple_size_v<AllTests>)
+		if constexpr (Index_ < std::tuple_size_v<Tests_>)
 		{
-			using Test_ = std::tuple_element_t<Index_, AllTests>;
+			using Test_ = std::tuple_element_t<Index_, Tests_>;
 			if constexpr (Test_::DO_TEST)
 			{
 				std::cout << "Test " << Index_ << " (" << Test_::NAME << ")\n";
@@ -354,6 +3222,23 @@ namespace EmuCore::TestingHelpers
 		} while (shouldRepeat);
 	}
 #pragma endregion
+
+	/// <summary> Asks whether to run AllBenchmarks, and if so executes them and outputs their results. Benchmarks are never run by PerformTests. </summary>
+	void PerformBenchmarks()
+	{
+		std::string str;
+		std::cout << "\n\nExecute benchmarks? [Y - Yes]: ";
+		std::getline(std::cin, str);
+		if (str.size() == 0 || (str[0] != 'y' && str[0] != 'Y'))
+		{
+			return;
+		}
+
+		AllBenchmarks benchmarks = AllBenchmarks();
+		PrepareAllTests<0>(benchmarks);
+		ExecuteTests<0>(benchmarks);
+		OnAllTestsOver<0>(benchmarks);
+	}
 }
 
 #endif
@@ -332,6 +332,7 @@ int main()
 #pragma region TEST_HARNESS_EXECUTION
 	system("pause");
 	EmuCore::TestingHelpers::PerformTests();
+	EmuCore::TestingHelpers::PerformBenchmarks();
 #pragma endregion
 	return 0;
 }